@@ -0,0 +1,41 @@
+#include "/tmp/rv/libc/include/stdio.h"
+int g;
+int arr[10];
+int sum(int* a, int n) { int s = 0; for (int i = 0; i < n; ++i) s += a[i]; return s; }
+long suml(long* a, int n) { long s = 0; int i; for (i = 0; i < n; i++) s += a[i]; return s; }
+int rev(int* a, int n) { int s = 0; for (int i = n - 1; i >= 0; --i) s = s * 3 + a[i]; return s; }
+unsigned ucmp(unsigned a, unsigned b) { return a < b; }
+int alias(int* p, int* q) { int x = *p; *q = 5; return x + *p; }
+int glob(void) { int a = g; g = 7; return a + g; }
+void setg(void) { g = 100; }
+int callclob(void) { int a = g; setg(); return a + g; }
+int loopcall(int n) { int s = 0; for (int i = 0; i < n; ++i) { s += g; setg(); } return s; }
+int whl(int n) { int i = 0, s = 0; while (i < n) { s += arr[i] * 2; i += 2; } return s; }
+int dowh(int n) { int i = 0, s = 0; do { s += i; ++i; } while (i < n); return s; }
+int afterloop(int n) { int i; for (i = 0; i < n; ++i) arr[i] = i; return i; }
+int divloop(int n, int d) { int s = 0; for (int i = 0; i < n; ++i) { if (d != 0) s += 100 / d; } return s; }
+int main(void)
+{
+    int a[5] = {1,2,3,4,5};
+    long b[4] = {10,20,30,40};
+    printf("%d\n", sum(a, 5));
+    printf("%d\n", (int) suml(b, 4));
+    printf("%d\n", rev(a, 5));
+    printf("%d %d\n", ucmp(1, 0xffffffffu), ucmp(0xffffffffu, 1));
+    int x = 1;
+    printf("%d\n", alias(&x, &x));
+    g = 3;
+    printf("%d\n", glob());
+    g = 3;
+    printf("%d\n", callclob());
+    g = 1;
+    printf("%d\n", loopcall(3));
+    for (int i = 0; i < 10; ++i) arr[i] = i;
+    printf("%d\n", whl(10));
+    printf("%d\n", dowh(5));
+    printf("%d\n", afterloop(7));
+    printf("%d\n", divloop(4, 0));
+    printf("%d\n", divloop(4, 5));
+    printf("%d\n", sum(a, 0));
+    return 0;
+}
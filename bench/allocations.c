@@ -0,0 +1,97 @@
+#include <string.h>
+
+#include "bench.h"
+
+/*
+
+counts heap allocations (and the bytes they ask for) made while tokenizing and parsing a
+large valid translation unit. speculative parses fail all the time even on valid input, so this
+is mostly a measure of how much the parser allocates on paths that get thrown away, while the
+byte count mostly follows how big syntax nodes are.
+
+*/
+
+#define NO_FUNCTIONS 300
+
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t count, size_t size);
+extern void* __libc_realloc(void* ptr, size_t size);
+
+static size_t allocations = 0;
+static size_t bytes = 0;
+static bool counting = false;
+
+// glibc lets the program interpose its allocator, which also catches strdup and friends
+void* malloc(size_t size)
+{
+    allocations += counting;
+    bytes += counting ? size : 0;
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size)
+{
+    allocations += counting;
+    bytes += counting ? count * size : 0;
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size)
+{
+    allocations += counting;
+    bytes += counting ? size : 0;
+    return __libc_realloc(ptr, size);
+}
+
+int main(void)
+{
+    FILE* file = tmpfile();
+    for (int i = 0; i < NO_FUNCTIONS; ++i)
+    {
+        fprintf(file, "typedef struct s%d { int a; long b[4]; char* c; } s%d_t;\n", i, i);
+        fprintf(file, "static int table%d[] = { 1, 2, 3, 4, 5, 6, 7, 8 };\n", i);
+        fprintf(file, "int f%d(int x, s%d_t* p)\n{\n    int y = (x * %d + table%d[x & 7]) << 2;\n", i, i, i, i);
+        fprintf(file, "    for (int j = 0; j < 10; ++j)\n        y += p->b[j & 3] - (int) sizeof(s%d_t) * j;\n", i);
+        fprintf(file, "    if (y > 100 && p->c)\n        y = p->c[0] ? -y : y / 2;\n    return y;\n}\n");
+    }
+    rewind(file);
+
+    preprocessing_token_t* pp_tokens = lex(file, true);
+    fclose(file);
+    time_t t = time(NULL);
+    char pp_error[MAX_ERROR_LENGTH] = { 0 };
+    preprocessing_settings_t settings = { .translation_time = &t, .filepath = "allocations.c", .error = pp_error };
+    if (!preprocess(&pp_tokens, &settings))
+    {
+        printf("%s", pp_error);
+        return EXIT_FAILURE;
+    }
+    strlitconcat(pp_tokens);
+
+    size_t total = 0;
+    for (preprocessing_token_t* token = pp_tokens; token; token = token->next)
+        total += token->type != PPT_WHITESPACE;
+
+    char tk_error[MAX_ERROR_LENGTH] = { 0 };
+    tokenizing_settings_t tk_settings = { .filepath = "allocations.c", .error = tk_error };
+    counting = true;
+    double start = bench_now();
+    token_stream_t* stream = token_stream_init(pp_tokens, &tk_settings);
+    syntax_component_t* tlu = parse(stream);
+    double parsed = bench_now();
+    counting = false;
+    if (!tlu || tk_error[0])
+    {
+        printf("%s", tk_error);
+        return EXIT_FAILURE;
+    }
+
+    printf("%-40s %10zu tokens\n", "tokens parsed", total);
+    printf("%-40s %10zu (%.2f per token)\n", "allocations while parsing", allocations, (double) allocations / total);
+    printf("%-40s %10zu (%.2f per token)\n", "bytes allocated while parsing", bytes, (double) bytes / total);
+    BENCH_REPORT("tokenize + parse", parsed - start, total, "token");
+
+    token_stream_delete(stream);
+    free_syntax(tlu, tlu);
+    return EXIT_SUCCESS;
+}
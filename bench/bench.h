@@ -0,0 +1,28 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../src/ecc.h"
+
+// benchmarks link against everything but main.o, so they need to provide this themselves
+static program_options_t bench_opts;
+
+program_options_t* get_program_options(void)
+{
+    return &bench_opts;
+}
+
+static double bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+#define BENCH_REPORT(name, seconds, count, unit) \
+    printf("%-40s %10.2f ns/%s (%zu %ss in %.3fs)\n", (name), (seconds) * 1e9 / (count), (unit), (size_t) (count), (unit), (seconds))
+
+#endif
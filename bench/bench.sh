@@ -0,0 +1,56 @@
+#!/bin/bash
+
+printf "*** BENCHMARK RESULTS ***\n"
+
+dir=$(mktemp -d)
+
+# runs a compiled kernel three times with the given arguments, leaving the best time in ms in best
+run_kernel()
+{
+    best=-1
+    for round in 1 2 3
+    do
+        local start=$(date +%s%N)
+        if ! $dir/kernel "$@"; then
+            return 1
+        fi
+        local ms=$((($(date +%s%N) - start) / 1000000))
+        if [[ $best -lt 0 || $ms -lt $best ]]; then
+            best=$ms
+        fi
+    done
+}
+
+for bench in "$@"
+do
+    printf -- "- %s\n" $(basename $bench)
+
+    # kernels are compiled with ecc itself and timed as whole programs: as they're meant to be
+    # optimized (no arguments) against a variant the optimizer has to leave alone (any argument)
+    if [[ "$bench" == *.c ]]; then
+        status=1
+        if ../ecc -S -o $dir/kernel.s $bench && as -o $dir/kernel.o $dir/kernel.s &&
+            ld -o $dir/kernel $dir/kernel.o ../libc/libc.a ../libecc/libecc.a && run_kernel; then
+            optimized=$best
+            run_kernel unoptimized
+            status=$?
+        fi
+        if [[ $status -ne 0 ]]; then
+            printf "%s: FAIL\n" $(basename $bench)
+            rm -rf $dir
+            exit 1
+        fi
+        printf "%-40s %10d ms (best of 3)\n" "optimized" $optimized
+        printf "%-40s %10d ms (best of 3, %d.%02dx the optimized time)\n" "unoptimized" $best \
+            $(($best / $optimized)) $(($best * 100 / $optimized % 100))
+        continue
+    fi
+
+    if ! $bench; then
+        printf "%s: FAIL\n" $(basename $bench)
+        rm -rf $dir
+        exit 1
+    fi
+done
+
+rm -rf $dir
@@ -0,0 +1,171 @@
+#include <string.h>
+
+#include "bench.h"
+
+/*
+
+builds the control-flow graphs (blocks, dominator and post-dominator trees, and loops) of a
+generated translation unit made of many functions with nested loops, branches, a goto, and a
+switch, and reports the time per block. every function should come out with the same four loops
+nested three deep, and every block should be dominated by its immediate dominator and by the
+headers of the loops it is in. taking every instruction that can be taken out of a block out of
+it (leaving some blocks empty) should leave the graph as it was.
+
+*/
+
+#define NO_FUNCTIONS 2000
+#define ROUNDS 5
+
+static const char* FUNCTION =
+    "int f%d(int n)\n"
+    "{\n"
+    "    int s = 0;\n"
+    "    for (int i = 0; i < n; ++i)\n"
+    "    {\n"
+    "        for (int j = 0; j < i; ++j)\n"
+    "        {\n"
+    "            if (j & 1) s += j; else s -= i;\n"
+    "            while (s > 100) s /= 2;\n"
+    "        }\n"
+    "        if (s == %d) goto out;\n"
+    "    }\n"
+    "    do s++; while (s < 0);\n"
+    "out:\n"
+    "    switch (s) { case 1: return 1; case 2: s = 3; break; default: break; }\n"
+    "    return s;\n"
+    "}\n";
+
+// returns whether the graph looks the way the generated function says it should
+static bool check(cfg_t* cfg)
+{
+    size_t max_depth = 0;
+    VECTOR_FOR(cfg_loop_t*, loop, cfg->loops)
+    {
+        if (loop->depth > max_depth)
+            max_depth = loop->depth;
+    }
+    if (cfg->loops->size != 4 || max_depth != 3)
+        return false;
+    VECTOR_FOR(cfg_block_t*, block, cfg->rpo)
+    {
+        if (block->idom && !cfg_dominates(block->idom, block))
+            return false;
+        if (block->ipdom && !cfg_post_dominates(block->ipdom, block))
+            return false;
+        for (cfg_loop_t* loop = block->loop; loop; loop = loop->parent)
+        {
+            if (!cfg_dominates(loop->header, block))
+                return false;
+        }
+    }
+    return true;
+}
+
+// empties out every block as far as cfg_block_remove allows (leaving only labels and control transfers)
+static bool check_removal(cfg_t* cfg)
+{
+    size_t emptied = 0;
+    VECTOR_FOR(cfg_block_t*, block, cfg->blocks)
+    {
+        for (air_insn_t* insn = block->first; insn;)
+        {
+            air_insn_t* next = insn == block->last ? NULL : insn->next;
+            if (insn->prev && insn->type != AIR_LABEL && !cfg_is_terminator(insn))
+                cfg_block_remove(block, insn);
+            insn = next;
+        }
+        if (!block->first)
+            ++emptied;
+        CFG_BLOCK_FOR(insn, block)
+        {
+            if (insn->prev && insn->type != AIR_LABEL && !cfg_is_terminator(insn))
+                return false;
+        }
+    }
+    return emptied && check(cfg);
+}
+
+int main(void)
+{
+    FILE* file = tmpfile();
+    for (int i = 0; i < NO_FUNCTIONS; ++i)
+        fprintf(file, FUNCTION, i, i);
+    rewind(file);
+
+    preprocessing_token_t* pp_tokens = lex(file, true);
+    fclose(file);
+    time_t t = time(NULL);
+    char pp_error[MAX_ERROR_LENGTH] = { 0 };
+    preprocessing_settings_t settings = { .translation_time = &t, .filepath = "cfg.c", .error = pp_error };
+    if (!preprocess(&pp_tokens, &settings))
+    {
+        printf("%s", pp_error);
+        return EXIT_FAILURE;
+    }
+    strlitconcat(pp_tokens);
+
+    char tk_error[MAX_ERROR_LENGTH] = { 0 };
+    tokenizing_settings_t tk_settings = { .filepath = "cfg.c", .error = tk_error };
+    token_stream_t* stream = token_stream_init(pp_tokens, &tk_settings);
+    syntax_component_t* tlu = parse(stream);
+    if (!tlu || tk_error[0])
+    {
+        printf("%s", tk_error);
+        return EXIT_FAILURE;
+    }
+    analysis_error_t* errors = type(tlu);
+    if (error_list_size(errors, false) > 0)
+    {
+        dump_errors(errors);
+        return EXIT_FAILURE;
+    }
+    error_delete_all(errors);
+    errors = analyze(tlu);
+    if (error_list_size(errors, false) > 0)
+    {
+        dump_errors(errors);
+        return EXIT_FAILURE;
+    }
+    error_delete_all(errors);
+    air_t* air = airinize(tlu);
+    opt1(air, opt1_profile_basic());
+
+    size_t blocks = 0;
+    double elapsed = 0.0;
+    for (int r = 0; r < ROUNDS; ++r)
+    {
+        VECTOR_FOR(air_routine_t*, routine, air->routines)
+        {
+            double start = bench_now();
+            cfg_t* cfg = cfg_init(routine);
+            elapsed += bench_now() - start;
+            blocks += cfg->blocks->size;
+            if (!check(cfg))
+            {
+                printf("the control-flow graph of %s is not what it should be:\n", symbol_get_name(routine->sy));
+                cfg_print(cfg, air, printf);
+                return EXIT_FAILURE;
+            }
+            cfg_delete(cfg);
+        }
+    }
+
+    BENCH_REPORT("build control-flow graph", elapsed, blocks, "block");
+
+    VECTOR_FOR(air_routine_t*, routine, air->routines)
+    {
+        cfg_t* cfg = cfg_init(routine);
+        if (!check_removal(cfg))
+        {
+            printf("the control-flow graph of %s did not survive having its blocks emptied:\n", symbol_get_name(routine->sy));
+            cfg_print(cfg, air, printf);
+            return EXIT_FAILURE;
+        }
+        cfg_delete(cfg);
+    }
+
+    air_delete(air);
+    token_stream_delete(stream);
+    free_syntax(tlu, tlu);
+    return EXIT_SUCCESS;
+}
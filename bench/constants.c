@@ -0,0 +1,204 @@
+#include <string.h>
+#include <stdint.h>
+
+#include "bench.h"
+
+/*
+
+checks integer and floating constant conversion against the C library on a randomized corpus,
+then times the floating constant conversion against plain strtold, on that corpus and on one of
+only the short, simple constants that make up most of real code.
+
+*/
+
+#define CORPUS_SIZE 200000
+#define ROUNDS 10
+
+static uint64_t random64(void)
+{
+    uint64_t r = 0;
+    for (int i = 0; i < 4; ++i)
+        r = (r << 16) ^ (rand() & 0xFFFF);
+    return r;
+}
+
+#define NO_KINDS 6
+#define FIRST_TYPICAL_KIND 4
+
+static void random_floating(char* buf, size_t size, int kind)
+{
+    switch (kind)
+    {
+        // any finite double, shortest round trip
+        case 0:
+        {
+            uint64_t bits;
+            double d;
+            do
+            {
+                bits = random64() & ~(1ULL << 63);
+                memcpy(&d, &bits, sizeof d);
+            }
+            while (d != d || d - d != 0);
+            snprintf(buf, size, "%.17g", d);
+            if (!strpbrk(buf, ".e"))
+                strcat(buf, ".0");
+            break;
+        }
+        // random digits with an exponent all over the range, including subnormals
+        case 1:
+        {
+            int digits = 1 + rand() % 25;
+            char* p = buf;
+            for (int i = 0; i < digits; ++i)
+            {
+                if (i == 1) *p++ = '.';
+                *p++ = '0' + rand() % 10;
+            }
+            snprintf(p, size - (p - buf), "e%d", rand() % 660 - 350);
+            break;
+        }
+        // exactly halfway between two doubles
+        case 2:
+        {
+            uint64_t bits = random64() % 0x7FE0000000000000ULL, next = bits + 1;
+            double lo, hi;
+            memcpy(&lo, &bits, sizeof lo);
+            memcpy(&hi, &next, sizeof hi);
+            snprintf(buf, size, "%.40Le", ((long double) lo + hi) / 2);
+            break;
+        }
+        // integers around the edge of what a double holds exactly
+        case 3:
+            snprintf(buf, size, "%llu.0", (unsigned long long) ((1ULL << 53) + random64() % 1000));
+            break;
+        // short and simple, the common case in real code
+        case 4:
+            snprintf(buf, size, "%d.%d", rand() % 1000, rand() % 1000);
+            break;
+        default:
+            snprintf(buf, size, "%de%d", rand() % 100000, rand() % 80 - 40);
+            break;
+    }
+    if (rand() % 4 == 0)
+        strcat(buf, "f");
+}
+
+static bool check_floating(char* con)
+{
+    c_type_class_t class;
+    long double value = process_floating_constant(con, &class);
+    size_t length = strlen(con);
+    if (con[length - 1] == 'f')
+    {
+        con[length - 1] = '\0';
+        float expected = strtof(con, NULL), actual = value;
+        con[length - 1] = 'f';
+        if (expected - expected != 0)
+            return class == CTC_ERROR;
+        return class == CTC_FLOAT && !memcmp(&expected, &actual, sizeof expected);
+    }
+    double expected = strtod(con, NULL), actual = value;
+    if (expected - expected != 0)
+        return class == CTC_ERROR;
+    return class == CTC_DOUBLE && !memcmp(&expected, &actual, sizeof expected);
+}
+
+static bool check_integer(char* buf, size_t size)
+{
+    static const char* SUFFIXES[] = { "", "u", "l", "ul", "LU", "ll", "uLL", "llU" };
+    static const char* FORMATS[] = { "%llu%s", "0x%llx%s", "0%llo%s" };
+    unsigned long long v = random64() >> (rand() % 64);
+    snprintf(buf, size, FORMATS[rand() % 3], v, SUFFIXES[rand() % 8]);
+    c_type_class_t class;
+    unsigned long long actual = process_integer_constant(buf, &class);
+    if (actual != strtoull(buf, NULL, 0) || class == CTC_ERROR)
+        return false;
+    // anything over the largest value stays an error
+    snprintf(buf, size, FORMATS[rand() % 3], UNSIGNED_LONG_LONG_INT_MAX, "");
+    strcat(buf, "0");
+    process_integer_constant(buf, &class);
+    return class == CTC_ERROR;
+}
+
+// the two alternate round by round and each keeps its best round, so a noisy machine hurts them alike
+static void time_corpus(char* name, char** corpus, size_t count)
+{
+    volatile long double sink = 0;
+    c_type_class_t class;
+    char label[64];
+
+    double library = 0.0, processed = 0.0;
+    for (int r = 0; r < ROUNDS; ++r)
+    {
+        double start = bench_now();
+        for (size_t i = 0; i < count; ++i)
+            sink += strtold(corpus[i], NULL);
+        double elapsed = bench_now() - start;
+        if (!r || elapsed < library)
+            library = elapsed;
+
+        start = bench_now();
+        for (size_t i = 0; i < count; ++i)
+            sink += process_floating_constant(corpus[i], &class);
+        elapsed = bench_now() - start;
+        if (!r || elapsed < processed)
+            processed = elapsed;
+    }
+
+    snprintf(label, sizeof label, "%s constants (strtold)", name);
+    BENCH_REPORT(label, library, count, "constant");
+    snprintf(label, sizeof label, "%s constants (eisel-lemire)", name);
+    BENCH_REPORT(label, processed, count, "constant");
+}
+
+int main(void)
+{
+    srand(1);
+    char buf[256];
+    for (size_t i = 0; i < CORPUS_SIZE; ++i)
+    {
+        if (!check_integer(buf, sizeof buf))
+        {
+            printf("integer mismatch on '%s'\n", buf);
+            return EXIT_FAILURE;
+        }
+    }
+
+    char** corpus = malloc(CORPUS_SIZE * sizeof(char*));
+    for (size_t i = 0; i < CORPUS_SIZE; ++i)
+    {
+        random_floating(buf, sizeof buf, rand() % NO_KINDS);
+        corpus[i] = strdup(buf);
+        if (!check_floating(corpus[i]))
+        {
+            printf("floating mismatch on '%s'\n", corpus[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // long digit strings go to the C library anyway, so time the kinds that make up real code on their own
+    char** typical = malloc(CORPUS_SIZE * sizeof(char*));
+    for (size_t i = 0; i < CORPUS_SIZE; ++i)
+    {
+        random_floating(buf, sizeof buf, FIRST_TYPICAL_KIND + rand() % (NO_KINDS - FIRST_TYPICAL_KIND));
+        typical[i] = strdup(buf);
+        if (!check_floating(typical[i]))
+        {
+            printf("floating mismatch on '%s'\n", typical[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    time_corpus("all", corpus, CORPUS_SIZE);
+    time_corpus("typical", typical, CORPUS_SIZE);
+
+    for (size_t i = 0; i < CORPUS_SIZE; ++i)
+    {
+        free(corpus[i]);
+        free(typical[i]);
+    }
+    free(corpus);
+    free(typical);
+    return EXIT_SUCCESS;
+}
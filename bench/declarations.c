@@ -0,0 +1,65 @@
+#include <string.h>
+
+#include "bench.h"
+
+/*
+
+parses a generated header-like translation unit (prototypes, typedefs, struct definitions,
+and extern objects, with a few inline definitions) and reports the time per external declaration.
+
+*/
+
+#define NO_GROUPS 300
+#define ROUNDS 5
+
+int main(void)
+{
+    FILE* file = tmpfile();
+    for (int i = 0; i < NO_GROUPS; ++i)
+    {
+        fprintf(file, "typedef struct node%d { struct node%d* next; unsigned long size; const char* name; } node%d_t;\n", i, i, i);
+        fprintf(file, "extern node%d_t* node%d_create(const char* name, unsigned long size, int flags);\n", i, i);
+        fprintf(file, "extern void node%d_delete(node%d_t* node);\n", i, i);
+        fprintf(file, "extern int (*node%d_compare)(const node%d_t* a, const node%d_t* b);\n", i, i, i);
+        fprintf(file, "extern const unsigned long NODE%d_LIMIT, NODE%d_DEFAULT;\n", i, i);
+        fprintf(file, "static inline unsigned long node%d_size(node%d_t* node) { return node->size; }\n", i, i);
+    }
+
+    double elapsed = 0.0;
+    size_t nodecls = 0;
+    for (int r = 0; r < ROUNDS; ++r)
+    {
+        // the token stream consumes the preprocessing tokens, so every round starts from lexing
+        rewind(file);
+        preprocessing_token_t* pp_tokens = lex(file, true);
+        time_t t = time(NULL);
+        char pp_error[MAX_ERROR_LENGTH] = { 0 };
+        preprocessing_settings_t settings = { .translation_time = &t, .filepath = "declarations.c", .error = pp_error };
+        if (!preprocess(&pp_tokens, &settings))
+        {
+            printf("%s", pp_error);
+            return EXIT_FAILURE;
+        }
+        strlitconcat(pp_tokens);
+
+        char tk_error[MAX_ERROR_LENGTH] = { 0 };
+        tokenizing_settings_t tk_settings = { .filepath = "declarations.c", .error = tk_error };
+        double start = bench_now();
+        token_stream_t* stream = token_stream_init(pp_tokens, &tk_settings);
+        syntax_component_t* tlu = parse(stream);
+        elapsed += bench_now() - start;
+        if (!tlu || tk_error[0])
+        {
+            printf("%s", tk_error);
+            return EXIT_FAILURE;
+        }
+        nodecls += tlu->tlu_external_declarations->size;
+        token_stream_delete(stream);
+        free_syntax(tlu, tlu);
+    }
+    fclose(file);
+
+    printf("%-40s %10zu declarations\n", "external declarations", nodecls / ROUNDS);
+    BENCH_REPORT("tokenize + parse", elapsed, nodecls, "declaration");
+    return EXIT_SUCCESS;
+}
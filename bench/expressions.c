@@ -0,0 +1,66 @@
+#include <string.h>
+
+#include "bench.h"
+
+/*
+
+parses long generated expressions mixing every binary operator and reports the time per token.
+the expressions are parsed on their own (the way #if expressions are) to leave out everything
+a whole translation unit brings along, like declarations and the symbol table.
+
+*/
+
+#define NO_OPERANDS 4000
+#define ROUNDS 50
+
+static const char* OPERATORS[] = {
+    "+", "-", "*", "/", "%", "<<", ">>", "<", ">", "<=", ">=", "==", "!=", "&", "^", "|", "&&", "||"
+};
+
+static const char* OPERANDS[] = {
+    "a", "(b + 1)", "c[2]", "-d", "f(x, 3)", "(int) e", "s.m", "p->n", "12", "sizeof x"
+};
+
+int main(void)
+{
+    FILE* file = tmpfile();
+    size_t noops = sizeof(OPERATORS) / sizeof(OPERATORS[0]);
+    size_t nooperands = sizeof(OPERANDS) / sizeof(OPERANDS[0]);
+    srand(1);
+    for (int i = 0; i < NO_OPERANDS; ++i)
+        fprintf(file, "%s %s ", OPERANDS[rand() % nooperands], OPERATORS[rand() % noops]);
+    fprintf(file, "z\n");
+    rewind(file);
+
+    preprocessing_token_t* pp_tokens = lex(file, true);
+    fclose(file);
+    char error[MAX_ERROR_LENGTH] = { 0 };
+    tokenizing_settings_t settings = { .filepath = "expressions.c", .error = error };
+    token_t* tokens = tokenize_sequence(pp_tokens, NULL, &settings);
+    if (!tokens)
+    {
+        printf("%s", error);
+        return EXIT_FAILURE;
+    }
+    size_t total = 0;
+    for (token_t* token = tokens; token; token = token->next)
+        ++total;
+
+    double start = bench_now();
+    for (int r = 0; r < ROUNDS; ++r)
+    {
+        syntax_component_t* expr = parse_if_directive_expression(tokens, error);
+        if (!expr)
+        {
+            printf("%s", error);
+            return EXIT_FAILURE;
+        }
+        free_syntax(expr, NULL);
+    }
+    double elapsed = bench_now() - start;
+
+    BENCH_REPORT("expression parse", elapsed, (size_t) ROUNDS * total, "token");
+    token_delete_all(tokens);
+    pp_token_delete_all(pp_tokens);
+    return EXIT_SUCCESS;
+}
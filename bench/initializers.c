@@ -0,0 +1,131 @@
+#include <string.h>
+
+#include "bench.h"
+
+/*
+
+analyzes and linearizes huge brace initializers (a table of a million ints and an array of a
+hundred thousand structs), each also at a quarter of that size, and reports the time per
+element. analysis is where every element is given its place in the table, so it is timed apart
+from linearization. working out where every element goes should not depend on how many came
+before it, so the analysis time per element should stay about the same between the two sizes.
+each measurement keeps the best of a few rounds.
+
+*/
+
+#define NO_INTS 1000000
+#define NO_STRUCTS 100000
+#define ROUNDS 3
+
+static void write_int_table(FILE* file, size_t count)
+{
+    fprintf(file, "static int table[] = {");
+    for (size_t i = 0; i < count; ++i)
+        fprintf(file, "%s%zu", i ? ", " : " ", i % 1000);
+    fprintf(file, " };\n");
+}
+
+static void write_struct_table(FILE* file, size_t count)
+{
+    fprintf(file, "struct entry { int key; char flag; long range[2]; };\n");
+    fprintf(file, "static struct entry table[] = {");
+    for (size_t i = 0; i < count; ++i)
+        fprintf(file, "%s{ %zu, %zu, { %zu, 1 } }", i ? ", " : " ", i % 100, i % 7, i);
+    fprintf(file, " };\n");
+}
+
+// the time taken to analyze and to linearize the table
+typedef struct timing
+{
+    double analysis;
+    double linearization;
+} timing_t;
+
+static bool run(void (*write_table)(FILE*, size_t), size_t count, timing_t* timing)
+{
+    FILE* file = tmpfile();
+    write_table(file, count);
+    rewind(file);
+
+    preprocessing_token_t* pp_tokens = lex(file, true);
+    fclose(file);
+    time_t t = time(NULL);
+    char pp_error[MAX_ERROR_LENGTH] = { 0 };
+    preprocessing_settings_t settings = { .translation_time = &t, .filepath = "initializers.c", .error = pp_error };
+    if (!preprocess(&pp_tokens, &settings))
+    {
+        printf("%s", pp_error);
+        return false;
+    }
+    strlitconcat(pp_tokens);
+
+    char tk_error[MAX_ERROR_LENGTH] = { 0 };
+    tokenizing_settings_t tk_settings = { .filepath = "initializers.c", .error = tk_error };
+    token_stream_t* stream = token_stream_init(pp_tokens, &tk_settings);
+    syntax_component_t* tlu = parse(stream);
+    if (!tlu || tk_error[0])
+    {
+        printf("%s", tk_error);
+        return false;
+    }
+
+    double start = bench_now();
+    analysis_error_t* errors = type(tlu);
+    if (error_list_size(errors, false) > 0)
+    {
+        dump_errors(errors);
+        return false;
+    }
+    error_delete_all(errors);
+    errors = analyze(tlu);
+    if (error_list_size(errors, false) > 0)
+    {
+        dump_errors(errors);
+        return false;
+    }
+    error_delete_all(errors);
+    double analyzed = bench_now();
+    air_t* air = airinize(tlu);
+    double linearized = bench_now();
+
+    if (!timing->analysis || analyzed - start < timing->analysis)
+        timing->analysis = analyzed - start;
+    if (!timing->linearization || linearized - analyzed < timing->linearization)
+        timing->linearization = linearized - analyzed;
+
+    air_delete(air);
+    token_stream_delete(stream);
+    free_syntax(tlu, tlu);
+    return true;
+}
+
+// both sizes are timed round by round and each keeps its best round, so a noisy machine hurts them alike
+static bool report(const char* name, void (*write_table)(FILE*, size_t), size_t count)
+{
+    timing_t small = { 0 }, large = { 0 };
+    for (int r = 0; r < ROUNDS; ++r)
+    {
+        if (!run(write_table, count / 4, &small) || !run(write_table, count, &large))
+            return false;
+    }
+    char label[64];
+    snprintf(label, sizeof label, "%s analysis (1/4 size)", name);
+    BENCH_REPORT(label, small.analysis, count / 4, "element");
+    snprintf(label, sizeof label, "%s analysis", name);
+    BENCH_REPORT(label, large.analysis, count, "element");
+    snprintf(label, sizeof label, "%s linearization (1/4 size)", name);
+    BENCH_REPORT(label, small.linearization, count / 4, "element");
+    snprintf(label, sizeof label, "%s linearization", name);
+    BENCH_REPORT(label, large.linearization, count, "element");
+    printf("%-40s %10.2fx\n", "analysis per element at full size", (large.analysis / count) / (small.analysis / (count / 4)));
+    return true;
+}
+
+int main(void)
+{
+    if (!report("int table", write_int_table, NO_INTS))
+        return EXIT_FAILURE;
+    if (!report("struct table", write_struct_table, NO_STRUCTS))
+        return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
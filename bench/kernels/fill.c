@@ -0,0 +1,43 @@
+/*
+
+fills a global array over and over. with no arguments, the loop counts with an int, which
+strength reduction turns into a pointer stepping through the array with the counter gone, so
+nothing in the loop goes through memory but the store itself. given any argument, it counts with
+an unsigned int instead, which the pass leaves alone (an unsigned counter can wrap), so the
+counter is loaded, stepped and stored back in memory every time around.
+
+*/
+
+#define N 4096
+#define ROUNDS 100000
+
+static long a[N];
+
+static void fill_int(void)
+{
+    for (int i = 0; i < N; ++i)
+        a[i] = 7;
+}
+
+static void fill_unsigned(void)
+{
+    for (unsigned i = 0; i < N; ++i)
+        a[i] = 7;
+}
+
+int main(int argc, char** argv)
+{
+    for (int r = 0; r < ROUNDS; ++r)
+    {
+        if (argc > 1)
+            fill_unsigned();
+        else
+            fill_int();
+    }
+    for (int i = 0; i < N; ++i)
+    {
+        if (a[i] != 7)
+            return 1;
+    }
+    return 0;
+}
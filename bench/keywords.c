@@ -0,0 +1,85 @@
+#include <string.h>
+
+#include "bench.h"
+
+/*
+
+microbenchmark for keyword classification of identifiers.
+compares the perfect hash used by the tokenizer to a linear scan over KEYWORDS.
+
+*/
+
+#define CORPUS_SIZE 4096
+#define ROUNDS 2000
+
+static const char* IDENTIFIERS[] = {
+    "i", "j", "n", "x", "buf", "len", "size", "count", "node", "next", "prev", "value",
+    "index", "result", "tokens", "printf", "malloc", "strlen", "syntax_component",
+    "initializer", "do_thing", "integer", "charset", "constant", "format", "stdout",
+    "forward", "ifdef", "unsigned_value", "_Boolean", "struct_t", "voidptr", "whiles"
+};
+
+static int linear_lookup(char* id)
+{
+    return contains((void**) KEYWORDS, KW_ELEMENTS, id, (int (*)(void*, void*)) strcmp);
+}
+
+int main(void)
+{
+    // roughly one in three identifiers in real code is a keyword
+    size_t noids = sizeof(IDENTIFIERS) / sizeof(IDENTIFIERS[0]);
+    char** corpus = malloc(CORPUS_SIZE * sizeof(char*));
+    srand(1);
+    for (size_t i = 0; i < CORPUS_SIZE; ++i)
+        corpus[i] = (char*) (rand() % 3 == 0 ? KEYWORDS[rand() % KW_ELEMENTS] : IDENTIFIERS[rand() % noids]);
+
+    for (size_t i = 0; i < CORPUS_SIZE; ++i)
+    {
+        if (keyword_lookup(corpus[i]) != linear_lookup(corpus[i]))
+        {
+            printf("mismatch on '%s'\n", corpus[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    volatile long sink = 0;
+
+    double start = bench_now();
+    for (int r = 0; r < ROUNDS; ++r)
+        for (size_t i = 0; i < CORPUS_SIZE; ++i)
+            sink += linear_lookup(corpus[i]);
+    double linear = bench_now() - start;
+
+    start = bench_now();
+    for (int r = 0; r < ROUNDS; ++r)
+        for (size_t i = 0; i < CORPUS_SIZE; ++i)
+            sink += keyword_lookup(corpus[i]);
+    double hashed = bench_now() - start;
+
+    preprocessing_token_t pp_token;
+    memset(&pp_token, 0, sizeof pp_token);
+    pp_token.type = PPT_IDENTIFIER;
+    tokenizing_settings_t settings;
+    char error[MAX_ERROR_LENGTH];
+    settings.filepath = "bench";
+    settings.error = error;
+    start = bench_now();
+    for (int r = 0; r < ROUNDS / 10; ++r)
+    {
+        for (size_t i = 0; i < CORPUS_SIZE; ++i)
+        {
+            pp_token.identifier = corpus[i];
+            token_t* token = tokenize_identifier(&pp_token, &settings);
+            sink += token->type;
+            token_delete(token);
+        }
+    }
+    double tokenized = bench_now() - start;
+
+    BENCH_REPORT("keyword lookup (linear scan)", linear, (size_t) ROUNDS * CORPUS_SIZE, "identifier");
+    BENCH_REPORT("keyword lookup (perfect hash)", hashed, (size_t) ROUNDS * CORPUS_SIZE, "identifier");
+    BENCH_REPORT("tokenize_identifier", tokenized, (size_t) ROUNDS / 10 * CORPUS_SIZE, "identifier");
+
+    free(corpus);
+    return EXIT_SUCCESS;
+}
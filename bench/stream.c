@@ -0,0 +1,63 @@
+#include <string.h>
+
+#include "bench.h"
+
+/*
+
+parses a large generated translation unit through the token stream and reports
+how many tokens were alive at once compared to how many were produced in total.
+
+*/
+
+#define NO_FUNCTIONS 1000
+
+int main(void)
+{
+    FILE* file = tmpfile();
+    for (int i = 0; i < NO_FUNCTIONS; ++i)
+    {
+        fprintf(file, "struct s%d { int a; long b[4]; char* c; };\n", i);
+        fprintf(file, "static int table%d[] = { 1, 2, 3, 4, 5, 6, 7, 8 };\n", i);
+        fprintf(file, "int f%d(int x, struct s%d* p)\n{\n    int y = x * %d + table%d[x & 7];\n", i, i, i, i);
+        fprintf(file, "    for (int j = 0; j < 10; ++j)\n        y += p->b[j & 3] - j;\n    return y;\n}\n");
+    }
+    rewind(file);
+
+    double start = bench_now();
+    preprocessing_token_t* pp_tokens = lex(file, true);
+    fclose(file);
+    time_t t = time(NULL);
+    char pp_error[MAX_ERROR_LENGTH] = { 0 };
+    preprocessing_settings_t settings = { .translation_time = &t, .filepath = "stream.c", .error = pp_error };
+    if (!preprocess(&pp_tokens, &settings))
+    {
+        printf("%s", pp_error);
+        return EXIT_FAILURE;
+    }
+    strlitconcat(pp_tokens);
+    double preprocessed = bench_now();
+
+    size_t total = 0;
+    for (preprocessing_token_t* token = pp_tokens; token; token = token->next)
+        total += token->type != PPT_WHITESPACE;
+
+    char tk_error[MAX_ERROR_LENGTH] = { 0 };
+    tokenizing_settings_t tk_settings = { .filepath = "stream.c", .error = tk_error };
+    token_stream_t* stream = token_stream_init(pp_tokens, &tk_settings);
+    syntax_component_t* tlu = parse(stream);
+    double parsed = bench_now();
+    if (!tlu || tk_error[0])
+    {
+        printf("%s", tk_error);
+        return EXIT_FAILURE;
+    }
+
+    printf("%-40s %10zu tokens\n", "tokens produced", total);
+    printf("%-40s %10zu tokens\n", "peak tokens alive", token_stream_peak(stream));
+    BENCH_REPORT("lex + preprocess", preprocessed - start, total, "token");
+    BENCH_REPORT("tokenize + parse", parsed - preprocessed, total, "token");
+
+    token_stream_delete(stream);
+    free_syntax(tlu, tlu);
+    return EXIT_SUCCESS;
+}
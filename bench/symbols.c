@@ -0,0 +1,77 @@
+#include <string.h>
+
+#include "bench.h"
+
+/*
+
+resolves the identifiers of a generated translation unit made of many functions that all reuse
+the same few names for their parameters and locals (the way real code does with i, n, p, etc.),
+and reports the time per function for parsing, typing, and analyzing it. all three look up
+symbols constantly, so this mostly follows how long a lookup takes as the file gets bigger.
+
+*/
+
+#define NO_FUNCTIONS 2000
+
+int main(void)
+{
+    FILE* file = tmpfile();
+    fprintf(file, "typedef unsigned long size_t;\n");
+    for (int i = 0; i < NO_FUNCTIONS; ++i)
+    {
+        fprintf(file, "static int count%d;\n", i);
+        fprintf(file, "int sum%d(int* p, size_t len)\n{\n    int n = 0;\n", i);
+        fprintf(file, "    for (size_t i = 0; i < len; ++i)\n    {\n        int x = p[i];\n        n += x * %d;\n    }\n", i);
+        fprintf(file, "    {\n        int n2 = n;\n        size_t i = len;\n        n = n2 + (int) i + count%d;\n    }\n", i);
+        fprintf(file, "    count%d = n;\n    return n;\n}\n", i);
+    }
+    rewind(file);
+
+    preprocessing_token_t* pp_tokens = lex(file, true);
+    fclose(file);
+    time_t t = time(NULL);
+    char pp_error[MAX_ERROR_LENGTH] = { 0 };
+    preprocessing_settings_t settings = { .translation_time = &t, .filepath = "symbols.c", .error = pp_error };
+    if (!preprocess(&pp_tokens, &settings))
+    {
+        printf("%s", pp_error);
+        return EXIT_FAILURE;
+    }
+    strlitconcat(pp_tokens);
+
+    char tk_error[MAX_ERROR_LENGTH] = { 0 };
+    tokenizing_settings_t tk_settings = { .filepath = "symbols.c", .error = tk_error };
+    double start = bench_now();
+    token_stream_t* stream = token_stream_init(pp_tokens, &tk_settings);
+    syntax_component_t* tlu = parse(stream);
+    double parsed = bench_now();
+    if (!tlu || tk_error[0])
+    {
+        printf("%s", tk_error);
+        return EXIT_FAILURE;
+    }
+    analysis_error_t* errors = type(tlu);
+    double typed = bench_now();
+    if (error_list_size(errors, false) > 0)
+    {
+        dump_errors(errors);
+        return EXIT_FAILURE;
+    }
+    error_delete_all(errors);
+    errors = analyze(tlu);
+    double analyzed = bench_now();
+    if (error_list_size(errors, false) > 0)
+    {
+        dump_errors(errors);
+        return EXIT_FAILURE;
+    }
+    error_delete_all(errors);
+
+    BENCH_REPORT("tokenize + parse", parsed - start, NO_FUNCTIONS, "function");
+    BENCH_REPORT("type", typed - parsed, NO_FUNCTIONS, "function");
+    BENCH_REPORT("analyze", analyzed - typed, NO_FUNCTIONS, "function");
+
+    token_stream_delete(stream);
+    free_syntax(tlu, tlu);
+    return EXIT_SUCCESS;
+}
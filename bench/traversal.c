@@ -0,0 +1,110 @@
+#include <string.h>
+
+#include "bench.h"
+
+/*
+
+walks a syntax tree a million levels deep (a chain of additions leaning to the left, the shape
+a long a + b + c + ... parses to) and reports the time per element visited. a walk that recursed
+into every child would run out of stack long before reaching the bottom of it. the visitors check
+that every element is visited before its children and after them, once each.
+
+*/
+
+#define DEPTH 1000000
+#define ROUNDS 5
+
+typedef struct counting_traverser
+{
+    syntax_traverser_t base;
+    size_t befores;
+    size_t afters;
+    size_t depth;
+    size_t max_depth;
+    bool misordered;
+} counting_traverser_t;
+
+#define COUNTING_TRAVERSER ((counting_traverser_t*) trav)
+
+static void count_before(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    ++COUNTING_TRAVERSER->befores;
+    if (++COUNTING_TRAVERSER->depth > COUNTING_TRAVERSER->max_depth)
+        COUNTING_TRAVERSER->max_depth = COUNTING_TRAVERSER->depth;
+}
+
+static void count_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    ++COUNTING_TRAVERSER->afters;
+    --COUNTING_TRAVERSER->depth;
+}
+
+// identifiers remember when they were finished with, so their parents can tell they came right before them
+static void identifier_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    syn->sid = COUNTING_TRAVERSER->afters;
+    count_after(trav, syn);
+}
+
+// the right operand is walked last, so it should be the last thing finished before its parent
+static void addition_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    if (syn->bexpr_rhs->sid + 1 != COUNTING_TRAVERSER->afters)
+        COUNTING_TRAVERSER->misordered = true;
+    count_after(trav, syn);
+}
+
+static syntax_component_t* make_identifier(void)
+{
+    syntax_component_t* syn = syntax_component_init(SC_IDENTIFIER, NULL);
+    syn->id = strdup("a");
+    return syn;
+}
+
+int main(void)
+{
+    syntax_component_t* root = make_identifier();
+    for (int i = 0; i < DEPTH; ++i)
+    {
+        syntax_component_t* add = syntax_component_init(SC_ADDITION_EXPRESSION, NULL);
+        add->bexpr_lhs = root;
+        add->bexpr_rhs = make_identifier();
+        root = add;
+    }
+    size_t nodes = 2 * (size_t) DEPTH + 1;
+
+    double elapsed = 0.0;
+    for (int r = 0; r < ROUNDS; ++r)
+    {
+        syntax_traverser_t* trav = traverse_init(root, sizeof(counting_traverser_t));
+        trav->default_before = count_before;
+        trav->default_after = count_after;
+        trav->after[SC_ADDITION_EXPRESSION] = addition_after;
+        trav->after[SC_IDENTIFIER] = identifier_after;
+        double start = bench_now();
+        traverse(trav);
+        elapsed += bench_now() - start;
+        counting_traverser_t* ct = (counting_traverser_t*) trav;
+        if (ct->befores != nodes || ct->afters != nodes || ct->max_depth != DEPTH + 1 || ct->misordered)
+        {
+            printf("walk visited %zu elements before and %zu after (%zu levels deep)%s, expected %zu each (%d levels deep)\n",
+                ct->befores, ct->afters, ct->max_depth, ct->misordered ? " out of order" : "", nodes, DEPTH + 1);
+            return EXIT_FAILURE;
+        }
+        traverse_delete(trav);
+    }
+
+    printf("%-40s %10d levels\n", "tree depth", DEPTH + 1);
+    BENCH_REPORT("traverse", elapsed, (size_t) ROUNDS * nodes, "element");
+
+    // freeing the chain from the top, one element at a time, since free_syntax recurses too
+    while (root->type == SC_ADDITION_EXPRESSION)
+    {
+        syntax_component_t* lhs = root->bexpr_lhs;
+        root->bexpr_lhs = NULL;
+        free_syntax(root, NULL);
+        root = lhs;
+    }
+    free_syntax(root, NULL);
+    return EXIT_SUCCESS;
+}
@@ -10,10 +10,26 @@ typedef struct airinizing_syntax_traverser
     air_t* air;
     air_routine_t* croutine;
     unsigned long long next_label;
+    // labels of loops and switches, keyed by syntax id and only made once something jumps to them
+    map_t* break_labels; // <unsigned (syntax id), unsigned long long>
+    map_t* continue_labels; // <unsigned (syntax id), unsigned long long>
+    map_t* calling_args; // <unsigned (syntax id)>, function call arguments that make calls themselves
 } airinizing_syntax_traverser_t;
 
+// finds the function call arguments that make function calls themselves, in the same walk as linearization
+typedef struct call_syntax_traverser
+{
+    syntax_traverser_t base;
+    unsigned long long calls; // function calls visited so far
+    vector_t* marks; // <unsigned long long>, calls visited before each argument on the current path
+    map_t* calling_args;
+} call_syntax_traverser_t;
+
 #define AIRINIZING_TRAVERSER ((airinizing_syntax_traverser_t*) trav)
+#define BREAK_LABEL(s) ((unsigned long long) map_get(AIRINIZING_TRAVERSER->break_labels, (void*) (uintptr_t) (s)->sid))
+#define CONTINUE_LABEL(s) ((unsigned long long) map_get(AIRINIZING_TRAVERSER->continue_labels, (void*) (uintptr_t) (s)->sid))
 #define SYMBOL_TABLE ((syntax_get_translation_unit(syn))->tlu_st)
+#define TYPES (AIRINIZING_TRAVERSER->air->st->types)
 #define NEXT_VIRTUAL_REGISTER (AIRINIZING_TRAVERSER->air->next_available_temporary++)
 #define NEXT_LABEL (AIRINIZING_TRAVERSER->next_label++)
 
@@ -21,7 +37,7 @@ void air_data_delete(air_data_t* ad)
 {
     if (!ad) return;
     vector_deep_delete(ad->addresses, free);
-    free(ad->data);
+    image_delete(ad->image);
     free(ad);
 }
 
@@ -52,6 +68,7 @@ void air_insn_delete_all(air_insn_t* insns)
 void air_routine_delete(air_routine_t* routine)
 {
     if (!routine) return;
+    air_routine_unindex(routine);
     air_insn_delete_all(routine->insns);
     free(routine);
 }
@@ -76,36 +93,55 @@ void air_data_print(air_data_t* ad, air_t* air, int (*printer)(const char* fmt,
         printer("readonly ");
     type_humanized_print(ad->sy->type, printer);
     printer(" %s {\n", symbol_get_name(ad->sy));
-    long long size = type_size(ad->sy->type);
-    if (size == -1)
-        assert_fail;
-    for (long long i = 0, j = 0; i < size;)
+    uint64_t size = ad->image->size;
+    // runs of bytes are printed in rows of 16, and the zeros between them as a count
+    for (uint64_t i = 0, j = 0, k = 0; i < size;)
     {
-        if (i % 16 == 0)
-            printer("    ");
         if (ad->addresses && j < ad->addresses->size)
         {
             init_address_t* ia = vector_get(ad->addresses, j);
             if (i == ia->data_location)
             {
                 ++j;
-                if (i % 16 != 0)
-                    printer("\n");
+                int64_t offset;
+                image_read(ad->image, ia->data_location, &offset, POINTER_WIDTH);
                 if (ia->sy)
-                    printer("&%s + %lld", symbol_get_name(ia->sy), *((int64_t*) (ad->data + ia->data_location)));
+                    printer("    &%s + %lld\n", symbol_get_name(ia->sy), offset);
                 else
-                    printer("0x%llX", *((int64_t*) (ad->data + ia->data_location)));
-                if (i % 16 != 0)
-                    printer("\n");
+                    printer("    0x%llX\n", offset);
                 i += POINTER_WIDTH;
                 continue;
             }
         }
-        printer("%02X ", ad->data[i++]);
-        if (i < size && i % 16 == 0)
-            printer("\n");
+        uint64_t stop = size;
+        if (ad->addresses && j < ad->addresses->size)
+        {
+            init_address_t* ia = vector_get(ad->addresses, j);
+            if (ia->data_location < i)
+            {
+                ++j;
+                continue;
+            }
+            stop = ia->data_location;
+        }
+        for (; k < ad->image->noruns && ad->image->runs[k].offset + ad->image->runs[k].length <= i; ++k);
+        image_run_t* run = k < ad->image->noruns ? &ad->image->runs[k] : NULL;
+        if (!run || run->offset > i)
+        {
+            if (run && run->offset < stop)
+                stop = run->offset;
+            printer("    (%llu zero bytes)\n", stop - i);
+            i = stop;
+            continue;
+        }
+        if (run->offset + run->length < stop)
+            stop = run->offset + run->length;
+        printer("   ");
+        for (uint64_t end = i + 16 < stop ? i + 16 : stop; i < end; ++i)
+            printer(" %02X", run->bytes[i - run->offset]);
+        printer("\n");
     }
-    printer("\n}\n");
+    printer("}\n");
 }
 
 void register_print(regid_t reg, c_type_t* ct, air_t* air, int (*printer)(const char* fmt, ...))
@@ -537,7 +573,7 @@ air_insn_operand_t* air_insn_operand_copy(air_insn_operand_t* op)
     if (!op) return NULL;
     air_insn_operand_t* n = calloc(1, sizeof *n);
     n->type = op->type;
-    n->ct = type_copy(op->ct);
+    n->ct = type_share(op->ct);
     switch (n->type)
     {
         case AOP_SYMBOL:
@@ -567,7 +603,7 @@ air_insn_operand_t* air_insn_operand_copy(air_insn_operand_t* op)
             n->content.insy.offset = op->content.insy.offset;
             break;
         case AOP_TYPE:
-            n->content.ct = type_copy(op->content.ct);
+            n->content.ct = type_share(op->content.ct);
             break;
     }
     return n;
@@ -590,7 +626,7 @@ air_insn_operand_t* air_insn_register_operand_init(regid_t reg)
 air_insn_operand_t* air_insn_type_operand_init(c_type_t* ct)
 {
     air_insn_operand_t* op = air_insn_operand_init(AOP_TYPE);
-    op->content.ct = type_copy(ct);
+    op->content.ct = type_share(ct);
     return op;
 }
 
@@ -648,7 +684,7 @@ air_insn_t* air_insn_copy(air_insn_t* insn)
     if (!insn) return NULL;
     air_insn_t* n = calloc(1, sizeof *n);
     n->type = insn->type;
-    n->ct = type_copy(insn->ct);
+    n->ct = type_share(insn->ct);
     n->prev = insn->prev;
     n->next = insn->next;
     n->noops = insn->noops;
@@ -822,6 +858,7 @@ bool air_insn_produces_side_effect(air_insn_t* insn)
         case AIR_VA_ARG:
         case AIR_VA_END:
         case AIR_VA_START:
+        case AIR_LSYSCALL:
             return true;
         case AIR_ASSIGN:
         case AIR_DIRECT_ADD:
@@ -910,10 +947,10 @@ bool air_insn_produces_side_effect(air_insn_t* insn)
     return false;
 }
 
-bool air_insn_uses(air_insn_t* insn, regid_t reg)
+// whether any operand from the given one on uses reg
+static bool operands_use(air_insn_t* insn, size_t from, regid_t reg)
 {
-    if (!insn) return false;
-    for (size_t i = 0; i < insn->noops; ++i)
+    for (size_t i = from; i < insn->noops; ++i)
     {
         air_insn_operand_t* op = insn->ops[i];
         if (!op) continue;
@@ -936,8 +973,20 @@ bool air_insn_uses(air_insn_t* insn, regid_t reg)
     return false;
 }
 
+bool air_insn_uses(air_insn_t* insn, regid_t reg)
+{
+    if (!insn) return false;
+    return operands_use(insn, 0, reg);
+}
+
 air_insn_t* air_insn_find_temporary_definition_above(regid_t tmp, air_insn_t* start)
 {
+    if (start && start->defuse)
+    {
+        vector_t* defs = air_defuse_definitions(start->defuse, tmp);
+        size_t index = air_insn_vector_search(defs, start->order + 1);
+        return index ? vector_get(defs, index - 1) : NULL;
+    }
     for (; start; start = start->prev)
     {
         if (!air_insn_creates_temporary(start)) continue;
@@ -951,6 +1000,11 @@ air_insn_t* air_insn_find_temporary_definition_above(regid_t tmp, air_insn_t* st
 
 air_insn_t* air_insn_find_temporary_definition_below(regid_t tmp, air_insn_t* start)
 {
+    if (start && start->defuse)
+    {
+        vector_t* defs = air_defuse_definitions(start->defuse, tmp);
+        return vector_get(defs, air_insn_vector_search(defs, start->order));
+    }
     for (; start; start = start->next)
     {
         if (!air_insn_creates_temporary(start)) continue;
@@ -971,6 +1025,8 @@ air_insn_t* air_insn_find_temporary_definition_from_insn(regid_t tmp, air_insn_t
 
 air_insn_t* air_insn_find_temporary_definition(regid_t tmp, air_routine_t* routine)
 {
+    if (routine->defuse)
+        return vector_get(air_defuse_definitions(routine->defuse, tmp), 0);
     for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
     {
         if (!air_insn_creates_temporary(insn)) continue;
@@ -982,6 +1038,208 @@ air_insn_t* air_insn_find_temporary_definition(regid_t tmp, air_routine_t* routi
     return NULL;
 }
 
+/*
+
+def-use index. while a routine is indexed, each temporary maps to the instructions defining it and
+the ones using it (both in routine order), so finding a definition or the next use doesn't take a
+scan of the routine. the register being defined by an instruction creating a temporary isn't a use
+of it, every other register operand is.
+
+instructions remember their place in the routine as a number, with gaps left between neighbors so
+an instruction inserted between two others can take a number in between. on the rare occasion
+there's no room left, the whole routine is renumbered.
+
+inserting, moving, and removing instructions keeps the index up to date. changing the registers of
+an indexed instruction in place doesn't, so that has to happen between air_insn_unindex and
+air_insn_index.
+
+*/
+
+#define AIR_ORDER_GAP ((uint64_t) 1 << 20)
+
+// index of the first instruction in an ordered vector whose number is at least order (the size if none is)
+size_t air_insn_vector_search(vector_t* insns, uint64_t order)
+{
+    if (!insns) return 0;
+    size_t lo = 0, hi = insns->size;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (((air_insn_t*) vector_get(insns, mid))->order < order)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static void defuse_add(vector_t* insns, air_insn_t* insn)
+{
+    size_t index = air_insn_vector_search(insns, insn->order);
+    if (vector_get(insns, index) != insn)
+        vector_insert(insns, index, insn);
+}
+
+static void defuse_drop(vector_t* insns, air_insn_t* insn)
+{
+    size_t index = air_insn_vector_search(insns, insn->order);
+    if (vector_get(insns, index) == insn)
+        vector_remove(insns, index);
+}
+
+static void defuse_visit_register(map_t* map, regid_t reg, air_insn_t* insn, bool adding)
+{
+    if (reg == INVALID_VREGID) return;
+    vector_t* insns = map_get(map, (void*) reg);
+    if (!insns)
+    {
+        if (!adding) return;
+        map_add(map, (void*) reg, insns = vector_init());
+    }
+    if (adding)
+        defuse_add(insns, insn);
+    else
+        defuse_drop(insns, insn);
+}
+
+// adds an instruction to the index (or drops it) under every register it defines or uses
+static void defuse_visit(air_defuse_t* defuse, air_insn_t* insn, bool adding)
+{
+    size_t i = 0;
+    if (air_insn_creates_temporary(insn))
+    {
+        defuse_visit_register(defuse->defs, insn->ops[0]->content.reg, insn, adding);
+        i = 1;
+    }
+    for (; i < insn->noops; ++i)
+    {
+        air_insn_operand_t* op = insn->ops[i];
+        if (!op) continue;
+        if (op->type == AOP_REGISTER)
+            defuse_visit_register(defuse->uses, op->content.reg, insn, adding);
+        else if (op->type == AOP_INDIRECT_REGISTER)
+        {
+            defuse_visit_register(defuse->uses, op->content.inreg.id, insn, adding);
+            defuse_visit_register(defuse->uses, op->content.inreg.roffset, insn, adding);
+        }
+    }
+    if (insn->type == AIR_FUNC_CALL)
+    {
+        if (adding)
+            defuse_add(defuse->calls, insn);
+        else
+            defuse_drop(defuse->calls, insn);
+    }
+}
+
+// gives an instruction just linked into an indexed routine a number between its neighbors'
+static void defuse_number(air_insn_t* insn)
+{
+    uint64_t lo = insn->prev ? insn->prev->order : 0;
+    if (!insn->next)
+    {
+        insn->order = lo + AIR_ORDER_GAP;
+        return;
+    }
+    uint64_t hi = insn->next->order;
+    if (hi - lo >= 2)
+    {
+        insn->order = lo + (hi - lo) / 2;
+        return;
+    }
+    air_insn_t* first = insn;
+    for (; first->prev; first = first->prev);
+    uint64_t order = 0;
+    for (air_insn_t* renumbering = first; renumbering; renumbering = renumbering->next)
+        renumbering->order = (order += AIR_ORDER_GAP);
+}
+
+// puts an instruction that's in its place in the routine (back) in the index
+void air_insn_index(air_insn_t* insn, air_defuse_t* defuse)
+{
+    if (!insn || !defuse) return;
+    insn->defuse = defuse;
+    defuse_visit(defuse, insn, true);
+}
+
+// takes an instruction out of its index, returning the index it was in (if any)
+air_defuse_t* air_insn_unindex(air_insn_t* insn)
+{
+    if (!insn || !insn->defuse) return NULL;
+    air_defuse_t* defuse = insn->defuse;
+    defuse_visit(defuse, insn, false);
+    insn->defuse = NULL;
+    return defuse;
+}
+
+void air_routine_index(air_routine_t* routine)
+{
+    if (!routine || routine->defuse) return;
+    air_defuse_t* defuse = calloc(1, sizeof *defuse);
+    defuse->routine = routine;
+    defuse->defs = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+    defuse->uses = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+    map_set_deleters(defuse->defs, NULL, (deleter_t) vector_delete);
+    map_set_deleters(defuse->uses, NULL, (deleter_t) vector_delete);
+    defuse->calls = vector_init();
+    uint64_t order = 0;
+    for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
+    {
+        insn->order = (order += AIR_ORDER_GAP);
+        air_insn_index(insn, defuse);
+    }
+    routine->defuse = defuse;
+}
+
+void air_routine_unindex(air_routine_t* routine)
+{
+    if (!routine || !routine->defuse) return;
+    for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
+        insn->defuse = NULL;
+    map_delete(routine->defuse->defs);
+    map_delete(routine->defuse->uses);
+    vector_delete(routine->defuse->calls);
+    free(routine->defuse);
+    routine->defuse = NULL;
+}
+
+// the instructions defining reg, in routine order (NULL if there aren't any)
+vector_t* air_defuse_definitions(air_defuse_t* defuse, regid_t reg)
+{
+    return map_get(defuse->defs, (void*) reg);
+}
+
+// the instructions using reg, in routine order (NULL if there aren't any)
+vector_t* air_defuse_uses(air_defuse_t* defuse, regid_t reg)
+{
+    return map_get(defuse->uses, (void*) reg);
+}
+
+// the first instruction after start that uses reg (other than to define it)
+air_insn_t* air_insn_find_use_below(regid_t reg, air_insn_t* start)
+{
+    if (!start) return NULL;
+    if (start->defuse)
+    {
+        vector_t* uses = air_defuse_uses(start->defuse, reg);
+        return vector_get(uses, air_insn_vector_search(uses, start->order + 1));
+    }
+    for (air_insn_t* insn = start->next; insn; insn = insn->next)
+    {
+        if (operands_use(insn, air_insn_creates_temporary(insn) ? 1 : 0, reg))
+            return insn;
+    }
+    return NULL;
+}
+
+// keeps the index of the routine an instruction was just linked into up to date
+static void air_insn_linked(air_insn_t* insn, air_insn_t* neighbor)
+{
+    if (!neighbor->defuse) return;
+    defuse_number(insn);
+    air_insn_index(insn, neighbor->defuse);
+}
+
 // prev insn inserting
 air_insn_t* air_insn_insert_before(air_insn_t* insn, air_insn_t* inserting)
 {
@@ -992,6 +1250,7 @@ air_insn_t* air_insn_insert_before(air_insn_t* insn, air_insn_t* inserting)
     insn->prev = prev;
     if (prev)
         prev->next = insn;
+    air_insn_linked(insn, inserting);
     return insn;
 }
 
@@ -1005,6 +1264,7 @@ air_insn_t* air_insn_insert_after(air_insn_t* insn, air_insn_t* inserting)
     insn->next = next;
     if (next)
         next->prev = insn;
+    air_insn_linked(insn, inserting);
     return insn;
 }
 
@@ -1012,6 +1272,8 @@ static void air_insn_remove_from_list(air_insn_t* insn)
 {
     if (!insn) return;
 
+    air_insn_unindex(insn);
+
     if (insn->prev)
         insn->prev->next = insn->next;
 
@@ -1150,11 +1412,11 @@ static regid_t convert(syntax_traverser_t* trav, c_type_t* from, c_type_t* to, r
     if (type != AIR_NOP)
     {
         air_insn_t* insn = air_insn_init(type, operands);
-        insn->ct = type_copy(to);
+        insn->ct = type_canonical(TYPES, to);
         result = NEXT_VIRTUAL_REGISTER;
         insn->ops[0] = air_insn_register_operand_init(result);
         insn->ops[1] = air_insn_register_operand_init(reg);
-        insn->ops[1]->ct = type_copy(from);
+        insn->ops[1]->ct = type_canonical(TYPES, from);
         ADD_CODE(insn);
     }
     *c = code;
@@ -1202,12 +1464,12 @@ static void linearize_function_definition_after(syntax_traverser_t* trav, syntax
         {
             regid_t reg = NEXT_VIRTUAL_REGISTER;
             air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-            ld->ct = make_basic_type(CTC_INT);
+            ld->ct = type_canonical_basic(TYPES, CTC_INT);
             ld->ops[0] = air_insn_register_operand_init(reg);
             ld->ops[1] = air_insn_integer_constant_operand_init(0);
             last = air_insn_insert_after(ld, last);
             air_insn_t* ret = air_insn_init(AIR_RETURN, 1);
-            ret->ct = make_basic_type(CTC_INT);
+            ret->ct = type_canonical_basic(TYPES, CTC_INT);
             ret->ops[0] = air_insn_register_operand_init(reg);
             last = air_insn_insert_after(ret, last);
         }
@@ -1261,12 +1523,12 @@ static void linearize_primary_expression_identifier_after(syntax_traverser_t* tr
     if (!syntax_is_in_lvalue_context(syn) && !type_is_sua(sy->type) && sy->type->class != CTC_FUNCTION)
     {
         insn = air_insn_init(AIR_LOAD, 2);
-        insn->ct = type_copy(syn->ctype);
+        insn->ct = type_canonical(TYPES, syn->ctype);
     }
     else
     {
         insn = air_insn_init(AIR_LOAD_ADDR, 2);
-        insn->ct = make_reference_type(sy->type);
+        insn->ct = type_canonical_reference(TYPES, sy->type);
     }
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_symbol_operand_init(sy);
@@ -1282,7 +1544,7 @@ static void linearize_primary_expression_enumeration_constant_after(syntax_trave
     assert(sy);
     SETUP_LINEARIZE;
     air_insn_t* insn = air_insn_init(AIR_LOAD, 2);
-    insn->ct = type_copy(syn->ctype);
+    insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_integer_constant_operand_init(sy->declarer->parent->enumr_value);
     ADD_CODE(insn);
@@ -1293,7 +1555,7 @@ static void linearize_integer_constant_after(syntax_traverser_t* trav, syntax_co
 {
     SETUP_LINEARIZE;
     air_insn_t* insn = air_insn_init(AIR_LOAD, 2);
-    insn->ct = type_copy(syn->ctype);
+    insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_integer_constant_operand_init(syn->intc);
     ADD_CODE(insn);
@@ -1304,7 +1566,7 @@ static void linearize_character_constant_after(syntax_traverser_t* trav, syntax_
 {
     SETUP_LINEARIZE;
     air_insn_t* insn = air_insn_init(AIR_LOAD, 2);
-    insn->ct = type_copy(syn->ctype);
+    insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_integer_constant_operand_init(syn->charc_value);
     ADD_CODE(insn);
@@ -1320,24 +1582,34 @@ static void linearize_floating_constant_after(syntax_traverser_t* trav, syntax_c
     switch (syn->ctype->class)
     {
         case CTC_FLOAT:
-            data->data = malloc(FLOAT_WIDTH);
-            *((float*) (data->data)) = (float) syn->floc;
+        {
+            float value = (float) syn->floc;
+            data->image = image_init(FLOAT_WIDTH);
+            image_write(data->image, 0, &value, FLOAT_WIDTH);
             break;
+        }
         case CTC_DOUBLE:
-            data->data = malloc(DOUBLE_WIDTH);
-            *((double*) (data->data)) = (double) syn->floc;
+        {
+            double value = (double) syn->floc;
+            data->image = image_init(DOUBLE_WIDTH);
+            image_write(data->image, 0, &value, DOUBLE_WIDTH);
             break;
+        }
         case CTC_LONG_DOUBLE:
-            data->data = malloc(LONG_DOUBLE_WIDTH);
-            *((long double*) (data->data)) = (long double) syn->floc;
+        {
+            // only the first ten bytes of a long double mean anything, the rest stay zero
+            long double value = (long double) syn->floc;
+            data->image = image_init(LONG_DOUBLE_WIDTH);
+            image_write(data->image, 0, &value, 10);
             break;
+        }
         default: assert_fail;
     }
     vector_add(air->rodata, data);
 
     SETUP_LINEARIZE;
     air_insn_t* insn = air_insn_init(AIR_LOAD, 2);
-    insn->ct = type_copy(syn->ctype);
+    insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_symbol_operand_init(data->sy);
     ADD_CODE(insn);
@@ -1378,11 +1650,7 @@ static void linearize_return_statement_after(syntax_traverser_t* trav, syntax_co
         ADD_SEQUENCE_POINT;
         regid_t reg = syn->retstmt_expression->expr_reg;
 
-        syntax_component_t* fdef = syntax_get_enclosing(syn, SC_FUNCTION_DEFINITION);
-        assert(fdef);
-        syntax_component_t* fdef_id = syntax_get_declarator_identifier(fdef->fdef_declarator);
-        assert(fdef_id);
-        symbol_t* fsy = symbol_table_get_syn_id(SYMBOL_TABLE, fdef_id);
+        symbol_t* fsy = AIRINIZING_TRAVERSER->croutine->sy;
         assert(fsy);
 
         reg = convert(trav, syn->retstmt_expression->ctype, fsy->type->derived_from, reg, &code);
@@ -1426,7 +1694,7 @@ static void linearize_array_declarator_after(syntax_traverser_t* trav, syntax_co
     FINALIZE_LINEARIZE;
 }
 
-static void initialize_string_literal(syntax_component_t* strl, symbol_t* sy, int64_t base_offset, air_insn_t** c)
+static void initialize_string_literal(syntax_traverser_t* trav, syntax_component_t* strl, symbol_t* sy, int64_t base_offset, air_insn_t** c)
 {
     air_insn_t* code = *c;
     int64_t array_size = type_size(sy->type);
@@ -1445,7 +1713,7 @@ static void initialize_string_literal(syntax_component_t* strl, symbol_t* sy, in
         else if (remaining < UNSIGNED_LONG_LONG_INT_WIDTH)
             class = CTC_UNSIGNED_INT;
         air_insn_t* loaddest = air_insn_init(AIR_ASSIGN, 2);
-        loaddest->ct = make_basic_type(class);
+        loaddest->ct = type_canonical_basic(TYPES, class);
         loaddest->ops[0] = air_insn_indirect_symbol_operand_init(sy, base_offset + copied);
         unsigned long long value = 0;
         switch (class)
@@ -1472,30 +1740,31 @@ static void initialize_string_literal(syntax_component_t* strl, symbol_t* sy, in
     *c = code;
 }
 
-static void initialize(syntax_traverser_t* trav, syntax_component_t* initializer, symbol_t* sy, int64_t base_offset, air_insn_t** c)
+static void initialize(syntax_traverser_t* trav, syntax_component_t* initializer, symbol_t* sy, air_insn_t** c)
 {
     if (initializer->type == SC_INITIALIZER_LIST)
     {
         VECTOR_FOR(syntax_component_t*, init, initializer->inlist_initializers)
-            initialize(trav, init, sy, base_offset + initializer->initializer_offset, c);
+            initialize(trav, init, sy, c);
         return;
     }
     air_insn_t* code = *c;
 
-    c_type_t* ct = initializer->initializer_ctype;
+    c_type_t* ct = syntax_get_initializer_ctype(trav->tlu, initializer);
+    int64_t offset = syntax_get_initializer_offset(trav->tlu, initializer);
 
     if (type_is_scalar(ct))
     {
         COPY_CODE(initializer);
-        regid_t reg = convert(trav, initializer->ctype, initializer->initializer_ctype, initializer->expr_reg, &code);
+        regid_t reg = convert(trav, initializer->ctype, ct, initializer->expr_reg, &code);
         air_insn_t* assign = air_insn_init(AIR_ASSIGN, 2);
-        assign->ct = type_copy(ct);
-        assign->ops[0] = air_insn_indirect_symbol_operand_init(sy, base_offset + initializer->initializer_offset);
+        assign->ct = type_canonical(TYPES, ct);
+        assign->ops[0] = air_insn_indirect_symbol_operand_init(sy, offset);
         assign->ops[1] = air_insn_register_operand_init(reg);
         ADD_CODE(assign);
     }
     else if (initializer->type == SC_STRING_LITERAL && initializer->strl_reg && ct->class == CTC_ARRAY && type_is_character(ct->derived_from))
-        initialize_string_literal(initializer, sy, base_offset + initializer->initializer_offset, &code);
+        initialize_string_literal(trav, initializer, sy, offset, &code);
     else if (initializer->type == SC_STRING_LITERAL && initializer->strl_wide && ct->class == CTC_ARRAY && type_is_wchar_compatible(ct->derived_from))
         // TODO
         assert_fail;
@@ -1557,13 +1826,13 @@ static void linearize_initializer_list_after(syntax_traverser_t* trav, syntax_co
     SETUP_LINEARIZE;
 
     air_insn_t* ms = air_insn_init(AIR_MEMSET, 3);
-    ms->ct = make_reference_type(sy->type);
+    ms->ct = type_canonical_reference(TYPES, sy->type);
     ms->ops[0] = air_insn_integer_constant_operand_init(0);
     ms->ops[1] = air_insn_symbol_operand_init(sy);
     ms->ops[2] = air_insn_integer_constant_operand_init(type_size(sy->type));
     ADD_CODE(ms);
 
-    initialize(trav, syn, sy, 0, &code);
+    initialize(trav, syn, sy, &code);
 
     ADD_SEQUENCE_POINT;
 
@@ -1581,10 +1850,8 @@ static void linearize_static_init_declarator_after(syntax_traverser_t* trav, syn
     air_data_t* data = calloc(1, sizeof *data);
     data->sy = sy;
     data->readonly = false;
-    long long size = type_size(sy->type);
-    data->data = calloc(size, sizeof(unsigned char));
-    if (sy->data)
-        memcpy(data->data, sy->data, size);
+    // objects without an initializer get an image with no runs, which costs nothing however big they are
+    data->image = sy->image ? image_copy(sy->image) : image_init(type_size(sy->type));
     data->addresses = vector_deep_copy(sy->addresses, (void* (*)(void*)) init_address_copy);
 
     vector_add(AIRINIZING_TRAVERSER->air->data, data);
@@ -1647,7 +1914,7 @@ static void linearize_init_declarator_after(syntax_traverser_t* trav, syntax_com
     {
         regid_t reg = convert(trav, init->ctype, sy->type, init->expr_reg, &code);
         air_insn_t* insn = air_insn_init(AIR_ASSIGN, 2);
-        insn->ct = type_copy(sy->type);
+        insn->ct = type_canonical(TYPES, sy->type);
         insn->ops[0] = air_insn_symbol_operand_init(sy);
         insn->ops[1] = air_insn_register_operand_init(reg);
         ADD_CODE(insn);
@@ -1655,7 +1922,7 @@ static void linearize_init_declarator_after(syntax_traverser_t* trav, syntax_com
 
     // ISO: 6.7.8 (14), 6.7.8 (15)
     else if (is_char_array || is_wchar_array)
-        initialize_string_literal(init, sy, 0, &code);
+        initialize_string_literal(trav, init, sy, 0, &code);
 
     // ISO: 6.7.8 (13)
     else
@@ -1673,13 +1940,13 @@ static void linearize_init_declarator_after(syntax_traverser_t* trav, syntax_com
             else if (remaining < UNSIGNED_LONG_LONG_INT_WIDTH)
                 class = CTC_UNSIGNED_INT;
             air_insn_t* loadsrc = air_insn_init(AIR_LOAD, 2);
-            loadsrc->ct = make_basic_type(class);
+            loadsrc->ct = type_canonical_basic(TYPES, class);
             regid_t srcreg = NEXT_VIRTUAL_REGISTER;
             loadsrc->ops[0] = air_insn_register_operand_init(srcreg);
             loadsrc->ops[1] = air_insn_indirect_register_operand_init(init->expr_reg, copied, INVALID_VREGID, 1);
             ADD_CODE(loadsrc);
             air_insn_t* loaddest = air_insn_init(AIR_ASSIGN, 2);
-            loaddest->ct = make_basic_type(class);
+            loaddest->ct = type_canonical_basic(TYPES, class);
             loaddest->ops[0] = air_insn_indirect_symbol_operand_init(sy, copied);
             loaddest->ops[1] = air_insn_register_operand_init(srcreg);
             ADD_CODE(loaddest);
@@ -1715,7 +1982,7 @@ static void linearize_subscript_expression_after(syntax_traverser_t* trav, synta
         idx = tmp;
     }
     air_insn_t* sizeup = air_insn_init(AIR_MULTIPLY, 3);
-    sizeup->ct = type_copy(idx->ctype);
+    sizeup->ct = type_canonical(TYPES, idx->ctype);
     regid_t sureg = NEXT_VIRTUAL_REGISTER;
     sizeup->ops[0] = air_insn_register_operand_init(sureg);
     sizeup->ops[1] = air_insn_register_operand_init(idx->expr_reg);
@@ -1729,11 +1996,11 @@ static void linearize_subscript_expression_after(syntax_traverser_t* trav, synta
     {
         insn = air_insn_init(AIR_ADD, 3);
         if (mt->class == CTC_ARRAY)
-            insn->ct = type_copy(syn->ctype);
+            insn->ct = type_canonical(TYPES, syn->ctype);
         else if (mt->class == CTC_STRUCTURE || mt->class == CTC_UNION)
-            insn->ct = make_reference_type(syn->ctype);
+            insn->ct = type_canonical_reference(TYPES, syn->ctype);
         else
-            insn->ct = type_copy(obj->ctype);
+            insn->ct = type_canonical(TYPES, obj->ctype);
         insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
         insn->ops[1] = air_insn_register_operand_init(syn->bexpr_lhs->expr_reg);
         insn->ops[2] = air_insn_register_operand_init(sureg);
@@ -1741,7 +2008,7 @@ static void linearize_subscript_expression_after(syntax_traverser_t* trav, synta
     else
     {
         insn = air_insn_init(AIR_LOAD, 2);
-        insn->ct = type_copy(syn->ctype);
+        insn->ct = type_canonical(TYPES, syn->ctype);
         insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
         insn->ops[1] = air_insn_indirect_register_operand_init(syn->bexpr_lhs->expr_reg, 0, sureg, 1);
     }
@@ -1767,28 +2034,22 @@ static void linearize_string_literal_after(syntax_traverser_t* trav, syntax_comp
     air_data_t* data = calloc(1, sizeof *data);
     data->readonly = true;
     data->sy = symbol_table_get_syn_id(SYMBOL_TABLE, syn);
+    // the null terminator is left to the image
+    data->image = image_init(type_size(data->sy->type));
     if (syn->strl_reg)
-    {
-        data->data = calloc(syn->strl_length->intc + 1, sizeof(unsigned char));
-        memcpy(data->data, syn->strl_reg, syn->strl_length->intc);
-        data->data[syn->strl_length->intc] = '\0';
-    }
+        image_write(data->image, 0, syn->strl_reg, syn->strl_length->intc);
     else
-    {
-        data->data = calloc(syn->strl_length->intc + 1, sizeof(int));
-        memcpy(data->data, syn->strl_wide, sizeof(int) * syn->strl_length->intc);
-        ((int*) data->data)[syn->strl_length->intc] = '\0';
-    }
+        image_write(data->image, 0, syn->strl_wide, sizeof(int) * syn->strl_length->intc);
     vector_add(air->rodata, data);
     SETUP_LINEARIZE;
     air_insn_t* insn = air_insn_init(AIR_LOAD_ADDR, 2);
     if (syn->parent->type == SC_REFERENCE_EXPRESSION)
     {
-        insn->ct = make_basic_type(CTC_POINTER);
-        insn->ct->derived_from = type_copy(syn->ctype);
+        c_type_t ref = { .class = CTC_POINTER, .derived_from = syn->ctype };
+        insn->ct = type_canonical(TYPES, &ref);
     }
     else
-        insn->ct = type_copy(syn->ctype);
+        insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_symbol_operand_init(data->sy);
     ADD_CODE(insn);
@@ -1819,6 +2080,27 @@ static air_insn_t* add_function_call_arg(syntax_traverser_t* trav, syntax_compon
     return code;
 }
 
+static bool is_function_call_argument(syntax_component_t* syn)
+{
+    return syn->parent && syn->parent->type == SC_FUNCTION_CALL_EXPRESSION && syn != syn->parent->fcallexpr_expression;
+}
+
+static void call_default_before(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    call_syntax_traverser_t* ctrav = (call_syntax_traverser_t*) trav;
+    if (is_function_call_argument(syn))
+        vector_add(ctrav->marks, (void*) ctrav->calls);
+}
+
+static void call_default_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    call_syntax_traverser_t* ctrav = (call_syntax_traverser_t*) trav;
+    if (syn->type == SC_FUNCTION_CALL_EXPRESSION)
+        ++ctrav->calls;
+    if (is_function_call_argument(syn) && (unsigned long long) vector_pop(ctrav->marks) != ctrav->calls)
+        set_add(ctrav->calling_args, (void*) (uintptr_t) syn->sid);
+}
+
 static void linearize_function_call_expression_after(syntax_traverser_t* trav, syntax_component_t* syn)
 {
     SETUP_LINEARIZE;
@@ -1826,7 +2108,7 @@ static void linearize_function_call_expression_after(syntax_traverser_t* trav, s
     for (int i = syn->fcallexpr_args->size - 1; i >= 0; --i)
     {
         syntax_component_t* arg = vector_get(syn->fcallexpr_args, i);
-        if (!syntax_contains_subelement(arg, SC_FUNCTION_CALL_EXPRESSION))
+        if (!set_contains(AIRINIZING_TRAVERSER->calling_args, (void*) (uintptr_t) arg->sid))
             continue;
         code = add_function_call_arg(trav, syn, i, insn, code);
     }
@@ -1840,11 +2122,11 @@ static void linearize_function_call_expression_after(syntax_traverser_t* trav, s
     COPY_CODE(syn->fcallexpr_expression);
     if (syn->ctype->class == CTC_STRUCTURE || syn->ctype->class == CTC_UNION)
     {
-        insn->ct = make_reference_type(syn->ctype);
+        insn->ct = type_canonical_reference(TYPES, syn->ctype);
         insn->metadata.fcall_sret = true;
     }
     else
-        insn->ct = type_copy(syn->ctype);
+        insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_register_operand_init(syn->fcallexpr_expression->expr_reg);
     ADD_CODE(insn);
@@ -1869,9 +2151,9 @@ static void linearize_member_expression_after(syntax_traverser_t* trav, syntax_c
     {
         insn = air_insn_init(AIR_ADD, 3);
         if (mt->class == CTC_ARRAY)
-            insn->ct = type_copy(syn->ctype);
+            insn->ct = type_canonical(TYPES, syn->ctype);
         else
-            insn->ct = make_reference_type(mt);
+            insn->ct = type_canonical_reference(TYPES, mt);
         insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
         insn->ops[1] = air_insn_register_operand_init(syn->memexpr_expression->expr_reg);
         insn->ops[2] = air_insn_integer_constant_operand_init(offset);
@@ -1879,7 +2161,7 @@ static void linearize_member_expression_after(syntax_traverser_t* trav, syntax_c
     else
     {
         insn = air_insn_init(AIR_LOAD, 2);
-        insn->ct = type_copy(syn->ctype);
+        insn->ct = type_canonical(TYPES, syn->ctype);
         insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
         insn->ops[1] = air_insn_indirect_register_operand_init(syn->bexpr_lhs->expr_reg, offset, INVALID_VREGID, 1);
     }
@@ -1901,11 +2183,11 @@ static void linearize_increment_decrement_expression_after(syntax_traverser_t* t
     bool add = syn->type == SC_PREFIX_INCREMENT_EXPRESSION || syn->type == SC_POSTFIX_INCREMENT_EXPRESSION;
     bool prefix = syn->type == SC_PREFIX_INCREMENT_EXPRESSION || syn->type == SC_PREFIX_DECREMENT_EXPRESSION;
     air_insn_t* chg = air_insn_init(add ? AIR_DIRECT_ADD : AIR_DIRECT_SUBTRACT, 2);
-    chg->ct = type_copy(syn->uexpr_operand->ctype);
+    chg->ct = type_canonical(TYPES, syn->uexpr_operand->ctype);
     chg->ops[0] = air_insn_indirect_register_operand_init(syn->uexpr_operand->expr_reg, 0, INVALID_VREGID, 1);
     chg->ops[1] = air_insn_integer_constant_operand_init(syn->uexpr_operand->ctype->class == CTC_POINTER ? type_size(syn->uexpr_operand->ctype->derived_from) : 1);
     air_insn_t* access = air_insn_init(AIR_LOAD, 2);
-    access->ct = type_copy(syn->uexpr_operand->ctype);
+    access->ct = type_canonical(TYPES, syn->uexpr_operand->ctype);
     access->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     access->ops[1] = air_insn_indirect_register_operand_init(syn->uexpr_operand->expr_reg, 0, INVALID_VREGID, 1);
     if (prefix)
@@ -1925,13 +2207,13 @@ static void linearize_automatic_compound_literal_after(syntax_traverser_t* trav,
 {
     SETUP_LINEARIZE;
     air_insn_t* decl = air_insn_init(AIR_DECLARE, 1);
-    decl->ct = type_copy(sy->type);
+    decl->ct = type_canonical(TYPES, sy->type);
     decl->ops[0] = air_insn_symbol_operand_init(sy);
     ADD_CODE(decl);
     COPY_CODE(syn->cl_type_name);
     COPY_CODE(syn->cl_inlist);
     air_insn_t* insn = air_insn_init(AIR_LOAD_ADDR, 2);
-    insn->ct = make_reference_type(sy->type);
+    insn->ct = type_canonical_reference(TYPES, sy->type);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_symbol_operand_init(sy);
     ADD_CODE(insn);
@@ -1943,9 +2225,7 @@ static void linearize_static_compound_literal_after(syntax_traverser_t* trav, sy
     air_data_t* data = calloc(1, sizeof *data);
     data->sy = sy;
     data->readonly = false;
-    long long size = type_size(sy->type);
-    data->data = malloc(size);
-    memcpy(data->data, sy->data, size);
+    data->image = image_copy(sy->image);
     data->addresses = vector_deep_copy(sy->addresses, (void* (*)(void*)) init_address_copy);
     vector_add(AIRINIZING_TRAVERSER->air->data, data);
 }
@@ -2011,7 +2291,7 @@ static void linearize_unary_expression_after(syntax_traverser_t* trav, syntax_co
         default: assert_fail;
     }
     air_insn_t* insn = air_insn_init(type, 2);
-    insn->ct = type_copy(syn->ctype);
+    insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     regid_t srcreg = syn->uexpr_operand->expr_reg;
     c_type_t* ut = NULL;
@@ -2029,10 +2309,7 @@ static void linearize_unary_expression_after(syntax_traverser_t* trav, syntax_co
     {
         c_type_t* dt = syn->uexpr_operand->ctype->derived_from;
         if (dt->class == CTC_STRUCTURE || dt->class == CTC_UNION || syntax_is_in_lvalue_context(syn))
-        {
-            type_delete(insn->ct);
-            insn->ct = make_reference_type(dt);
-        }
+            insn->ct = type_canonical_reference(TYPES, dt);
         if (!type_is_sua(dt) && !syntax_is_in_lvalue_context(syn))
             insn->ops[1] = air_insn_indirect_register_operand_init(srcreg, 0, INVALID_VREGID, 1);
         else
@@ -2041,7 +2318,10 @@ static void linearize_unary_expression_after(syntax_traverser_t* trav, syntax_co
     else
         insn->ops[1] = air_insn_register_operand_init(srcreg);
     if (syn->type == SC_NOT_EXPRESSION)
-        insn->ops[1]->ct = ut;
+    {
+        insn->ops[1]->ct = type_canonical(TYPES, ut);
+        type_delete(ut);
+    }
     ADD_CODE(insn);
     FINALIZE_LINEARIZE;
 }
@@ -2054,7 +2334,7 @@ static void linearize_sizeof_expression_after(syntax_traverser_t* trav, syntax_c
         // TODO: VLA garbage
         assert_fail;
     air_insn_t* insn = air_insn_init(AIR_LOAD, 2);
-    insn->ct = make_basic_type(C_TYPE_SIZE_T);
+    insn->ct = type_canonical_basic(TYPES, C_TYPE_SIZE_T);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_integer_constant_operand_init(size);
     ADD_CODE(insn);
@@ -2070,7 +2350,7 @@ static void linearize_sizeof_type_expression_after(syntax_traverser_t* trav, syn
     if (size == -1)
         assert_fail;
     air_insn_t* insn = air_insn_init(AIR_LOAD, 2);
-    insn->ct = make_basic_type(C_TYPE_SIZE_T);
+    insn->ct = type_canonical_basic(TYPES, C_TYPE_SIZE_T);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_integer_constant_operand_init(size);
     ADD_CODE(insn);
@@ -2136,7 +2416,7 @@ static void linearize_assignment_expression_after(syntax_traverser_t* trav, synt
         (lhs_deref_size = type_size(syn->bexpr_lhs->ctype->derived_from)) != 1)
     {
         air_insn_t* mul = air_insn_init(AIR_MULTIPLY, 3);
-        mul->ct = type_copy(syn->bexpr_rhs->ctype);
+        mul->ct = type_canonical(TYPES, syn->bexpr_rhs->ctype);
         regid_t multiplied_reg = NEXT_VIRTUAL_REGISTER;
         mul->ops[0] = air_insn_register_operand_init(multiplied_reg);
         mul->ops[1] = air_insn_register_operand_init(rhs_reg);
@@ -2148,7 +2428,7 @@ static void linearize_assignment_expression_after(syntax_traverser_t* trav, synt
     {
         syn->expr_reg = convert(trav, syn->bexpr_rhs->ctype, syn->ctype, rhs_reg, &code);
         air_insn_t* insn = air_insn_init(type, 2);
-        insn->ct = type_copy(syn->ctype);
+        insn->ct = type_canonical(TYPES, syn->ctype);
         insn->ops[0] = air_insn_indirect_register_operand_init(syn->bexpr_lhs->expr_reg, 0, INVALID_VREGID, 1);
         insn->ops[1] = air_insn_register_operand_init(syn->expr_reg);
         ADD_CODE(insn);
@@ -2158,7 +2438,7 @@ static void linearize_assignment_expression_after(syntax_traverser_t* trav, synt
     if (syn->type != SC_ASSIGNMENT_EXPRESSION)
     {
         air_insn_t* insn = air_insn_init(AIR_LOAD, 2);
-        insn->ct = type_copy(syn->ctype);
+        insn->ct = type_canonical(TYPES, syn->ctype);
         insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
         insn->ops[1] = air_insn_indirect_register_operand_init(syn->bexpr_lhs->expr_reg, 0, INVALID_VREGID, 1);
         ADD_CODE(insn);
@@ -2226,17 +2506,21 @@ static void linearize_binary_expression_after(syntax_traverser_t* trav, syntax_c
         type_is_arithmetic(syn->bexpr_lhs->ctype) &&
         type_is_arithmetic(syn->bexpr_rhs->ctype))
         opt = usual_arithmetic_conversions_result_type(syn->bexpr_lhs->ctype, syn->bexpr_rhs->ctype);
+    else if ((syntax_is_relational_expression_type(syn->type) || syntax_is_equality_expression_type(syn->type)) &&
+        (syn->bexpr_lhs->ctype->class == CTC_POINTER || syn->bexpr_rhs->ctype->class == CTC_POINTER))
+        // pointers are compared as pointers (a null pointer constant against one too)
+        opt = type_copy(syn->bexpr_lhs->ctype->class == CTC_POINTER ? syn->bexpr_lhs->ctype : syn->bexpr_rhs->ctype);
     else
         opt = type_copy(syn->ctype);
     lreg = convert(trav, syn->bexpr_lhs->ctype, opt, lreg, &code);
     rreg = convert(trav, syn->bexpr_rhs->ctype, opt, rreg, &code);
     air_insn_t* insn = air_insn_init(type, 3);
-    insn->ct = type_copy(syn->ctype);
+    insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_register_operand_init(lreg);
-    insn->ops[1]->ct = type_copy(opt);
+    insn->ops[1]->ct = type_canonical(TYPES, opt);
     insn->ops[2] = air_insn_register_operand_init(rreg);
-    insn->ops[2]->ct = type_copy(opt);
+    insn->ops[2]->ct = type_canonical(TYPES, opt);
     ADD_CODE(insn);
     type_delete(opt);
     FINALIZE_LINEARIZE;
@@ -2266,7 +2550,7 @@ static void linearize_ptr_offset_expression_after(syntax_traverser_t* trav, synt
     if (size != 1)
     {
         mul = air_insn_init(AIR_MULTIPLY, 3);
-        mul->ct = type_copy(scale_on_left ? lhs->ctype : rhs->ctype);
+        mul->ct = type_canonical(TYPES, scale_on_left ? lhs->ctype : rhs->ctype);
         mul->ops[0] = air_insn_register_operand_init(reg = NEXT_VIRTUAL_REGISTER);
         mul->ops[1] = air_insn_register_operand_init(scale_on_left ? lhs->expr_reg : rhs->expr_reg);
         mul->ops[2] = air_insn_integer_constant_operand_init(size);
@@ -2277,7 +2561,7 @@ static void linearize_ptr_offset_expression_after(syntax_traverser_t* trav, synt
     if (mul && !scale_on_left)
         ADD_CODE(mul);
     air_insn_t* insn = air_insn_init(type, 3);
-    insn->ct = type_copy(syn->ctype);
+    insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_register_operand_init(scale_on_left ? reg : lhs->expr_reg);
     insn->ops[2] = air_insn_register_operand_init(scale_on_left ? rhs->expr_reg : reg);
@@ -2301,7 +2585,7 @@ static void linearize_addition_expression_after(syntax_traverser_t* trav, syntax
     lreg = convert(trav, syn->bexpr_lhs->ctype, syn->ctype, lreg, &code);
     rreg = convert(trav, syn->bexpr_rhs->ctype, syn->ctype, rreg, &code);
     air_insn_t* insn = air_insn_init(AIR_ADD, 3);
-    insn->ct = type_copy(syn->ctype);
+    insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_register_operand_init(lreg);
     insn->ops[2] = air_insn_register_operand_init(rreg);
@@ -2315,7 +2599,7 @@ static void linearize_ptrdiff_expression_after(syntax_traverser_t* trav, syntax_
     COPY_CODE(syn->bexpr_lhs);
     COPY_CODE(syn->bexpr_rhs);
     air_insn_t* insn = air_insn_init(AIR_SUBTRACT, 3);
-    insn->ct = make_basic_type(C_TYPE_PTRSIZE_T);
+    insn->ct = type_canonical_basic(TYPES, C_TYPE_PTRSIZE_T);
     regid_t sub_reg = NEXT_VIRTUAL_REGISTER;
     insn->ops[0] = air_insn_register_operand_init(sub_reg);
     insn->ops[1] = air_insn_register_operand_init(syn->bexpr_lhs->expr_reg);
@@ -2323,7 +2607,7 @@ static void linearize_ptrdiff_expression_after(syntax_traverser_t* trav, syntax_
     ADD_CODE(insn);
     long long size = type_size(syn->bexpr_lhs->ctype->derived_from);
     air_insn_t* div = air_insn_init(AIR_DIVIDE, 3);
-    div->ct = make_basic_type(C_TYPE_PTRSIZE_T);
+    div->ct = type_canonical_basic(TYPES, C_TYPE_PTRSIZE_T);
     div->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     div->ops[1] = air_insn_register_operand_init(sub_reg);
     div->ops[2] = air_insn_integer_constant_operand_init(size);
@@ -2353,7 +2637,7 @@ static void linearize_subtraction_expression_after(syntax_traverser_t* trav, syn
     lreg = convert(trav, syn->bexpr_lhs->ctype, syn->ctype, lreg, &code);
     rreg = convert(trav, syn->bexpr_rhs->ctype, syn->ctype, rreg, &code);
     air_insn_t* insn = air_insn_init(AIR_SUBTRACT, 3);
-    insn->ct = type_copy(syn->ctype);
+    insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_register_operand_init(lreg);
     insn->ops[2] = air_insn_register_operand_init(rreg);
@@ -2375,7 +2659,7 @@ static void linearize_logical_expression_after(syntax_traverser_t* trav, syntax_
     ADD_SEQUENCE_POINT;
 
     air_insn_t* jzl = air_insn_init(or ? AIR_JNZ : AIR_JZ, 2);
-    jzl->ct = type_copy(syn->bexpr_lhs->ctype);
+    jzl->ct = type_canonical(TYPES, syn->bexpr_lhs->ctype);
     jzl->ops[0] = air_insn_label_operand_init(first_label_no, 'E');
     jzl->ops[1] = air_insn_register_operand_init(syn->bexpr_lhs->expr_reg);
     ADD_CODE(jzl);
@@ -2383,14 +2667,14 @@ static void linearize_logical_expression_after(syntax_traverser_t* trav, syntax_
     COPY_CODE(syn->bexpr_rhs);
 
     air_insn_t* jzr = air_insn_init(or ? AIR_JNZ : AIR_JZ, 2);
-    jzr->ct = type_copy(syn->bexpr_rhs->ctype);
+    jzr->ct = type_canonical(TYPES, syn->bexpr_rhs->ctype);
     jzr->ops[0] = air_insn_label_operand_init(first_label_no, 'E');
     jzr->ops[1] = air_insn_register_operand_init(syn->bexpr_rhs->expr_reg);
     ADD_CODE(jzr);
 
     regid_t lastreg = NEXT_VIRTUAL_REGISTER;
     air_insn_t* last = air_insn_init(AIR_LOAD, 2);
-    last->ct = make_basic_type(CTC_INT);
+    last->ct = type_canonical_basic(TYPES, CTC_INT);
     last->ops[0] = air_insn_register_operand_init(lastreg);
     last->ops[1] = air_insn_integer_constant_operand_init(or ? 0 : 1);
     ADD_CODE(last);
@@ -2405,7 +2689,7 @@ static void linearize_logical_expression_after(syntax_traverser_t* trav, syntax_
 
     regid_t firstreg = NEXT_VIRTUAL_REGISTER;
     air_insn_t* first = air_insn_init(AIR_LOAD, 2);
-    first->ct = make_basic_type(CTC_INT);
+    first->ct = type_canonical_basic(TYPES, CTC_INT);
     first->ops[0] = air_insn_register_operand_init(firstreg);
     first->ops[1] = air_insn_integer_constant_operand_init(or ? 1 : 0);
     ADD_CODE(first);
@@ -2415,7 +2699,7 @@ static void linearize_logical_expression_after(syntax_traverser_t* trav, syntax_
     ADD_CODE(pass_label);
 
     air_insn_t* phi = air_insn_init(AIR_PHI, 3);
-    phi->ct = make_basic_type(CTC_INT);
+    phi->ct = type_canonical_basic(TYPES, CTC_INT);
     phi->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     phi->ops[1] = air_insn_register_operand_init(lastreg);
     phi->ops[2] = air_insn_register_operand_init(firstreg);
@@ -2439,7 +2723,7 @@ static void linearize_conditional_expression_after(syntax_traverser_t* trav, syn
     regid_t elsereg = syn->cexpr_else->expr_reg;
 
     air_insn_t* jz = air_insn_init(AIR_JZ, 2);
-    jz->ct = type_copy(syn->cexpr_condition->ctype);
+    jz->ct = type_canonical(TYPES, syn->cexpr_condition->ctype);
     jz->ops[0] = air_insn_label_operand_init(else_label_no, 'E');
     jz->ops[1] = air_insn_register_operand_init(syn->cexpr_condition->expr_reg);
     ADD_CODE(jz);
@@ -2463,7 +2747,7 @@ static void linearize_conditional_expression_after(syntax_traverser_t* trav, syn
     ADD_CODE(end_label);
 
     air_insn_t* phi = air_insn_init(AIR_PHI, 3);
-    phi->ct = type_copy(syn->ctype);
+    phi->ct = type_canonical(TYPES, syn->ctype);
     phi->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     phi->ops[1] = air_insn_register_operand_init(ifreg);
     phi->ops[2] = air_insn_register_operand_init(elsereg);
@@ -2511,7 +2795,7 @@ static void linearize_if_statement_after(syntax_traverser_t* trav, syntax_compon
     ADD_SEQUENCE_POINT;
 
     air_insn_t* jz = air_insn_init(AIR_JZ, 2);
-    jz->ct = type_copy(syn->ifstmt_condition->ctype);
+    jz->ct = type_canonical(TYPES, syn->ifstmt_condition->ctype);
     jz->ops[0] = air_insn_label_operand_init(has_else ? else_label_no : end_label_no, 'S');
     jz->ops[1] = air_insn_register_operand_init(syn->ifstmt_condition->expr_reg);
     ADD_CODE(jz);
@@ -2553,27 +2837,27 @@ static void linearize_switch_statement_after(syntax_traverser_t* trav, syntax_co
     {
         regid_t cvreg = NEXT_VIRTUAL_REGISTER;
         air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-        ld->ct = type_copy(pt);
+        ld->ct = type_canonical(TYPES, pt);
         ld->ops[0] = air_insn_register_operand_init(cvreg);
         ld->ops[1] = air_insn_integer_constant_operand_init(cstmt->lstmt_value);
         ADD_CODE(ld);
 
         regid_t eqreg = NEXT_VIRTUAL_REGISTER;
         air_insn_t* eq = air_insn_init(AIR_EQUAL, 3);
-        eq->ct = make_basic_type(CTC_INT);
+        eq->ct = type_canonical_basic(TYPES, CTC_INT);
         eq->ops[0] = air_insn_register_operand_init(eqreg);
         eq->ops[1] = air_insn_register_operand_init(reg);
         eq->ops[2] = air_insn_register_operand_init(cvreg);
         ADD_CODE(eq);
 
         air_insn_t* jnz = air_insn_init(AIR_JNZ, 2);
-        jnz->ct = make_basic_type(CTC_INT);
+        jnz->ct = type_canonical_basic(TYPES, CTC_INT);
         jnz->ops[0] = air_insn_label_operand_init(cstmt->lstmt_uid, 'L');
         jnz->ops[1] = air_insn_register_operand_init(eqreg);
         ADD_CODE(jnz);
     }
 
-    uint64_t after_label_no = syn->break_label_no ? syn->break_label_no : 0;
+    uint64_t after_label_no = BREAK_LABEL(syn);
 
     if (syn->swstmt_default)
     {
@@ -2583,7 +2867,7 @@ static void linearize_switch_statement_after(syntax_traverser_t* trav, syntax_co
     }
     else
     {
-        after_label_no = syn->break_label_no ? syn->break_label_no : NEXT_LABEL;
+        after_label_no = BREAK_LABEL(syn) ? BREAK_LABEL(syn) : NEXT_LABEL;
         air_insn_t* jmp = air_insn_init(AIR_JMP, 1);
         jmp->ops[0] = air_insn_label_operand_init(after_label_no, 'S');
         ADD_CODE(jmp);
@@ -2656,10 +2940,10 @@ static void linearize_for_statement_after(syntax_traverser_t* trav, syntax_compo
 
     COPY_CODE(syn->forstmt_body);
 
-    if (syn->continue_label_no)
+    if (CONTINUE_LABEL(syn))
     {
         air_insn_t* continue_label = air_insn_init(AIR_LABEL, 1);
-        continue_label->ops[0] = air_insn_label_operand_init(syn->continue_label_no, 'S');
+        continue_label->ops[0] = air_insn_label_operand_init(CONTINUE_LABEL(syn), 'S');
         ADD_CODE(continue_label);
     }
 
@@ -2679,7 +2963,7 @@ static void linearize_for_statement_after(syntax_traverser_t* trav, syntax_compo
     if (syn->forstmt_condition)
     {
         air_insn_t* jnz = air_insn_init(AIR_JNZ, 2);
-        jnz->ct = type_copy(syn->forstmt_condition->ctype);
+        jnz->ct = type_canonical(TYPES, syn->forstmt_condition->ctype);
         jnz->ops[0] = air_insn_label_operand_init(body_label_no, 'S');
         jnz->ops[1] = air_insn_register_operand_init(syn->forstmt_condition->expr_reg);
         ADD_CODE(jnz);
@@ -2691,10 +2975,10 @@ static void linearize_for_statement_after(syntax_traverser_t* trav, syntax_compo
         ADD_CODE(jmp);
     }
 
-    if (syn->break_label_no)
+    if (BREAK_LABEL(syn))
     {
         air_insn_t* break_label = air_insn_init(AIR_LABEL, 1);
-        break_label->ops[0] = air_insn_label_operand_init(syn->break_label_no, 'S');
+        break_label->ops[0] = air_insn_label_operand_init(BREAK_LABEL(syn), 'S');
         ADD_CODE(break_label);
     }
 
@@ -2706,7 +2990,7 @@ static void linearize_while_statement_after(syntax_traverser_t* trav, syntax_com
     SETUP_LINEARIZE;
 
     unsigned long long body_label_no = NEXT_LABEL;
-    unsigned long long condition_label_no = syn->continue_label_no ? syn->continue_label_no : NEXT_LABEL;
+    unsigned long long condition_label_no = CONTINUE_LABEL(syn) ? CONTINUE_LABEL(syn) : NEXT_LABEL;
 
     air_insn_t* jmp = air_insn_init(AIR_JMP, 1);
     jmp->ops[0] = air_insn_label_operand_init(condition_label_no, 'S');
@@ -2726,15 +3010,15 @@ static void linearize_while_statement_after(syntax_traverser_t* trav, syntax_com
     ADD_SEQUENCE_POINT;
 
     air_insn_t* jnz = air_insn_init(AIR_JNZ, 2);
-    jnz->ct = type_copy(syn->whstmt_condition->ctype);
+    jnz->ct = type_canonical(TYPES, syn->whstmt_condition->ctype);
     jnz->ops[0] = air_insn_label_operand_init(body_label_no, 'S');
     jnz->ops[1] = air_insn_register_operand_init(syn->whstmt_condition->expr_reg);
     ADD_CODE(jnz);
 
-    if (syn->break_label_no)
+    if (BREAK_LABEL(syn))
     {
         air_insn_t* break_label = air_insn_init(AIR_LABEL, 1);
-        break_label->ops[0] = air_insn_label_operand_init(syn->break_label_no, 'S');
+        break_label->ops[0] = air_insn_label_operand_init(BREAK_LABEL(syn), 'S');
         ADD_CODE(break_label);
     }
 
@@ -2753,10 +3037,10 @@ static void linearize_do_while_statement_after(syntax_traverser_t* trav, syntax_
 
     COPY_CODE(syn->dostmt_body);
 
-    if (syn->continue_label_no)
+    if (CONTINUE_LABEL(syn))
     {
         air_insn_t* continue_label = air_insn_init(AIR_LABEL, 1);
-        continue_label->ops[0] = air_insn_label_operand_init(syn->continue_label_no, 'S');
+        continue_label->ops[0] = air_insn_label_operand_init(CONTINUE_LABEL(syn), 'S');
         ADD_CODE(continue_label);
     }
 
@@ -2764,15 +3048,15 @@ static void linearize_do_while_statement_after(syntax_traverser_t* trav, syntax_
     ADD_SEQUENCE_POINT;
 
     air_insn_t* jnz = air_insn_init(AIR_JNZ, 2);
-    jnz->ct = type_copy(syn->dostmt_condition->ctype);
+    jnz->ct = type_canonical(TYPES, syn->dostmt_condition->ctype);
     jnz->ops[0] = air_insn_label_operand_init(body_label_no, 'S');
     jnz->ops[1] = air_insn_register_operand_init(syn->dostmt_condition->expr_reg);
     ADD_CODE(jnz);
 
-    if (syn->break_label_no)
+    if (BREAK_LABEL(syn))
     {
         air_insn_t* break_label = air_insn_init(AIR_LABEL, 1);
-        break_label->ops[0] = air_insn_label_operand_init(syn->break_label_no, 'S');
+        break_label->ops[0] = air_insn_label_operand_init(BREAK_LABEL(syn), 'S');
         ADD_CODE(break_label);
     }
 
@@ -2791,7 +3075,7 @@ static void linearize_va_intrinsic_call_expression_after(syntax_traverser_t* tra
     COPY_CODE(arg_ap);
 
     air_insn_t* insn = air_insn_init(type, 2);
-    insn->ct = type_copy(syn->ctype);
+    insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_register_operand_init(arg_ap->expr_reg);
     ADD_CODE(insn);
@@ -2804,7 +3088,7 @@ static void linearize_lsyscall_intrinsic_call_expression_after(syntax_traverser_
     SETUP_LINEARIZE;
 
     air_insn_t* insn = air_insn_init(AIR_LSYSCALL, 2 + syn->icallexpr_args->size);
-    insn->ct = type_copy(syn->ctype);
+    insn->ct = type_canonical(TYPES, syn->ctype);
     insn->ops[0] = air_insn_register_operand_init(syn->expr_reg = NEXT_VIRTUAL_REGISTER);
     insn->ops[1] = air_insn_integer_constant_operand_init(id);
     VECTOR_FOR(syntax_component_t*, arg, syn->icallexpr_args)
@@ -2846,12 +3130,12 @@ static void linearize_break_statement_after(syntax_traverser_t* trav, syntax_com
         parent->type != SC_DO_STATEMENT &&
         parent->type != SC_SWITCH_STATEMENT; parent = parent->parent);
     assert(parent);
-    if (!parent->break_label_no)
-        parent->break_label_no = NEXT_LABEL;
+    if (!BREAK_LABEL(parent))
+        map_add(AIRINIZING_TRAVERSER->break_labels, (void*) (uintptr_t) parent->sid, (void*) NEXT_LABEL);
     
     SETUP_LINEARIZE;
     air_insn_t* jmp = air_insn_init(AIR_JMP, 1);
-    jmp->ops[0] = air_insn_label_operand_init(parent->break_label_no, 'S');
+    jmp->ops[0] = air_insn_label_operand_init(BREAK_LABEL(parent), 'S');
     ADD_CODE(jmp);
     FINALIZE_LINEARIZE;
 }
@@ -2865,12 +3149,12 @@ static void linearize_continue_statement_after(syntax_traverser_t* trav, syntax_
         loop->type != SC_DO_STATEMENT;
         loop = loop->parent);
     assert(loop);
-    if (!loop->continue_label_no)
-        loop->continue_label_no = NEXT_LABEL;
+    if (!CONTINUE_LABEL(loop))
+        map_add(AIRINIZING_TRAVERSER->continue_labels, (void*) (uintptr_t) loop->sid, (void*) NEXT_LABEL);
 
     SETUP_LINEARIZE;
     air_insn_t* jmp = air_insn_init(AIR_JMP, 1);
-    jmp->ops[0] = air_insn_label_operand_init(loop->continue_label_no, 'S');
+    jmp->ops[0] = air_insn_label_operand_init(CONTINUE_LABEL(loop), 'S');
     ADD_CODE(jmp);
     FINALIZE_LINEARIZE;
 }
@@ -2893,10 +3177,15 @@ air_t* airinize(syntax_component_t* tlu)
     air_t* air = AIRINIZING_TRAVERSER->air = calloc(1, sizeof(air_t));
     air->next_available_temporary = NO_PHYSICAL_REGISTERS + 1;
     AIRINIZING_TRAVERSER->next_label = 1;
+    AIRINIZING_TRAVERSER->break_labels = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+    AIRINIZING_TRAVERSER->continue_labels = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+    AIRINIZING_TRAVERSER->calling_args = set_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
     air->data = vector_init();
     air->rodata = vector_init();
     air->routines = vector_init();
     air->st = tlu->tlu_st;
+    if (!air->st->types)
+        air->st->types = type_table_init();
 
     trav->after[SC_DECLARATOR_IDENTIFIER] = linearize_declarator_identifier_after;
     trav->after[SC_FUNCTION_DECLARATOR] = linearize_function_declarator_after;
@@ -3001,7 +3290,25 @@ air_t* airinize(syntax_component_t* tlu)
 
     trav->default_after = linearize_default_after;
 
-    traverse(trav);
+    // calls in arguments are found by a pass that visits each node right before linearization does
+    syntax_traverser_t* ctrav = traverse_init(tlu, sizeof(call_syntax_traverser_t));
+    ((call_syntax_traverser_t*) ctrav)->marks = vector_init();
+    ((call_syntax_traverser_t*) ctrav)->calling_args = AIRINIZING_TRAVERSER->calling_args;
+    ctrav->default_before = call_default_before;
+    ctrav->default_after = call_default_after;
+
+    traversal_schedule_t* ts = traversal_schedule_init(tlu);
+    traversal_schedule_add(ts, ctrav);
+    traversal_schedule_add(ts, trav);
+    traversal_schedule_depend(ts, trav, ctrav, TD_NODE);
+    traversal_schedule_run(ts);
+    traversal_schedule_delete(ts);
+
+    vector_delete(((call_syntax_traverser_t*) ctrav)->marks);
+    traverse_delete(ctrav);
+    map_delete(AIRINIZING_TRAVERSER->break_labels);
+    map_delete(AIRINIZING_TRAVERSER->continue_labels);
+    set_delete(AIRINIZING_TRAVERSER->calling_args);
     traverse_delete(trav);
     return air;
 }
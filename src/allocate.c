@@ -4,11 +4,20 @@
 
 #include "ecc.h"
 
+typedef struct live_range
+{
+    uint64_t start;
+    uint64_t end;
+} live_range_t;
+
 typedef struct allocinfo
 {
     vector_t* live_starts; // vector_t<uint64_t>
     vector_t* live_ends; // vector_t<uint64_t>
     vector_t* aliases; // vector_t<regid_t>
+    live_range_t* ranges; // the live ranges above as closed ranges, sorted and disjoint (see live_ranges_conflict)
+    size_t noranges;
+    bool physical; // whether a physical register is among the aliases
 } allocinfo_t;
 
 typedef struct allocator
@@ -42,6 +51,7 @@ void allocinfo_delete(allocinfo_t* info)
     vector_delete(info->aliases);
     vector_delete(info->live_starts);
     vector_delete(info->live_ends);
+    free(info->ranges);
     free(info);
 }
 
@@ -54,36 +64,54 @@ void allocator_delete(allocator_t* a)
     free(a);
 }
 
-static air_insn_t* find_liveness_end(regid_t reg, air_insn_t* def, air_t* air, uint64_t* end_mark)
+/*
+
+a temporary stays live from its definition to its last use before it's defined again (including a
+use by the instruction defining it again, like x = x + 1), or through the bottom of any loop it's
+used in but defined outside of (see cfg_live_until). on x86-64, caller-saved registers are also
+used up by every function call they live across.
+
+live ranges are marked with the instructions' numbers in the routine's def-use index.
+
+*/
+static air_insn_t* find_liveness_end(regid_t reg, air_insn_t* def, cfg_t* cfg, air_t* air, uint64_t* end_mark)
 {
     if (!def) return NULL;
+    air_defuse_t* defuse = def->defuse;
     air_insn_t* last = def;
-    uint64_t e = *end_mark + 1;
-    for (air_insn_t* insn = def->next; insn; insn = insn->next, ++e)
+
+    vector_t* defs = air_defuse_definitions(defuse, reg);
+    air_insn_t* redef = vector_get(defs, air_insn_vector_search(defs, def->order + 1));
+    uint64_t bound = redef ? redef->order : UINT64_MAX;
+
+    vector_t* uses = air_defuse_uses(defuse, reg);
+    size_t u = air_insn_vector_search(uses, redef ? bound + 1 : bound);
+    air_insn_t* use = u ? vector_get(uses, u - 1) : NULL;
+    if (use && use->order > last->order)
+        last = use;
+
+    if (cfg->loops->size && reg > NO_PHYSICAL_REGISTERS)
     {
-        if (air_insn_creates_temporary(insn) && insn->ops[0]->content.reg == reg)
-            break;
-        if (insn->type == AIR_FUNC_CALL &&
-            air->locale == LOC_X86_64 &&
-            reg != X86R_RAX && reg != X86R_RBX && reg != X86R_RBP && (reg < X86R_R12 || reg > X86R_R15) &&
-            reg <= NO_PHYSICAL_REGISTERS)
+        for (size_t i = air_insn_vector_search(uses, def->order + 1); i < u; ++i)
         {
-            last = insn;
-            *end_mark = e;
-            continue;
-        }
-        for (size_t i = 0; i < insn->noops; ++i)
-        {
-            air_insn_operand_t* op = insn->ops[i];
-            if (!op) continue;
-            if ((op->type == AOP_INDIRECT_REGISTER && (op->content.inreg.id == reg || op->content.inreg.roffset == reg)) ||
-                (op->type == AOP_REGISTER && op->content.reg == reg))
-            {
-                last = insn;
-                *end_mark = e;
-            }
+            air_insn_t* until = cfg_live_until(cfg, def, vector_get(uses, i));
+            if (until->order > last->order)
+                last = until;
         }
     }
+
+    if (air->locale == LOC_X86_64 &&
+        reg != X86R_RAX && reg != X86R_RBX && reg != X86R_RBP && (reg < X86R_R12 || reg > X86R_R15) &&
+        reg <= NO_PHYSICAL_REGISTERS)
+    {
+        size_t c = air_insn_vector_search(defuse->calls, bound);
+        air_insn_t* call = c ? vector_get(defuse->calls, c - 1) : NULL;
+        if (call && call->order > last->order)
+            last = call;
+    }
+
+    if (last != def)
+        *end_mark = last->order;
     if (get_program_options()->iflag)
     {
         printf("liveness ends for ");
@@ -95,10 +123,9 @@ static air_insn_t* find_liveness_end(regid_t reg, air_insn_t* def, air_t* air, u
     return last;
 }
 
-static void find_all_conflicts(air_routine_t* routine, allocator_t* a, air_t* air)
+static void find_all_conflicts(air_routine_t* routine, allocator_t* a, cfg_t* cfg, air_t* air)
 {
-    uint64_t i = 0;
-    for (air_insn_t* insn = routine->insns; insn; insn = insn->next, ++i)
+    for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
     {
         if (!air_insn_creates_temporary(insn))
             continue;
@@ -118,14 +145,15 @@ static void find_all_conflicts(air_routine_t* routine, allocator_t* a, air_t* ai
             info->live_starts = vector_init();
             info->live_ends = vector_init();
             vector_add(info->aliases, (void*) reg);
+            info->physical = reg <= NO_PHYSICAL_REGISTERS;
             map_add(a->map, (void*) reg, info);
         }
         
-        uint64_t end_mark = i;
+        uint64_t end_mark = insn->order;
         if (insn->type != AIR_BLIP)
-            find_liveness_end(reg, insn, air, &end_mark);
+            find_liveness_end(reg, insn, cfg, air, &end_mark);
 
-        uint64_t start_mark = i + 1;
+        uint64_t start_mark = insn->order + 1;
 
         // if (start_mark > end_mark && reg > NO_PHYSICAL_REGISTERS)
         // {
@@ -139,33 +167,94 @@ static void find_all_conflicts(air_routine_t* routine, allocator_t* a, air_t* ai
     }
 }
 
-static bool live_range_conflicts(allocator_t* a, regid_t r1, regid_t r2)
+/*
+
+a live range runs from the instruction after a temporary's definition to the end of its liveness, so
+a temporary that's never used has an empty range (its end is right before its start). that still has
+to conflict with anything live at the definition itself, or with another empty range at the same
+place, so it's taken as the closed range holding just its definition. every other range is used as it
+is, and two temporaries conflict if any of their closed ranges overlap.
+
+each register's ranges are kept sorted and disjoint, so checking one range against another register's
+is a binary search instead of a walk over all of them.
+
+*/
+
+// adds a closed range to the end of a sorted list, joining it with the last one if they touch
+static void live_ranges_append(live_range_t* ranges, size_t* count, uint64_t start, uint64_t end)
 {
-    allocinfo_t* info1 = map_get(a->map, (void*) r1);
-    allocinfo_t* info2 = map_get(a->map, (void*) r2);
-    if (!info1 || !info2)
-        return false;
-    for (int i = 0; i < info1->live_starts->size; ++i)
+    if (*count && start <= ranges[*count - 1].end + 1)
     {
-        uint64_t start1 = (uint64_t) vector_get(info1->live_starts, i);
-        uint64_t end1 = (uint64_t) vector_get(info1->live_ends, i);
-        for (int j = 0; j < info2->live_starts->size; ++j)
-        {
-            uint64_t start2 = (uint64_t) vector_get(info2->live_starts, j);
-            uint64_t end2 = (uint64_t) vector_get(info2->live_ends, j);
+        if (end > ranges[*count - 1].end)
+            ranges[*count - 1].end = end;
+        return;
+    }
+    ranges[*count].start = start;
+    ranges[*count].end = end;
+    ++(*count);
+}
+
+// sorts out a register's ranges the first time they're checked against another's
+static void live_ranges_init(allocinfo_t* info)
+{
+    // live starts are in routine order already, since they come from definitions in routine order
+    info->ranges = malloc(info->live_starts->size * sizeof *info->ranges);
+    info->noranges = 0;
+    for (size_t i = 0; i < info->live_starts->size; ++i)
+    {
+        uint64_t start = (uint64_t) vector_get(info->live_starts, i);
+        uint64_t end = (uint64_t) vector_get(info->live_ends, i);
+        if (end + 1 == start)
+            start = end;
+        live_ranges_append(info->ranges, &info->noranges, start, end);
+    }
+}
 
-            if (end1 + 1 == start1 && end2 + 1 == start2 && start1 == start2)
-                return true;
+static void live_ranges_merge(allocinfo_t* into, allocinfo_t* from)
+{
+    live_range_t* ranges = malloc((into->noranges + from->noranges) * sizeof *ranges);
+    size_t count = 0;
+    for (size_t i = 0, j = 0; i < into->noranges || j < from->noranges;)
+    {
+        live_range_t* r;
+        if (j >= from->noranges || (i < into->noranges && into->ranges[i].start <= from->ranges[j].start))
+            r = &into->ranges[i++];
+        else
+            r = &from->ranges[j++];
+        live_ranges_append(ranges, &count, r->start, r->end);
+    }
+    free(into->ranges);
+    into->ranges = ranges;
+    into->noranges = count;
+}
 
-            if (end1 + 1 == start1 && start2 <= end1 && end1 <= end2)
-                return true;
-            
-            if (end2 + 1 == start2 && start1 <= end2 && end2 <= end1)
-                return true;
+static bool live_ranges_conflict(allocinfo_t* info1, allocinfo_t* info2)
+{
+    if (!info1->ranges) live_ranges_init(info1);
+    if (!info2->ranges) live_ranges_init(info2);
+    if (info1->noranges > info2->noranges)
+    {
+        allocinfo_t* tmp = info1;
+        info1 = info2;
+        info2 = tmp;
+    }
+    for (size_t i = 0; i < info1->noranges; ++i)
+    {
+        live_range_t* r = &info1->ranges[i];
 
-            if (max(start1, start2) <= min(end1, end2))
-                return true;
+        // the first range of the other register that doesn't end before this one starts
+        size_t lo = 0, hi = info2->noranges;
+        while (lo < hi)
+        {
+            size_t mid = lo + (hi - lo) / 2;
+            if (info2->ranges[mid].end < r->start)
+                lo = mid + 1;
+            else
+                hi = mid;
         }
+
+        if (lo < info2->noranges && info2->ranges[lo].start <= r->end)
+            return true;
     }
     return false;
 }
@@ -187,27 +276,12 @@ static void coalesce(air_routine_t* routine, allocator_t* a, air_t* air)
             // cannot coalesce two physical registers
             if (ok <= NO_PHYSICAL_REGISTERS && k <= NO_PHYSICAL_REGISTERS) continue;
 
-            // if this register has the register we're merging as a conflict, skip it
-            if (live_range_conflicts(a, k, ok))
-                continue;
-            
-            // if any of this register's aliases has the register we're merging as a conflict, skip it
             // if any of this register's aliases is a physical register and the register we're merging is one too, we cannot coalesce
-            bool found_conflict = false;
-            VECTOR_FOR(regid_t, alias, ov->aliases)
-            {
-                if (alias <= NO_PHYSICAL_REGISTERS && k <= NO_PHYSICAL_REGISTERS)
-                {
-                    found_conflict = true;
-                    break;
-                }
-                if (live_range_conflicts(a, k, alias))
-                {
-                    found_conflict = true;
-                    break;
-                }
-            }
-            if (found_conflict)
+            if (ov->physical && k <= NO_PHYSICAL_REGISTERS)
+                continue;
+
+            // if this register (or any of its aliases, whose ranges it took) has the register we're merging as a conflict, skip it
+            if (live_ranges_conflict(v, ov))
                 continue;
             
             air_insn_t* odef = air_insn_find_temporary_definition(ok, routine);
@@ -222,6 +296,8 @@ static void coalesce(air_routine_t* routine, allocator_t* a, air_t* air)
             vector_add_if_new(ov->aliases, (void*) k, (comparator_t) regid_comparator);
             vector_concat(ov->live_starts, v->live_starts);
             vector_concat(ov->live_ends, v->live_ends);
+            live_ranges_merge(ov, v);
+            ov->physical = ov->physical || k <= NO_PHYSICAL_REGISTERS;
 
             map_remove(a->map, (void*) k);
             map_add(a->aliases, (void*) k, (void*) ok);
@@ -229,6 +305,12 @@ static void coalesce(air_routine_t* routine, allocator_t* a, air_t* air)
     }
 }
 
+// whether a physical register is already spoken for, either by itself or by the group it was coalesced into
+static bool is_allocated(allocator_t* a, regid_t reg)
+{
+    return map_contains_key(a->map, (void*) reg) || map_contains_key(a->aliases, (void*) reg);
+}
+
 static regid_t find_replacement_x86_64(regid_t reg, air_insn_t* insn, allocator_t* a, regid_t* nextintreg, regid_t* nextssereg)
 {
     // get allocation info and its replacement, if any
@@ -271,14 +353,14 @@ static regid_t find_replacement_x86_64(regid_t reg, air_insn_t* insn, allocator_
             // if it's an integer/pointer type, take next integer register available (skipping ones that were part of the allocation process)
             if (type_is_integer(def->ct) || def->ct->class == CTC_POINTER)
             {
-                for (; (*nextintreg <= X86R_R15 && map_contains_key(a->map, (void*) (*nextintreg))) || *nextintreg == X86R_RBP; ++(*nextintreg));
+                for (; (*nextintreg <= X86R_R15 && is_allocated(a, *nextintreg)) || *nextintreg == X86R_RBP; ++(*nextintreg));
                 assert(*nextintreg <= X86R_R15);
                 map_add(a->replacements, (void*) reg, (void*) (repl = (*nextintreg)++));
             }
             // if it's a floating type, take next SSE register available (skipping in the same manner as above)
             else if (type_is_real_floating(def->ct))
             {
-                for (; *nextssereg <= X86R_XMM7 && map_contains_key(a->map, (void*) (*nextssereg)); ++(*nextssereg));
+                for (; *nextssereg <= X86R_XMM7 && is_allocated(a, *nextssereg); ++(*nextssereg));
                 assert(*nextssereg <= X86R_XMM7);
                 map_add(a->replacements, (void*) reg, (void*) (repl = (*nextssereg)++));
             }
@@ -375,7 +457,13 @@ static void allocate_routine(air_routine_t* routine, air_t* air)
         (int (*)(void*, int (*)(const char*, ...))) regid_print,
         (int (*)(void*, int (*)(const char*, ...))) regid_print);
 
-    find_all_conflicts(routine, a, air);
+    // replacing registers below changes operands without telling the index, which is fine: it's only
+    // asked about a temporary before any of its occurrences have been replaced
+    air_routine_index(routine);
+
+    cfg_t* cfg = cfg_init(routine);
+    find_all_conflicts(routine, a, cfg, air);
+    cfg_delete(cfg);
 
     if (get_program_options()->iflag)
         map_print(a->map, printf);
@@ -390,6 +478,8 @@ static void allocate_routine(air_routine_t* routine, air_t* air)
 
     replace_registers(routine, a, air);
 
+    air_routine_unindex(routine);
+
     allocator_delete(a);
 }
 
@@ -15,8 +15,29 @@ typedef struct analysis_syntax_traverser
     unsigned long long next_string_literal;
     unsigned long long next_floating_constant;
     unsigned long long next_label_uid;
+    traversal_function expression_after[SC_NO_ELEMENTS]; // the analysis of each kind of expression, see intern_expression_type_after
+    struct context_traverser* context; // what encloses the node being analyzed
+    // what the enumerator analyzed last left for the next one to follow on from, if it doesn't have a value of its own
+    struct
+    {
+        syntax_component_t* valued; // the last enumerator so far with a value of its own (if any)
+        bool failed; // whether that value could not be evaluated
+        int64_t value;
+    } enumerator;
 } analysis_syntax_traverser_t;
 
+// keeps track of the syntax enclosing whatever is being visited, for the constraints that depend on it
+typedef struct context_traverser
+{
+    syntax_traverser_t base;
+    analysis_syntax_traverser_t* analysis_traverser;
+    vector_t* switches; // <syntax_component_t*> (SC_SWITCH_STATEMENT), innermost last
+    unsigned loops;
+    syntax_component_t* fdef; // SC_FUNCTION_DEFINITION
+    vector_t* init_declarators; // <syntax_component_t*> (SC_INIT_DECLARATOR), innermost last
+    unsigned struct_unions;
+} context_traverser_t;
+
 analysis_error_t* error_init(syntax_component_t* syn, bool warning, char* fmt, ...)
 {
     analysis_error_t* err = calloc(1, sizeof *err);
@@ -81,6 +102,7 @@ void dump_errors(analysis_error_t* errors)
 #define ADD_WARNING_MESSAGE(syn, fmt) ANALYSIS_TRAVERSER->errors = error_list_add(ANALYSIS_TRAVERSER->errors, error_init(syn, true, fmt))
 
 #define SYMBOL_TABLE (trav->tlu->tlu_st)
+#define TYPES (trav->tlu->tlu_st->types)
 
 static bool can_assign(c_type_t* tlhs, c_type_t* trhs, syntax_component_t* rhs);
 
@@ -95,8 +117,9 @@ static long long get_aggregate_type_element_count(c_type_t* ct)
     return 0;
 }
 
-// adds semantics to initializers in an initializer list for how and where to initialize its elements
-static void add_initializer_list_semantics(syntax_traverser_t* trav, syntax_component_t* syn, c_type_t* ct)
+// adds semantics to initializers in an initializer list for how and where to initialize its elements.
+// offsets are worked out on the way down and recorded from the start of the object, base being where this list starts.
+static void add_initializer_list_semantics(syntax_traverser_t* trav, syntax_component_t* syn, c_type_t* ct, int64_t base)
 {
     if (syn->inlist_has_semantics)
         return;
@@ -108,7 +131,7 @@ static void add_initializer_list_semantics(syntax_traverser_t* trav, syntax_comp
     vector_add(cot_stack, ct);
     vector_add(coei_stack, (void*) 0);
 
-    int64_t offset = 0;
+    int64_t offset = base;
     uint64_t ml = 1;
 
     for (unsigned i = 0; i < syn->inlist_initializers->size; ++i)
@@ -118,7 +141,7 @@ static void add_initializer_list_semantics(syntax_traverser_t* trav, syntax_comp
 
         if (desig)
         {
-            offset = 0;
+            offset = base;
             vector_delete(cot_stack);
             vector_delete(coei_stack);
             cot_stack = vector_init();
@@ -162,19 +185,18 @@ static void add_initializer_list_semantics(syntax_traverser_t* trav, syntax_comp
                         vector_delete(coei_stack);
                         return;
                     }
-                    constexpr_t* ce = constexpr_evaluate_integer(desigr);
-                    if (!constexpr_evaluation_succeeded(ce))
+                    constexpr_t ce;
+                    constexpr_evaluate_integer(desigr, &ce);
+                    if (!constexpr_evaluation_succeeded(&ce))
                     {
                         // ISO: 6.7.8 (6)
                         ADD_ERROR_MESSAGE(desigr, "array initialization designators must have a constant expression for its index");
                         vector_delete(cot_stack);
                         vector_delete(coei_stack);
-                        constexpr_delete(ce);
                         return;
                     }
-                    constexpr_convert_class(ce, CTC_LONG_LONG_INT);
-                    int64_t value = constexpr_as_i64(ce);
-                    constexpr_delete(ce);
+                    constexpr_convert_class(&ce, CTC_LONG_LONG_INT);
+                    int64_t value = constexpr_as_i64(&ce);
                     if (value < 0)
                     {
                         // ISO: 6.7.8 (6)
@@ -195,7 +217,7 @@ static void add_initializer_list_semantics(syntax_traverser_t* trav, syntax_comp
         if (!cot)
         {
             // ISO: 6.7.8 (2)
-            init->initializer_offset = -1;
+            syntax_set_initializer_offset(trav->tlu, init, -1);
             ADD_ERROR_MESSAGE(init, "this initializer and any after it would write outside the object being initialized");
             break;
         }
@@ -214,16 +236,13 @@ static void add_initializer_list_semantics(syntax_traverser_t* trav, syntax_comp
 
         bool is_scalar = type_is_scalar(et);
         bool is_char_array = et->class == CTC_ARRAY && type_is_character(et->derived_from);
-
-        c_type_t* wct = make_basic_type(C_TYPE_WCHAR_T);
-        bool is_wchar_array = et->class == CTC_ARRAY && type_is_compatible(et, wct);
-        type_delete(wct);
+        bool is_wchar_array = et->class == CTC_ARRAY && type_is_wchar_compatible(et);
 
         long long alignment = type_alignment(et);
-        offset += (alignment - (offset % alignment)) % alignment;
-
-        init->initializer_offset = offset;
+        offset += (alignment - ((offset - base) % alignment)) % alignment;
 
+        // the initializer as written, before any braces are taken off it below
+        syntax_component_t* written = init;
         bool enclosed = false;
 
         // scalar initializers can be enclosed in braces
@@ -256,9 +275,15 @@ static void add_initializer_list_semantics(syntax_traverser_t* trav, syntax_comp
             }
         }
 
+        if (written != init)
+            syntax_set_initializer_offset(trav->tlu, written, offset);
+
         // like: { { ... } }
         if (init->type == SC_INITIALIZER_LIST && !enclosed)
-            add_initializer_list_semantics(trav, init, et);
+        {
+            syntax_set_initializer_offset(trav->tlu, init, offset);
+            add_initializer_list_semantics(trav, init, et, offset);
+        }
 
         // like: { ... }
         else
@@ -273,16 +298,11 @@ static void add_initializer_list_semantics(syntax_traverser_t* trav, syntax_comp
                     break;
                 
                 // can start initializing an array with compatible element type of wchar_t with a wide string literal
-                c_type_t* wct = make_basic_type(C_TYPE_WCHAR_T);
                 if (et->class == CTC_ARRAY &&
-                    type_is_compatible(et->derived_from, wct) &&
+                    type_is_wchar_compatible(et->derived_from) &&
                     init->type == SC_STRING_LITERAL &&
                     init->strl_wide)
-                {
-                    type_delete(wct);
                     break;
-                }
-                type_delete(wct);
 
                 vector_add(cot_stack, et);
                 vector_add(coei_stack, (void*) ei);
@@ -290,7 +310,7 @@ static void add_initializer_list_semantics(syntax_traverser_t* trav, syntax_comp
                 cot = et;
                 et = et->class == CTC_ARRAY ? et->derived_from : vector_get(et->struct_union.member_types, ei);
             }
-            init->initializer_ctype = type_copy(et);
+            syntax_set_initializer(trav->tlu, init, offset, type_copy(et));
         }
 
         offset += type_size(et);
@@ -328,7 +348,10 @@ static void add_initializer_list_semantics(syntax_traverser_t* trav, syntax_comp
     vector_delete(coei_stack);
 
     if (ct->class == CTC_ARRAY && !ct->array.length_expression)
+    {
+        if (ct->canonical) assert_fail;
         ct->array.length = ml;
+    }
 }
 
 static bool string_literal_initializes_array(syntax_traverser_t* trav, syntax_component_t* syn)
@@ -336,7 +359,7 @@ static bool string_literal_initializes_array(syntax_traverser_t* trav, syntax_co
     if (!syn) return false;
     if (syn->type != SC_STRING_LITERAL) return false;
 
-    syntax_component_t* ideclr = syntax_get_enclosing(syn, SC_INIT_DECLARATOR);
+    syntax_component_t* ideclr = vector_peek(ANALYSIS_TRAVERSER->context->init_declarators);
     if (!ideclr) return false;
 
     syntax_component_t* id = syntax_get_declarator_identifier(ideclr);
@@ -357,12 +380,13 @@ static bool string_literal_initializes_array(syntax_traverser_t* trav, syntax_co
     if (ideclr->ideclr_initializer->type != SC_INITIALIZER_LIST)
         return false;
 
-    add_initializer_list_semantics(trav, ideclr->ideclr_initializer, isy->type);
+    add_initializer_list_semantics(trav, ideclr->ideclr_initializer, isy->type, 0);
 
-    if (!syn->initializer_ctype)
+    c_type_t* ct = syntax_get_initializer_ctype(trav->tlu, syn);
+    if (!ct)
         return false;
 
-    return syn->initializer_ctype->class == CTC_ARRAY && type_is_scalar(syn->initializer_ctype->derived_from);
+    return ct->class == CTC_ARRAY && type_is_scalar(ct->derived_from);
 }
 
 static c_type_t* expression_type_copy(c_type_t* ct, syntax_traverser_t* trav, syntax_component_t* syn)
@@ -418,15 +442,14 @@ static bool syntax_is_null_ptr_constant(syntax_component_t* expr, c_type_class_t
             return false;
         expr = expr->caexpr_operand;
     }
-    constexpr_t* ce = constexpr_evaluate_integer(expr);
-    if (!constexpr_evaluation_succeeded(ce))
+    constexpr_t ce;
+    constexpr_evaluate_integer(expr, &ce);
+    if (!constexpr_evaluation_succeeded(&ce))
     {
-        constexpr_delete(ce);
         return false;
     }
-    bool zero = constexpr_equals_zero(ce);
-    if (zero && class) *class = ce->ct->class;
-    constexpr_delete(ce);
+    bool zero = constexpr_equals_zero(&ce);
+    if (zero && class) *class = ce.ct->class;
     return zero;
 }
 
@@ -762,8 +785,7 @@ void analyze_function_call_expression_after(syntax_traverser_t* trav, syntax_com
                 c_type_t* tlhs = vector_get(called_type->derived_from->function.param_types, i);
                 if (!tlhs) // variadic arguments aren't going to have a type attached to them
                     break;
-                c_type_t* unqualified_tlhs = type_copy(tlhs);
-                unqualified_tlhs->qualifiers = 0;
+                c_type_t* unqualified_tlhs = type_canonical_unqualified(TYPES, tlhs);
                 if (!can_assign(unqualified_tlhs, rhs->ctype, rhs))
                 {
                     // ISO: 6.5.2.2 (2)
@@ -778,7 +800,6 @@ void analyze_function_call_expression_after(syntax_traverser_t* trav, syntax_com
                     ADD_ERROR(rhs, "invalid type for argument %d of this function call", i + 1);
                     pass = false;
                 }
-                type_delete(unqualified_tlhs);
             }
         }
     }
@@ -1022,15 +1043,17 @@ void analyze_dereference_member_expression_after(syntax_traverser_t* trav, synta
     bool pass = true;
     c_type_t* tlhs = syn->memexpr_expression->ctype;
     syntax_component_t* id = syn->memexpr_id;
-    int mem_idx = -1;
+    long long mem_idx = -1;
     if (tlhs->class != CTC_POINTER || (tlhs->derived_from->class != CTC_STRUCTURE && tlhs->derived_from->class != CTC_UNION))
     {
         // ISO: 6.5.2.3 (2)
         pass = false;
         ADD_ERROR_MESSAGE(syn, "left hand side of dereferencing member access expression must be of struct/union type");
     }
-    else if (!tlhs->derived_from->struct_union.member_names ||
-        (mem_idx = vector_contains(tlhs->derived_from->struct_union.member_names, id->id, (int (*)(void*, void*)) strcmp)) == -1)
+    else
+        type_get_struct_union_member_info(tlhs->derived_from, id->id, &mem_idx, NULL);
+
+    if (pass && mem_idx == -1)
     {
         // ISO: 6.5.2.3 (2)
         pass = false;
@@ -1056,14 +1079,17 @@ void analyze_member_expression_after(syntax_traverser_t* trav, syntax_component_
     bool pass = true;
     c_type_t* tlhs = syn->memexpr_expression->ctype;
     syntax_component_t* id = syn->memexpr_id;
-    int mem_idx = -1;
+    long long mem_idx = -1;
     if (tlhs->class != CTC_STRUCTURE && tlhs->class != CTC_UNION)
     {
         // ISO: 6.5.2.3 (1)
         pass = false;
         ADD_ERROR_MESSAGE(syn, "left hand side of member access expression must be of struct/union type");
     }
-    else if (!tlhs->struct_union.member_names || (mem_idx = vector_contains(tlhs->struct_union.member_names, id->id, (int (*)(void*, void*)) strcmp)) == -1)
+    else
+        type_get_struct_union_member_info(tlhs, id->id, &mem_idx, NULL);
+
+    if (pass && mem_idx == -1)
     {
         // ISO: 6.5.2.3 (1)
         pass = false;
@@ -1122,16 +1148,17 @@ void analyze_string_literal_after(syntax_traverser_t* trav, syntax_component_t*
     free(name);
 }
 
-void analyze_static_initializer_after(syntax_traverser_t* trav, syntax_component_t* syn, symbol_t* sy, int64_t base)
+// offset is where the initializer goes in the object (initializers in a list know their own)
+void analyze_static_initializer_after(syntax_traverser_t* trav, syntax_component_t* syn, symbol_t* sy, int64_t offset)
 {
     if (string_literal_initializes_array(trav, syn))
     {
         symbol_t* strsy = symbol_table_get_syn_id(SYMBOL_TABLE, syn);
         assert(strsy);
         if (syn->strl_reg)
-            memcpy(sy->data + base, syn->strl_reg, type_size(strsy->type));
+            image_write(sy->image, offset, syn->strl_reg, type_size(strsy->type));
         else if (syn->strl_wide)
-            memcpy(sy->data + base, syn->strl_wide, type_size(strsy->type));
+            image_write(sy->image, offset, syn->strl_wide, type_size(strsy->type));
         return;
     }
     if (syn->type != SC_INITIALIZER_LIST)
@@ -1139,60 +1166,64 @@ void analyze_static_initializer_after(syntax_traverser_t* trav, syntax_component
         bool offset_lhs = (syn->type == SC_ADDITION_EXPRESSION || syn->type == SC_SUBTRACTION_EXPRESSION) && syn->bexpr_lhs->ctype->class == CTC_POINTER;
         bool offset_rhs = (syn->type == SC_ADDITION_EXPRESSION && syn->bexpr_rhs->ctype->class == CTC_POINTER);
         bool offset_included = offset_lhs || offset_rhs;
-        syntax_component_t* ptr_side = offset_lhs ? syn->bexpr_lhs : syn->bexpr_rhs;
-        syntax_component_t* offset_side = offset_lhs ? syn->bexpr_rhs : syn->bexpr_lhs;
-        constexpr_t* ce = constexpr_evaluate(offset_included ? ptr_side : syn);
-        constexpr_t* oce = offset_included ? constexpr_evaluate_integer(offset_side) : NULL;
-        if (constexpr_evaluation_succeeded(ce) && (!oce || constexpr_evaluation_succeeded(oce)))
+        syntax_component_t* ptr_side = offset_lhs ? syn->bexpr_lhs : offset_rhs ? syn->bexpr_rhs : NULL;
+        syntax_component_t* offset_side = offset_lhs ? syn->bexpr_rhs : offset_rhs ? syn->bexpr_lhs : NULL;
+        constexpr_t ce, oce;
+        constexpr_evaluate(offset_included ? ptr_side : syn, &ce);
+        if (offset_included)
+            constexpr_evaluate_integer(offset_side, &oce);
+        if (constexpr_evaluation_succeeded(&ce) && (!offset_included || constexpr_evaluation_succeeded(&oce)))
         {
             if (get_program_options()->iflag)
             {
                 printf("value of static initializer on line %u: ", syn->row);
-                constexpr_print_value(ce, printf);
+                constexpr_print_value(&ce, printf);
                 printf("\n");
             }
 
-            if (ce->type == CE_ARITHMETIC || ce->type == CE_INTEGER)
-                memcpy(sy->data + base, ce->content.data, type_size(ce->ct));
+            if (ce.type == CE_ARITHMETIC || ce.type == CE_INTEGER)
+            {
+                // ISO: 6.7.8 (11)
+                c_type_t* ct = syntax_get_initializer_ctype(trav->tlu, syn);
+                if (type_is_arithmetic(ct))
+                    constexpr_convert(&ce, ct);
+                image_write(sy->image, offset, ce.content.data, type_size(ce.ct));
+            }
             else
             {
                 if (!sy->addresses) sy->addresses = vector_init();
                 init_address_t* ia = calloc(1, sizeof *ia);
-                ia->data_location = base;
-                ia->sy = ce->content.addr.sy;
+                ia->data_location = offset;
+                ia->sy = ce.content.addr.sy;
                 vector_add(sy->addresses, ia);
-                int64_t offset = ce->content.addr.offset * (ce->content.addr.negative_offset ? -1 : 1);
+                int64_t addr_offset = ce.content.addr.offset * (ce.content.addr.negative_offset ? -1 : 1);
                 if (offset_included)
                 {
-                    constexpr_convert_class(oce, CTC_LONG_LONG_INT);
-                    int64_t oce_value = constexpr_as_i64(oce);
+                    constexpr_convert_class(&oce, CTC_LONG_LONG_INT);
+                    int64_t oce_value = constexpr_as_i64(&oce);
                     c_type_t* lhs_pointed_ct = ptr_side->ctype->derived_from;
                     int64_t lpc_size = type_size(lhs_pointed_ct);
-                    syn->type == SC_ADDITION_EXPRESSION ? offset += (oce_value * lpc_size) : (offset -= (oce_value * lpc_size));
+                    syn->type == SC_ADDITION_EXPRESSION ? addr_offset += (oce_value * lpc_size) : (addr_offset -= (oce_value * lpc_size));
                 }
-                memcpy(sy->data + base, &offset, POINTER_WIDTH);
+                image_write(sy->image, offset, &addr_offset, POINTER_WIDTH);
             }
-
-            constexpr_delete(ce);
-            constexpr_delete(oce);
         }
         else
         {
             // ISO: 6.7.8 (4)
-            if (ce->error)
-                ADD_ERROR(syn, "in static initialization: %s", ce->error);
-            if (oce && oce->error)
-                ADD_ERROR(offset_side, "in address constant offset of static initialization: %s", oce->error);
-            constexpr_delete(ce);
-            constexpr_delete(oce);
+            if (ce.error)
+                ADD_ERROR(syn, "in static initialization: %s", ce.error);
+            if (offset_included && oce.error)
+                ADD_ERROR(offset_side, "in address constant offset of static initialization: %s", oce.error);
         }
         return;
     }
     VECTOR_FOR(syntax_component_t*, init, syn->inlist_initializers)
     {
-        if (init->initializer_offset == -1)
+        int64_t init_offset = syntax_get_initializer_offset(trav->tlu, init);
+        if (init_offset == -1)
             continue;
-        analyze_static_initializer_after(trav, init, sy, base + init->initializer_offset);
+        analyze_static_initializer_after(trav, init, sy, init_offset);
     }
 }
 
@@ -1207,6 +1238,7 @@ void analyze_initializer_after(syntax_traverser_t* trav, syntax_component_t* syn
     {
         symbol_t* strsy = symbol_table_get_syn_id(SYMBOL_TABLE, syn);
         assert(strsy);
+        if (sy->type->canonical) assert_fail;
         sy->type->array.length = type_get_array_length(strsy->type);
     }
 }
@@ -1220,7 +1252,7 @@ static void check_initializations(syntax_traverser_t* trav, syntax_component_t*
         return;
     }
 
-    c_type_t* ct = syn->initializer_ctype;
+    c_type_t* ct = syntax_get_initializer_ctype(trav->tlu, syn);
 
     bool is_scalar = type_is_scalar(ct);
     // bool is_char_array = ct->class == CTC_ARRAY && type_is_character(ct->derived_from);
@@ -1255,7 +1287,7 @@ void analyze_compound_literal_expression_after(syntax_traverser_t* trav, syntax_
     }
 
     if (syn->cl_inlist->type == SC_INITIALIZER_LIST)
-        add_initializer_list_semantics(trav, syn->cl_inlist, sy->type);
+        add_initializer_list_semantics(trav, syn->cl_inlist, sy->type, 0);
     
     check_initializations(trav, syn->cl_inlist);
 
@@ -1265,7 +1297,7 @@ void analyze_compound_literal_expression_after(syntax_traverser_t* trav, syntax_
 
     if (sd == SD_STATIC)
     {
-        sy->data = calloc(type_size(ct), sizeof(uint8_t));
+        sy->image = image_init(type_size(ct));
         analyze_static_initializer_after(trav, syn->cl_inlist, sy, 0);
     }
     else if (sd == SD_AUTOMATIC)
@@ -1994,73 +2026,65 @@ void analyze_enumeration_constant_after(syntax_traverser_t* trav, syntax_compone
     syntax_component_t* enumr = sy->declarer->parent;
     if (!enumr)
         assert_fail;
+    syntax_component_t* enums = enumr->parent;
+    if (!enums)
+        assert_fail;
+    // enumerators are analyzed in order, so whatever was left by the last one analyzed was left by the one before this one
+    // (enumerators of other enumerations can only come in between from inside of an enumerator's own constant expression)
+    if (vector_get(enums->enums_enumerators, 0) == enumr)
+    {
+        ANALYSIS_TRAVERSER->enumerator.valued = NULL;
+        ANALYSIS_TRAVERSER->enumerator.failed = false;
+        ANALYSIS_TRAVERSER->enumerator.value = -1;
+    }
     // if enumerator has a constant value associated with it, use that value
     if (enumr->enumr_expression)
     {
-        constexpr_t* ce = constexpr_evaluate_integer(enumr->enumr_expression);
-        if (!constexpr_evaluation_succeeded(ce))
+        ANALYSIS_TRAVERSER->enumerator.valued = enumr;
+        ANALYSIS_TRAVERSER->enumerator.failed = false;
+        constexpr_t ce;
+        constexpr_evaluate_integer(enumr->enumr_expression, &ce);
+        if (!constexpr_evaluation_succeeded(&ce))
         {
             // ISO: 6.7.2.2 (2)
             ADD_ERROR_MESSAGE(enumr, "enumeration constant value must be specified by an integer constant expression");
-            constexpr_delete(ce);
+            ANALYSIS_TRAVERSER->enumerator.failed = true;
             return;
         }
-        constexpr_convert_class(ce, CTC_LONG_LONG_INT);
-        int64_t value = constexpr_as_i64(ce);
+        constexpr_convert_class(&ce, CTC_LONG_LONG_INT);
+        int64_t value = constexpr_as_i64(&ce);
+        ANALYSIS_TRAVERSER->enumerator.value = value;
         if (value < -0x80000000LL || value > 0x7FFFFFFFLL)
         {
             // ISO: 6.7.2.2 (2)
             ADD_ERROR_MESSAGE(enumr, "enumeration constant value must be representable by type 'int'");
-            constexpr_delete(ce);
             return;
         }
-        constexpr_delete(ce);
         enumr->enumr_value = value;
         return;
     }
-    // otherwise...
-    syntax_component_t* enums = enumr->parent;
-    if (!enums)
-        assert_fail;
-    // find the last enumerator that does have one before the current enum constant
-    int last = -1;
-    int idx = 0;
-    VECTOR_FOR(syntax_component_t*, er, enums->enums_enumerators)
-    {
-        idx = i;
-        if (er == enumr)
-            break;
-        if (er->enumr_expression)
-            last = i;
-    }
-    // if there is no last one, take 0 to be the constant value of the first enum constant (go by placement index)
-    if (last == -1)
+    // otherwise, it's one more than the one before it
+    if (ANALYSIS_TRAVERSER->enumerator.failed)
     {
-        enumr->enumr_value = idx;
+        // ISO: 6.7.2.2 (2)
+        ADD_ERROR_MESSAGE(ANALYSIS_TRAVERSER->enumerator.valued, "enumeration constant value must be specified by an integer constant expression");
         return;
     }
-    // if there is, evaluate it
-    syntax_component_t* last_er = vector_get(enums->enums_enumerators, last);
-    constexpr_t* ce = constexpr_evaluate_integer(last_er->enumr_expression);
-    if (!constexpr_evaluation_succeeded(ce))
+    int64_t value = ++ANALYSIS_TRAVERSER->enumerator.value;
+    // if none before it have a value of their own, it's just its placement index
+    if (!ANALYSIS_TRAVERSER->enumerator.valued)
     {
-        // ISO: 6.7.2.2 (2)
-        ADD_ERROR_MESSAGE(last_er, "enumeration constant value must be specified by an integer constant expression");
-        constexpr_delete(ce);
+        enumr->enumr_value = value;
         return;
     }
-    constexpr_convert_class(ce, CTC_LONG_LONG_INT);
-    int64_t value = constexpr_as_i64(ce) + (idx - last);
     if (value < -0x80000000LL || value > 0x7FFFFFFFLL)
     {
         // ISO: 6.7.2.2 (2)
         ADD_ERROR_MESSAGE(enumr, "enumeration constant value must be representable by type 'int'");
-        constexpr_delete(ce);
         if (get_program_options()->iflag)
             printf("value identified at %u:%u: %ld\n", enumr->row, enumr->col, value);
         return;
     }
-    constexpr_delete(ce);
     enumr->enumr_value = value;
 }
 
@@ -2073,7 +2097,7 @@ void analyze_declaring_identifier_after(syntax_traverser_t* trav, syntax_compone
     storage_duration_t sd = symbol_get_storage_duration(sy);
     syntax_component_t* scope = symbol_get_scope(sy);
 
-    syntax_component_t* fdef = syntax_get_function_definition(syn);
+    syntax_component_t* fdef = ANALYSIS_TRAVERSER->context->fdef;
     if (fdef)
     {
         syntax_component_t* fid = syntax_get_declarator_identifier(fdef->fdef_declarator);
@@ -2123,17 +2147,6 @@ void analyze_declaring_identifier_after(syntax_traverser_t* trav, syntax_compone
         // NOTE: GCC on -std=c99 -pedantic-errors does not complain about typedef (which seems fine semantically, but appears to break this rule)
         // ISO: 6.7.1 (5)
         ADD_ERROR_MESSAGE(syn, "function declarations at block scope may only have the 'extern' storage class specifier");
-    
-    if (syntax_is_tentative_definition(syn))
-    {
-        vector_t* declspecs = syntax_get_declspecs(syn);
-        if (declspecs && syntax_has_specifier(declspecs, SC_STORAGE_CLASS_SPECIFIER, SCS_STATIC) &&
-            !type_is_complete(sy->type))
-        {
-            // ISO: 6.9.2 (3)
-            ADD_ERROR_MESSAGE(syn, "tentative definitions with internal linkage may not have an incomplete type");
-        }
-    }
 
     if (sy->type->class == CTC_LABEL && !first && symbols->size > 1)
     {
@@ -2161,7 +2174,7 @@ void analyze_designating_identifier_after(syntax_traverser_t* trav, syntax_compo
 {
     linkage_t lk = symbol_get_linkage(sy);
 
-    syntax_component_t* fdef = syntax_get_function_definition(syn);
+    syntax_component_t* fdef = ANALYSIS_TRAVERSER->context->fdef;
     if (fdef)
     {
         syntax_component_t* fid = syntax_get_declarator_identifier(fdef->fdef_declarator);
@@ -2423,26 +2436,11 @@ void analyze_translation_unit_after(syntax_traverser_t* trav, syntax_component_t
     // TODO
 }
 
-void enforce_6_8_1_para_2(syntax_traverser_t* trav, syntax_component_t* syn)
-{
-    if (syn->lstmt_id)
-        return; // this constraint does not apply to regular labels, only case/default
-    
-    if (!syntax_get_enclosing(syn, SC_SWITCH_STATEMENT))
-        // ISO: 6.8.1 (2)
-        ADD_ERROR_MESSAGE(syn, "case and default labels may only exist within a switch statement");
-}
-
 void analyze_labeled_statement_before(syntax_traverser_t* trav, syntax_component_t* syn)
 {
     syn->lstmt_uid = ++(ANALYSIS_TRAVERSER->next_label_uid);
 }
 
-void analyze_labeled_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
-{
-    enforce_6_8_1_para_2(trav, syn);
-}
-
 void analyze_if_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
 {
     if (!type_is_scalar(syn->ifstmt_condition->ctype))
@@ -2450,44 +2448,95 @@ void analyze_if_statement_after(syntax_traverser_t* trav, syntax_component_t* sy
         ADD_ERROR_MESSAGE(syn->ifstmt_condition, "controlling expression of an if statement must be of scalar type");
 }
 
-#define SWBODY_ANALYSIS_TRAVERSER (((swbody_traverser_t*) trav)->analysis_traverser)
+#define CONTEXT_TRAVERSER ((context_traverser_t*) trav)
+#define CONTEXT_ANALYSIS_TRAVERSER (CONTEXT_TRAVERSER->analysis_traverser)
 
-typedef struct swbody_traverser
+static void context_switch_statement_before(syntax_traverser_t* trav, syntax_component_t* syn)
 {
-    syntax_traverser_t base;
-    analysis_syntax_traverser_t* analysis_traverser;
-} swbody_traverser_t;
+    syn->swstmt_cases = vector_init();
+    vector_add(CONTEXT_TRAVERSER->switches, syn);
+}
+
+static void context_switch_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    vector_pop(CONTEXT_TRAVERSER->switches);
+}
+
+static void context_function_definition_before(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    CONTEXT_TRAVERSER->fdef = syn;
+}
+
+static void context_function_definition_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    CONTEXT_TRAVERSER->fdef = NULL;
+}
+
+static void context_init_declarator_before(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    vector_add(CONTEXT_TRAVERSER->init_declarators, syn);
+}
+
+static void context_init_declarator_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    vector_pop(CONTEXT_TRAVERSER->init_declarators);
+}
+
+static void context_struct_union_specifier_before(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    ++CONTEXT_TRAVERSER->struct_unions;
+}
+
+static void context_struct_union_specifier_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    --CONTEXT_TRAVERSER->struct_unions;
+}
+
+static void context_iteration_statement_before(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    ++CONTEXT_TRAVERSER->loops;
+}
+
+static void context_iteration_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    --CONTEXT_TRAVERSER->loops;
+}
 
-void swbody_labeled_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
+static void context_labeled_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
 {
     if (syn->lstmt_id)
+        return; // only case and default labels belong to a switch
+    syntax_component_t* swstmt = vector_peek(CONTEXT_TRAVERSER->switches);
+    if (!swstmt)
+    {
+        // ISO: 6.8.1 (2)
+        ADD_ERROR_MESSAGE_TO_TRAVERSER(CONTEXT_ANALYSIS_TRAVERSER, syn, "case and default labels may only exist within a switch statement");
         return;
-    syntax_component_t* enc = syntax_get_enclosing(syn, SC_SWITCH_STATEMENT);
-    syntax_component_t* swstmt = trav->tlu;
-    if (enc != swstmt)
+    }
+    // the switch itself reports a bad controlling expression, its cases can't be checked against it
+    if (!type_is_integer(swstmt->swstmt_condition->ctype))
         return;
     if (syn->lstmt_case_expression)
     {
-        constexpr_t* ce = constexpr_evaluate_integer(syn->lstmt_case_expression);
-        if (!constexpr_evaluation_succeeded(ce))
+        constexpr_t ce;
+        constexpr_evaluate_integer(syn->lstmt_case_expression, &ce);
+        if (!constexpr_evaluation_succeeded(&ce))
         {
             // ISO: 6.8.4.2 (3)
-            ADD_ERROR_MESSAGE_TO_TRAVERSER(SWBODY_ANALYSIS_TRAVERSER, syn, "case statement must have a constant expression");
-            constexpr_delete(ce);
+            ADD_ERROR_MESSAGE_TO_TRAVERSER(CONTEXT_ANALYSIS_TRAVERSER, syn, "case statement must have a constant expression");
             return;
         }
         c_type_t* pt = integer_promotions(swstmt->swstmt_condition->ctype);
-        constexpr_convert(ce, pt);
+        constexpr_convert(&ce, pt);
         // TODO: make better?
-        syn->lstmt_value = constexpr_as_u64(ce);
+        syn->lstmt_value = constexpr_as_u64(&ce);
         type_delete(pt);
-        constexpr_delete(ce);
         VECTOR_FOR(syntax_component_t*, lstmt, swstmt->swstmt_cases)
         {
             if (lstmt->lstmt_value == syn->lstmt_value)
             {
                 // ISO: 6.8.4.2 (3)
-                ADD_ERROR_TO_TRAVERSER(SWBODY_ANALYSIS_TRAVERSER, syn,
+                ADD_ERROR_TO_TRAVERSER(CONTEXT_ANALYSIS_TRAVERSER, syn,
                     "case statement on line %u has expression with the same value", lstmt->row);
             }
         }
@@ -2497,12 +2546,26 @@ void swbody_labeled_statement_after(syntax_traverser_t* trav, syntax_component_t
     if (swstmt->swstmt_default)
     {
         // ISO: 6.8.4.2 (3)
-        ADD_ERROR_MESSAGE_TO_TRAVERSER(SWBODY_ANALYSIS_TRAVERSER, syn, "multiple default cases are not allowed within a switch statement");
+        ADD_ERROR_MESSAGE_TO_TRAVERSER(CONTEXT_ANALYSIS_TRAVERSER, syn, "multiple default cases are not allowed within a switch statement");
         return;
     }
     swstmt->swstmt_default = syn;
 }
 
+static void context_continue_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    if (!CONTEXT_TRAVERSER->loops)
+        // ISO: 6.8.6.2 (1)
+        ADD_ERROR_MESSAGE_TO_TRAVERSER(CONTEXT_ANALYSIS_TRAVERSER, syn, "continue statements are only allowed within loops");
+}
+
+static void context_break_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    if (!CONTEXT_TRAVERSER->loops && !CONTEXT_TRAVERSER->switches->size)
+        // ISO: 6.8.6.3 (1)
+        ADD_ERROR_MESSAGE_TO_TRAVERSER(CONTEXT_ANALYSIS_TRAVERSER, syn, "break statements are only allowed within loops and switch statements");
+}
+
 void analyze_switch_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
 {
     ADD_WARNING_MESSAGE(syn, "switch statements are not checked for identifiers with variably-modified types, use with your own risk");
@@ -2512,13 +2575,6 @@ void analyze_switch_statement_after(syntax_traverser_t* trav, syntax_component_t
         ADD_ERROR_MESSAGE(syn->swstmt_condition, "controlling expression of a switch statement must be of integer type");
         return;
     }
-    syn->swstmt_cases = vector_init();
-    
-    syntax_traverser_t* swb_trav = traverse_init(syn, sizeof(swbody_traverser_t));
-    ((swbody_traverser_t*) swb_trav)->analysis_traverser = ANALYSIS_TRAVERSER;
-    swb_trav->after[SC_LABELED_STATEMENT] = swbody_labeled_statement_after;
-    traverse(swb_trav);
-    traverse_delete(swb_trav);
 }
 
 void analyze_iteration_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
@@ -2559,31 +2615,9 @@ void analyze_iteration_statement_after(syntax_traverser_t* trav, syntax_componen
         ADD_ERROR_MESSAGE(controlling, "controlling expression of a loop must be of scalar type");
 }
 
-void analyze_continue_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
-{
-    syntax_component_t* loop = syn;
-    for (; loop && loop->type != SC_FOR_STATEMENT && loop->type != SC_WHILE_STATEMENT && loop->type != SC_DO_STATEMENT; loop = loop->parent);
-    if (!loop)
-        // ISO: 6.8.6.2 (1)
-        ADD_ERROR_MESSAGE(syn, "continue statements are only allowed within loops");
-}
-
-void analyze_break_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
-{
-    syntax_component_t* parent = syn;
-    for (; parent &&
-        parent->type != SC_FOR_STATEMENT &&
-        parent->type != SC_WHILE_STATEMENT &&
-        parent->type != SC_DO_STATEMENT &&
-        parent->type != SC_SWITCH_STATEMENT; parent = parent->parent);
-    if (!parent)
-        // ISO: 6.8.6.3 (1)
-        ADD_ERROR_MESSAGE(syn, "break statements are only allowed within loops and switch statements");
-}
-
 void analyze_return_statement_after(syntax_traverser_t* trav, syntax_component_t* syn)
 {
-    syntax_component_t* fdef = syntax_get_function_definition(syn);
+    syntax_component_t* fdef = ANALYSIS_TRAVERSER->context->fdef;
     if (!fdef) assert_fail;
     syntax_component_t* id = syntax_get_declarator_identifier(fdef->fdef_declarator);
     if (!id) assert_fail;
@@ -2600,12 +2634,25 @@ void analyze_return_statement_after(syntax_traverser_t* trav, syntax_component_t
 
 void analyze_init_declarator_after(syntax_traverser_t* trav, syntax_component_t* syn)
 {
-    syntax_component_t* init = syn->ideclr_initializer;
-    if (!init) return;
     syntax_component_t* id = syntax_get_declarator_identifier(syn->ideclr_declarator);
     if (!id) assert_fail;
     symbol_t* sy = symbol_table_get_syn_id(SYMBOL_TABLE, id);
     if (!sy) assert_fail;
+
+    // checked here instead of with the identifier, since array lengths in the declarator aren't typed until now
+    if (syntax_is_tentative_definition(id))
+    {
+        vector_t* declspecs = syntax_get_declspecs(id);
+        if (declspecs && syntax_has_specifier(declspecs, SC_STORAGE_CLASS_SPECIFIER, SCS_STATIC) &&
+            !type_is_complete(sy->type))
+        {
+            // ISO: 6.9.2 (3)
+            ADD_ERROR_MESSAGE(id, "tentative definitions with internal linkage may not have an incomplete type");
+        }
+    }
+
+    syntax_component_t* init = syn->ideclr_initializer;
+    if (!init) return;
     linkage_t lk = symbol_get_linkage(sy);
     syntax_component_t* scope = symbol_get_scope(sy);
     if (!type_is_object_type(sy->type) && (sy->type->class != CTC_ARRAY || type_is_vla(sy->type)))
@@ -2637,12 +2684,9 @@ void analyze_init_declarator_after(syntax_traverser_t* trav, syntax_component_t*
     }
 
     if (init->type == SC_INITIALIZER_LIST)
-        add_initializer_list_semantics(trav, init, sy->type);
+        add_initializer_list_semantics(trav, init, sy->type, 0);
     else
-    {
-        init->initializer_ctype = type_copy(sy->type);
-        init->initializer_offset = 0;
-    }
+        syntax_set_initializer(trav->tlu, init, 0, type_copy(sy->type));
 
     check_initializations(trav, init);
 
@@ -2651,7 +2695,7 @@ void analyze_init_declarator_after(syntax_traverser_t* trav, syntax_component_t*
     storage_duration_t sd = symbol_get_storage_duration(sy);
     if (sd == SD_STATIC)
     {
-        sy->data = calloc(type_size(sy->type), sizeof(uint8_t));
+        sy->image = image_init(type_size(sy->type));
         analyze_static_initializer_after(trav, init, sy, 0);
     }
     else if (sd == SD_AUTOMATIC)
@@ -2668,16 +2712,15 @@ void analyze_array_declarator_length_after(syntax_traverser_t* trav, syntax_comp
         ADD_ERROR_MESSAGE(syn, "array length expression must have an integer type");
         return;
     }
-    constexpr_t* ce = constexpr_evaluate_integer(syn->adeclr_length_expression);
-    if (!constexpr_evaluation_succeeded(ce))
+    constexpr_t ce;
+    constexpr_evaluate_integer(syn->adeclr_length_expression, &ce);
+    if (!constexpr_evaluation_succeeded(&ce))
     {
         ADD_ERROR_MESSAGE(syn, "variable-length arrays are not supported yet");
-        constexpr_delete(ce);
         return;
     }
-    constexpr_convert_class(ce, CTC_LONG_LONG_INT);
-    int64_t value = constexpr_as_i64(ce);
-    constexpr_delete(ce);
+    constexpr_convert_class(&ce, CTC_LONG_LONG_INT);
+    int64_t value = constexpr_as_i64(&ce);
     if (value <= 0)
     {
         ADD_ERROR_MESSAGE(syn, "constant array length must be greater than zero");
@@ -2717,19 +2760,18 @@ void analyze_complete_struct_union_specifier_after(syntax_traverser_t* trav, syn
                     continue;
                 }
 
-                constexpr_t* ce = constexpr_evaluate_integer(sdeclr->sdeclr_bits_expression);
-                if (!constexpr_evaluation_succeeded(ce))
+                constexpr_t ce;
+                constexpr_evaluate_integer(sdeclr->sdeclr_bits_expression, &ce);
+                if (!constexpr_evaluation_succeeded(&ce))
                 {
                     // ISO: 6.7.2.1 (3)
                     ADD_ERROR_MESSAGE(sdeclr->sdeclr_bits_expression, "bitfield width must be an integer constant expression");
-                    constexpr_delete(ce);
                     type_delete(mt);
                     continue;
                 }
 
-                constexpr_convert_class(ce, CTC_LONG_LONG_INT);
-                int64_t width = constexpr_as_i64(ce);
-                constexpr_delete(ce);
+                constexpr_convert_class(&ce, CTC_LONG_LONG_INT);
+                int64_t width = constexpr_as_i64(&ce);
 
                 if (width < 0)
                 {
@@ -2788,7 +2830,7 @@ void analyze_complete_struct_union_specifier_after(syntax_traverser_t* trav, syn
                 else
                     ADD_ERROR_MESSAGE(sdeclr, "incomplete types are not allowed within structs and unions");
             }
-            if (flexible && syntax_get_enclosing(syn->parent, SC_STRUCT_UNION_SPECIFIER))
+            if (flexible && ANALYSIS_TRAVERSER->context->struct_unions > 1)
                 // ISO: 6.7.2.1 (2)
                 ADD_ERROR_MESSAGE(sdeclr, "flexible array members are not permitted at the end of nested structs and unions");
             if (flexible && count == 1)
@@ -2867,6 +2909,20 @@ if referencing, duplicate the type of the declaring identifier.
 
 */
 
+// runs the analysis of an expression and then interns its type, so every expression
+// containing it sees a canonical type and type_is_compatible can mostly compare by identity
+static void intern_expression_type_after(syntax_traverser_t* trav, syntax_component_t* syn)
+{
+    traversal_function analysis = ANALYSIS_TRAVERSER->expression_after[syn->type];
+    if (analysis)
+        analysis(trav, syn);
+    c_type_t* ct = type_canonical(TYPES, syn->ctype);
+    if (ct == syn->ctype)
+        return;
+    type_delete(syn->ctype);
+    syn->ctype = ct;
+}
+
 analysis_error_t* analyze(syntax_component_t* tlu)
 {
     syntax_traverser_t* trav = traverse_init(tlu, sizeof(analysis_syntax_traverser_t));
@@ -2938,13 +2994,10 @@ analysis_error_t* analyze(syntax_component_t* tlu)
 
     // statements
     trav->before[SC_LABELED_STATEMENT] = analyze_labeled_statement_before;
-    trav->after[SC_LABELED_STATEMENT] = analyze_labeled_statement_after;
     trav->after[SC_IF_STATEMENT] = analyze_if_statement_after;
     trav->after[SC_FOR_STATEMENT] = analyze_iteration_statement_after;
     trav->after[SC_DO_STATEMENT] = analyze_iteration_statement_after;
     trav->after[SC_WHILE_STATEMENT] = analyze_iteration_statement_after;
-    trav->after[SC_CONTINUE_STATEMENT] = analyze_continue_statement_after;
-    trav->after[SC_BREAK_STATEMENT] = analyze_break_statement_after;
     trav->after[SC_RETURN_STATEMENT] = analyze_return_statement_after;
     trav->after[SC_SWITCH_STATEMENT] = analyze_switch_statement_after;
 
@@ -2955,8 +3008,57 @@ analysis_error_t* analyze(syntax_component_t* tlu)
     trav->after[SC_FUNCTION_DECLARATOR] = analyze_function_declarator_after;
     trav->after[SC_PARAMETER_DECLARATION] = analyze_parameter_declaration_after;
 
-    traverse(trav);
+    // an #if condition is analyzed on its own, without a translation unit to intern its types in
+    if (tlu->type == SC_TRANSLATION_UNIT)
+    {
+        for (syntax_component_type_t type = 0; type < SC_NO_ELEMENTS; ++type)
+        {
+            if (!syntax_is_expression_type(type))
+                continue;
+            ANALYSIS_TRAVERSER->expression_after[type] = trav->after[type];
+            trav->after[type] = intern_expression_type_after;
+        }
+
+        if (!tlu->tlu_st->types)
+            tlu->tlu_st->types = type_table_init();
+    }
+
+    // the enclosing syntax is tracked by a pass of its own that visits each node right after analysis does,
+    // so analysis of a node sees everything enclosing it, including the node itself
+    syntax_traverser_t* ctrav = traverse_init(tlu, sizeof(context_traverser_t));
+    ((context_traverser_t*) ctrav)->analysis_traverser = ANALYSIS_TRAVERSER;
+    ((context_traverser_t*) ctrav)->switches = vector_init();
+    ((context_traverser_t*) ctrav)->init_declarators = vector_init();
+    ANALYSIS_TRAVERSER->context = (context_traverser_t*) ctrav;
+    ctrav->before[SC_FUNCTION_DEFINITION] = context_function_definition_before;
+    ctrav->after[SC_FUNCTION_DEFINITION] = context_function_definition_after;
+    ctrav->before[SC_INIT_DECLARATOR] = context_init_declarator_before;
+    ctrav->after[SC_INIT_DECLARATOR] = context_init_declarator_after;
+    ctrav->before[SC_STRUCT_UNION_SPECIFIER] = context_struct_union_specifier_before;
+    ctrav->after[SC_STRUCT_UNION_SPECIFIER] = context_struct_union_specifier_after;
+    ctrav->before[SC_SWITCH_STATEMENT] = context_switch_statement_before;
+    ctrav->after[SC_SWITCH_STATEMENT] = context_switch_statement_after;
+    ctrav->before[SC_FOR_STATEMENT] = context_iteration_statement_before;
+    ctrav->after[SC_FOR_STATEMENT] = context_iteration_statement_after;
+    ctrav->before[SC_DO_STATEMENT] = context_iteration_statement_before;
+    ctrav->after[SC_DO_STATEMENT] = context_iteration_statement_after;
+    ctrav->before[SC_WHILE_STATEMENT] = context_iteration_statement_before;
+    ctrav->after[SC_WHILE_STATEMENT] = context_iteration_statement_after;
+    ctrav->after[SC_LABELED_STATEMENT] = context_labeled_statement_after;
+    ctrav->after[SC_CONTINUE_STATEMENT] = context_continue_statement_after;
+    ctrav->after[SC_BREAK_STATEMENT] = context_break_statement_after;
+
+    traversal_schedule_t* ts = traversal_schedule_init(tlu);
+    traversal_schedule_add(ts, trav);
+    traversal_schedule_add(ts, ctrav);
+    traversal_schedule_depend(ts, ctrav, trav, TD_NODE);
+    traversal_schedule_run(ts);
+    traversal_schedule_delete(ts);
+
     analysis_error_t* errors = ANALYSIS_TRAVERSER->errors;
+    vector_delete(((context_traverser_t*) ctrav)->switches);
+    vector_delete(((context_traverser_t*) ctrav)->init_declarators);
+    traverse_delete(ctrav);
     traverse_delete(trav);
     return errors;
 }
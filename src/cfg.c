@@ -0,0 +1,590 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "ecc.h"
+
+/*
+
+control-flow graphs over AIR routines. a routine is cut into basic blocks at its labels and after
+each of its jumps and returns, and the blocks are linked by where control can go next. on top of
+that sit the dominator and post-dominator trees (computed with Cooper, Harvey, and Kennedy's
+"a simple, fast dominance algorithm" over reverse postorder) and the natural loops, found from
+the edges that go back to a block dominating them. a cycle that can be entered other than through
+one block (only possible with goto) is irreducible and is not recognized as a loop.
+
+blocks point into the routine's instruction list instead of owning instructions. instructions
+added or removed inside a block with cfg_block_insert_before/after and cfg_block_remove keep the
+graph valid, since they don't change where control goes. anything that does (adding, removing,
+or retargeting a jump, a return, or a label) needs a cfg_rebuild afterward. removing can leave a
+block empty, so whatever goes by a block's first or last instruction has to skip empty ones.
+
+*/
+
+// labels are told apart by their number and disambiguator together (kept in the low bits, since regid_comparator only looks at the difference as an int)
+#define LABEL_KEY(op) ((void*) (((uint64_t) (op)->content.label.id << 8) | (unsigned char) (op)->content.label.disambiguator))
+
+bool cfg_is_terminator(air_insn_t* insn)
+{
+    if (!insn) return false;
+    switch (insn->type)
+    {
+        case AIR_JMP:
+        case AIR_JZ:
+        case AIR_JNZ:
+        case AIR_RETURN:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static cfg_block_t* cfg_block_init(size_t id)
+{
+    cfg_block_t* block = calloc(1, sizeof *block);
+    block->id = id;
+    block->preds = vector_init();
+    block->succs = vector_init();
+    block->rpo = SIZE_MAX;
+    block->dom_pre = block->dom_post = SIZE_MAX;
+    block->pdom_pre = block->pdom_post = SIZE_MAX;
+    return block;
+}
+
+static void cfg_block_delete(cfg_block_t* block)
+{
+    if (!block) return;
+    vector_delete(block->preds);
+    vector_delete(block->succs);
+    free(block);
+}
+
+static void cfg_loop_delete(cfg_loop_t* loop)
+{
+    if (!loop) return;
+    vector_delete(loop->blocks);
+    vector_delete(loop->latches);
+    free(loop);
+}
+
+// the exit's id is one past the last block's, so every id indexes an array of blocks->size + 1
+static cfg_block_t* block_by_id(cfg_t* cfg, size_t id)
+{
+    return id == cfg->blocks->size ? cfg->exit : vector_get(cfg->blocks, id);
+}
+
+static void add_edge(cfg_block_t* from, cfg_block_t* to)
+{
+    VECTOR_FOR(cfg_block_t*, succ, from->succs)
+    {
+        if (succ == to)
+            return;
+    }
+    vector_add(from->succs, to);
+    vector_add(to->preds, from);
+}
+
+static void find_blocks(cfg_t* cfg)
+{
+    cfg_block_t* block = NULL;
+    for (air_insn_t* insn = cfg->routine->insns; insn; insn = insn->next)
+    {
+        if (!block || insn->type == AIR_LABEL || cfg_is_terminator(block->last))
+        {
+            block = cfg_block_init(cfg->blocks->size);
+            block->first = insn;
+            vector_add(cfg->blocks, block);
+        }
+        block->last = insn;
+    }
+    // a routine with no code at all still has somewhere to start
+    if (!cfg->blocks->size)
+        vector_add(cfg->blocks, cfg_block_init(0));
+    cfg->exit = cfg_block_init(cfg->blocks->size);
+}
+
+static void link_blocks(cfg_t* cfg)
+{
+    map_t* labels = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+    VECTOR_FOR(cfg_block_t*, labeled, cfg->blocks)
+    {
+        if (labeled->first && labeled->first->type == AIR_LABEL)
+            map_add(labels, LABEL_KEY(labeled->first->ops[0]), labeled);
+    }
+    VECTOR_FOR(cfg_block_t*, block, cfg->blocks)
+    {
+        cfg_block_t* next = i + 1 < cfg->blocks->size ? vector_get(cfg->blocks, i + 1) : cfg->exit;
+        air_insn_t* last = block->last;
+        cfg_block_t* target = NULL;
+        switch (last ? last->type : AIR_NOP)
+        {
+            case AIR_RETURN:
+                add_edge(block, cfg->exit);
+                break;
+            case AIR_JMP:
+                target = map_get(labels, LABEL_KEY(last->ops[0]));
+                assert(target);
+                add_edge(block, target);
+                break;
+            case AIR_JZ:
+            case AIR_JNZ:
+                target = map_get(labels, LABEL_KEY(last->ops[0]));
+                assert(target);
+                add_edge(block, next);
+                add_edge(block, target);
+                break;
+            default:
+                add_edge(block, next);
+                break;
+        }
+    }
+    map_delete(labels);
+}
+
+/*
+
+depth-first walk from start (over predecessors instead of successors if reverse is set), writing
+the blocks it reaches to order in postorder. returns how many it reached.
+
+*/
+static size_t postorder(cfg_t* cfg, cfg_block_t* start, bool reverse, cfg_block_t** order)
+{
+    size_t count = cfg->blocks->size + 1;
+    // blocks being walked, along with how many of their edges have been followed so far
+    cfg_block_t** stack = malloc(count * sizeof *stack);
+    size_t* followed = calloc(count, sizeof *followed);
+    bool* seen = calloc(count, sizeof *seen);
+    size_t top = 0, reached = 0;
+    stack[top++] = start;
+    seen[start->id] = true;
+    while (top)
+    {
+        cfg_block_t* block = stack[top - 1];
+        vector_t* edges = reverse ? block->preds : block->succs;
+        if (followed[block->id] < edges->size)
+        {
+            cfg_block_t* next = vector_get(edges, followed[block->id]++);
+            if (!seen[next->id])
+            {
+                seen[next->id] = true;
+                stack[top++] = next;
+            }
+            continue;
+        }
+        order[reached++] = block;
+        --top;
+    }
+    free(stack);
+    free(followed);
+    free(seen);
+    return reached;
+}
+
+static void order_blocks(cfg_t* cfg)
+{
+    cfg_block_t** order = malloc((cfg->blocks->size + 1) * sizeof *order);
+    size_t reached = postorder(cfg, vector_get(cfg->blocks, 0), false, order);
+    for (size_t j = reached; j-- > 0;)
+    {
+        order[j]->rpo = cfg->rpo->size;
+        vector_add(cfg->rpo, order[j]);
+    }
+    free(order);
+}
+
+// walks both blocks up the (partially built) tree until they meet, going by postorder number
+static cfg_block_t* intersect(cfg_block_t* b1, cfg_block_t* b2, cfg_block_t** idom, size_t* number)
+{
+    while (b1 != b2)
+    {
+        while (number[b1->id] < number[b2->id])
+            b1 = idom[b1->id];
+        while (number[b2->id] < number[b1->id])
+            b2 = idom[b2->id];
+    }
+    return b1;
+}
+
+// gives every block in the tree its preorder and postorder number, without recursing
+static void number_tree(cfg_t* cfg, cfg_block_t* root, cfg_block_t** idom, bool post)
+{
+    size_t count = cfg->blocks->size + 1;
+    vector_t** children = calloc(count, sizeof *children);
+    for (size_t id = 0; id < count; ++id)
+    {
+        cfg_block_t* parent = idom[id];
+        if (!parent || id == root->id) continue;
+        if (!children[parent->id])
+            children[parent->id] = vector_init();
+        vector_add(children[parent->id], block_by_id(cfg, id));
+    }
+    cfg_block_t** stack = malloc(count * sizeof *stack);
+    size_t* visited = calloc(count, sizeof *visited);
+    size_t top = 0, tick = 0;
+    stack[top++] = root;
+    *(post ? &root->pdom_pre : &root->dom_pre) = tick++;
+    while (top)
+    {
+        cfg_block_t* block = stack[top - 1];
+        vector_t* kids = children[block->id];
+        if (kids && visited[block->id] < kids->size)
+        {
+            cfg_block_t* child = vector_get(kids, visited[block->id]++);
+            *(post ? &child->pdom_pre : &child->dom_pre) = tick++;
+            stack[top++] = child;
+            continue;
+        }
+        *(post ? &block->pdom_post : &block->dom_post) = tick++;
+        --top;
+    }
+    for (size_t id = 0; id < count; ++id)
+        vector_delete(children[id]);
+    free(children);
+    free(stack);
+    free(visited);
+}
+
+/*
+
+finds the immediate dominator of every block reachable from the entry or, if post is set, the
+immediate post-dominator of every block that reaches the exit (which is the same thing on the
+graph with its edges reversed, rooted at the exit).
+
+*/
+static void find_dominators(cfg_t* cfg, bool post)
+{
+    size_t count = cfg->blocks->size + 1;
+    cfg_block_t** order = malloc(count * sizeof *order);
+    size_t reached = postorder(cfg, post ? cfg->exit : vector_get(cfg->blocks, 0), post, order);
+    size_t* number = malloc(count * sizeof *number);
+    for (size_t j = 0; j < reached; ++j)
+        number[order[j]->id] = j;
+    cfg_block_t** idom = calloc(count, sizeof *idom);
+    cfg_block_t* root = order[reached - 1];
+    idom[root->id] = root;
+    for (bool changed = true; changed;)
+    {
+        changed = false;
+        // everything but the root, in reverse postorder
+        for (size_t j = reached - 1; j-- > 0;)
+        {
+            cfg_block_t* block = order[j];
+            cfg_block_t* dom = NULL;
+            VECTOR_FOR(cfg_block_t*, pred, post ? block->succs : block->preds)
+            {
+                // not processed yet (or never reached at all)
+                if (!idom[pred->id]) continue;
+                dom = dom ? intersect(pred, dom, idom, number) : pred;
+            }
+            if (idom[block->id] != dom)
+            {
+                idom[block->id] = dom;
+                changed = true;
+            }
+        }
+    }
+    number_tree(cfg, root, idom, post);
+    idom[root->id] = NULL;
+    for (size_t id = 0; id < count; ++id)
+        *(post ? &block_by_id(cfg, id)->ipdom : &block_by_id(cfg, id)->idom) = idom[id];
+    free(order);
+    free(number);
+    free(idom);
+}
+
+static void find_loops(cfg_t* cfg)
+{
+    size_t count = cfg->blocks->size + 1;
+    // which loop (counting from one) last took each block in
+    size_t* taken = calloc(count, sizeof *taken);
+    cfg_block_t** worklist = malloc(count * sizeof *worklist);
+    // headers come in reverse postorder, so a loop is always found before the ones nested in it
+    VECTOR_FOR(cfg_block_t*, header, cfg->rpo)
+    {
+        cfg_loop_t* loop = NULL;
+        VECTOR_FOR(cfg_block_t*, pred, header->preds)
+        {
+            if (!cfg_dominates(header, pred)) continue;
+            if (!loop)
+            {
+                loop = calloc(1, sizeof *loop);
+                loop->header = header;
+                loop->blocks = vector_init();
+                loop->latches = vector_init();
+            }
+            vector_add(loop->latches, pred);
+        }
+        if (!loop) continue;
+
+        // the body is everything that reaches a latch going backward without passing the header
+        size_t stamp = cfg->loops->size + 1;
+        size_t top = 0;
+        taken[header->id] = stamp;
+        vector_add(loop->blocks, header);
+        VECTOR_FOR(cfg_block_t*, latch, loop->latches)
+        {
+            if (taken[latch->id] == stamp) continue;
+            taken[latch->id] = stamp;
+            vector_add(loop->blocks, latch);
+            worklist[top++] = latch;
+        }
+        while (top)
+        {
+            cfg_block_t* block = worklist[--top];
+            VECTOR_FOR(cfg_block_t*, pred, block->preds)
+            {
+                if (pred->rpo == SIZE_MAX || taken[pred->id] == stamp) continue;
+                taken[pred->id] = stamp;
+                vector_add(loop->blocks, pred);
+                worklist[top++] = pred;
+            }
+        }
+
+        // whatever loop the header was in so far is the innermost one around this one
+        loop->parent = header->loop;
+        loop->depth = loop->parent ? loop->parent->depth + 1 : 1;
+        VECTOR_FOR(cfg_block_t*, block, loop->blocks)
+        {
+            block->loop = loop;
+            if (!loop->bottom || block->id > loop->bottom->id)
+                loop->bottom = block;
+        }
+        vector_add(cfg->loops, loop);
+    }
+    free(taken);
+    free(worklist);
+}
+
+static void cfg_build(cfg_t* cfg)
+{
+    cfg->blocks = vector_init();
+    cfg->rpo = vector_init();
+    cfg->loops = vector_init();
+    find_blocks(cfg);
+    link_blocks(cfg);
+    order_blocks(cfg);
+    find_dominators(cfg, false);
+    find_dominators(cfg, true);
+    find_loops(cfg);
+}
+
+static void cfg_clear(cfg_t* cfg)
+{
+    vector_deep_delete(cfg->blocks, (deleter_t) cfg_block_delete);
+    vector_deep_delete(cfg->loops, (deleter_t) cfg_loop_delete);
+    vector_delete(cfg->rpo);
+    cfg_block_delete(cfg->exit);
+    cfg->blocks = cfg->rpo = cfg->loops = NULL;
+    cfg->exit = NULL;
+}
+
+cfg_t* cfg_init(air_routine_t* routine)
+{
+    cfg_t* cfg = calloc(1, sizeof *cfg);
+    cfg->routine = routine;
+    cfg_build(cfg);
+    return cfg;
+}
+
+// starts over from the routine's instructions, for after control flow has changed
+void cfg_rebuild(cfg_t* cfg)
+{
+    cfg_clear(cfg);
+    cfg_build(cfg);
+}
+
+void cfg_delete(cfg_t* cfg)
+{
+    if (!cfg) return;
+    cfg_clear(cfg);
+    free(cfg);
+}
+
+// whether every path from the entry to b2 goes through b1 (a block dominates itself)
+bool cfg_dominates(cfg_block_t* b1, cfg_block_t* b2)
+{
+    if (b1->dom_pre == SIZE_MAX || b2->dom_pre == SIZE_MAX)
+        return false;
+    return b1->dom_pre <= b2->dom_pre && b2->dom_post <= b1->dom_post;
+}
+
+// whether every path from b2 to the exit goes through b1 (a block post-dominates itself)
+bool cfg_post_dominates(cfg_block_t* b1, cfg_block_t* b2)
+{
+    if (b1->pdom_pre == SIZE_MAX || b2->pdom_pre == SIZE_MAX)
+        return false;
+    return b1->pdom_pre <= b2->pdom_pre && b2->pdom_post <= b1->pdom_post;
+}
+
+// the block holding insn, found by its place in the routine (so the routine has to be indexed)
+cfg_block_t* cfg_find_block(cfg_t* cfg, air_insn_t* insn)
+{
+    assert(insn->defuse);
+    size_t lo = 0, hi = cfg->blocks->size;
+    while (hi - lo > 1)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+
+        // empty blocks have no place of their own, so go by the next one that isn't
+        size_t probe = mid;
+        cfg_block_t* block = NULL;
+        for (; probe < hi && !(block = vector_get(cfg->blocks, probe))->first; ++probe);
+        if (probe == hi)
+            hi = mid;
+        else if (block->first->order <= insn->order)
+            lo = probe;
+        else
+            hi = mid;
+    }
+    cfg_block_t* found = vector_get(cfg->blocks, lo);
+    assert(found->first && found->first->order <= insn->order);
+    return found;
+}
+
+// the last instruction in a loop's blocks
+air_insn_t* cfg_loop_last(cfg_t* cfg, cfg_loop_t* loop)
+{
+    // an empty bottom ends where the closest block before it with anything in it does
+    air_insn_t* last = NULL;
+    for (size_t id = loop->bottom->id + 1; !last && id--;)
+        last = ((cfg_block_t*) vector_get(cfg->blocks, id))->last;
+    return last;
+}
+
+/*
+
+the last instruction a temporary defined by def and used by use has to be kept through. that's use
+itself, unless use is in a loop def is outside of, in which case the value has to last the whole
+loop (it's needed again the next time around), so it's the bottom of the outermost such loop.
+
+*/
+air_insn_t* cfg_live_until(cfg_t* cfg, air_insn_t* def, air_insn_t* use)
+{
+    cfg_block_t* block = cfg_find_block(cfg, use);
+    if (!block->loop)
+        return use;
+    cfg_block_t* home = cfg_find_block(cfg, def);
+    air_insn_t* last = use;
+    for (cfg_loop_t* loop = block->loop; loop && !cfg_loop_contains(loop, home); loop = loop->parent)
+    {
+        air_insn_t* bottom = cfg_loop_last(cfg, loop);
+        if (bottom && bottom->order > last->order)
+            last = bottom;
+    }
+    return last;
+}
+
+bool cfg_loop_contains(cfg_loop_t* loop, cfg_block_t* block)
+{
+    for (cfg_loop_t* l = block->loop; l; l = l->parent)
+    {
+        if (l == loop)
+            return true;
+    }
+    return false;
+}
+
+/*
+
+the three functions below edit the instructions of a block without invalidating the graph. none of
+them deal in instructions that transfer control, nothing goes in front of a label (jumps to it
+would skip over it), and the routine's first instruction stays where it is.
+
+*/
+
+// inserts insn before inserting, which is in block
+air_insn_t* cfg_block_insert_before(cfg_block_t* block, air_insn_t* insn, air_insn_t* inserting)
+{
+    assert(inserting->prev && inserting->type != AIR_LABEL);
+    assert(insn->type != AIR_LABEL && !cfg_is_terminator(insn));
+    air_insn_insert_before(insn, inserting);
+    if (block->first == inserting)
+        block->first = insn;
+    return insn;
+}
+
+// inserts insn after inserting, which is in block
+air_insn_t* cfg_block_insert_after(cfg_block_t* block, air_insn_t* insn, air_insn_t* inserting)
+{
+    assert(!cfg_is_terminator(inserting));
+    assert(insn->type != AIR_LABEL && !cfg_is_terminator(insn));
+    air_insn_insert_after(insn, inserting);
+    if (block->last == inserting)
+        block->last = insn;
+    return insn;
+}
+
+// removes insn from block and deletes it, returning the instruction before it. if insn was all the
+// block had, the block is left empty but stays in the graph, with the same edges
+air_insn_t* cfg_block_remove(cfg_block_t* block, air_insn_t* insn)
+{
+    assert(insn->prev && insn->type != AIR_LABEL && !cfg_is_terminator(insn));
+    if (block->first == insn && block->last == insn)
+        block->first = block->last = NULL;
+    else if (block->first == insn)
+        block->first = insn->next;
+    else if (block->last == insn)
+        block->last = insn->prev;
+    return air_insn_remove(insn);
+}
+
+static void print_block_name(cfg_t* cfg, cfg_block_t* block, int (*printer)(const char* fmt, ...))
+{
+    if (block == cfg->exit)
+        printer("exit");
+    else
+        printer("%zu", block->id);
+}
+
+static void print_block_list(cfg_t* cfg, vector_t* blocks, int (*printer)(const char* fmt, ...))
+{
+    printer("[");
+    VECTOR_FOR(cfg_block_t*, block, blocks)
+    {
+        if (i) printer(", ");
+        print_block_name(cfg, block, printer);
+    }
+    printer("]");
+}
+
+void cfg_print(cfg_t* cfg, air_t* air, int (*printer)(const char* fmt, ...))
+{
+    printer("%s:\n", symbol_get_name(cfg->routine->sy));
+    VECTOR_FOR(cfg_block_t*, block, cfg->blocks)
+    {
+        printer("block %zu%s: preds ", block->id, block->rpo == SIZE_MAX ? " (unreachable)" : "");
+        print_block_list(cfg, block->preds, printer);
+        printer(", succs ");
+        print_block_list(cfg, block->succs, printer);
+        if (block->idom)
+        {
+            printer(", idom ");
+            print_block_name(cfg, block->idom, printer);
+        }
+        if (block->ipdom)
+        {
+            printer(", ipdom ");
+            print_block_name(cfg, block->ipdom, printer);
+        }
+        if (block->loop)
+            printer(", loop depth %zu", block->loop->depth);
+        printer("\n");
+        CFG_BLOCK_FOR(insn, block)
+        {
+            if (insn->type == AIR_NOP) continue;
+            printer("    ");
+            air_insn_print(insn, air, printer);
+            printer("\n");
+        }
+    }
+    printer("exit: preds ");
+    print_block_list(cfg, cfg->exit->preds, printer);
+    printer("\n");
+    VECTOR_FOR(cfg_loop_t*, loop, cfg->loops)
+    {
+        printer("loop at block %zu (depth %zu): blocks ", loop->header->id, loop->depth);
+        print_block_list(cfg, loop->blocks, printer);
+        printer(", latches ");
+        print_block_list(cfg, loop->latches, printer);
+        printer("\n");
+    }
+}
@@ -4,51 +4,7 @@
 #include "ecc.h"
 
 #define SYMBOL_TABLE (syntax_get_translation_unit(expr)->tlu_st)
-#define SET_ERROR(syn, fmt, ...) (free(ce->error), ce->error = NULL, ce->error = malloc(MAX_ERROR_LENGTH), ce->err_row = (syn)->row, ce->err_col = (syn)->col, snprintf(ce->error, MAX_ERROR_LENGTH, fmt, __VA_ARGS__))
-#define SET_ERROR_MESSAGE(syn, fmt) (free(ce->error), ce->error = NULL, ce->error = malloc(MAX_ERROR_LENGTH), ce->err_row = (syn)->row, ce->err_col = (syn)->col, snprintf(ce->error, MAX_ERROR_LENGTH, fmt))
-
-void constexpr_delete(constexpr_t* ce)
-{
-    if (!ce) return;
-    type_delete(ce->ct);
-    switch (ce->type)
-    {
-        case CE_ADDRESS:
-            break;
-        case CE_ARITHMETIC:
-        case CE_INTEGER:
-            free(ce->content.data);
-            break;
-    }
-    free(ce->error);
-    free(ce);
-}
-
-constexpr_t* constexpr_copy(constexpr_t* ce)
-{
-    constexpr_t* n = calloc(1, sizeof *n);
-    n->type = ce->type;
-    n->ct = type_copy(ce->ct);
-    if (ce->error)
-    {
-        n->error = strdup(ce->error);
-        n->err_row = ce->err_row;
-        n->err_col = ce->err_col;
-    }
-    switch (n->type)
-    {
-        case CE_INTEGER:
-        case CE_ARITHMETIC:
-            memcpy(n->content.data, ce->content.data, type_size(n->ct));
-            break;
-        case CE_ADDRESS:
-            n->content.addr.sy = ce->content.addr.sy;
-            n->content.addr.negative_offset = ce->content.addr.negative_offset;
-            n->content.addr.offset = ce->content.addr.offset;
-            break;
-    }
-    return n;
-}
+#define SET_ERROR_MESSAGE(syn, msg) (ce->error = (msg), ce->err_row = (syn)->row, ce->err_col = (syn)->col)
 
 #define data_as(data, type) (*((type*) (data)))
 #define to_data(obj) ((uint8_t*) &(obj))
@@ -139,31 +95,18 @@ void constexpr_print_value(constexpr_t* ce, int (*printer)(const char*, ...))
     }
 }
 
-static void copy_typed_data(constexpr_t* ce, c_type_t* ct, uint8_t* data)
+static void set_value(constexpr_t* ce, c_type_class_t class, void* data)
 {
-    if (ce->ct) type_delete(ce->ct);
-    ce->ct = ct;
-    int64_t size = type_size(ct);
-    if (ce->content.data)
-        ce->content.data = realloc(ce->content.data, size);
-    else
-        ce->content.data = malloc(size);
-    memcpy(ce->content.data, data, size);
+    ce->ct = type_basic(class);
+    memcpy(ce->content.data, data, type_size(ce->ct));
 }
 
 static bool constexpr_move(constexpr_t* dest, constexpr_t* src)
 {
     if (src->type != dest->type)
         return false;
-    if (src->type == CE_ADDRESS)
-    {
-        dest->ct = type_copy(src->ct);
-        dest->content.addr.sy = src->content.addr.sy;
-        dest->content.addr.negative_offset = src->content.addr.negative_offset;
-        dest->content.addr.offset = src->content.addr.offset;
-        return true;
-    }
-    copy_typed_data(dest, type_copy(src->ct), src->content.data);
+    dest->ct = src->ct;
+    dest->content = src->content;
     return true;
 }
 
@@ -171,7 +114,7 @@ static bool constexpr_move(constexpr_t* dest, constexpr_t* src)
     if (from->class == (c1) && to->class == (c2)) \
     { \
         t2 value = (t2) data_as(ce->content.data, t1); \
-        copy_typed_data(ce, type_copy(to), to_data(value)); \
+        set_value(ce, to->class, to_data(value)); \
         return; \
     }
 
@@ -182,6 +125,14 @@ void constexpr_convert(constexpr_t* ce, c_type_t* to)
     if (type_is_compatible(from, to))
         return;
 
+    // ISO: 6.3.1.2 (1)
+    if (to->class == CTC_BOOL && type_is_arithmetic(from))
+    {
+        unsigned char value = !constexpr_equals_zero(ce);
+        set_value(ce, to->class, to_data(value));
+        return;
+    }
+
     /* signed integer -> larger integer */
     
     // char -> larger integer
@@ -526,27 +477,43 @@ generate_constexpr_representable_function(multiplication, multiplication_represe
 
 void constexpr_convert_class(constexpr_t* ce, c_type_class_t class)
 {
-    c_type_t* ct = make_basic_type(class);
-    constexpr_convert(ce, ct);
-    type_delete(ct);
+    constexpr_convert(ce, type_basic(class));
 }
 
-static constexpr_t* constexpr_evaluate_type(syntax_component_t* expr, constexpr_type_t type);
+static void constexpr_evaluate_type(syntax_component_t* expr, constexpr_type_t type, constexpr_t* ce);
 static void evaluate(syntax_component_t* expr, constexpr_t* ce);
 
+// takes on the reason another evaluation failed
+static void take_error(constexpr_t* ce, constexpr_t* failed)
+{
+    ce->error = failed->error;
+    ce->err_row = failed->err_row;
+    ce->err_col = failed->err_col;
+}
+
+// evaluates an operand of an expression as the same kind of constant expression, failing the expression with it if it can't be evaluated
+static bool evaluate_operand(syntax_component_t* expr, constexpr_t* ce, constexpr_t* operand)
+{
+    constexpr_evaluate_type(expr, ce->type, operand);
+    if (constexpr_evaluation_succeeded(operand))
+        return true;
+    take_error(ce, operand);
+    return false;
+}
+
 #define unop_switch_case(rt, t, c, op) \
     case c: \
     { \
-        t value = op data_as(operand->content.data, t); \
-        copy_typed_data(ce, type_copy(rt), to_data(value)); \
+        t value = op data_as(operand.content.data, t); \
+        set_value(ce, (rt)->class, to_data(value)); \
         break; \
     }
 
 #define binop_switch_case(rt, t, c, op) \
     case c: \
     { \
-        t value = data_as(lhs->content.data, t) op data_as(rhs->content.data, t); \
-        copy_typed_data(ce, type_copy(rt), to_data(value)); \
+        t value = data_as(lhs.content.data, t) op data_as(rhs.content.data, t); \
+        set_value(ce, (rt)->class, to_data(value)); \
         break; \
     }
 
@@ -587,18 +554,28 @@ static void evaluate(syntax_component_t* expr, constexpr_t* ce);
         default: assert_fail; \
     }
 
+#define as_switch_case(rt, t, c, ty) \
+    case c: \
+        return (ty) data_as(ce->content.data, t);
+
+// values are only as wide as their own type, so they're read as that before being converted
 #define generate_constexpr_as_function(name, ty) \
     ty constexpr_as_##name(constexpr_t* ce) \
     { \
         if (ce->type == CE_ADDRESS) \
             return 0; \
-        return data_as(ce->content.data, ty); \
+        if (ce->ct->class == CTC_BOOL) \
+            return data_as(ce->content.data, bool); \
+        arithmetic_operation_switch(ce->ct, ty, as_switch_case) \
+        return 0; \
     }
 
 generate_constexpr_as_function(i64, int64_t)
 generate_constexpr_as_function(u64, uint64_t)
 generate_constexpr_as_function(i32, int32_t)
 
+#undef as_switch_case
+
 bool constexpr_equals_zero(constexpr_t* ce)
 {
     if (ce->type == CE_ADDRESS)
@@ -622,28 +599,6 @@ bool constexpr_equals_zero(constexpr_t* ce)
     return true;
 }
 
-bool constexpr_equals(constexpr_t* ce1, constexpr_t* ce2)
-{
-    c_type_t* rt = usual_arithmetic_conversions_result_type(ce1->ct, ce2->ct);
-
-    constexpr_t* lhs = constexpr_copy(ce1);
-    constexpr_t* rhs = constexpr_copy(ce2);
-    constexpr_t* ce = calloc(1, sizeof *ce);
-    ce->type = ce1->type;
-
-    constexpr_convert(lhs, rt);
-    constexpr_convert(rhs, rt);
-
-    arithmetic_operation_switch(rt, ==, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
-    type_delete(rt);
-    bool zero = constexpr_equals_zero(ce);
-    constexpr_delete(ce);
-    return !zero;
-}
-
 void evaluate_plus_expression(syntax_component_t* expr, constexpr_t* ce)
 {
     if (ce->type == CE_ADDRESS)
@@ -652,20 +607,13 @@ void evaluate_plus_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* operand = constexpr_evaluate_type(expr->uexpr_operand, ce->type);
-    if (!constexpr_evaluation_succeeded(operand))
-    {
-        ce->error = operand->error;
-        operand->error = NULL;
-        constexpr_delete(operand);
+    constexpr_t operand;
+    if (!evaluate_operand(expr->uexpr_operand, ce, &operand))
         return;
-    }
 
-    constexpr_convert(operand, expr->ctype);
+    constexpr_convert(&operand, expr->ctype);
 
     arithmetic_operation_switch(expr->ctype, +, unop_switch_case);
-
-    constexpr_delete(operand);
 }
 
 void evaluate_minus_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -676,20 +624,13 @@ void evaluate_minus_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* operand = constexpr_evaluate_type(expr->uexpr_operand, ce->type);
-    if (!constexpr_evaluation_succeeded(operand))
-    {
-        ce->error = operand->error;
-        operand->error = NULL;
-        constexpr_delete(operand);
+    constexpr_t operand;
+    if (!evaluate_operand(expr->uexpr_operand, ce, &operand))
         return;
-    }
 
-    constexpr_convert(operand, expr->ctype);
+    constexpr_convert(&operand, expr->ctype);
 
     arithmetic_operation_switch(expr->ctype, -, unop_switch_case);
-
-    constexpr_delete(operand);
 }
 
 void evaluate_addition_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -700,35 +641,18 @@ void evaluate_addition_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
-
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
 
     if (type_is_arithmetic(expr->bexpr_lhs->ctype) && type_is_arithmetic(expr->bexpr_rhs->ctype))
     {
-        constexpr_convert(lhs, expr->ctype);
-        constexpr_convert(rhs, expr->ctype);
+        constexpr_convert(&lhs, expr->ctype);
+        constexpr_convert(&rhs, expr->ctype);
 
-        if (!constexpr_addition_representable(lhs, rhs, expr->ctype))
+        if (!constexpr_addition_representable(&lhs, &rhs, expr->ctype))
         {
             SET_ERROR_MESSAGE(expr, "addition in constant expression does not fit within its size");
-            constexpr_delete(lhs);
-            constexpr_delete(rhs);
             return;
         }
 
@@ -737,9 +661,6 @@ void evaluate_addition_expression(syntax_component_t* expr, constexpr_t* ce)
     else
         // TODO: handle ptr arithmetic
         assert_fail;
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_subtraction_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -750,35 +671,18 @@ void evaluate_subtraction_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
-
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
 
     if (type_is_arithmetic(expr->bexpr_lhs->ctype) && type_is_arithmetic(expr->bexpr_rhs->ctype))
     {
-        constexpr_convert(lhs, expr->ctype);
-        constexpr_convert(rhs, expr->ctype);
+        constexpr_convert(&lhs, expr->ctype);
+        constexpr_convert(&rhs, expr->ctype);
 
-        if (!constexpr_subtraction_representable(lhs, rhs, expr->ctype))
+        if (!constexpr_subtraction_representable(&lhs, &rhs, expr->ctype))
         {
             SET_ERROR_MESSAGE(expr, "subtraction in constant expression does not fit within its size");
-            constexpr_delete(lhs);
-            constexpr_delete(rhs);
             return;
         }
 
@@ -787,9 +691,6 @@ void evaluate_subtraction_expression(syntax_component_t* expr, constexpr_t* ce)
     else
         // TODO: handle ptr arithmetic
         assert_fail;
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_multiplication_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -800,40 +701,20 @@ void evaluate_multiplication_expression(syntax_component_t* expr, constexpr_t* c
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
 
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
-
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
-    if (!constexpr_multiplication_representable(lhs, rhs, expr->ctype))
+    if (!constexpr_multiplication_representable(&lhs, &rhs, expr->ctype))
     {
         SET_ERROR_MESSAGE(expr, "multiplication in constant expression does not fit within its size");
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
         return;
     }
 
     arithmetic_operation_switch(expr->ctype, *, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_division_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -844,32 +725,14 @@ void evaluate_division_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
 
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
-
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     arithmetic_operation_switch(expr->ctype, /, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_modular_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -880,32 +743,14 @@ void evaluate_modular_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
 
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
-
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     integer_operation_switch(expr->ctype, %, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_complement_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -916,20 +761,13 @@ void evaluate_complement_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* operand = constexpr_evaluate_type(expr->uexpr_operand, ce->type);
-    if (!constexpr_evaluation_succeeded(operand))
-    {
-        ce->error = operand->error;
-        operand->error = NULL;
-        constexpr_delete(operand);
+    constexpr_t operand;
+    if (!evaluate_operand(expr->uexpr_operand, ce, &operand))
         return;
-    }
 
-    constexpr_convert(operand, expr->ctype);
+    constexpr_convert(&operand, expr->ctype);
 
     integer_operation_switch(expr->ctype, ~, unop_switch_case);
-
-    constexpr_delete(operand);
 }
 
 void evaluate_bitwise_and_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -940,32 +778,14 @@ void evaluate_bitwise_and_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
-        return;
-    }
-
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
 
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     integer_operation_switch(expr->ctype, &, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_bitwise_or_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -976,32 +796,14 @@ void evaluate_bitwise_or_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
 
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
-
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     integer_operation_switch(expr->ctype, |, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_bitwise_xor_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1012,32 +814,14 @@ void evaluate_bitwise_xor_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
 
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
-
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     integer_operation_switch(expr->ctype, ^, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_bitwise_left_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1048,32 +832,14 @@ void evaluate_bitwise_left_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
-        return;
-    }
-
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
 
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     integer_operation_switch(expr->ctype, <<, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_bitwise_right_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1084,32 +850,14 @@ void evaluate_bitwise_right_expression(syntax_component_t* expr, constexpr_t* ce
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
-        return;
-    }
-
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
 
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     integer_operation_switch(expr->ctype, >>, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_not_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1120,20 +868,13 @@ void evaluate_not_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* operand = constexpr_evaluate_type(expr->uexpr_operand, ce->type);
-    if (!constexpr_evaluation_succeeded(operand))
-    {
-        ce->error = operand->error;
-        operand->error = NULL;
-        constexpr_delete(operand);
+    constexpr_t operand;
+    if (!evaluate_operand(expr->uexpr_operand, ce, &operand))
         return;
-    }
 
-    constexpr_convert(operand, expr->ctype);
+    constexpr_convert(&operand, expr->ctype);
 
     arithmetic_operation_switch(expr->ctype, !, unop_switch_case);
-
-    constexpr_delete(operand);
 }
 
 void evaluate_logical_and_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1144,39 +885,27 @@ void evaluate_logical_and_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs))
         return;
-    }
 
-    bool zero = constexpr_equals_zero(lhs);
-    constexpr_delete(lhs);
+    bool zero = constexpr_equals_zero(&lhs);
 
     if (zero)
     {
         int value = 0;
-        copy_typed_data(ce, make_basic_type(CTC_INT), to_data(value));
+        set_value(ce, CTC_INT, to_data(value));
         return;
     }
 
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(rhs);
+    constexpr_t rhs;
+    if (!evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
 
-    zero = constexpr_equals_zero(rhs);
-    constexpr_delete(rhs);
+    zero = constexpr_equals_zero(&rhs);
 
     int value = zero ? 0 : 1;
-    copy_typed_data(ce, make_basic_type(CTC_INT), to_data(value));
+    set_value(ce, CTC_INT, to_data(value));
 }
 
 void evaluate_logical_or_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1187,39 +916,27 @@ void evaluate_logical_or_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs))
         return;
-    }
 
-    bool zero = constexpr_equals_zero(lhs);
-    constexpr_delete(lhs);
+    bool zero = constexpr_equals_zero(&lhs);
 
     if (!zero)
     {
         int value = 1;
-        copy_typed_data(ce, make_basic_type(CTC_INT), to_data(value));
+        set_value(ce, CTC_INT, to_data(value));
         return;
     }
 
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(rhs);
+    constexpr_t rhs;
+    if (!evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
 
-    zero = constexpr_equals_zero(rhs);
-    constexpr_delete(rhs);
+    zero = constexpr_equals_zero(&rhs);
 
     int value = zero ? 0 : 1;
-    copy_typed_data(ce, make_basic_type(CTC_INT), to_data(value));
+    set_value(ce, CTC_INT, to_data(value));
 }
 
 void evaluate_equality_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1230,32 +947,14 @@ void evaluate_equality_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
-
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
 
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     arithmetic_operation_switch(expr->ctype, ==, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_inequality_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1266,32 +965,14 @@ void evaluate_inequality_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
-
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
 
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     arithmetic_operation_switch(expr->ctype, !=, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_less_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1302,32 +983,14 @@ void evaluate_less_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
-
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
 
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     arithmetic_operation_switch(expr->ctype, <, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_less_equal_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1338,32 +1001,14 @@ void evaluate_less_equal_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
-
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
 
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     arithmetic_operation_switch(expr->ctype, <=, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_greater_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1374,32 +1019,14 @@ void evaluate_greater_expression(syntax_component_t* expr, constexpr_t* ce)
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
-
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
 
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     arithmetic_operation_switch(expr->ctype, >, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_greater_equal_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1410,32 +1037,14 @@ void evaluate_greater_equal_expression(syntax_component_t* expr, constexpr_t* ce
         return;
     }
 
-    constexpr_t* lhs = constexpr_evaluate_type(expr->bexpr_lhs, ce->type);
-    if (!constexpr_evaluation_succeeded(lhs))
-    {
-        ce->error = lhs->error;
-        lhs->error = NULL;
-        constexpr_delete(lhs);
+    constexpr_t lhs, rhs;
+    if (!evaluate_operand(expr->bexpr_lhs, ce, &lhs) || !evaluate_operand(expr->bexpr_rhs, ce, &rhs))
         return;
-    }
-
-    constexpr_t* rhs = constexpr_evaluate_type(expr->bexpr_rhs, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(lhs);
-        constexpr_delete(rhs);
-        return;
-    }
 
-    constexpr_convert(lhs, expr->ctype);
-    constexpr_convert(rhs, expr->ctype);
+    constexpr_convert(&lhs, expr->ctype);
+    constexpr_convert(&rhs, expr->ctype);
 
     arithmetic_operation_switch(expr->ctype, >=, binop_switch_case)
-
-    constexpr_delete(lhs);
-    constexpr_delete(rhs);
 }
 
 void evaluate_subscript_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1450,28 +1059,25 @@ void evaluate_subscript_expression(syntax_component_t* expr, constexpr_t* ce)
     }
     if (ce->type == CE_ADDRESS)
     {
-        constexpr_t* cearray = constexpr_evaluate_address(sarray);
-        if (!constexpr_evaluation_succeeded(cearray))
+        constexpr_t cearray;
+        constexpr_evaluate_address(sarray, &cearray);
+        if (!constexpr_evaluation_succeeded(&cearray))
         {
-            ce->error = cearray->error;
-            cearray->error = NULL;
-            constexpr_delete(cearray);
+            take_error(ce, &cearray);
             return;
         }
 
-        constexpr_move(ce, cearray);
-        constexpr_delete(cearray);
-
-        constexpr_t* ceindex = constexpr_evaluate_integer(sindex);
-        if (!constexpr_evaluation_succeeded(ceindex))
+        constexpr_t ceindex;
+        constexpr_evaluate_integer(sindex, &ceindex);
+        if (!constexpr_evaluation_succeeded(&ceindex))
         {
-            ce->error = ceindex->error;
-            ceindex->error = NULL;
-            constexpr_delete(ceindex);
+            take_error(ce, &ceindex);
             return;
         }
-        constexpr_convert_class(ceindex, CTC_UNSIGNED_LONG_LONG_INT);
-        uint64_t index = constexpr_as_u64(ceindex);
+
+        constexpr_move(ce, &cearray);
+        constexpr_convert_class(&ceindex, CTC_UNSIGNED_LONG_LONG_INT);
+        uint64_t index = constexpr_as_u64(&ceindex);
         ce->content.addr.offset += index * type_size(sarray->ctype->derived_from);
         return;
     }
@@ -1483,17 +1089,15 @@ void evaluate_dereference_expression(syntax_component_t* expr, constexpr_t* ce)
 {
     if (ce->type == CE_ADDRESS)
     {
-        constexpr_t* operand = constexpr_evaluate_address(expr->uexpr_operand);
-        if (!constexpr_evaluation_succeeded(operand))
+        constexpr_t operand;
+        constexpr_evaluate_address(expr->uexpr_operand, &operand);
+        if (!constexpr_evaluation_succeeded(&operand))
         {
-            ce->error = operand->error;
-            operand->error = NULL;
-            constexpr_delete(operand);
+            take_error(ce, &operand);
             return;
         }
 
-        constexpr_move(ce, operand);
-        constexpr_delete(operand);
+        constexpr_move(ce, &operand);
         return;
     }
     // ISO: 6.6 (9)
@@ -1504,17 +1108,15 @@ void evaluate_reference_expression(syntax_component_t* expr, constexpr_t* ce)
 {
     if (ce->type == CE_ADDRESS)
     {
-        constexpr_t* operand = constexpr_evaluate_address(expr->uexpr_operand);
-        if (!constexpr_evaluation_succeeded(operand))
+        constexpr_t operand;
+        constexpr_evaluate_address(expr->uexpr_operand, &operand);
+        if (!constexpr_evaluation_succeeded(&operand))
         {
-            ce->error = operand->error;
-            operand->error = NULL;
-            constexpr_delete(operand);
+            take_error(ce, &operand);
             return;
         }
 
-        constexpr_move(ce, operand);
-        constexpr_delete(operand);
+        constexpr_move(ce, &operand);
         return;
     }
     // ISO: 6.6 (9)
@@ -1525,17 +1127,15 @@ void evaluate_dereference_member_expression(syntax_component_t* expr, constexpr_
 {
     if (ce->type == CE_ADDRESS)
     {
-        constexpr_t* lhs = constexpr_evaluate_address(expr->memexpr_expression);
-        if (!constexpr_evaluation_succeeded(lhs))
+        constexpr_t lhs;
+        constexpr_evaluate_address(expr->memexpr_expression, &lhs);
+        if (!constexpr_evaluation_succeeded(&lhs))
         {
-            ce->error = lhs->error;
-            lhs->error = NULL;
-            constexpr_delete(lhs);
+            take_error(ce, &lhs);
             return;
         }
 
-        constexpr_move(ce, lhs);
-        constexpr_delete(lhs);
+        constexpr_move(ce, &lhs);
 
         c_type_t* st = expr->memexpr_expression->ctype->derived_from;
 
@@ -1556,17 +1156,15 @@ void evaluate_member_expression(syntax_component_t* expr, constexpr_t* ce)
 {
     if (ce->type == CE_ADDRESS)
     {
-        constexpr_t* lhs = constexpr_evaluate_address(expr->memexpr_expression);
-        if (!constexpr_evaluation_succeeded(lhs))
+        constexpr_t lhs;
+        constexpr_evaluate_address(expr->memexpr_expression, &lhs);
+        if (!constexpr_evaluation_succeeded(&lhs))
         {
-            ce->error = lhs->error;
-            lhs->error = NULL;
-            constexpr_delete(lhs);
+            take_error(ce, &lhs);
             return;
         }
 
-        constexpr_move(ce, lhs);
-        constexpr_delete(lhs);
+        constexpr_move(ce, &lhs);
 
         c_type_t* st = expr->memexpr_expression->ctype;
 
@@ -1585,70 +1183,39 @@ void evaluate_member_expression(syntax_component_t* expr, constexpr_t* ce)
 
 void evaluate_cast_expression(syntax_component_t* expr, constexpr_t* ce)
 {
-    c_type_t* to = create_type(expr->caexpr_type_name, expr->caexpr_type_name->tn_declarator);
+    // the type of a cast is the one it names
+    c_type_t* to = expr->ctype;
     if (ce->type == CE_INTEGER && (!type_is_arithmetic(expr->caexpr_operand->ctype) || !type_is_integer(to)))
     {
         // ISO: 6.6 (6)
         SET_ERROR_MESSAGE(expr, "casts in an integer constant expression may only convert arithmetic types to integer types");
-        type_delete(to);
         return;
     }
     if (ce->type == CE_ARITHMETIC && (!type_is_arithmetic(expr->caexpr_operand->ctype) || !type_is_arithmetic(to)))
     {
         // ISO: 6.6 (8)
         SET_ERROR_MESSAGE(expr, "casts in an arithmetic constant expression may only convert arithmetic types to other arithmetic types");
-        type_delete(to);
         return;
     }
-    constexpr_t* op = constexpr_evaluate_type(expr->caexpr_operand, ce->type);
-    constexpr_convert(op, to);
-    if (!constexpr_move(ce, op))
+    constexpr_t op;
+    if (!evaluate_operand(expr->caexpr_operand, ce, &op))
+        return;
+    constexpr_convert(&op, to);
+    if (!constexpr_move(ce, &op))
         assert_fail;
-    constexpr_delete(op);
-    type_delete(to);
 }
 
 void evaluate_conditional_expression(syntax_component_t* expr, constexpr_t* ce)
 {
-    constexpr_t* condition = constexpr_evaluate_type(expr->cexpr_condition, ce->type);
-    if (!constexpr_evaluation_succeeded(condition))
-    {
-        ce->error = condition->error;
-        condition->error = NULL;
-        constexpr_delete(condition);
-        return;
-    }
-
-    bool zero = constexpr_equals_zero(condition);
-    constexpr_delete(condition);
-
-    if (!zero)
-    {
-        constexpr_t* lhs = constexpr_evaluate_type(expr->cexpr_if, ce->type);
-        if (!constexpr_evaluation_succeeded(lhs))
-        {
-            ce->error = lhs->error;
-            lhs->error = NULL;
-            constexpr_delete(lhs);
-            return;
-        }
-
-        constexpr_move(ce, lhs);
-        constexpr_delete(lhs);
+    constexpr_t condition;
+    if (!evaluate_operand(expr->cexpr_condition, ce, &condition))
         return;
-    }
 
-    constexpr_t* rhs = constexpr_evaluate_type(expr->cexpr_else, ce->type);
-    if (!constexpr_evaluation_succeeded(rhs))
-    {
-        ce->error = rhs->error;
-        rhs->error = NULL;
-        constexpr_delete(rhs);
+    constexpr_t result;
+    if (!evaluate_operand(constexpr_equals_zero(&condition) ? expr->cexpr_else : expr->cexpr_if, ce, &result))
         return;
-    }
 
-    constexpr_move(ce, rhs);
-    constexpr_delete(rhs);
+    constexpr_move(ce, &result);
 }
 
 void evaluate_sizeof_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1660,7 +1227,7 @@ void evaluate_sizeof_expression(syntax_component_t* expr, constexpr_t* ce)
         SET_ERROR_MESSAGE(expr, "the 'sizeof' operator may only be applied to non-VLA type expressions in a constant expression");
         return;
     }
-    copy_typed_data(ce, type_copy(expr->ctype), to_data(size));
+    set_value(ce, expr->ctype->class, to_data(size));
 }
 
 void evaluate_sizeof_type_expression(syntax_component_t* expr, constexpr_t* ce)
@@ -1674,19 +1241,19 @@ void evaluate_sizeof_type_expression(syntax_component_t* expr, constexpr_t* ce)
         SET_ERROR_MESSAGE(expr, "the 'sizeof' operator may only be applied to non-VLA type expressions in a constant expression");
         return;
     }
-    copy_typed_data(ce, type_copy(expr->ctype), to_data(size));
+    set_value(ce, expr->ctype->class, to_data(size));
 }
 
 void evaluate_integer_constant(syntax_component_t* expr, constexpr_t* ce)
 {
     switch (expr->ctype->class)
     {
-        case CTC_INT: copy_typed_data(ce, make_basic_type(CTC_INT), to_data(expr->intc)); break;
-        case CTC_LONG_INT: copy_typed_data(ce, make_basic_type(CTC_LONG_INT), to_data(expr->intc)); break;
-        case CTC_LONG_LONG_INT: copy_typed_data(ce, make_basic_type(CTC_LONG_LONG_INT), to_data(expr->intc)); break;
-        case CTC_UNSIGNED_INT: copy_typed_data(ce, make_basic_type(CTC_UNSIGNED_INT), to_data(expr->intc)); break;
-        case CTC_UNSIGNED_LONG_INT: copy_typed_data(ce, make_basic_type(CTC_UNSIGNED_LONG_INT), to_data(expr->intc)); break;
-        case CTC_UNSIGNED_LONG_LONG_INT: copy_typed_data(ce, make_basic_type(CTC_UNSIGNED_LONG_LONG_INT), to_data(expr->intc)); break;
+        case CTC_INT: set_value(ce, CTC_INT, to_data(expr->intc)); break;
+        case CTC_LONG_INT: set_value(ce, CTC_LONG_INT, to_data(expr->intc)); break;
+        case CTC_LONG_LONG_INT: set_value(ce, CTC_LONG_LONG_INT, to_data(expr->intc)); break;
+        case CTC_UNSIGNED_INT: set_value(ce, CTC_UNSIGNED_INT, to_data(expr->intc)); break;
+        case CTC_UNSIGNED_LONG_INT: set_value(ce, CTC_UNSIGNED_LONG_INT, to_data(expr->intc)); break;
+        case CTC_UNSIGNED_LONG_LONG_INT: set_value(ce, CTC_UNSIGNED_LONG_LONG_INT, to_data(expr->intc)); break;
         // these are integer types, but they are not possible to be stored as integer constants explicitly
         // case CTC_BOOL:
         // case CTC_CHAR:
@@ -1715,7 +1282,7 @@ void evaluate_primary_expression_identifier(syntax_component_t* expr, constexpr_
             return;
         }
         ce->content.addr.sy = sy;
-        ce->ct = type_copy(sy->type);
+        ce->ct = sy->type;
         return;
     }
 }
@@ -1727,7 +1294,7 @@ void evaluate_string_literal(syntax_component_t* expr, constexpr_t* ce)
         symbol_t* sy = symbol_table_get_syn_id(SYMBOL_TABLE, expr);
         if (!sy) assert_fail;
         ce->content.addr.sy = sy;
-        ce->ct = type_copy(sy->type);
+        ce->ct = sy->type;
         return;
     }
 }
@@ -1739,7 +1306,7 @@ void evaluate_compound_literal(syntax_component_t* expr, constexpr_t* ce)
         symbol_t* sy = symbol_table_get_syn_id(SYMBOL_TABLE, expr);
         if (!sy) assert_fail;
         ce->content.addr.sy = sy;
-        ce->ct = type_copy(sy->type);
+        ce->ct = sy->type;
         return;
     }
 }
@@ -1751,7 +1318,7 @@ void evaluate_primary_expression_enumeration_constant(syntax_component_t* expr,
     namespace_delete(ns);
     if (!sy) assert_fail;
     int value = sy->declarer->parent->enumr_value;
-    copy_typed_data(ce, make_basic_type(CTC_INT), to_data(value));
+    set_value(ce, CTC_INT, to_data(value));
 }
 
 void evaluate_character_constant(syntax_component_t* expr, constexpr_t* ce)
@@ -1761,7 +1328,7 @@ void evaluate_character_constant(syntax_component_t* expr, constexpr_t* ce)
         SET_ERROR_MESSAGE(expr, "character constant encountered with unexpected type");
         return;
     }
-    copy_typed_data(ce, make_basic_type(CTC_INT), to_data(expr->charc_value));
+    set_value(ce, CTC_INT, to_data(expr->charc_value));
 }
 
 void evaluate_floating_constant(syntax_component_t* expr, constexpr_t* ce)
@@ -1775,15 +1342,15 @@ void evaluate_floating_constant(syntax_component_t* expr, constexpr_t* ce)
     {
         case CTC_FLOAT:;
             float f = (float) expr->floc;
-            copy_typed_data(ce, make_basic_type(CTC_FLOAT), to_data(f));
+            set_value(ce, CTC_FLOAT, to_data(f));
             break;
         case CTC_DOUBLE:;
             double d = (double) expr->floc;
-            copy_typed_data(ce, make_basic_type(CTC_DOUBLE), to_data(d));
+            set_value(ce, CTC_DOUBLE, to_data(d));
             break;
         case CTC_LONG_DOUBLE:;
             long double ld = (long double) expr->floc;
-            copy_typed_data(ce, make_basic_type(CTC_LONG_DOUBLE), to_data(ld));
+            set_value(ce, CTC_LONG_DOUBLE, to_data(ld));
             break;
         default:
             SET_ERROR_MESSAGE(expr, "floating constant encountered with unexpected type");
@@ -1878,15 +1445,13 @@ bool constexpr_evaluation_succeeded(constexpr_t* ce)
     return ce->ct->class != CTC_ERROR;
 }
 
-static constexpr_t* constexpr_evaluate_type(syntax_component_t* expr, constexpr_type_t type)
+static void evaluate_type(syntax_component_t* expr, constexpr_type_t type, constexpr_t* ce)
 {
-    constexpr_t* ce = calloc(1, sizeof *ce);
-    ce->type = type;
-    ce->ct = make_basic_type(CTC_ERROR);
+    *ce = (constexpr_t) { .type = type, .ct = type_basic(CTC_ERROR) };
     if (!expr->ctype)
     {
         SET_ERROR_MESSAGE(expr, "expression is not typed");
-        return ce;
+        return;
     }
     evaluate(expr, ce);
     if (type == CE_INTEGER && !ce->error && !type_is_integer(ce->ct))
@@ -1895,15 +1460,52 @@ static constexpr_t* constexpr_evaluate_type(syntax_component_t* expr, constexpr_
     if (type == CE_ARITHMETIC && !ce->error && !type_is_arithmetic(ce->ct))
         // ISO: 6.6 (8)
         SET_ERROR_MESSAGE(expr, "arithmetic constant expression must have an arithmetic type");
-    return ce;
+}
+
+/*
+
+evaluates expr as the given kind of constant expression into ce, finding either its value or the
+reason it doesn't have one. every evaluation goes through here, so whatever asks (typing, analysis,
+or linearization) and however many times it asks, a subexpression is only ever evaluated once per
+kind. the results are kept in the translation unit and copied out of it, which is cheap since
+constants don't own anything.
+
+expressions that aren't typed yet haven't been analyzed, so anything they evaluate to might still
+change (e.g., enumeration constants don't have their values yet), and they aren't remembered.
+neither are expressions outside of a translation unit (like #if expressions).
+
+*/
+static void constexpr_evaluate_type(syntax_component_t* expr, constexpr_type_t type, constexpr_t* ce)
+{
+    syntax_component_t* tlu = expr->ctype && expr->sid ? syntax_get_translation_unit(expr) : NULL;
+    if (!tlu)
+    {
+        evaluate_type(expr, type, ce);
+        return;
+    }
+    if (!tlu->tlu_constexprs)
+    {
+        tlu->tlu_constexprs = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+        map_set_deleters(tlu->tlu_constexprs, NULL, free);
+    }
+    void* key = (void*) (uintptr_t) ((unsigned long long) expr->sid * 3 + type);
+    constexpr_t* known = map_get(tlu->tlu_constexprs, key);
+    if (known)
+    {
+        *ce = *known;
+        return;
+    }
+    evaluate_type(expr, type, ce);
+    known = malloc(sizeof *known);
+    *known = *ce;
+    map_add(tlu->tlu_constexprs, key, known);
 }
 
 static bool constexpr_can_evaluate_type(syntax_component_t* expr, constexpr_type_t type)
 {
-    constexpr_t* ce = constexpr_evaluate_type(expr, type);
-    bool success = constexpr_evaluation_succeeded(ce);
-    constexpr_delete(ce);
-    return success;
+    constexpr_t ce;
+    constexpr_evaluate_type(expr, type, &ce);
+    return constexpr_evaluation_succeeded(&ce);
 }
 
 /*
@@ -1915,53 +1517,36 @@ unary +, unary -, +, -, *, /, %, ~, &, |, ^, <<, >>, !,
 integer constants, enumeration constants, character constants,
 float constants immediately converted to integer constants
 
+the results are written into storage the caller provides (usually on its stack) and nothing in
+them needs freeing afterwards.
+
 */
-constexpr_t* constexpr_evaluate_integer(syntax_component_t* expr)
+void constexpr_evaluate_integer(syntax_component_t* expr, constexpr_t* ce)
 {
-    return constexpr_evaluate_type(expr, CE_INTEGER);
+    constexpr_evaluate_type(expr, CE_INTEGER, ce);
 }
 
-constexpr_t* constexpr_evaluate_arithmetic(syntax_component_t* expr)
+void constexpr_evaluate_arithmetic(syntax_component_t* expr, constexpr_t* ce)
 {
-    return constexpr_evaluate_type(expr, CE_ARITHMETIC);
+    constexpr_evaluate_type(expr, CE_ARITHMETIC, ce);
 }
 
-constexpr_t* constexpr_evaluate_address(syntax_component_t* expr)
+void constexpr_evaluate_address(syntax_component_t* expr, constexpr_t* ce)
 {
-    constexpr_t* ce = calloc(1, sizeof *ce);
-    ce->type = CE_ADDRESS;
-    ce->ct = make_basic_type(CTC_ERROR);
-    if (!expr->ctype)
+    // integers cast to pointers are only address constants at the top of one
+    if (expr->ctype && expr->type == SC_CAST_EXPRESSION && expr->ctype->class == CTC_POINTER)
     {
-        SET_ERROR_MESSAGE(expr, "expression is not typed");
-        return ce;
-    }
-    if (expr->type == SC_CAST_EXPRESSION)
-    {
-        c_type_t* ct = create_type(expr->caexpr_type_name, expr->caexpr_type_name->tn_declarator);
-        if (ct->class != CTC_POINTER)
-        {
-            type_delete(ct);
-            goto after_cast;
-        }
-        constexpr_t* ice = constexpr_evaluate_integer(expr->caexpr_operand);
-        if (!constexpr_evaluation_succeeded(ice))
+        constexpr_t ice;
+        constexpr_evaluate_integer(expr->caexpr_operand, &ice);
+        if (constexpr_evaluation_succeeded(&ice))
         {
-            type_delete(ct);
-            constexpr_delete(ice);
-            goto after_cast;
+            *ce = (constexpr_t) { .type = CE_ADDRESS, .ct = expr->ctype };
+            constexpr_convert_class(&ice, CTC_LONG_LONG_INT);
+            ce->content.addr.offset = constexpr_as_i64(&ice);
+            return;
         }
-        type_delete(ce->ct);
-        ce->ct = ct;
-        constexpr_convert_class(ice, CTC_LONG_LONG_INT);
-        int64_t value = constexpr_as_i64(ice);
-        constexpr_delete(ice);
-        ce->content.addr.offset = value;
-        return ce;
-    }
-after_cast:
-    evaluate(expr, ce);
-    return ce;
+    }
+    constexpr_evaluate_type(expr, CE_ADDRESS, ce);
 }
 
 bool constexpr_can_evaluate_integer(syntax_component_t* expr)
@@ -1986,13 +1571,15 @@ bool constexpr_can_evaluate(syntax_component_t* expr)
         constexpr_can_evaluate_type(expr, CE_ADDRESS);
 }
 
-constexpr_t* constexpr_evaluate(syntax_component_t* expr)
+void constexpr_evaluate(syntax_component_t* expr, constexpr_t* ce)
 {
     if (expr->ctype->class == CTC_POINTER)
-        return constexpr_evaluate_address(expr);
+    {
+        constexpr_evaluate_address(expr, ce);
+        return;
+    }
 
-    constexpr_t* ce = constexpr_evaluate_integer(expr);
-    if (constexpr_evaluation_succeeded(ce)) return ce;
-    constexpr_delete(ce);
-    return constexpr_evaluate_arithmetic(expr);
+    constexpr_evaluate_integer(expr, ce);
+    if (constexpr_evaluation_succeeded(ce)) return;
+    constexpr_evaluate_arithmetic(expr, ce);
 }
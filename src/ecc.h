@@ -33,6 +33,16 @@
 #define NO_LIBRARY_SEARCH_DIRECTORIES 4
 #define NO_ANGLED_INCLUDE_SEARCH_DIRECTORIES 4
 
+// perfect hash over keywords, see KEYWORD_HASH_TABLE in const.c
+#define KEYWORD_HASH_SIZE 128
+#define KEYWORD_HASH(c0, c1, cl, len) (((c0) + (c1) * 9 + (cl) * 12 + (len)) & (KEYWORD_HASH_SIZE - 1))
+#define KEYWORD_MIN_LENGTH 2
+#define KEYWORD_MAX_LENGTH 10
+
+// range of POWERS_OF_FIVE_128 in const.c
+#define FLOAT_POWER_OF_FIVE_MIN (-342)
+#define FLOAT_POWER_OF_FIVE_MAX 308
+
 #define STACKFRAME_ALIGNMENT 16
 #define STRUCT_UNION_ALIGNMENT 8
 #define ALIGN(x, req) ((x) + ((req) - ((x) % (req))))
@@ -315,6 +325,7 @@ typedef struct analysis_error analysis_error_t;
 typedef struct syntax_component_t syntax_component_t;
 typedef struct preprocessing_token preprocessing_token_t;
 typedef struct token token_t;
+typedef struct token_stream token_stream_t;
 typedef struct ir_insn ir_insn_t;
 typedef struct x86_insn x86_insn_t;
 typedef struct symbol_t symbol_t;
@@ -337,6 +348,7 @@ typedef struct program_options
     bool cflag;
     char* oflag;
     bool gflag;
+    bool pchflag;
 } program_options_t;
 
 typedef struct init_address
@@ -415,6 +427,8 @@ typedef struct preprocessing_settings
     char* filepath;
     char* error;
     preprocessing_table_t* table;
+    // if non-NULL, the paths of all files included during preprocessing are added here
+    vector_t* dependencies;
 } preprocessing_settings_t;
 
 struct token
@@ -422,6 +436,8 @@ struct token
     token_type_t type;
     unsigned row, col;
     token_t* next;
+    // the stream this token was pulled from (NULL if it was tokenized all at once)
+    token_stream_t* stream;
     union
     {
         // T_KEYWORD
@@ -483,6 +499,24 @@ typedef struct buffer_t
     unsigned size;
 } buffer_t;
 
+// a run of explicitly written bytes in an image
+typedef struct image_run
+{
+    uint64_t offset;
+    uint64_t length;
+    uint64_t capacity;
+    uint8_t* bytes;
+} image_run_t;
+
+// the initial content of a static object, kept as sorted runs of bytes with zeros in between
+typedef struct image
+{
+    uint64_t size;
+    image_run_t* runs;
+    size_t noruns;
+    size_t capacity;
+} image_t;
+
 struct vector_t
 {
     void** data;
@@ -492,11 +526,25 @@ struct vector_t
 
 typedef struct c_type c_type_t;
 
+// where the members of a complete struct or union live, worked out once per type
+typedef struct struct_layout_t
+{
+    long long size; // -1 if unknown
+    long long alignment;
+    int64_t* offsets; // by member index
+    unsigned count; // number of members the layout was made for
+    bool settled; // every member's size was known, so nothing here can change anymore
+    int* index; // member indices hashed by name, -1 in empty slots
+    unsigned capacity; // of the index, always a power of two
+} struct_layout_t;
+
 struct c_type
 {
     c_type_class_t class;
     unsigned char qualifiers;
     unsigned char function_specifiers;
+    bool canonical; // interned in a type table, so shared and never modified
+    bool exact; // canonical and only compatible with itself
     c_type_t* derived_from;
     union
     {
@@ -513,6 +561,7 @@ struct c_type
             vector_t* member_names; // <char*>
             vector_t* member_bitfields; // <syntax_component_t*>
             int64_t* member_bitfield_lengths;
+            struct_layout_t* layout;
         } struct_union;
         struct
         {
@@ -528,6 +577,15 @@ struct c_type
     };
 };
 
+// hash-consed types for a translation unit. structurally identical types interned here are the same
+// instance, which makes copying them free and comparing them a pointer comparison
+typedef struct type_table_t
+{
+    c_type_t** types; // open-addressed set of interned derived types
+    unsigned size;
+    unsigned capacity; // always a power of two
+} type_table_t;
+
 typedef enum linkage
 {
     LK_EXTERNAL,
@@ -700,6 +758,15 @@ typedef enum air_insn_type {
 } air_insn_type_t;
 
 typedef struct air_insn air_insn_t;
+typedef struct air_routine air_routine_t;
+
+// def-use index of a routine (see air_routine_index)
+typedef struct air_defuse {
+    air_routine_t* routine;
+    struct map_t* defs; // <regid_t, vector_t<air_insn_t*>*> instructions defining each temporary, in routine order
+    struct map_t* uses; // <regid_t, vector_t<air_insn_t*>*> instructions using each temporary (once each), in routine order
+    vector_t* calls; // <air_insn_t*> function calls, in routine order
+} air_defuse_t;
 
 struct air_insn {
     air_insn_type_t type;
@@ -712,21 +779,24 @@ struct air_insn {
         // function calls that return structs have C type "pointer to struct." this disambiguates struct returns from ptr to struct returns. 
         bool fcall_sret;
     } metadata;
+    air_defuse_t* defuse; // index this instruction is in, if any
+    uint64_t order; // increases through the routine (only kept while indexed)
 };
 
 typedef struct air_data {
     bool readonly;
     symbol_t* sy;
-    unsigned char* data;
+    image_t* image;
     vector_t* addresses;
 } air_data_t;
 
-typedef struct air_routine {
+struct air_routine {
     symbol_t* sy;
     air_insn_t* insns;
     symbol_t* retptr;
     bool uses_varargs;
-} air_routine_t;
+    air_defuse_t* defuse;
+};
 
 typedef struct air {
     vector_t* rodata; // <air_data_t*>
@@ -737,10 +807,53 @@ typedef struct air {
 
     regid_t next_available_temporary;
     unsigned long long next_available_lv;
+    unsigned long long next_available_fc; // for floating constants made by optimizations
     symbol_t* sse32_negater;
     symbol_t* sse64_negater;
 } air_t;
 
+// iterates over the instructions of a basic block, first to last
+#define CFG_BLOCK_FOR(var, block) for (air_insn_t* var = (block)->first; var; var = var == (block)->last ? NULL : var->next)
+
+typedef struct cfg_block cfg_block_t;
+typedef struct cfg_loop cfg_loop_t;
+
+// a straight run of instructions only ever entered at its first and left after its last
+struct cfg_block {
+    size_t id; // position in the routine (the exit comes after every block)
+    // both NULL if the block is empty (the exit, the one block of a routine with no code, or a block
+    // cfg_block_remove took everything out of), so go through the instructions with CFG_BLOCK_FOR
+    air_insn_t* first;
+    air_insn_t* last;
+    vector_t* preds; // <cfg_block_t*>
+    vector_t* succs; // <cfg_block_t*> (fall-through first, then the jump target)
+    size_t rpo; // position in reverse postorder (SIZE_MAX if unreachable)
+    cfg_block_t* idom; // immediate dominator (NULL for the entry and unreachable blocks)
+    cfg_block_t* ipdom; // immediate post-dominator (NULL for the exit and blocks that never reach it)
+    cfg_loop_t* loop; // innermost loop containing this block, if any
+    // intervals in the dominator and post-dominator trees, for answering dominance in constant time
+    size_t dom_pre, dom_post;
+    size_t pdom_pre, pdom_post;
+};
+
+// a natural loop: every block that can reach one of the latches without going through the header
+struct cfg_loop {
+    cfg_block_t* header;
+    cfg_loop_t* parent; // innermost loop this one is nested in, if any
+    vector_t* blocks; // <cfg_block_t*> (the header first, includes the blocks of nested loops)
+    vector_t* latches; // <cfg_block_t*> blocks jumping back to the header
+    cfg_block_t* bottom; // the loop's block that comes last in the routine
+    size_t depth; // 1 for a loop not nested in any other
+};
+
+typedef struct cfg {
+    air_routine_t* routine;
+    vector_t* blocks; // <cfg_block_t*> (in routine order, the entry first)
+    cfg_block_t* exit; // empty block that returns (and falling off the end) lead to
+    vector_t* rpo; // <cfg_block_t*> blocks reachable from the entry, in reverse postorder
+    vector_t* loops; // <cfg_loop_t*> (a loop always comes before the ones nested in it)
+} cfg_t;
+
 typedef enum x86_operand_type
 {
     X86OP_REGISTER,
@@ -818,6 +931,8 @@ typedef enum x86_insn_type
     X86I_SETG,
     X86I_SETA,
     X86I_SETNB,
+    X86I_SETB,
+    X86I_SETBE,
     X86I_SETP,
     X86I_SETNP,
     X86I_AND,
@@ -904,9 +1019,8 @@ typedef struct x86_asm_data
     size_t alignment;
     char* label;
     bool readonly;
-    unsigned char* data;
+    image_t* image;
     vector_t* addresses;
-    size_t length;
 } x86_asm_data_t;
 
 #define USED_NONVOLATILES_RBX (uint16_t) 0x0001
@@ -946,7 +1060,11 @@ typedef struct opt1_options
 {
     bool inline_fcalls;
     bool remove_fcall_passing_lifetimes;
-    bool inline_integer_constant;
+    bool propagate_constants;
+    bool eliminate_common_subexpressions;
+    bool hoist_loop_invariants;
+    bool reduce_induction_variables;
+    bool eliminate_dead_code;
 } opt1_options_t;
 
 typedef struct opt4_options
@@ -1017,6 +1135,7 @@ typedef enum type_qualifier
 #define TQ_B_CONST (1 << TQ_CONST)
 #define TQ_B_RESTRICT (1 << TQ_RESTRICT)
 #define TQ_B_VOLATILE (1 << TQ_VOLATILE)
+#define TQ_B_ALL (TQ_B_CONST | TQ_B_RESTRICT | TQ_B_VOLATILE)
 
 typedef enum function_specifier
 {
@@ -1151,33 +1270,32 @@ typedef enum syntax_component_type_t
 // SC_CONSTANT_EXPRESSION = SC_CONDITIONAL_EXPRESSION
 // SC_CONSTANT = SC_INTEGER_CONSTANT | SC_FLOATING_CONSTANT | SC_ENUMERATION_CONSTANT | SC_CHARACTER_CONSTANT
 
+// semantic information about an initializer, kept in a side table on the translation unit
+typedef struct initializer_info
+{
+    // offset into the object being initialized, from its start (-1 if out of bounds)
+    int64_t offset;
+    // type of the object being initialized
+    c_type_t* ctype;
+} initializer_info_t;
+
 // THE GREATEST STRUCT OF ALL TIME
+// every node only gets as much of the union below as its type uses (see syntax_component_size),
+// and anything only a few kinds of nodes need goes in a side table keyed by the node's syntax id instead
 struct syntax_component_t
 {
     syntax_component_type_t type;
     unsigned row, col;
+    unsigned sid; // syntax id, unique within a translation unit
     struct syntax_component_t* parent;
 
     // additional information
     c_type_t* ctype;
-    bool lost_lvalue;
     air_insn_t* code;
 
-    // type-specific additional info for linear IR transformation
-
     // expression types
     regid_t expr_reg;
-    regid_t result_register;
-
-    // loop types
-    uint64_t continue_label_no;
-
-    // switch & loop types
-    uint64_t break_label_no;
-
-    // initializer types
-    int64_t initializer_offset;
-    c_type_t* initializer_ctype;
+    bool lost_lvalue;
 
     union
     {
@@ -1185,8 +1303,12 @@ struct syntax_component_t
         struct
         {
             vector_t* tlu_external_declarations;
-            vector_t* tlu_errors; // <syntax_component_t> (SC_ERROR)
+            struct syntax_component_t* tlu_error; // SC_ERROR (the deepest one encountered while parsing)
+            struct parse_memo* tlu_memo; // only alive while parsing
             symbol_table_t* tlu_st;
+            struct map_t* tlu_initializers; // <unsigned (syntax id), initializer_info_t*>
+            struct map_t* tlu_constexprs; // <unsigned (syntax id and constexpr_type_t), constexpr_t*>
+            unsigned tlu_last_sid;
         };
 
         // SC_FUNCTION_DEFINITION - fdef
@@ -1537,7 +1659,7 @@ struct syntax_component_t
         // SC_ERROR - err
         struct
         {
-            char* err_message;
+            const char* err_message; // not owned
             int err_depth;
         };
     };
@@ -1591,16 +1713,27 @@ typedef enum constexpr_type
     CE_ADDRESS
 } constexpr_type_t;
 
+// big enough for any scalar value (long double is the widest)
+#define CONSTEXPR_VALUE_SIZE 16
+
+/*
+
+the result of evaluating a constant expression. it's small enough to keep on the stack and owns
+nothing, so it never has to be freed: values are stored in place, the type is either a canonical
+basic type (see type_basic) or borrowed from the syntax tree (or symbol table) for addresses, and
+the error is a static message that only gets formatted if whoever asked reports it.
+
+*/
 struct constexpr
 {
     constexpr_type_t type;
     c_type_t* ct;
-    char* error;
+    const char* error;
     uint32_t err_row;
     uint32_t err_col;
     union
     {
-        uint8_t* data;
+        uint8_t data[CONSTEXPR_VALUE_SIZE];
         struct
         {
             symbol_t* sy; // null if the constant is a null pointer
@@ -1619,18 +1752,46 @@ struct symbol_t
     long long stack_offset;
     char* name; // explicit name, if needed
     storage_duration_t sd; // explicit storage duration, if needed
-    uint8_t* data; // initializing content for this symbol, if needed
+    image_t* image; // initializing content for this symbol, if needed
     vector_t* addresses; // symbol and location information about addresses in the initializing content, if needed
     struct symbol_t* next; // next symbol in list (if in a list, otherwise NULL)
+    struct symbol_t* prev; // previous symbol in list (if in a list, otherwise NULL)
+    struct symbol_t* scope_next; // next symbol declared with the same name in the same scope
+    unsigned scope; // syntax id of the scope this symbol was declared in (only meaningful if it has a declarer)
 };
 
+// an entry in a symbol index, keyed by a syntax id, a name, or both
+typedef struct symbol_index_entry_t
+{
+    unsigned sid; // 0 if not keyed by a syntax id
+    char* name; // NULL if not keyed by a name
+    union
+    {
+        symbol_t* sy;
+        unsigned slot; // position of a name in the symbol table
+    };
+} symbol_index_entry_t;
+
+// open-addressed hash table used by the symbol table to find things without walking lists
+typedef struct symbol_index_t
+{
+    symbol_index_entry_t* entries;
+    unsigned size;
+    unsigned capacity; // always a power of two
+} symbol_index_t;
+
 struct symbol_table_t
 {
     char** key;
     symbol_t** value;
+    symbol_t** last; // last symbol in each list
     unsigned size;
     unsigned capacity;
     vector_t* unique_types; // <c_type_t*>
+    type_table_t* types; // canonical types, made when AIR generation starts
+    symbol_index_t* names; // <name, slot> where each name is in key and value
+    symbol_index_t* declarers; // <declarer syntax id, symbol_t*>
+    symbol_index_t* scopes; // <scope syntax id + name, symbol_t*> the first of the symbols declared with a name in a scope (the rest follow by scope_next)
 };
 
 struct analysis_error
@@ -1654,6 +1815,19 @@ struct syntax_traverser
     traversal_function after[SC_NO_ELEMENTS];
 };
 
+typedef enum traversal_dependency
+{
+    TD_NODE, // needs the other pass to have visited a node before visiting it
+    TD_TREE // needs the other pass to have visited the whole tree before starting
+} traversal_dependency_t;
+
+typedef struct traversal_schedule
+{
+    syntax_component_t* root;
+    vector_t* passes; // <syntax_traverser_t*>
+    vector_t* walks; // <uint64_t>, which walk over the tree each pass runs in
+} traversal_schedule_t;
+
 typedef struct map_t
 {
     void** key;
@@ -1694,6 +1868,15 @@ void buffer_delete(buffer_t* b);
 char* buffer_export(buffer_t* b);
 int* buffer_export_wide(buffer_t* b);
 
+/* image.c */
+image_t* image_init(uint64_t size);
+image_t* image_copy(image_t* im);
+void image_delete(image_t* im);
+void image_write(image_t* im, uint64_t offset, const void* bytes, uint64_t length);
+void image_read(image_t* im, uint64_t offset, void* dest, uint64_t length);
+bool image_is_zero(image_t* im);
+void image_print(image_t* im, int (*printer)(const char* fmt, ...));
+
 /* vector.c */
 vector_t* vector_init(void);
 vector_t* vector_add(vector_t* v, void* el);
@@ -1706,6 +1889,8 @@ bool vector_equals(vector_t* v1, vector_t* v2, bool (*equals)(void*, void*));
 void vector_delete(vector_t* v);
 void vector_deep_delete(vector_t* v, void (*deleter)(void*));
 void* vector_pop(vector_t* v);
+vector_t* vector_insert(vector_t* v, unsigned index, void* el);
+void* vector_remove(vector_t* v, unsigned index);
 void* vector_peek(vector_t* v);
 void vector_concat(vector_t* v, vector_t* u);
 void vector_merge(vector_t* v, vector_t* u, int (*c)(void*, void*));
@@ -1735,6 +1920,8 @@ void* set_get(map_t* m, void *key);
 
 /* const.c */
 extern const char* KEYWORDS[37];
+extern const unsigned char KEYWORD_HASH_TABLE[KEYWORD_HASH_SIZE];
+extern const uint64_t POWERS_OF_FIVE_128[2 * (FLOAT_POWER_OF_FIVE_MAX - FLOAT_POWER_OF_FIVE_MIN + 1)];
 extern const char* SYNTAX_COMPONENT_NAMES[SC_NO_ELEMENTS];
 extern const char* SPECIFIER_QUALIFIER_NAMES[9];
 extern const char* ARITHMETIC_TYPE_NAMES[21];
@@ -1789,17 +1976,30 @@ bool pp_token_equals(preprocessing_token_t* t1, preprocessing_token_t* t2);
 char* pp_token_stringify_range(preprocessing_token_t* start, preprocessing_token_t* end);
 
 /* preprocess.c */
+preprocessing_table_t* preprocessing_table_init(void);
+preprocessing_token_t* preprocessing_table_add(preprocessing_table_t* t, char* k, preprocessing_token_t* token, preprocessing_token_t* end, vector_t* id_list, bool variadic);
+void preprocessing_table_delete(preprocessing_table_t* t);
 bool preprocess(preprocessing_token_t** tokens, preprocessing_settings_t* settings);
 void strlitconcat(preprocessing_token_t* tokens);
 
+/* pch.c */
+char* pch_filepath(char* header);
+bool pch_emit(char* header, char* target);
+bool pch_load(char* header, preprocessing_table_t* table, preprocessing_token_t** tokens);
+
 /* parse.c */
 syntax_component_t* parse_if_directive_expression(token_t* tokens, char* error);
-syntax_component_t* parse(token_t* toks);
+syntax_component_t* parse(token_stream_t* stream);
 
 /* traverse.c */
 syntax_traverser_t* traverse_init(syntax_component_t* tlu, size_t size);
 void traverse_delete(syntax_traverser_t* trav);
 void traverse(syntax_traverser_t* trav);
+traversal_schedule_t* traversal_schedule_init(syntax_component_t* root);
+void traversal_schedule_delete(traversal_schedule_t* ts);
+void traversal_schedule_add(traversal_schedule_t* ts, syntax_traverser_t* trav);
+void traversal_schedule_depend(traversal_schedule_t* ts, syntax_traverser_t* trav, syntax_traverser_t* on, traversal_dependency_t dependency);
+void traversal_schedule_run(traversal_schedule_t* ts);
 
 /* analyze.c */
 analysis_error_t* analyze(syntax_component_t* tlu);
@@ -1870,8 +2070,13 @@ unsigned long long evaluate_enumeration_constant(syntax_component_t* enumr);
 bool syntax_is_assignment_expression(syntax_component_type_t type);
 bool syntax_is_identifier(syntax_component_type_t type);
 bool syntax_is_in_lvalue_context(syntax_component_t* syn);
-bool syntax_contains_subelement(syntax_component_t* syn, syntax_component_type_t type);
-int64_t syntax_get_full_initialization_offset(syntax_component_t* initializer);
+size_t syntax_component_size(syntax_component_type_t type);
+syntax_component_t* syntax_component_init(syntax_component_type_t type, syntax_component_t* tlu);
+int64_t syntax_get_initializer_offset(syntax_component_t* tlu, syntax_component_t* initializer);
+void syntax_set_initializer_offset(syntax_component_t* tlu, syntax_component_t* initializer, int64_t offset);
+c_type_t* syntax_get_initializer_ctype(syntax_component_t* tlu, syntax_component_t* initializer);
+void syntax_set_initializer_ctype(syntax_component_t* tlu, syntax_component_t* initializer, c_type_t* ct);
+void syntax_set_initializer(syntax_component_t* tlu, syntax_component_t* initializer, int64_t offset, c_type_t* ct);
 
 /* type.c */
 c_type_t* make_basic_type(c_type_class_t class);
@@ -1880,12 +2085,20 @@ c_type_t* integer_promotions(c_type_t* ct);
 c_type_t* default_argument_promotions(c_type_t* ct);
 void usual_arithmetic_conversions(c_type_t* t1, c_type_t* t2, c_type_t** conv_t1, c_type_t** conv_t2);
 c_type_t* usual_arithmetic_conversions_result_type(c_type_t* t1, c_type_t* t2);
+struct_layout_t* type_get_struct_union_layout(c_type_t* ct);
 void type_get_struct_union_member_info(c_type_t* ct, char* name, long long* index, int64_t* offset);
 bool type_has_flexible_array_member(c_type_t* ct);
 long long type_alignment(c_type_t* ct);
 long long type_size(c_type_t* ct);
 void type_delete(c_type_t* ct);
 void symbol_type_delete(c_type_t* ct);
+type_table_t* type_table_init(void);
+void type_table_delete(type_table_t* tt);
+c_type_t* type_canonical(type_table_t* tt, c_type_t* ct);
+c_type_t* type_canonical_unqualified(type_table_t* tt, c_type_t* ct);
+c_type_t* type_canonical_basic(type_table_t* tt, c_type_class_t class);
+c_type_t* type_basic(c_type_class_t class);
+c_type_t* type_canonical_reference(type_table_t* tt, c_type_t* ct);
 c_type_t* type_compose(c_type_t* t1, c_type_t* t2);
 bool type_is_compatible(c_type_t* t1, c_type_t* t2);
 bool type_is_compatible_ignore_qualifiers(c_type_t* t1, c_type_t* t2);
@@ -1928,6 +2141,7 @@ c_type_t* create_type_with_errors(analysis_error_t* errors, syntax_component_t*
 c_type_t* create_type(syntax_component_t* specifying, syntax_component_t* declr);
 void type_humanized_print(c_type_t* ct, int (*printer)(const char*, ...));
 c_type_t* type_copy(c_type_t* ct);
+c_type_t* type_share(c_type_t* ct);
 c_type_t* strip_qualifiers(c_type_t* ct);
 c_namespace_t* make_basic_namespace(c_namespace_class_t class);
 #define type_is_qualified(ct) (ct ? ((ct)->qualifiers != 0) : false)
@@ -1978,8 +2192,16 @@ char* replace_extension(char* filepath, char* ext);
 void token_delete(token_t* token);
 void token_delete_all(token_t* token);
 void token_print(token_t* token, int (*printer)(const char* fmt, ...));
+int keyword_lookup(char* id);
+token_t* tokenize_identifier(preprocessing_token_t* pp_token, tokenizing_settings_t* settings);
 token_t* tokenize_sequence(preprocessing_token_t* pp_tokens, preprocessing_token_t* end, tokenizing_settings_t* settings);
-token_t* tokenize(preprocessing_token_t* pp_tokens, tokenizing_settings_t* settings);
+token_stream_t* token_stream_init(preprocessing_token_t* pp_tokens, tokenizing_settings_t* settings);
+token_t* token_stream_first(token_stream_t* stream);
+token_t* token_next(token_t* token);
+void token_stream_release(token_stream_t* stream, token_t* until);
+bool token_stream_drain(token_stream_t* stream);
+size_t token_stream_peak(token_stream_t* stream);
+void token_stream_delete(token_stream_t* stream);
 
 /* air.c */
 
@@ -2011,6 +2233,31 @@ air_insn_t* air_insn_find_temporary_definition(regid_t tmp, air_routine_t* routi
 bool air_insn_assigns(air_insn_t* insn);
 bool air_insn_uses(air_insn_t* insn, regid_t reg);
 bool air_insn_produces_side_effect(air_insn_t* insn);
+void air_routine_index(air_routine_t* routine);
+void air_routine_unindex(air_routine_t* routine);
+air_defuse_t* air_insn_unindex(air_insn_t* insn);
+void air_insn_index(air_insn_t* insn, air_defuse_t* defuse);
+vector_t* air_defuse_definitions(air_defuse_t* defuse, regid_t reg);
+vector_t* air_defuse_uses(air_defuse_t* defuse, regid_t reg);
+size_t air_insn_vector_search(vector_t* insns, uint64_t order);
+air_insn_t* air_insn_find_use_below(regid_t reg, air_insn_t* start);
+
+/* cfg.c */
+
+cfg_t* cfg_init(air_routine_t* routine);
+void cfg_rebuild(cfg_t* cfg);
+void cfg_delete(cfg_t* cfg);
+void cfg_print(cfg_t* cfg, air_t* air, int (*printer)(const char* fmt, ...));
+bool cfg_is_terminator(air_insn_t* insn);
+bool cfg_dominates(cfg_block_t* b1, cfg_block_t* b2);
+bool cfg_post_dominates(cfg_block_t* b1, cfg_block_t* b2);
+bool cfg_loop_contains(cfg_loop_t* loop, cfg_block_t* block);
+cfg_block_t* cfg_find_block(cfg_t* cfg, air_insn_t* insn);
+air_insn_t* cfg_loop_last(cfg_t* cfg, cfg_loop_t* loop);
+air_insn_t* cfg_live_until(cfg_t* cfg, air_insn_t* def, air_insn_t* use);
+air_insn_t* cfg_block_insert_before(cfg_block_t* block, air_insn_t* insn, air_insn_t* inserting);
+air_insn_t* cfg_block_insert_after(cfg_block_t* block, air_insn_t* insn, air_insn_t* inserting);
+air_insn_t* cfg_block_remove(cfg_block_t* block, air_insn_t* insn);
 
 /* localize.c */
 void localize(air_t* air, air_locale_t locale);
@@ -2040,16 +2287,15 @@ bool x86_64_is_sse_register(regid_t reg);
 
 /* constexpr.c */
 
-void constexpr_delete(constexpr_t* ce);
 void constexpr_print_value(constexpr_t* ce, int (*printer)(const char*, ...));
 bool constexpr_evaluation_succeeded(constexpr_t* ce);
 bool constexpr_can_evaluate_integer(syntax_component_t* expr);
 bool constexpr_can_evaluate_arithmetic(syntax_component_t* expr);
 bool constexpr_can_evaluate_address(syntax_component_t* expr);
-constexpr_t* constexpr_evaluate_integer(syntax_component_t* expr);
-constexpr_t* constexpr_evaluate_arithmetic(syntax_component_t* expr);
-constexpr_t* constexpr_evaluate_address(syntax_component_t* expr);
-constexpr_t* constexpr_evaluate(syntax_component_t* expr);
+void constexpr_evaluate_integer(syntax_component_t* expr, constexpr_t* ce);
+void constexpr_evaluate_arithmetic(syntax_component_t* expr, constexpr_t* ce);
+void constexpr_evaluate_address(syntax_component_t* expr, constexpr_t* ce);
+void constexpr_evaluate(syntax_component_t* expr, constexpr_t* ce);
 void constexpr_convert(constexpr_t* ce, c_type_t* to);
 void constexpr_convert_class(constexpr_t* ce, c_type_class_t class);
 int64_t constexpr_as_i64(constexpr_t* ce);
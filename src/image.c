@@ -0,0 +1,181 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "ecc.h"
+
+/*
+
+images hold the initial content of objects with static storage duration. instead of one buffer
+as big as the object, an image keeps a sorted list of runs of explicitly written bytes, and
+everything in between them is zero. this way a huge object that is mostly (or entirely) zero
+costs memory proportional to its initializer rather than its size.
+
+runs never overlap or touch, so writing next to a run grows it instead of starting a new one.
+this keeps objects initialized front to back (most of them) down to a single run.
+
+*/
+
+image_t* image_init(uint64_t size)
+{
+    image_t* im = calloc(1, sizeof *im);
+    im->size = size;
+    return im;
+}
+
+image_t* image_copy(image_t* im)
+{
+    if (!im) return NULL;
+    image_t* n = image_init(im->size);
+    n->noruns = n->capacity = im->noruns;
+    n->runs = malloc(n->capacity * sizeof(image_run_t));
+    for (size_t i = 0; i < im->noruns; ++i)
+    {
+        image_run_t* run = &n->runs[i];
+        run->offset = im->runs[i].offset;
+        run->length = run->capacity = im->runs[i].length;
+        run->bytes = malloc(run->length);
+        memcpy(run->bytes, im->runs[i].bytes, run->length);
+    }
+    return n;
+}
+
+void image_delete(image_t* im)
+{
+    if (!im) return;
+    for (size_t i = 0; i < im->noruns; ++i)
+        free(im->runs[i].bytes);
+    free(im->runs);
+    free(im);
+}
+
+// index of the first run ending at or after the offset (i.e., the first one it could touch)
+static size_t image_find(image_t* im, uint64_t offset)
+{
+    size_t lo = 0, hi = im->noruns;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (im->runs[mid].offset + im->runs[mid].length < offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static void run_reserve(image_run_t* run, uint64_t length)
+{
+    if (length <= run->capacity)
+        return;
+    run->capacity = run->capacity * 2 > length ? run->capacity * 2 : length;
+    run->bytes = realloc(run->bytes, run->capacity);
+}
+
+static bool bytes_are_zero(const uint8_t* bytes, uint64_t length)
+{
+    for (uint64_t i = 0; i < length; ++i)
+        if (bytes[i])
+            return false;
+    return true;
+}
+
+void image_write(image_t* im, uint64_t offset, const void* bytes, uint64_t length)
+{
+    // anything written past the end of the object is dropped
+    if (offset >= im->size)
+        return;
+    if (length > im->size - offset)
+        length = im->size - offset;
+    if (!length)
+        return;
+    uint64_t end = offset + length;
+    size_t first = image_find(im, offset);
+    size_t last = first;
+    for (; last < im->noruns && im->runs[last].offset <= end; ++last);
+
+    // nothing touched, so the bytes either go into a run of their own or are zeros that are already there
+    if (first == last)
+    {
+        if (bytes_are_zero(bytes, length))
+            return;
+        if (im->noruns == im->capacity)
+        {
+            im->capacity = im->capacity ? im->capacity * 2 : 4;
+            im->runs = realloc(im->runs, im->capacity * sizeof(image_run_t));
+        }
+        memmove(im->runs + first + 1, im->runs + first, (im->noruns - first) * sizeof(image_run_t));
+        ++im->noruns;
+        image_run_t* run = &im->runs[first];
+        run->offset = offset;
+        run->length = run->capacity = length;
+        run->bytes = malloc(length);
+        memcpy(run->bytes, bytes, length);
+        return;
+    }
+
+    // merge every run touched into the first one, then lay the new bytes over it
+    image_run_t* run = &im->runs[first];
+    if (offset < run->offset)
+    {
+        uint64_t shift = run->offset - offset;
+        run_reserve(run, run->length + shift);
+        memmove(run->bytes + shift, run->bytes, run->length);
+        memset(run->bytes, 0, shift);
+        run->offset = offset;
+        run->length += shift;
+    }
+    image_run_t* tail = &im->runs[last - 1];
+    uint64_t new_end = tail->offset + tail->length > end ? tail->offset + tail->length : end;
+    uint64_t old_end = run->offset + run->length;
+    if (new_end > old_end)
+    {
+        run_reserve(run, new_end - run->offset);
+        memset(run->bytes + run->length, 0, new_end - old_end);
+        run->length = new_end - run->offset;
+    }
+    for (size_t i = first + 1; i < last; ++i)
+    {
+        memcpy(run->bytes + (im->runs[i].offset - run->offset), im->runs[i].bytes, im->runs[i].length);
+        free(im->runs[i].bytes);
+    }
+    memcpy(run->bytes + (offset - run->offset), bytes, length);
+    memmove(im->runs + first + 1, im->runs + last, (im->noruns - last) * sizeof(image_run_t));
+    im->noruns -= last - first - 1;
+}
+
+void image_read(image_t* im, uint64_t offset, void* dest, uint64_t length)
+{
+    uint8_t* out = dest;
+    memset(out, 0, length);
+    uint64_t end = offset + length;
+    for (size_t i = image_find(im, offset); i < im->noruns && im->runs[i].offset < end; ++i)
+    {
+        image_run_t* run = &im->runs[i];
+        uint64_t from = run->offset > offset ? run->offset : offset;
+        uint64_t to = run->offset + run->length < end ? run->offset + run->length : end;
+        if (from < to)
+            memcpy(out + (from - offset), run->bytes + (from - run->offset), to - from);
+    }
+}
+
+// whether every byte of the image is zero
+bool image_is_zero(image_t* im)
+{
+    for (size_t i = 0; i < im->noruns; ++i)
+        if (!bytes_are_zero(im->runs[i].bytes, im->runs[i].length))
+            return false;
+    return true;
+}
+
+void image_print(image_t* im, int (*printer)(const char* fmt, ...))
+{
+    for (size_t i = 0; i < im->noruns; ++i)
+    {
+        image_run_t* run = &im->runs[i];
+        printer(" [%llu]", (unsigned long long) run->offset);
+        for (uint64_t j = 0; j < run->length; ++j)
+            printer(" %02X", run->bytes[j]);
+    }
+    if (!im->noruns)
+        printer(" (zero)");
+}
@@ -122,15 +122,6 @@ static bool jump_impl(lex_state_t* state, long long cursor, unsigned row, unsign
     return true;
 }
 
-static preprocessing_token_t* add_token(preprocessing_token_t* head, preprocessing_token_t* token)
-{
-    preprocessing_token_t* orig = head;
-    if (!head) return token;
-    for (; head->next; head = head->next);
-    head->next = token;
-    return orig;
-}
-
 static bool in_source_charset(int c)
 {
     return c < 128;
@@ -1380,7 +1371,11 @@ preprocessing_token_t* lex_raw(unsigned char* data, size_t length, bool dump_err
         }
         else
         {
-            tokens = add_token(tokens, token);
+            // state->prev is the tail of the list, no need to walk it
+            if (state->prev)
+                state->prev->next = token;
+            else
+                tokens = token;
             token->prev = state->prev;
             state->prev = token;
         }
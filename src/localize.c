@@ -6,6 +6,7 @@
 #define NEXT_VIRTUAL_REGISTER (air->next_available_temporary++)
 #define NEXT_LV (air->next_available_lv++)
 #define SYMBOL_TABLE (air->st)
+#define TYPES (air->st->types)
 
 typedef enum arg_class
 {
@@ -247,7 +248,7 @@ static regid_t try_extract_integer_constant(air_insn_t* insn, air_t* air, size_t
     regid_t reg = NEXT_VIRTUAL_REGISTER;
 
     air_insn_t* def = air_insn_init(AIR_LOAD, 2);
-    def->ct = type_copy(ct);
+    def->ct = type_canonical(TYPES, ct);
     def->ops[0] = air_insn_register_operand_init(reg);
     def->ops[1] = air_insn_integer_constant_operand_init(value);
     air_insn_insert_before(def, insn);
@@ -290,7 +291,7 @@ air_insn_t* store_eightbyte_on_stack(air_insn_t* loc, air_insn_t* tempdef, c_typ
         if (total_remaining >= UNSIGNED_LONG_LONG_INT_WIDTH)
         {
             air_insn_t* push = air_insn_init(AIR_PUSH, 1);
-            push->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+            push->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
             push->ops[0] = air_insn_indirect_register_operand_init(argreg, progress, INVALID_VREGID, 1);
             air_insn_insert_before(push, loc);
             return push;
@@ -307,7 +308,7 @@ air_insn_t* store_eightbyte_on_stack(air_insn_t* loc, air_insn_t* tempdef, c_typ
         regid_t tmpreg = NEXT_VIRTUAL_REGISTER;
 
         air_insn_t* init = air_insn_init(AIR_LOAD, 2);
-        init->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+        init->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
         init->ops[0] = air_insn_register_operand_init(tmpreg);
         init->ops[1] = air_insn_integer_constant_operand_init(0);
         air_insn_insert_before(init, loc);
@@ -322,7 +323,7 @@ air_insn_t* store_eightbyte_on_stack(air_insn_t* loc, air_insn_t* tempdef, c_typ
             long long remaining = total_remaining - copied;
 
             // create the type that can fit the largest number of bytes we still need to copy
-            c_type_t* cyt = make_basic_type(largest_type_class_for_eightbyte(remaining));
+            c_type_t* cyt = type_canonical_basic(TYPES, largest_type_class_for_eightbyte(remaining));
             long long cytsize = type_size(cyt);
 
             // if this isn't the first time adding to the temporary,
@@ -331,7 +332,7 @@ air_insn_t* store_eightbyte_on_stack(air_insn_t* loc, air_insn_t* tempdef, c_typ
             if (copied)
             {
                 air_insn_t* shl = air_insn_init(AIR_DIRECT_SHIFT_LEFT, 2);
-                shl->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+                shl->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
                 shl->ops[0] = air_insn_register_operand_init(tmpreg);
                 shl->ops[1] = air_insn_integer_constant_operand_init(type_size(cyt) << 3);
                 air_insn_insert_before(shl, loc);
@@ -350,7 +351,7 @@ air_insn_t* store_eightbyte_on_stack(air_insn_t* loc, air_insn_t* tempdef, c_typ
 
         // then push the temporary
         air_insn_t* push = air_insn_init(AIR_PUSH, 1);
-        push->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+        push->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
         push->ops[0] = air_insn_register_operand_init(tmpreg);
         air_insn_insert_before(push, loc);
 
@@ -360,7 +361,7 @@ air_insn_t* store_eightbyte_on_stack(air_insn_t* loc, air_insn_t* tempdef, c_typ
     // look how easy it is when we don't have to do dumb garbage!
     // just a quick push onto the stack!
     air_insn_t* push = air_insn_init(AIR_PUSH, 1);
-    push->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    push->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     push->ops[0] = air_insn_register_operand_init(argreg);
     air_insn_insert_before(push, loc);
     return push;
@@ -393,7 +394,7 @@ air_insn_t* store_eightbyte_in_register(air_insn_t* loc, air_insn_t* tempdef, c_
         if (total_remaining >= UNSIGNED_LONG_LONG_INT_WIDTH)
         {
             air_insn_t* deref = air_insn_init(AIR_LOAD, 2);
-            deref->ct = make_basic_type(x86_64_is_sse_register(dest) ? CTC_DOUBLE : CTC_UNSIGNED_LONG_LONG_INT);
+            deref->ct = type_canonical_basic(TYPES, x86_64_is_sse_register(dest) ? CTC_DOUBLE : CTC_UNSIGNED_LONG_LONG_INT);
             deref->ops[0] = air_insn_register_operand_init(dest);
             deref->ops[1] = air_insn_indirect_register_operand_init(argreg, progress, INVALID_VREGID, 1);
             air_insn_insert_before(deref, loc);
@@ -411,7 +412,7 @@ air_insn_t* store_eightbyte_in_register(air_insn_t* loc, air_insn_t* tempdef, c_
 
             // find the type that can fit the largest number of bytes
             // for the amount remaining
-            c_type_t* cyt = make_basic_type(x86_64_is_sse_register(dest) ?
+            c_type_t* cyt = type_canonical_basic(TYPES, x86_64_is_sse_register(dest) ?
                 largest_sse_type_class_for_eightbyte(remaining) : largest_type_class_for_eightbyte(remaining));
             long long cytsize = type_size(cyt);
 
@@ -419,7 +420,7 @@ air_insn_t* store_eightbyte_in_register(air_insn_t* loc, air_insn_t* tempdef, c_
             if (copied)
             {
                 air_insn_t* shl = air_insn_init(AIR_DIRECT_SHIFT_LEFT, 2);
-                shl->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+                shl->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
                 shl->ops[0] = air_insn_register_operand_init(dest);
                 shl->ops[1] = air_insn_integer_constant_operand_init(type_size(cyt) << 3);
                 air_insn_insert_before(shl, loc);
@@ -445,15 +446,33 @@ air_insn_t* store_eightbyte_in_register(air_insn_t* loc, air_insn_t* tempdef, c_
 
     // if there's no garbage, we just do a skraight load
     air_insn_t* assign = air_insn_init(AIR_LOAD, 2);
-    assign->ct = type_copy(ct);
+    assign->ct = type_canonical(TYPES, ct);
     assign->ops[0] = air_insn_register_operand_init(dest);
     assign->ops[1] = air_insn_register_operand_init(argreg);
     air_insn_insert_before(assign, loc);
     return assign;
 }
 
+// the main loop keeps track of the latest definition it's gone past for each temporary, so finding
+// the one an argument comes from doesn't take a walk back up the routine every call.
+// localizing an instruction can replace it, or put new ones in front of it, so everything from where
+// it was up to where the loop picks up again is looked at after it's been localized.
+static void localize_saw_definitions(map_t* defs, air_insn_t* from, air_insn_t* to)
+{
+    for (air_insn_t* insn = from; insn && insn != to->next; insn = insn->next)
+    {
+        if (!air_insn_creates_temporary(insn)) continue;
+        map_add(defs, (void*) insn->ops[0]->content.reg, insn);
+    }
+}
+
+static air_insn_t* localize_find_definition(map_t* defs, regid_t tmp)
+{
+    return map_get(defs, (void*) tmp);
+}
+
 // guyyyyy this sucks (it really doesn't)
-void localize_x86_64_func_call_args(air_insn_t* insn, air_routine_t* routine, air_t* air)
+void localize_x86_64_func_call_args(air_insn_t* insn, air_routine_t* routine, air_t* air, map_t* defs)
 {
     // ignore if there's no arguments
     if (insn->noops <= 2) return;
@@ -478,7 +497,7 @@ void localize_x86_64_func_call_args(air_insn_t* insn, air_routine_t* routine, ai
         if (op->type != AOP_REGISTER && op->type != AOP_INDIRECT_REGISTER) assert_fail;
 
         // find the definition for the temporary used here as an argument
-        air_insn_t* tempdef = air_insn_find_temporary_definition_above(op->type == AOP_REGISTER ? op->content.reg : op->content.inreg.id, insn);
+        air_insn_t* tempdef = localize_find_definition(defs, op->type == AOP_REGISTER ? op->content.reg : op->content.inreg.id);
         if (!tempdef) assert_fail;
 
         // so that we can get its type
@@ -522,7 +541,7 @@ void localize_x86_64_func_call_args(air_insn_t* insn, air_routine_t* routine, ai
     {
         // create and declare a local variable of the struct type
         symbol_t* sy = symbol_table_add(SYMBOL_TABLE, "__anonymous_lv__", symbol_init(NULL));
-        sy->type = type_copy(insn->ct->derived_from);
+        sy->type = type_canonical(TYPES, insn->ct->derived_from);
 
         air_insn_t* decl = air_insn_init(AIR_DECLARE, 1);
         decl->ops[0] = air_insn_symbol_operand_init(sy);
@@ -530,7 +549,7 @@ void localize_x86_64_func_call_args(air_insn_t* insn, air_routine_t* routine, ai
 
         // and then give the address of that local variable to %rdi
         air_insn_t* loadaddr = air_insn_init(AIR_LOAD_ADDR, 2);
-        loadaddr->ct = type_copy(insn->ct);
+        loadaddr->ct = type_canonical(TYPES, insn->ct);
         loadaddr->ops[0] = air_insn_register_operand_init(X86R_RDI);
         loadaddr->ops[1] = air_insn_symbol_operand_init(sy);
         air_insn_insert_before(loadaddr, insn);
@@ -540,7 +559,7 @@ void localize_x86_64_func_call_args(air_insn_t* insn, air_routine_t* routine, ai
     // if (nextssereg - X86R_XMM0 > 0)
     // {
     //     air_insn_t* assign = air_insn_init(AIR_ASSIGN, 2);
-    //     assign->ct = make_basic_type(CTC_UNSIGNED_CHAR);
+    //     assign->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_CHAR);
     //     assign->ops[0] = air_insn_register_operand_init(X86R_RAX);
     //     assign->ops[1] = air_insn_integer_constant_operand_init(nextssereg - X86R_XMM0);
     //     air_insn_insert_before(assign, insn);
@@ -579,7 +598,7 @@ INTEGER:
 
 */
 
-static air_insn_t* blip_volatiles_after(air_insn_t* insn)
+static air_insn_t* blip_volatiles_after(air_insn_t* insn, air_t* air)
 {
     static const regid_t volatile_integer_registers[] = {
         X86R_RAX,
@@ -611,7 +630,7 @@ static air_insn_t* blip_volatiles_after(air_insn_t* insn)
     {
         regid_t reg = volatile_integer_registers[i];
         air_insn_t* decl = air_insn_init(AIR_BLIP, 1);
-        decl->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+        decl->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
         decl->ops[0] = air_insn_register_operand_init(reg);
         pos = air_insn_insert_after(decl, pos);
     }
@@ -620,7 +639,7 @@ static air_insn_t* blip_volatiles_after(air_insn_t* insn)
     {
         regid_t reg = volatile_sse_registers[i];
         air_insn_t* decl = air_insn_init(AIR_BLIP, 1);
-        decl->ct = make_basic_type(CTC_DOUBLE);
+        decl->ct = type_canonical_basic(TYPES, CTC_DOUBLE);
         decl->ops[0] = air_insn_register_operand_init(reg);
         pos = air_insn_insert_after(decl, pos);
     }
@@ -649,7 +668,7 @@ void localize_x86_64_func_call_return(air_insn_t* insn, air_routine_t* routine,
     if (insn->metadata.fcall_sret)
         ct = ct->derived_from;
 
-    air_insn_t* pos = blip_volatiles_after(insn);
+    air_insn_t* pos = blip_volatiles_after(insn, air);
 
     if (ct->class == CTC_VOID)
         return;
@@ -670,7 +689,7 @@ void localize_x86_64_func_call_return(air_insn_t* insn, air_routine_t* routine,
     {
         // load the actual value
         air_insn_t* load = air_insn_init(AIR_LOAD, 2);
-        load->ct = type_copy(insn->ct);
+        load->ct = type_canonical(TYPES, insn->ct);
         load->ops[0] = air_insn_register_operand_init(resreg);
         load->ops[1] = air_insn_register_operand_init(X86R_RAX);
         pos = air_insn_insert_after(load, pos);
@@ -684,7 +703,7 @@ void localize_x86_64_func_call_return(air_insn_t* insn, air_routine_t* routine,
     {
         // load the actual value
         air_insn_t* load = air_insn_init(AIR_LOAD, 2);
-        load->ct = type_copy(insn->ct);
+        load->ct = type_canonical(TYPES, insn->ct);
         load->ops[0] = air_insn_register_operand_init(resreg);
         load->ops[1] = air_insn_register_operand_init(X86R_XMM0);
         pos = air_insn_insert_after(load, pos);
@@ -705,7 +724,7 @@ void localize_x86_64_func_call_return(air_insn_t* insn, air_routine_t* routine,
 
     // create and declare a local variable to load the struct data into
     symbol_t* lv = symbol_table_add(SYMBOL_TABLE, "__anonymous_lv__", symbol_init(NULL));
-    lv->type = type_copy(ct);
+    lv->type = type_canonical(TYPES, ct);
 
     air_insn_t* decl = air_insn_init(AIR_DECLARE, 1);
     decl->ops[0] = air_insn_symbol_operand_init(lv);
@@ -714,7 +733,7 @@ void localize_x86_64_func_call_return(air_insn_t* insn, air_routine_t* routine,
 
     // load the address of the local variable we just created
     air_insn_t* loadaddr = air_insn_init(AIR_LOAD_ADDR, 2);
-    loadaddr->ct = make_reference_type(ct);
+    loadaddr->ct = type_canonical_reference(TYPES, ct);
     loadaddr->ops[0] = air_insn_register_operand_init(resreg);
     loadaddr->ops[1] = air_insn_symbol_operand_init(lv);
     pos = air_insn_insert_after(loadaddr, pos);
@@ -739,7 +758,7 @@ void localize_x86_64_func_call_return(air_insn_t* insn, air_routine_t* routine,
 
                 // keep on loading!
                 air_insn_t* assign = air_insn_init(AIR_ASSIGN, 2);
-                assign->ct = make_basic_type(class == ARG_INTEGER ? largest_type_class_for_eightbyte(remaining) :
+                assign->ct = type_canonical_basic(TYPES, class == ARG_INTEGER ? largest_type_class_for_eightbyte(remaining) :
                     largest_sse_type_class_for_eightbyte(remaining));
                 long long csize = type_size(assign->ct);
                 assign->ops[0] = air_insn_indirect_register_operand_init(resreg, (i * 8) + copied, INVALID_VREGID, 1);
@@ -752,7 +771,7 @@ void localize_x86_64_func_call_return(air_insn_t* insn, air_routine_t* routine,
                     continue;
 
                 air_insn_t* shr = air_insn_init(AIR_DIRECT_SHIFT_RIGHT, 2);
-                shr->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+                shr->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
                 shr->ops[0] = air_insn_register_operand_init(reg);
                 shr->ops[1] = air_insn_integer_constant_operand_init(csize << 3);
                 pos = air_insn_insert_after(shr, pos);
@@ -770,10 +789,10 @@ void localize_x86_64_func_call_return(air_insn_t* insn, air_routine_t* routine,
 }
 
 // inserts necessary System V ABI loads and stores around the call site
-void localize_x86_64_func_call(air_insn_t* insn, air_routine_t* routine, air_t* air)
+void localize_x86_64_func_call(air_insn_t* insn, air_routine_t* routine, air_t* air, map_t* defs)
 {
     localize_x86_64_func_call_return(insn, routine, air);
-    localize_x86_64_func_call_args(insn, routine, air);
+    localize_x86_64_func_call_args(insn, routine, air, defs);
 }
 
 /*
@@ -842,12 +861,12 @@ void localize_x86_64_divide_modulo(air_insn_t* insn, air_routine_t* routine, air
     if (insn->ops[0]->type != AOP_REGISTER) assert_fail;
     if (insn->ops[1]->type != AOP_REGISTER) assert_fail;
     air_insn_t* assign_top = air_insn_init(AIR_LOAD, 2);
-    assign_top->ct = type_copy(insn->ct);
+    assign_top->ct = type_canonical(TYPES, insn->ct);
     assign_top->ops[0] = air_insn_register_operand_init(X86R_RAX);
     assign_top->ops[1] = air_insn_register_operand_init(insn->ops[1]->content.reg);
     air_insn_insert_before(assign_top, insn);
     air_insn_t* zero_rdx = air_insn_init(AIR_LOAD, 2);
-    zero_rdx->ct = type_copy(insn->ct);
+    zero_rdx->ct = type_canonical(TYPES, insn->ct);
     zero_rdx->ops[0] = air_insn_register_operand_init(X86R_RDX);
     zero_rdx->ops[1] = air_insn_integer_constant_operand_init(0);
     air_insn_insert_before(zero_rdx, insn);
@@ -855,7 +874,7 @@ void localize_x86_64_divide_modulo(air_insn_t* insn, air_routine_t* routine, air
     insn->ops[0]->content.reg = hresultreg;
     insn->ops[1]->content.reg = INVALID_VREGID;
     air_insn_t* load_result = air_insn_init(AIR_LOAD, 2);
-    load_result->ct = type_copy(insn->ct);
+    load_result->ct = type_canonical(TYPES, insn->ct);
     load_result->ops[0] = air_insn_register_operand_init(resultreg);
     load_result->ops[1] = air_insn_register_operand_init(hresultreg);
     air_insn_insert_after(load_result, insn);
@@ -895,19 +914,19 @@ void localize_x86_64_direct_divide_modulo(air_insn_t* insn, air_routine_t* routi
     if (insn->ops[0]->type != AOP_REGISTER && insn->ops[0]->type != AOP_INDIRECT_REGISTER) assert_fail;
     if (insn->ops[1]->type != AOP_REGISTER) assert_fail;
     air_insn_t* assign_top = air_insn_init(AIR_LOAD, 2);
-    assign_top->ct = type_copy(insn->ct);
+    assign_top->ct = type_canonical(TYPES, insn->ct);
     assign_top->ops[0] = air_insn_register_operand_init(X86R_RAX);
     assign_top->ops[1] = air_insn_operand_copy(insn->ops[0]);
     air_insn_insert_before(assign_top, insn);
     air_insn_t* zero_rdx = air_insn_init(AIR_LOAD, 2);
-    zero_rdx->ct = type_copy(insn->ct);
+    zero_rdx->ct = type_canonical(TYPES, insn->ct);
     zero_rdx->ops[0] = air_insn_register_operand_init(X86R_RDX);
     zero_rdx->ops[1] = air_insn_integer_constant_operand_init(0);
     air_insn_insert_before(zero_rdx, insn);
     regid_t resultreg = insn->ops[1]->content.reg;
     insn->ops[0]->content.reg = INVALID_VREGID;
     air_insn_t* load_result = air_insn_init(AIR_LOAD, 2);
-    load_result->ct = type_copy(insn->ct);
+    load_result->ct = type_canonical(TYPES, insn->ct);
     load_result->ops[0] = air_insn_register_operand_init(resultreg);
     load_result->ops[1] = air_insn_register_operand_init(hresultreg);
     air_insn_insert_after(load_result, insn);
@@ -933,7 +952,7 @@ void localize_x86_64_multiply(air_insn_t* insn, air_routine_t* routine, air_t* a
     try_extract_integer_constant(insn, air, 2, insn->ct);
     
     air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-    ld->ct = insn->ops[1]->ct ? type_copy(insn->ops[1]->ct) : type_copy(insn->ct);
+    ld->ct = type_canonical(TYPES, insn->ops[1]->ct ? insn->ops[1]->ct : insn->ct);
     ld->ops[0] = air_insn_register_operand_init(X86R_RAX);
     ld->ops[1] = air_insn_operand_copy(insn->ops[1]);
     air_insn_insert_before(ld, insn);
@@ -942,7 +961,7 @@ void localize_x86_64_multiply(air_insn_t* insn, air_routine_t* routine, air_t* a
     insn->ops[1] = air_insn_register_operand_init(X86R_RAX);
 
     air_insn_t* blip = air_insn_init(AIR_BLIP, 1);
-    blip->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    blip->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     blip->ops[0] = air_insn_register_operand_init(X86R_RDX);
     air_insn_insert_after(blip, insn);
 }
@@ -965,7 +984,7 @@ void localize_x86_64_direct_multiply(air_insn_t* insn, air_routine_t* routine, a
         return;
 
     air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-    ld->ct = insn->ops[0]->ct ? type_copy(insn->ops[0]->ct) : type_copy(insn->ct);
+    ld->ct = type_canonical(TYPES, insn->ops[0]->ct ? insn->ops[0]->ct : insn->ct);
     ld->ops[0] = air_insn_register_operand_init(X86R_RAX);
     ld->ops[1] = air_insn_operand_copy(insn->ops[0]);
     air_insn_insert_before(ld, insn);
@@ -974,13 +993,13 @@ void localize_x86_64_direct_multiply(air_insn_t* insn, air_routine_t* routine, a
     insn->ops[0] = air_insn_register_operand_init(X86R_RAX);
 
     air_insn_t* assign = air_insn_init(AIR_ASSIGN, 2);
-    assign->ct = type_copy(insn->ct);
+    assign->ct = type_canonical(TYPES, insn->ct);
     assign->ops[0] = air_insn_operand_copy(insn->ops[0]);
     assign->ops[1] = air_insn_register_operand_init(X86R_RAX);
     air_insn_insert_after(assign, insn);
 
     air_insn_t* blip = air_insn_init(AIR_BLIP, 1);
-    blip->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    blip->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     blip->ops[0] = air_insn_register_operand_init(X86R_RDX);
     air_insn_insert_after(blip, insn);
 }
@@ -1085,7 +1104,7 @@ void localize_x86_64_return(air_insn_t* insn, air_routine_t* routine, air_t* air
         for (long long copied = 0; copied < rtsize;)
         {
             long long remaining = rtsize - copied;
-            c_type_t* copytype = make_basic_type(largest_type_class_for_eightbyte(remaining));
+            c_type_t* copytype = type_canonical_basic(TYPES, largest_type_class_for_eightbyte(remaining));
 
             regid_t tempreg = NEXT_VIRTUAL_REGISTER;
 
@@ -1096,7 +1115,7 @@ void localize_x86_64_return(air_insn_t* insn, air_routine_t* routine, air_t* air
             pos = air_insn_insert_after(ld, pos);
 
             air_insn_t* copy = air_insn_init(AIR_ASSIGN, 2);
-            copy->ct = type_copy(copytype);
+            copy->ct = type_canonical(TYPES, copytype);
             copy->ops[0] = air_insn_indirect_symbol_operand_init(routine->retptr, copied);
             copy->ops[1] = air_insn_register_operand_init(tempreg);
             pos = air_insn_insert_after(copy, pos);
@@ -1109,7 +1128,7 @@ void localize_x86_64_return(air_insn_t* insn, air_routine_t* routine, air_t* air
     if (type_is_integer(rettype) || rettype->class == CTC_ARRAY || rettype->class == CTC_POINTER)
     {
         air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-        ld->ct = type_copy(rettype);
+        ld->ct = type_canonical(TYPES, rettype);
         ld->ops[0] = air_insn_register_operand_init(X86R_RAX);
         ld->ops[1] = air_insn_register_operand_init(retreg);
         pos = air_insn_insert_after(ld, pos);
@@ -1119,7 +1138,7 @@ void localize_x86_64_return(air_insn_t* insn, air_routine_t* routine, air_t* air
     if (type_is_sse_floating(rettype))
     {
         air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-        ld->ct = type_copy(rettype);
+        ld->ct = type_canonical(TYPES, rettype);
         ld->ops[0] = air_insn_register_operand_init(X86R_XMM0);
         ld->ops[1] = air_insn_register_operand_init(retreg);
         pos = air_insn_insert_after(ld, pos);
@@ -1146,14 +1165,14 @@ void localize_x86_64_return(air_insn_t* insn, air_routine_t* routine, air_t* air
             for (long long copied = 0; copied < copy_size;)
             {
                 long long remaining = copy_size - copied;
-                c_type_t* copytype = make_basic_type(class == ARG_SSE ?
+                c_type_t* copytype = type_canonical_basic(TYPES, class == ARG_SSE ?
                     largest_sse_type_class_for_eightbyte(remaining) : largest_type_class_for_eightbyte(remaining));
                 long long cpytsize = type_size(copytype);
 
                 if (copied)
                 {
                     air_insn_t* shl = air_insn_init(AIR_DIRECT_SHIFT_LEFT, 2);
-                    shl->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+                    shl->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
                     shl->ops[0] = air_insn_register_operand_init(integer_return_sequence[next_intretreg]);
                     shl->ops[1] = air_insn_integer_constant_operand_init(cpytsize << 3);
                     pos = air_insn_insert_after(shl, pos);
@@ -1208,14 +1227,14 @@ void localize_x86_64_routine_before(air_routine_t* routine, air_t* air)
 
         // create and declare a local variable to store the ptr for the return value
         symbol_t* sy = symbol_table_add(air->st, "__anonymous_lv__", symbol_init(NULL));
-        sy->type = make_reference_type(rettype);
+        sy->type = type_canonical_reference(TYPES, rettype);
 
         air_insn_t* decl = air_insn_init(AIR_DECLARE, 1);
         decl->ops[0] = air_insn_symbol_operand_init(sy);
 
         // assign %rdi to the local variable
         air_insn_t* assign = air_insn_init(AIR_ASSIGN, 2);
-        assign->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+        assign->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
         assign->ops[0] = air_insn_symbol_operand_init(sy);
         assign->ops[1] = air_insn_register_operand_init(nextintreg++);
 
@@ -1265,7 +1284,7 @@ void localize_x86_64_routine_before(air_routine_t* routine, air_t* air)
             {
                 reg = nextintreg++;
                 air_insn_t* insn = air_insn_init(AIR_DECLARE_REGISTER, 1);
-                insn->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+                insn->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
                 insn->ops[0] = air_insn_register_operand_init(reg);
                 inserting = air_insn_insert_after(insn, inserting);
             }
@@ -1273,14 +1292,14 @@ void localize_x86_64_routine_before(air_routine_t* routine, air_t* air)
             {
                 reg = nextssereg++;
                 air_insn_t* insn = air_insn_init(AIR_DECLARE_REGISTER, 1);
-                insn->ct = make_basic_type(CTC_DOUBLE);
+                insn->ct = type_canonical_basic(TYPES, CTC_DOUBLE);
                 insn->ops[0] = air_insn_register_operand_init(reg);
                 inserting = air_insn_insert_after(insn, inserting);
             }
             else if (class == ARG_MEMORY || class == ARG_INTEGER || class == ARG_SSE)
             {
                 air_insn_t* insn = air_insn_init(AIR_LOAD, 2);
-                insn->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+                insn->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
                 insn->ops[0] = air_insn_register_operand_init(reg = NEXT_VIRTUAL_REGISTER);
                 insn->ops[1] = air_insn_indirect_register_operand_init(X86R_RBP, nexteightbyteoffset, INVALID_VREGID, 1);
                 nexteightbyteoffset += 8;
@@ -1291,7 +1310,7 @@ void localize_x86_64_routine_before(air_routine_t* routine, air_t* air)
             for (long long copied = 0; copied < to_be_copied;)
             {
                 long long remaining = to_be_copied - copied;
-                c_type_t* tt = make_basic_type(class == ARG_SSE ? 
+                c_type_t* tt = type_canonical_basic(TYPES, class == ARG_SSE ? 
                     largest_sse_type_class_for_eightbyte(remaining) : largest_type_class_for_eightbyte(remaining));
                 long long ttsize = type_size(tt);
 
@@ -1309,7 +1328,7 @@ void localize_x86_64_routine_before(air_routine_t* routine, air_t* air)
                     continue;
                 
                 air_insn_t* shr = air_insn_init(AIR_DIRECT_SHIFT_RIGHT, 2);
-                shr->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+                shr->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
                 shr->ops[0] = air_insn_register_operand_init(reg);
                 shr->ops[1] = air_insn_integer_constant_operand_init(ttsize << 3);
 
@@ -1391,43 +1410,43 @@ air_insn_t* localize_x86_64_va_start(air_insn_t* insn, air_routine_t* routine, a
     regid_t valist_reg = insn->ops[1]->content.reg;
 
     air_insn_t* ld_rbp = air_insn_init(AIR_LOAD, 2);
-    ld_rbp->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    ld_rbp->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     ld_rbp->ops[0] = air_insn_register_operand_init(reg);
     ld_rbp->ops[1] = air_insn_register_operand_init(X86R_RBP);
     air_insn_insert_before(ld_rbp, insn);
 
     air_insn_t* sub = air_insn_init(AIR_DIRECT_SUBTRACT, 2);
-    sub->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    sub->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     sub->ops[0] = air_insn_register_operand_init(reg);
     sub->ops[1] = air_insn_integer_constant_operand_init(llabs(sseoffset));
     air_insn_insert_before(sub, insn);
 
     air_insn_t* ld_ssepos = air_insn_init(AIR_ASSIGN, 2);
-    ld_ssepos->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    ld_ssepos->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     ld_ssepos->ops[0] = air_insn_indirect_register_operand_init(valist_reg, 8, INVALID_VREGID, 1);
     ld_ssepos->ops[1] = air_insn_register_operand_init(reg);
     air_insn_insert_before(ld_ssepos, insn);
 
     air_insn_t* add1 = air_insn_init(AIR_DIRECT_ADD, 2);
-    add1->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    add1->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     add1->ops[0] = air_insn_register_operand_init(reg);
     add1->ops[1] = air_insn_integer_constant_operand_init(intoffset - sseoffset);
     air_insn_insert_before(add1, insn);
 
     air_insn_t* ld_intpos = air_insn_init(AIR_ASSIGN, 2);
-    ld_intpos->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    ld_intpos->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     ld_intpos->ops[0] = air_insn_indirect_register_operand_init(valist_reg, 0, INVALID_VREGID, 1);
     ld_intpos->ops[1] = air_insn_register_operand_init(reg);
     air_insn_insert_before(ld_intpos, insn);
 
     air_insn_t* add2 = air_insn_init(AIR_DIRECT_ADD, 2);
-    add2->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    add2->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     add2->ops[0] = air_insn_register_operand_init(reg);
     add2->ops[1] = air_insn_integer_constant_operand_init(stackoffset - intoffset);
     air_insn_insert_before(add2, insn);
 
     air_insn_t* ld_stackpos = air_insn_init(AIR_ASSIGN, 2);
-    ld_stackpos->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    ld_stackpos->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     ld_stackpos->ops[0] = air_insn_indirect_register_operand_init(valist_reg, 16, INVALID_VREGID, 1);
     ld_stackpos->ops[1] = air_insn_register_operand_init(reg);
     air_insn_insert_before(ld_stackpos, insn);
@@ -1475,19 +1494,19 @@ air_insn_t* localize_x86_64_va_arg(air_insn_t* insn, air_routine_t* routine, air
     regid_t posreg = NEXT_VIRTUAL_REGISTER;
 
     air_insn_t* ld_pos = air_insn_init(AIR_LOAD, 2);
-    ld_pos->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    ld_pos->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     ld_pos->ops[0] = air_insn_register_operand_init(posreg);
     ld_pos->ops[1] = air_insn_indirect_register_operand_init(valist_reg, offset, INVALID_VREGID, 1);
     air_insn_insert_before(ld_pos, insn);
 
     air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-    ld->ct = type_copy(insn->ct);
+    ld->ct = type_canonical(TYPES, insn->ct);
     ld->ops[0] = air_insn_register_operand_init(reg);
     ld->ops[1] = air_insn_indirect_register_operand_init(posreg, 0, INVALID_VREGID, 1);
     air_insn_insert_before(ld, insn);
 
     air_insn_t* add = air_insn_init(AIR_DIRECT_ADD, 2);
-    add->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    add->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     add->ops[0] = air_insn_indirect_register_operand_init(valist_reg, offset, INVALID_VREGID, 1);
     add->ops[1] = air_insn_integer_constant_operand_init(increment);
     air_insn_insert_before(add, insn);
@@ -1519,7 +1538,7 @@ void localize_x86_64_setcc_comparison(air_insn_t* insn, air_routine_t* routine,
     regid_t reg = insn->ops[0]->content.reg;
 
     air_insn_t* and = air_insn_init(AIR_DIRECT_AND, 2);
-    and->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    and->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     and->ops[0] = air_insn_register_operand_init(reg);
     and->ops[1] = air_insn_integer_constant_operand_init(1);
     air_insn_insert_after(and, insn);
@@ -1536,7 +1555,7 @@ void localize_x86_64_shift(air_insn_t* insn, air_routine_t* routine, air_t* air,
         assert_fail;
 
     air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-    ld->ct = type_copy(insn->ct);
+    ld->ct = type_canonical(TYPES, insn->ct);
     ld->ops[0] = air_insn_register_operand_init(X86R_RCX);
     ld->ops[1] = air_insn_register_operand_init(insn->ops[index]->content.reg);
     air_insn_insert_before(ld, insn);
@@ -1563,14 +1582,14 @@ air_insn_t* localize_x86_64_sse_negate(air_insn_t* insn, air_routine_t* routine,
     {
         negater = air->sse32_negater = symbol_table_add(SYMBOL_TABLE, "__sse32_negater", symbol_init(NULL));
         negater->name = strdup("__sse32_negater");
-        negater->type = make_basic_type(CTC_FLOAT);
+        negater->type = type_canonical_basic(TYPES, CTC_FLOAT);
         negater->sd = SD_STATIC;
     }
     if (!negater && !is_float)
     {
         negater = air->sse64_negater = symbol_table_add(SYMBOL_TABLE, "__sse64_negater", symbol_init(NULL));
         negater->name = strdup("__sse64_negater");
-        negater->type = make_basic_type(CTC_DOUBLE);
+        negater->type = type_canonical_basic(TYPES, CTC_DOUBLE);
         negater->sd = SD_STATIC;
     }
 
@@ -1581,13 +1600,15 @@ air_insn_t* localize_x86_64_sse_negate(air_insn_t* insn, air_routine_t* routine,
         data->sy = negater;
         if (is_float)
         {
-            data->data = malloc(FLOAT_WIDTH);
-            *((unsigned*) (data->data)) = 0x80000000;
+            unsigned mask = 0x80000000;
+            data->image = image_init(FLOAT_WIDTH);
+            image_write(data->image, 0, &mask, FLOAT_WIDTH);
         }
         else
         {
-            data->data = malloc(DOUBLE_WIDTH);
-            *((unsigned long long*) (data->data)) = 0x8000000000000000;
+            unsigned long long mask = 0x8000000000000000;
+            data->image = image_init(DOUBLE_WIDTH);
+            image_write(data->image, 0, &mask, DOUBLE_WIDTH);
         }
         vector_add(air->rodata, data);
     }
@@ -1595,13 +1616,13 @@ air_insn_t* localize_x86_64_sse_negate(air_insn_t* insn, air_routine_t* routine,
     regid_t negater_reg = NEXT_VIRTUAL_REGISTER;
 
     air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-    ld->ct = type_copy(insn->ct);
+    ld->ct = type_canonical(TYPES, insn->ct);
     ld->ops[0] = air_insn_register_operand_init(negater_reg);
     ld->ops[1] = air_insn_symbol_operand_init(negater);
     air_insn_insert_before(ld, insn);
 
     air_insn_t* xor = air_insn_init(AIR_XOR, 3);
-    xor->ct = type_copy(insn->ct);
+    xor->ct = type_canonical(TYPES, insn->ct);
     xor->ops[0] = air_insn_operand_copy(insn->ops[0]);
     xor->ops[1] = air_insn_operand_copy(insn->ops[1]);
     xor->ops[2] = air_insn_register_operand_init(negater_reg);
@@ -1626,19 +1647,19 @@ void localize_x86_64_memset(air_insn_t* insn, air_routine_t* routine, air_t* air
     air_insn_operand_t* op3 = insn->ops[2];
 
     air_insn_t* ldv = air_insn_init(AIR_LOAD, 2);
-    ldv->ct = make_basic_type(CTC_UNSIGNED_CHAR);
+    ldv->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_CHAR);
     ldv->ops[0] = air_insn_register_operand_init(X86R_RAX);
     ldv->ops[1] = air_insn_operand_copy(op1);
     air_insn_insert_before(ldv, insn);
 
     air_insn_t* ldptr = air_insn_init(AIR_LOAD_ADDR, 2);
-    ldptr->ct = type_copy(insn->ct);
+    ldptr->ct = type_canonical(TYPES, insn->ct);
     ldptr->ops[0] = air_insn_register_operand_init(X86R_RDI);
     ldptr->ops[1] = air_insn_operand_copy(op2);
     air_insn_insert_before(ldptr, insn);
 
     air_insn_t* ldc = air_insn_init(AIR_LOAD, 2);
-    ldc->ct = make_basic_type(C_TYPE_SIZE_T);
+    ldc->ct = type_canonical_basic(TYPES, C_TYPE_SIZE_T);
     ldc->ops[0] = air_insn_register_operand_init(X86R_RCX);
     ldc->ops[1] = air_insn_operand_copy(op3);
     air_insn_insert_before(ldc, insn);
@@ -1648,7 +1669,7 @@ void localize_x86_64_memset(air_insn_t* insn, air_routine_t* routine, air_t* air
     air_insn_operand_delete(op3);
 
     insn->ops[0] = air_insn_register_operand_init(X86R_RAX);
-    insn->ops[0]->ct = make_basic_type(CTC_UNSIGNED_CHAR);
+    insn->ops[0]->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_CHAR);
     insn->ops[1] = air_insn_register_operand_init(X86R_RDI);
     insn->ops[2] = air_insn_register_operand_init(X86R_RCX);
 }
@@ -1663,7 +1684,7 @@ void localize_x86_64_assign_imm64_to_m64(air_insn_t* insn, air_routine_t* routin
     regid_t reg = NEXT_VIRTUAL_REGISTER;
 
     air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-    ld->ct = type_copy(insn->ct);
+    ld->ct = type_canonical(TYPES, insn->ct);
     ld->ops[0] = air_insn_register_operand_init(reg);
     ld->ops[1] = air_insn_operand_copy(op2);
     air_insn_insert_before(ld, insn);
@@ -1695,7 +1716,7 @@ blip volatiles;
 
 */
 
-void localize_x86_64_lsyscall(air_insn_t* insn, air_routine_t* routine, air_t* air)
+void localize_x86_64_lsyscall(air_insn_t* insn, air_routine_t* routine, air_t* air, map_t* defs)
 {
     static regid_t sequence[] = {
         X86R_RDI,
@@ -1711,11 +1732,13 @@ void localize_x86_64_lsyscall(air_insn_t* insn, air_routine_t* routine, air_t* a
         air_insn_operand_t* op = insn->ops[i];
         if (!op || op->type != AOP_REGISTER) assert_fail;
 
-        air_insn_t* def = air_insn_find_temporary_definition_from_insn(op->content.reg, insn);
+        air_insn_t* def = localize_find_definition(defs, op->content.reg);
+        if (!def)
+            def = air_insn_find_temporary_definition_below(op->content.reg, insn);
         if (!def) assert_fail;
 
         air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-        ld->ct = type_copy(def->ct);
+        ld->ct = type_canonical(TYPES, def->ct);
         ld->ops[0] = air_insn_register_operand_init(sequence[nextreg++]);
         ld->ops[1] = air_insn_operand_copy(op);
         air_insn_insert_before(ld, insn);
@@ -1728,14 +1751,14 @@ void localize_x86_64_lsyscall(air_insn_t* insn, air_routine_t* routine, air_t* a
     if (!id_op || id_op->type != AOP_INTEGER_CONSTANT) assert_fail;
 
     air_insn_t* id_load = air_insn_init(AIR_LOAD, 2);
-    id_load->ct = make_basic_type(CTC_UNSIGNED_LONG_LONG_INT);
+    id_load->ct = type_canonical_basic(TYPES, CTC_UNSIGNED_LONG_LONG_INT);
     id_load->ops[0] = air_insn_register_operand_init(X86R_RAX);
     id_load->ops[1] = air_insn_integer_constant_operand_init(id_op->content.ic);
     air_insn_insert_before(id_load, insn);
     id_op->type = AOP_REGISTER;
     id_op->content.reg = INVALID_VREGID;
 
-    air_insn_t* pos = blip_volatiles_after(insn);
+    air_insn_t* pos = blip_volatiles_after(insn, air);
 
     air_insn_operand_t* rop = insn->ops[0];
 
@@ -1744,7 +1767,7 @@ void localize_x86_64_lsyscall(air_insn_t* insn, air_routine_t* routine, air_t* a
     regid_t rreg = rop->content.reg;
 
     air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
-    ld->ct = type_copy(insn->ct);
+    ld->ct = type_canonical(TYPES, insn->ct);
     ld->ops[0] = air_insn_register_operand_init(rreg);
     ld->ops[1] = air_insn_register_operand_init(X86R_RAX);
     pos = air_insn_insert_after(ld, pos);
@@ -1752,17 +1775,104 @@ void localize_x86_64_lsyscall(air_insn_t* insn, air_routine_t* routine, air_t* a
     rop->content.reg = INVALID_VREGID;
 }
 
+/*
+
+x86 arithmetic overwrites its first operand, so the code generator turns
+
+int _3 = _1 + _2;
+
+into _1 += _2 followed by _3 = _1. that's only right if nothing needs _1 afterward, which isn't so
+once an optimization has reused it (or it's used in a loop it was defined outside of), so those get
+a copy of their own to overwrite:
+
+int _4 = _1;
+int _3 = _4 + _2;
+
+*/
+
+static bool overwrites_first_operand(air_insn_t* insn)
+{
+    switch (insn->type)
+    {
+        case AIR_ADD:
+        case AIR_SUBTRACT:
+        case AIR_MULTIPLY:
+        case AIR_DIVIDE:
+        case AIR_AND:
+        case AIR_XOR:
+        case AIR_OR:
+        case AIR_SHIFT_LEFT:
+        case AIR_SHIFT_RIGHT:
+        case AIR_SIGNED_SHIFT_RIGHT:
+        case AIR_NEGATE:
+        case AIR_COMPLEMENT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// whether the value a temporary has at an instruction is still needed after it
+static bool is_live_after(cfg_t* cfg, air_insn_t* insn, regid_t reg)
+{
+    vector_t* defs = air_defuse_definitions(insn->defuse, reg);
+    vector_t* uses = air_defuse_uses(insn->defuse, reg);
+    if (!defs || defs->size != 1)
+    {
+        // merged from a phi: needed if it's used before it's defined again, or if that's not known within the block
+        cfg_block_t* block = cfg_find_block(cfg, insn);
+        for (air_insn_t* after = insn->next, * end = block->last->next; after != end; after = after->next)
+        {
+            if (air_insn_uses(after, reg))
+                return true;
+            if (air_insn_creates_temporary(after) && after->ops[0]->type == AOP_REGISTER && after->ops[0]->content.reg == reg)
+                return false;
+        }
+        return true;
+    }
+    air_insn_t* def = vector_get(defs, 0);
+    return air_insn_vector_search(uses, insn->order + 1) < uses->size || cfg_live_until(cfg, def, insn) != insn;
+}
+
+static void localize_x86_64_overwritten_operands(air_routine_t* routine, air_t* air)
+{
+    air_routine_index(routine);
+    cfg_t* cfg = cfg_init(routine);
+    for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
+    {
+        if (!overwrites_first_operand(insn) || insn->noops < 2 ||
+            insn->ops[0]->type != AOP_REGISTER || insn->ops[1]->type != AOP_REGISTER)
+            continue;
+        regid_t reg = insn->ops[1]->content.reg;
+        if (reg <= NO_PHYSICAL_REGISTERS || reg == insn->ops[0]->content.reg || !is_live_after(cfg, insn, reg))
+            continue;
+        air_insn_t* def = vector_get(air_defuse_definitions(routine->defuse, reg), 0);
+        air_insn_t* copy = air_insn_init(AIR_LOAD, 2);
+        copy->ct = type_canonical(TYPES, def && def->ct ? def->ct : insn->ct);
+        copy->ops[0] = air_insn_register_operand_init(NEXT_VIRTUAL_REGISTER);
+        copy->ops[1] = air_insn_register_operand_init(reg);
+        cfg_block_insert_before(cfg_find_block(cfg, insn), copy, insn);
+        air_defuse_t* defuse = air_insn_unindex(insn);
+        insn->ops[1]->content.reg = copy->ops[0]->content.reg;
+        air_insn_index(insn, defuse);
+    }
+    cfg_delete(cfg);
+    air_routine_unindex(routine);
+}
+
 void localize_x86_64(air_t* air)
 {
     VECTOR_FOR(air_routine_t*, routine, air->routines)
     {
         localize_x86_64_routine_before(routine, air);
+        map_t* defs = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
         for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
         {
+            air_insn_t* prev = insn->prev;
             switch (insn->type)
             {
                 case AIR_FUNC_CALL:
-                    localize_x86_64_func_call(insn, routine, air);
+                    localize_x86_64_func_call(insn, routine, air, defs);
                     break;
                 case AIR_RETURN:
                     localize_x86_64_return(insn, routine, air);
@@ -1823,12 +1933,15 @@ void localize_x86_64(air_t* air)
                     localize_x86_64_assign(insn, routine, air);
                     break;
                 case AIR_LSYSCALL:
-                    localize_x86_64_lsyscall(insn, routine, air);
+                    localize_x86_64_lsyscall(insn, routine, air, defs);
                     break;
                 default:
                     break;
             }
+            localize_saw_definitions(defs, prev ? prev->next : routine->insns, insn);
         }
+        map_delete(defs);
+        localize_x86_64_overwritten_operands(routine, air);
     }
 }
 
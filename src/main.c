@@ -6,7 +6,7 @@ ecc compilation process overview:
     - lex.c: the text is split into lexical preprocessing tokens
     - preprocess.c: preprocessing tokens are built into a tree structure reflecting the syntax
         of a preprocessing file. preprocessing directives are then executed.
-    - tokenize.c: preprocessing tokens are converted to tokens
+    - tokenize.c: preprocessing tokens are converted to tokens, on demand as the parser advances
     - parse.c: tokens are built into a tree structure reflecting the syntax of a translation unit.
         symbols are identified in the source program.
     - type.c: symbols found in the source have their type definitions analyzed and added as semantics.
@@ -23,14 +23,17 @@ ecc compilation process overview:
 
 brief descriptions of the other files in this project:
     - buffer.c: just represents an expandable byte buffer
+    - cfg.c: control-flow graphs over AIR routines (basic blocks, dominator trees, and loops)
     - const.c: contains compile-time constant data
     - constexpr.c: evaluates constant expressions using a semantically analyzed syntax tree (i.e., valid for invocation after static analysis)
     - graph.c: adjacency list-based graph implementation
+    - image.c: sparse byte images holding the initial content of static objects (zeros cost nothing)
     - log.c: the ol' logger
+    - pch.c: precompiled header snapshots (macro table + preprocessed tokens of a header) for skipping preprocessing
     - map.c: closed, linear probing-based hash table implementation, also provides an API for interacting with the struct as if it's a set
     - symbol.c: functions for handling the symbol_t struct
     - syntax.c: functions for handling the syntax_component_t struct
-    - traverse.c: traversal data structure for syntax_component_t
+    - traverse.c: traversal data structure for syntax_component_t, and schedules for running several traversals in one walk
     - util.c: uncategorized utility functions
     - vector.c: dynamic array implementation
 
@@ -49,6 +52,9 @@ brief descriptions of the other files in this project:
 
 #define OPTION_DESCRIPTION_LENGTH 12
 
+// long options get values outside of the range of chars
+#define OPTION_EMIT_PCH 256
+
 char* PROGRAM_NAME = NULL;
 program_options_t opts;
 
@@ -73,6 +79,7 @@ int usage(void)
     printf("  %-*sCompile, but do not assemble or link\n", OPTION_DESCRIPTION_LENGTH, "-S");
     printf("  %-*sCompile and assemble, but do not link\n", OPTION_DESCRIPTION_LENGTH, "-c");
     printf("  %-*sLink against default GNU libraries\n", OPTION_DESCRIPTION_LENGTH, "-g");
+    printf("  %-*sPrecompile the given headers into <header>.pch\n", OPTION_DESCRIPTION_LENGTH, "--emit-pch");
     printf("  %-*sDisplay internal states (tokens, IRs, etc.)\n", OPTION_DESCRIPTION_LENGTH, "-i");
     printf("  %-*sPreprocess\n", OPTION_DESCRIPTION_LENGTH, "-P");
     printf("  %-*sParse\n", OPTION_DESCRIPTION_LENGTH, "-p");
@@ -114,6 +121,7 @@ x86_asm_file_t* compile_object(char* filename)
     settings.error = pp_error;
     settings.error[0] = '\0';
     settings.table = NULL;
+    settings.dependencies = NULL;
 
     if (!preprocess(&tokens, &settings))
     {
@@ -135,26 +143,16 @@ x86_asm_file_t* compile_object(char* filename)
     tk_settings.error = tok_error;
     tk_settings.error[0] = '\0';
 
-    token_t* ts = tokenize(tokens, &tk_settings);
+    token_stream_t* ts = token_stream_init(tokens, &tk_settings);
+    syntax_component_t* tlu = parse(ts);
     if (tk_settings.error[0])
     {
         printf("%s", tk_settings.error);
+        free_syntax(tlu, tlu);
+        token_stream_delete(ts);
         return NULL;
     }
-
-    pp_token_delete_all(tokens);
-
-    if (opts.iflag)
-    {
-        printf("<<tokenizer output>>\n");
-        for (token_t* t = ts; t; t = t->next)
-        {
-            token_print(t, printf);
-            printf("\n");
-        }
-    }
-
-    syntax_component_t* tlu = parse(ts);
+    token_stream_delete(ts);
     if (!tlu) return NULL;
 
     if (opts.iflag)
@@ -166,10 +164,13 @@ x86_asm_file_t* compile_object(char* filename)
     if (opts.pflag)
     {
         free_syntax(tlu, tlu);
-        token_delete_all(ts);
         return NULL;
     }
 
+    // typing is not scheduled alongside analysis's passes: it runs over the symbol table rather than the tree,
+    // and analysis needs every symbol typed before the walk reaches any use of it, which can precede the
+    // declaration (a function's body is visited before its declarator, a goto before its label, and a tag
+    // may be completed after it is used). a typing error also stops compilation before analysis begins.
     analysis_error_t* type_errors = type(tlu);
     if (type_errors)
     {
@@ -178,7 +179,6 @@ x86_asm_file_t* compile_object(char* filename)
         {
             fclose(file);
             free_syntax(tlu, tlu);
-            token_delete_all(ts);
             return NULL;
         }
     }
@@ -200,7 +200,6 @@ x86_asm_file_t* compile_object(char* filename)
         {
             fclose(file);
             free_syntax(tlu, tlu);
-            token_delete_all(ts);
             error_delete_all(errors);
             return NULL;
         }
@@ -221,7 +220,6 @@ x86_asm_file_t* compile_object(char* filename)
     {
         fclose(file);
         free_syntax(tlu, tlu);
-        token_delete_all(ts);
         return NULL;
     }
 
@@ -239,6 +237,14 @@ x86_asm_file_t* compile_object(char* filename)
     {
         printf("<<AIR (optimized)>>\n");
         air_print(air, printf);
+
+        printf("<<control-flow graphs>>\n");
+        VECTOR_FOR(air_routine_t*, routine, air->routines)
+        {
+            cfg_t* cfg = cfg_init(routine);
+            cfg_print(cfg, air, printf);
+            cfg_delete(cfg);
+        }
     }
 
     if (opts.aaflag)
@@ -246,7 +252,6 @@ x86_asm_file_t* compile_object(char* filename)
         fclose(file);
         air_delete(air);
         free_syntax(tlu, tlu);
-        token_delete_all(ts);
         return NULL;
     }
 
@@ -263,7 +268,6 @@ x86_asm_file_t* compile_object(char* filename)
         fclose(file);
         air_delete(air);
         free_syntax(tlu, tlu);
-        token_delete_all(ts);
         return NULL;
     }
 
@@ -280,7 +284,6 @@ x86_asm_file_t* compile_object(char* filename)
         fclose(file);
         air_delete(air);
         free_syntax(tlu, tlu);
-        token_delete_all(ts);
         return NULL;
     }
 
@@ -297,7 +300,6 @@ x86_asm_file_t* compile_object(char* filename)
     fclose(file);
     air_delete(air);
     free_syntax(tlu, tlu);
-    token_delete_all(ts);
 
     return asmfile;
 }
@@ -478,11 +480,18 @@ char* linker(char** object_files, size_t object_count, char* target)
 
 bool get_options(int argc, char** argv)
 {
+    static struct option long_options[] = {
+        { "emit-pch", no_argument, NULL, OPTION_EMIT_PCH },
+        { NULL, 0, NULL, 0 }
+    };
     memset(&opts, 0, sizeof(program_options_t));
-    for (int c; (c = getopt(argc, argv, "hiPpaxLArcSgo:")) != -1;)
+    for (int c; (c = getopt_long(argc, argv, "hiPpaxLArcSgo:", long_options, NULL)) != -1;)
     {
         switch (c)
         {
+            case OPTION_EMIT_PCH:
+                opts.pchflag = true;
+                break;
             case 'h':
                 opts.hflag = true;
                 break;
@@ -571,6 +580,24 @@ int handle_c_flag(int argc, char** argv)
     return EXIT_SUCCESS;
 }
 
+int handle_pch_flag(int argc, char** argv)
+{
+    if (opts.oflag && argc - optind > 1)
+    {
+        errorf("the -o flag can only be used with the --emit-pch flag with one file is given as input\n");
+        return EXIT_FAILURE;
+    }
+    for (int i = optind; i < argc; ++i)
+    {
+        char* created = opts.oflag ? strdup(opts.oflag) : pch_filepath(argv[i]);
+        bool success = pch_emit(argv[i], created);
+        free(created);
+        if (!success)
+            return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
 static int clean_exit(int code)
 {
     return code;
@@ -592,6 +619,9 @@ int main(int argc, char** argv)
     if (opts.hflag)
         return usage();
     
+    if (opts.pchflag)
+        return handle_pch_flag(argc, argv);
+
     if (opts.ssflag)
         return handle_ss_flag(argc, argv);
     
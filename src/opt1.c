@@ -1,9 +1,19 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
 #include "ecc.h"
 
+#define TYPES (air->st->types)
+
 static opt1_options_t opt_profile_basic = {
     .inline_fcalls = true,
     .remove_fcall_passing_lifetimes = true,
-    .inline_integer_constant = true
+    .propagate_constants = true,
+    .eliminate_common_subexpressions = true,
+    .hoist_loop_invariants = true,
+    .reduce_induction_variables = true,
+    .eliminate_dead_code = true
 };
 
 opt1_options_t* opt1_profile_basic(void)
@@ -30,8 +40,10 @@ static void try_inline_fcalls(air_insn_t* insn, air_routine_t* routine, air_t* a
     if (callexpr_insn->type != AIR_LOAD_ADDR) return;
     air_insn_operand_t* funcop = callexpr_insn->ops[1];
     if (funcop->type != AOP_SYMBOL) return;
+    air_defuse_t* defuse = air_insn_unindex(insn);
     op->type = AOP_SYMBOL;
     op->content.sy = funcop->content.sy;
+    air_insn_index(insn, defuse);
     air_insn_remove(callexpr_insn);
 }
 
@@ -50,22 +62,19 @@ static bool try_remove_fcall_passing_lifetimes(air_insn_t* insn, air_routine_t*
     if (!insn) return false;
     bool side = air_insn_produces_side_effect(insn);
     bool fcall_found = false;
-    air_insn_t* first_used = NULL;
     regid_t reg = insn->ops[0]->content.reg;
-    for (air_insn_t* trace = insn->next; trace; trace = trace->next)
+    air_insn_t* first_used = air_insn_find_use_below(reg, insn);
+    if (!first_used)
+        return false;
+    // only what comes between the definition and its first use matters
+    for (air_insn_t* trace = insn->next; trace != first_used; trace = trace->next)
     {
         if (side && trace->type == AIR_SEQUENCE_POINT)
-            break;
-        bool uses = air_insn_uses(trace, reg);
-        bool fcall = trace->type == AIR_FUNC_CALL;
-        if (uses && !fcall_found) // like: _1 where _1 is defining and we're before any function calls
             return false;
-        if (fcall) // like: func(_2) where _1 is defining
+        if (trace->type == AIR_FUNC_CALL) // like: func(_2) where _1 is defining
             fcall_found = true;
-        if (uses && !first_used) // like: _3 = _1 where _1 is defining
-            first_used = trace;
     }
-    if (!first_used)
+    if (!fcall_found) // like: _3 = _1 where _1 is defining and we're before any function calls
         return false;
     air_insn_move_before(insn, first_used);
     return true;
@@ -73,86 +82,2622 @@ static bool try_remove_fcall_passing_lifetimes(air_insn_t* insn, air_routine_t*
 
 /*
 
-int _1 = 5;
-int _2 = _1;
+sparse conditional constant propagation (Wegman and Zadeck's). temporaries are defined once (or
+merged by a phi), so each gets a place on a three-level lattice: undefined (nothing known yet), a
+constant, or varying. a block only counts once control is known to reach it, and a branch on a
+constant only lets control go one way. two worklists, one of blocks that became reachable and one
+of temporaries whose values went down the lattice, run until neither has anything left. after
+that, temporaries with constant values are rewritten as loads of the constant, branches on
+constants become jumps (or go away), and the blocks that can't be reached are emptied out.
+
+values are computed the way C has them. integers are read at the width and signedness of the type
+they're used as, so conversions to narrower types (which AIR leaves to whoever uses the value) come
+out right, and floats and doubles are computed in their own precision. whatever C leaves undefined
+(dividing by zero, overflowing a signed division, shifting by the width or more, converting a float
+out of range to an integer) stays varying so that it still happens at run time. long doubles are not
+folded.
+
+locals live in memory rather than in temporaries, so whatever is loaded from them is varying.
+
+*/
+
+typedef enum sccp_state
+{
+    SCCP_UNDEFINED,
+    SCCP_CONSTANT,
+    SCCP_VARYING
+} sccp_state_t;
+
+typedef struct sccp_value
+{
+    sccp_state_t state;
+    c_type_t* ct; // the type the value is computed as
+    uint64_t bits; // integers and pointers, extended out to 64 bits as their type would be
+    double fp; // floats and doubles
+} sccp_value_t;
+
+typedef struct sccp
+{
+    air_routine_t* routine;
+    air_t* air;
+    cfg_t* cfg;
+    map_t* values; // <regid_t, sccp_value_t*>
+    bool* executable; // by block id
+    vector_t* blocks; // <cfg_block_t*> blocks that just became reachable
+    vector_t* regs; // <regid_t> temporaries whose values just changed
+} sccp_t;
+
+static bool sccp_integral(c_type_t* ct)
+{
+    return ct && (type_is_integer(ct) || ct->class == CTC_ENUMERATED || ct->class == CTC_POINTER);
+}
+
+static bool sccp_floating(c_type_t* ct)
+{
+    return ct && type_is_sse_floating(ct);
+}
+
+static bool sccp_signed(c_type_t* ct)
+{
+    return type_is_signed_integer(ct) || ct->class == CTC_CHAR || ct->class == CTC_ENUMERATED;
+}
+
+static unsigned sccp_width(c_type_t* ct)
+{
+    long long size = type_size(ct);
+    return size > 0 && size < 8 ? size * 8 : 64;
+}
+
+// cuts the bits down to the width given and extends them back out to 64
+static uint64_t sccp_extend(uint64_t bits, unsigned width, bool sign)
+{
+    if (width >= 64)
+        return bits;
+    uint64_t mask = ((uint64_t) 1 << width) - 1;
+    bits &= mask;
+    if (sign && (bits >> (width - 1)))
+        bits |= ~mask;
+    return bits;
+}
+
+static sccp_value_t sccp_varying(void)
+{
+    return (sccp_value_t) { .state = SCCP_VARYING };
+}
+
+static sccp_value_t sccp_integer(c_type_t* ct, uint64_t bits)
+{
+    return (sccp_value_t) { .state = SCCP_CONSTANT, .ct = ct, .bits = sccp_extend(bits, sccp_width(ct), sccp_signed(ct)) };
+}
+
+static sccp_value_t sccp_float(c_type_t* ct, double fp)
+{
+    return (sccp_value_t) { .state = SCCP_CONSTANT, .ct = ct, .fp = ct->class == CTC_FLOAT ? (float) fp : fp };
+}
+
+static bool sccp_same(sccp_value_t* v1, sccp_value_t* v2)
+{
+    if (v1->state != v2->state)
+        return false;
+    if (v1->state != SCCP_CONSTANT)
+        return true;
+    return v1->bits == v2->bits && !memcmp(&v1->fp, &v2->fp, sizeof(double));
+}
+
+static bool sccp_is_zero(sccp_value_t* v)
+{
+    return sccp_floating(v->ct) ? v->fp == 0.0 : !v->bits;
+}
+
+// meets two values (undefined meets anything as that thing, and two different constants meet as varying)
+static void sccp_meet(sccp_value_t* v, sccp_value_t with)
+{
+    if (with.state == SCCP_UNDEFINED || v->state == SCCP_VARYING)
+        return;
+    if (v->state == SCCP_UNDEFINED || with.state == SCCP_VARYING)
+        *v = with;
+    else if (!sccp_same(v, &with))
+        *v = sccp_varying();
+}
+
+// the value of an operand read as the given type
+static sccp_value_t sccp_operand(sccp_t* s, air_insn_operand_t* op, c_type_t* ct)
+{
+    if (!op || !ct)
+        return sccp_varying();
+    if (op->type == AOP_INTEGER_CONSTANT)
+        return sccp_integral(ct) ? sccp_integer(ct, op->content.ic) : sccp_varying();
+    if (op->type != AOP_REGISTER)
+        return sccp_varying();
+    sccp_value_t* v = map_get(s->values, (void*) op->content.reg);
+    if (!v)
+        return sccp_varying();
+    if (v->state != SCCP_CONSTANT)
+        return *v;
+    if (sccp_integral(v->ct) && sccp_integral(ct))
+        return sccp_integer(ct, v->bits);
+    if (sccp_floating(v->ct) && v->ct->class == ct->class)
+        return sccp_float(ct, v->fp);
+    return sccp_varying();
+}
+
+// the type an operand is read as: its own if it has one, otherwise the instruction's
+static c_type_t* sccp_operand_type(air_insn_t* insn, size_t index)
+{
+    return insn->ops[index]->ct ? insn->ops[index]->ct : insn->ct;
+}
+
+static sccp_value_t sccp_load(sccp_t* s, air_insn_t* insn)
+{
+    air_insn_operand_t* op = insn->ops[1];
+    if (op->type != AOP_SYMBOL)
+        return sccp_operand(s, op, insn->ct);
+    // floating constants are loaded out of read-only data
+    syntax_component_t* declarer = op->content.sy->declarer;
+    if (!declarer || declarer->type != SC_FLOATING_CONSTANT || !sccp_floating(insn->ct))
+        return sccp_varying();
+    return sccp_float(insn->ct, insn->ct->class == CTC_FLOAT ? (float) declarer->floc : (double) declarer->floc);
+}
+
+static sccp_value_t sccp_unary(sccp_t* s, air_insn_t* insn)
+{
+    c_type_t* ct = insn->ct;
+    c_type_t* opt = sccp_operand_type(insn, 1);
+    sccp_value_t a = sccp_operand(s, insn->ops[1], opt);
+    if (a.state != SCCP_CONSTANT)
+        return a;
+    switch (insn->type)
+    {
+        case AIR_NOT:
+            return sccp_integral(ct) ? sccp_integer(ct, sccp_is_zero(&a)) : sccp_varying();
+        case AIR_POSATE:
+            return sccp_operand(s, insn->ops[1], ct);
+        case AIR_NEGATE:
+            if (sccp_floating(ct) && ct->class == opt->class)
+                return sccp_float(ct, -a.fp);
+            return sccp_integral(ct) ? sccp_integer(ct, 0 - a.bits) : sccp_varying();
+        case AIR_COMPLEMENT:
+            return sccp_integral(ct) ? sccp_integer(ct, ~a.bits) : sccp_varying();
+        default:
+            return sccp_varying();
+    }
+}
+
+static sccp_value_t sccp_convert(sccp_t* s, air_insn_t* insn)
+{
+    c_type_t* ct = insn->ct;
+    c_type_t* from = sccp_operand_type(insn, 1);
+    sccp_value_t a = sccp_operand(s, insn->ops[1], from);
+    if (a.state != SCCP_CONSTANT)
+        return a;
+    bool to_float = ct->class == CTC_FLOAT;
+    switch (insn->type)
+    {
+        case AIR_SEXT:
+        case AIR_ZEXT:
+            return sccp_integral(ct) ? sccp_integer(ct, a.bits) : sccp_varying();
+        case AIR_S2D:
+        case AIR_D2S:
+            return sccp_floating(ct) ? sccp_float(ct, a.fp) : sccp_varying();
+        case AIR_SI2S:
+        case AIR_SI2D:
+            if (!sccp_floating(ct))
+                return sccp_varying();
+            // straight to the type, since going through a double first could round twice
+            return sccp_float(ct, to_float ? (float) (int64_t) a.bits : (double) (int64_t) a.bits);
+        case AIR_UI2S:
+        case AIR_UI2D:
+            if (!sccp_floating(ct))
+                return sccp_varying();
+            return sccp_float(ct, to_float ? (float) a.bits : (double) a.bits);
+        case AIR_S2SI:
+        case AIR_D2SI:
+        {
+            if (!sccp_integral(ct))
+                return sccp_varying();
+            // has to fit once the fraction is gone (NaNs fail both comparisons)
+            long double limit = (long double) ((uint64_t) 1 << (sccp_width(ct) - 1));
+            if (!(a.fp > -limit - 1.0L && a.fp < limit))
+                return sccp_varying();
+            return sccp_integer(ct, (uint64_t) (int64_t) a.fp);
+        }
+        case AIR_S2UI:
+        case AIR_D2UI:
+        {
+            if (!sccp_integral(ct))
+                return sccp_varying();
+            long double limit = (long double) ((uint64_t) 1 << (sccp_width(ct) - 1)) * 2.0L;
+            if (!(a.fp > -1.0 && a.fp < limit))
+                return sccp_varying();
+            return sccp_integer(ct, (uint64_t) a.fp);
+        }
+        default:
+            return sccp_varying();
+    }
+}
+
+static sccp_value_t sccp_float_binary(air_insn_t* insn, sccp_value_t a, sccp_value_t b)
+{
+    c_type_t* ct = insn->ct;
+    if (ct->class == CTC_FLOAT)
+    {
+        float x = a.fp, y = b.fp;
+        switch (insn->type)
+        {
+            case AIR_ADD: return sccp_float(ct, x + y);
+            case AIR_SUBTRACT: return sccp_float(ct, x - y);
+            case AIR_MULTIPLY: return sccp_float(ct, x * y);
+            case AIR_DIVIDE: return y != 0.0f ? sccp_float(ct, x / y) : sccp_varying();
+            default: return sccp_varying();
+        }
+    }
+    double x = a.fp, y = b.fp;
+    switch (insn->type)
+    {
+        case AIR_ADD: return sccp_float(ct, x + y);
+        case AIR_SUBTRACT: return sccp_float(ct, x - y);
+        case AIR_MULTIPLY: return sccp_float(ct, x * y);
+        case AIR_DIVIDE: return y != 0.0 ? sccp_float(ct, x / y) : sccp_varying();
+        default: return sccp_varying();
+    }
+}
+
+static sccp_value_t sccp_binary(sccp_t* s, air_insn_t* insn)
+{
+    c_type_t* ct = insn->ct;
+    sccp_value_t a = sccp_operand(s, insn->ops[1], sccp_operand_type(insn, 1));
+    sccp_value_t b = sccp_operand(s, insn->ops[2], sccp_operand_type(insn, 2));
+    if (a.state == SCCP_VARYING || b.state == SCCP_VARYING)
+        return sccp_varying();
+    if (a.state == SCCP_UNDEFINED || b.state == SCCP_UNDEFINED)
+        return (sccp_value_t) { .state = SCCP_UNDEFINED };
+    if (sccp_floating(ct))
+        return sccp_floating(a.ct) && sccp_floating(b.ct) ? sccp_float_binary(insn, a, b) : sccp_varying();
+    if (!sccp_integral(ct) || !sccp_integral(a.ct) || !sccp_integral(b.ct))
+        return sccp_varying();
+    unsigned width = sccp_width(ct);
+    bool sign = sccp_signed(ct);
+    uint64_t x = sccp_extend(a.bits, width, sign), y = sccp_extend(b.bits, width, sign);
+    uint64_t min = sign ? (uint64_t) 1 << (width - 1) : 0;
+    switch (insn->type)
+    {
+        case AIR_ADD: return sccp_integer(ct, x + y);
+        case AIR_SUBTRACT: return sccp_integer(ct, x - y);
+        case AIR_MULTIPLY: return sccp_integer(ct, x * y);
+        case AIR_AND: return sccp_integer(ct, x & y);
+        case AIR_OR: return sccp_integer(ct, x | y);
+        case AIR_XOR: return sccp_integer(ct, x ^ y);
+        case AIR_DIVIDE:
+        case AIR_MODULO:
+            if (!y || (sign && sccp_extend(x, width, false) == min && y == (uint64_t) -1))
+                return sccp_varying();
+            if (insn->type == AIR_DIVIDE)
+                return sccp_integer(ct, sign ? (uint64_t) ((int64_t) x / (int64_t) y) : x / y);
+            return sccp_integer(ct, sign ? (uint64_t) ((int64_t) x % (int64_t) y) : x % y);
+        case AIR_SHIFT_LEFT:
+        case AIR_SHIFT_RIGHT:
+        case AIR_SIGNED_SHIFT_RIGHT:
+            // the count is whatever type it is, so it gets read as its own
+            y = b.bits;
+            if (y >= width)
+                return sccp_varying();
+            if (insn->type == AIR_SHIFT_LEFT)
+                return sccp_integer(ct, x << y);
+            if (insn->type == AIR_SHIFT_RIGHT)
+                return sccp_integer(ct, sccp_extend(x, width, false) >> y);
+            return sccp_integer(ct, (uint64_t) ((int64_t) sccp_extend(x, width, true) >> y));
+        default:
+            return sccp_varying();
+    }
+}
+
+static sccp_value_t sccp_compare(sccp_t* s, air_insn_t* insn)
+{
+    c_type_t* opt = sccp_operand_type(insn, 1);
+    sccp_value_t a = sccp_operand(s, insn->ops[1], opt);
+    sccp_value_t b = sccp_operand(s, insn->ops[2], opt);
+    if (a.state == SCCP_VARYING || b.state == SCCP_VARYING || !sccp_integral(insn->ct))
+        return sccp_varying();
+    if (a.state == SCCP_UNDEFINED || b.state == SCCP_UNDEFINED)
+        return (sccp_value_t) { .state = SCCP_UNDEFINED };
+    int order = 0;
+    if (sccp_floating(opt))
+    {
+        // NaNs are unordered, and only != holds for them
+        if (a.fp != a.fp || b.fp != b.fp)
+            return sccp_integer(insn->ct, insn->type == AIR_INEQUAL);
+        order = a.fp < b.fp ? -1 : a.fp > b.fp;
+    }
+    else if (sccp_signed(opt))
+        order = (int64_t) a.bits < (int64_t) b.bits ? -1 : (int64_t) a.bits > (int64_t) b.bits;
+    else
+        order = a.bits < b.bits ? -1 : a.bits > b.bits;
+    bool result = false;
+    switch (insn->type)
+    {
+        case AIR_LESS_EQUAL: result = order <= 0; break;
+        case AIR_LESS: result = order < 0; break;
+        case AIR_GREATER_EQUAL: result = order >= 0; break;
+        case AIR_GREATER: result = order > 0; break;
+        case AIR_EQUAL: result = order == 0; break;
+        case AIR_INEQUAL: result = order != 0; break;
+        default: return sccp_varying();
+    }
+    return sccp_integer(insn->ct, result);
+}
+
+// the value an instruction gives its temporary, going by what's known of its operands so far
+static sccp_value_t sccp_evaluate(sccp_t* s, air_insn_t* insn)
+{
+    switch (insn->type)
+    {
+        case AIR_LOAD:
+            return sccp_load(s, insn);
+        case AIR_PHI:
+        {
+            // an operand defined in a block nobody reaches is still undefined, so it drops out
+            sccp_value_t v = { .state = SCCP_UNDEFINED };
+            for (size_t i = 1; i < insn->noops; ++i)
+                sccp_meet(&v, sccp_operand(s, insn->ops[i], insn->ct));
+            return v;
+        }
+        case AIR_NEGATE:
+        case AIR_POSATE:
+        case AIR_COMPLEMENT:
+        case AIR_NOT:
+            return sccp_unary(s, insn);
+        case AIR_SEXT:
+        case AIR_ZEXT:
+        case AIR_S2D:
+        case AIR_D2S:
+        case AIR_S2SI:
+        case AIR_S2UI:
+        case AIR_D2SI:
+        case AIR_D2UI:
+        case AIR_SI2S:
+        case AIR_UI2S:
+        case AIR_SI2D:
+        case AIR_UI2D:
+            return sccp_convert(s, insn);
+        case AIR_ADD:
+        case AIR_SUBTRACT:
+        case AIR_MULTIPLY:
+        case AIR_DIVIDE:
+        case AIR_MODULO:
+        case AIR_SHIFT_LEFT:
+        case AIR_SHIFT_RIGHT:
+        case AIR_SIGNED_SHIFT_RIGHT:
+        case AIR_AND:
+        case AIR_XOR:
+        case AIR_OR:
+            return sccp_binary(s, insn);
+        case AIR_LESS_EQUAL:
+        case AIR_LESS:
+        case AIR_GREATER_EQUAL:
+        case AIR_GREATER:
+        case AIR_EQUAL:
+        case AIR_INEQUAL:
+            return sccp_compare(s, insn);
+        default:
+            return sccp_varying();
+    }
+}
+
+static void sccp_reach(sccp_t* s, cfg_block_t* block)
+{
+    if (block == s->cfg->exit || s->executable[block->id])
+        return;
+    s->executable[block->id] = true;
+    vector_add(s->blocks, block);
+}
+
+// lets control out of a block, only one way if it ends in a branch on a constant
+static void sccp_leave(sccp_t* s, cfg_block_t* block)
+{
+    air_insn_t* last = block->last;
+    if (last && (last->type == AIR_JZ || last->type == AIR_JNZ))
+    {
+        sccp_value_t cond = sccp_operand(s, last->ops[1], last->ct);
+        if (cond.state == SCCP_UNDEFINED)
+            return;
+        if (cond.state == SCCP_CONSTANT && block->succs->size == 2)
+        {
+            bool taken = (last->type == AIR_JZ) == sccp_is_zero(&cond);
+            sccp_reach(s, vector_get(block->succs, taken ? 1 : 0));
+            return;
+        }
+    }
+    VECTOR_FOR(cfg_block_t*, succ, block->succs)
+        sccp_reach(s, succ);
+}
+
+static void sccp_visit(sccp_t* s, air_insn_t* insn, cfg_block_t* block)
+{
+    if (air_insn_creates_temporary(insn) && insn->ops[0]->type == AOP_REGISTER)
+    {
+        regid_t reg = insn->ops[0]->content.reg;
+        sccp_value_t* v = map_get(s->values, (void*) reg);
+        if (v && v->state != SCCP_VARYING)
+        {
+            sccp_value_t old = *v;
+            sccp_meet(v, sccp_evaluate(s, insn));
+            if (!sccp_same(v, &old))
+                vector_add(s->regs, (void*) reg);
+        }
+    }
+    if (insn == block->last)
+        sccp_leave(s, block);
+}
+
+// makes a read-only floating constant for a folded value
+static symbol_t* sccp_floating_constant(air_t* air, c_type_t* ct, double value)
+{
+    char name[6 + MAX_STRINGIFIED_INTEGER_LENGTH + 1];
+    snprintf(name, sizeof(name), "__fold%llu", air->next_available_fc++);
+    symbol_t* sy = symbol_table_add(air->st, name, symbol_init(NULL));
+    sy->name = strdup(name);
+    sy->type = type_canonical(TYPES, ct);
+    sy->sd = SD_STATIC;
+
+    air_data_t* data = calloc(1, sizeof *data);
+    data->readonly = true;
+    data->sy = sy;
+    if (ct->class == CTC_FLOAT)
+    {
+        float f = value;
+        data->image = image_init(FLOAT_WIDTH);
+        image_write(data->image, 0, &f, FLOAT_WIDTH);
+    }
+    else
+    {
+        data->image = image_init(DOUBLE_WIDTH);
+        image_write(data->image, 0, &value, DOUBLE_WIDTH);
+    }
+    vector_add(air->rodata, data);
+    return sy;
+}
+
+// whether the instruction already is a load of its constant
+static bool sccp_is_constant_load(air_insn_t* insn)
+{
+    if (insn->type != AIR_LOAD)
+        return false;
+    air_insn_operand_t* op = insn->ops[1];
+    return op->type == AOP_INTEGER_CONSTANT || (op->type == AOP_SYMBOL && sccp_floating(insn->ct));
+}
+
+// replaces the instruction with a load of its constant value
+static void sccp_fold(sccp_t* s, air_insn_t* insn, sccp_value_t* v)
+{
+    air_t* air = s->air;
+    air_insn_t* ld = air_insn_init(AIR_LOAD, 2);
+    ld->ct = type_canonical(TYPES, insn->ct);
+    ld->ops[0] = air_insn_operand_copy(insn->ops[0]);
+    if (sccp_floating(insn->ct))
+        ld->ops[1] = air_insn_symbol_operand_init(sccp_floating_constant(air, insn->ct, v->fp));
+    else
+        // only as wide as the type, so the assembler sees what fits in the register
+        ld->ops[1] = air_insn_integer_constant_operand_init(sccp_extend(v->bits, sccp_width(insn->ct), false));
+    air_insn_insert_before(ld, insn);
+    air_insn_remove(insn);
+}
+
+// drops the operands of a phi whose definitions went away with the blocks they were in
+static void prune_phi(air_insn_t* phi)
+{
+    air_defuse_t* defuse = air_insn_unindex(phi);
+    size_t kept = 1;
+    for (size_t i = 1; i < phi->noops; ++i)
+    {
+        air_insn_operand_t* op = phi->ops[i];
+        vector_t* defs = op->type == AOP_REGISTER ? air_defuse_definitions(defuse, op->content.reg) : NULL;
+        if (op->type == AOP_REGISTER && (!defs || !defs->size))
+            air_insn_operand_delete(op);
+        else
+            phi->ops[kept++] = op;
+    }
+    phi->noops = kept;
+    air_insn_index(phi, defuse);
+}
+
+static void sccp_rewrite(sccp_t* s, size_t* folded, size_t* removed)
+{
+    // first the constants and branches in the blocks control reaches
+    VECTOR_FOR(cfg_block_t*, block, s->cfg->blocks)
+    {
+        if (!s->executable[block->id] || !block->first)
+            continue;
+        for (air_insn_t* insn = block->first, * end = block->last->next; insn != end;)
+        {
+            air_insn_t* next = insn->next;
+            if ((insn->type == AIR_JZ || insn->type == AIR_JNZ) && block->succs->size == 2)
+            {
+                sccp_value_t cond = sccp_operand(s, insn->ops[1], insn->ct);
+                if (cond.state == SCCP_CONSTANT)
+                {
+                    if ((insn->type == AIR_JZ) == sccp_is_zero(&cond))
+                    {
+                        air_insn_t* jmp = air_insn_init(AIR_JMP, 1);
+                        jmp->ops[0] = air_insn_operand_copy(insn->ops[0]);
+                        air_insn_insert_before(jmp, insn);
+                    }
+                    air_insn_remove(insn);
+                    ++(*removed);
+                }
+            }
+            else if (air_insn_creates_temporary(insn) && insn->ops[0]->type == AOP_REGISTER && !sccp_is_constant_load(insn))
+            {
+                sccp_value_t* v = map_get(s->values, (void*) insn->ops[0]->content.reg);
+                if (v && v->state == SCCP_CONSTANT && (sccp_integral(insn->ct) || sccp_floating(insn->ct)))
+                {
+                    sccp_fold(s, insn, v);
+                    ++(*folded);
+                }
+            }
+            insn = next;
+        }
+    }
+
+    // then everything in the blocks it doesn't, except for labels (for jumps that never happen) and declarations
+    VECTOR_FOR(cfg_block_t*, dead, s->cfg->blocks)
+    {
+        if (s->executable[dead->id] || !dead->first)
+            continue;
+        for (air_insn_t* insn = dead->first, * end = dead->last->next; insn != end;)
+        {
+            air_insn_t* next = insn->next;
+            if (insn->prev && insn->type != AIR_LABEL && insn->type != AIR_DECLARE)
+            {
+                air_insn_remove(insn);
+                ++(*removed);
+            }
+            insn = next;
+        }
+    }
+
+    // and last the phis that lost operands along with those blocks
+    if (*removed)
+    {
+        for (air_insn_t* insn = s->routine->insns; insn; insn = insn->next)
+        {
+            if (insn->type == AIR_PHI)
+                prune_phi(insn);
+        }
+    }
+}
+
+static void propagate_constants(air_routine_t* routine, air_t* air)
+{
+    sccp_t s = {
+        .routine = routine,
+        .air = air,
+        .cfg = cfg_init(routine),
+        .values = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash),
+        .blocks = vector_init(),
+        .regs = vector_init()
+    };
+    map_set_deleters(s.values, NULL, free);
+    s.executable = calloc(s.cfg->blocks->size + 1, sizeof(bool));
+
+    // every temporary starts out undefined, unless it's defined more than once
+    for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
+    {
+        if (!air_insn_assigns(insn) || insn->ops[0]->type != AOP_REGISTER)
+            continue;
+        regid_t reg = insn->ops[0]->content.reg;
+        sccp_value_t* v = map_get(s.values, (void*) reg);
+        if (!v)
+        {
+            v = calloc(1, sizeof *v);
+            v->ct = insn->ct;
+            map_add(s.values, (void*) reg, v);
+        }
+        else
+            v->state = SCCP_VARYING;
+        if (!air_insn_creates_temporary(insn))
+            v->state = SCCP_VARYING;
+    }
+
+    sccp_reach(&s, vector_get(s.cfg->blocks, 0));
+    while (s.blocks->size || s.regs->size)
+    {
+        if (s.regs->size)
+        {
+            regid_t reg = (regid_t) vector_pop(s.regs);
+            vector_t* uses = air_defuse_uses(routine->defuse, reg);
+            if (!uses) continue;
+            VECTOR_FOR(air_insn_t*, use, uses)
+            {
+                cfg_block_t* block = cfg_find_block(s.cfg, use);
+                if (s.executable[block->id])
+                    sccp_visit(&s, use, block);
+            }
+            continue;
+        }
+        cfg_block_t* block = vector_pop(s.blocks);
+        CFG_BLOCK_FOR(insn, block)
+            sccp_visit(&s, insn, block);
+    }
+
+    size_t folded = 0, removed = 0;
+    sccp_rewrite(&s, &folded, &removed);
+    if (get_program_options()->iflag)
+        printf("constant propagation in %s: %zu instructions folded, %zu removed\n", symbol_get_name(routine->sy), folded, removed);
+
+    free(s.executable);
+    vector_delete(s.blocks);
+    vector_delete(s.regs);
+    map_delete(s.values);
+    cfg_delete(s.cfg);
+}
+
+/*
+
+the scalar locals of a routine whose every access can be seen: read or written whole, by name or
+through an address taken only to be read or written through right away. nothing else can get at
+one of these, so a store by some other name or a function call can't change it.
+
+*/
+
+typedef struct locals
+{
+    air_routine_t* routine;
+    map_t* indices; // <symbol_t*, size_t> (index + 1)
+    map_t* addresses; // <regid_t, symbol_t*> temporaries holding the address of a local (one of these or not)
+    vector_t* symbols; // <symbol_t*> by index
+} locals_t;
+
+// the local an operand is the whole of, by name or through its address (index + 1, or 0)
+static size_t locals_operand(locals_t* l, air_insn_operand_t* op)
+{
+    if (op->type == AOP_SYMBOL)
+        return (size_t) map_get(l->indices, op->content.sy);
+    if (op->type != AOP_INDIRECT_REGISTER || op->content.inreg.offset || op->content.inreg.roffset != INVALID_VREGID)
+        return 0;
+    symbol_t* sy = map_get(l->addresses, (void*) op->content.inreg.id);
+    return sy ? (size_t) map_get(l->indices, sy) : 0;
+}
+
+static bool is_direct_assignment(air_insn_t* insn)
+{
+    return insn->type >= AIR_DIRECT_ADD && insn->type <= AIR_DIRECT_OR;
+}
+
+// the local an instruction writes (index + 1, or 0)
+static size_t locals_store(locals_t* l, air_insn_t* insn)
+{
+    if (insn->type != AIR_ASSIGN && !is_direct_assignment(insn))
+        return 0;
+    return locals_operand(l, insn->ops[0]);
+}
+
+// the local an instruction reads (index + 1, or 0)
+static size_t locals_load(locals_t* l, air_insn_t* insn)
+{
+    if (insn->type == AIR_LOAD)
+        return locals_operand(l, insn->ops[1]);
+    if (is_direct_assignment(insn))
+        return locals_operand(l, insn->ops[0]);
+    return 0;
+}
+
+// whether a store writes all of a local
+static bool locals_is_whole(air_insn_t* insn, symbol_t* sy)
+{
+    return insn->ct && type_size(insn->ct) == type_size(sy->type);
+}
+
+static void locals_escape(locals_t* l, symbol_t* sy)
+{
+    if (map_get(l->indices, sy))
+        map_add(l->indices, sy, (void*) 0);
+}
+
+// whether an instruction copies the address of a local into a temporary defined nowhere else
+static bool locals_is_address_copy(locals_t* l, air_insn_t* insn)
+{
+    if (insn->type != AIR_LOAD || insn->ops[0]->type != AOP_REGISTER || insn->ops[1]->type != AOP_REGISTER)
+        return false;
+    if (!map_contains_key(l->addresses, (void*) insn->ops[1]->content.reg))
+        return false;
+    vector_t* defs = air_defuse_definitions(l->routine->defuse, insn->ops[0]->content.reg);
+    return defs && defs->size == 1;
+}
+
+static locals_t* locals_find(air_routine_t* routine)
+{
+    locals_t* l = calloc(1, sizeof *l);
+    l->routine = routine;
+    l->indices = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+    l->addresses = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+    l->symbols = vector_init();
+    for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
+    {
+        if (insn->type != AIR_DECLARE || insn->ops[0]->type != AOP_SYMBOL)
+            continue;
+        symbol_t* sy = insn->ops[0]->content.sy;
+        if (symbol_get_storage_duration(sy) == SD_AUTOMATIC && type_is_scalar(sy->type) && !(sy->type->qualifiers & TQ_B_VOLATILE))
+        {
+            vector_add(l->symbols, sy);
+            map_add(l->indices, sy, (void*) (size_t) l->symbols->size);
+        }
+    }
+    if (!l->symbols->size)
+        return l;
+    for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
+    {
+        if (insn->type == AIR_LOAD_ADDR && insn->ops[1]->type == AOP_SYMBOL && map_get(l->indices, insn->ops[1]->content.sy))
+            map_add(l->addresses, (void*) insn->ops[0]->content.reg, insn->ops[1]->content.sy);
+        // as do copies of them (*&a takes the address and then copies it)
+        else if (locals_is_address_copy(l, insn))
+            map_add(l->addresses, (void*) insn->ops[0]->content.reg, map_get(l->addresses, (void*) insn->ops[1]->content.reg));
+    }
+
+    // anything that isn't a whole read or write gives the local away
+    for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
+    {
+        if (insn->type == AIR_DECLARE || locals_is_address_copy(l, insn))
+            continue;
+        size_t access = 0;
+        if (insn->type == AIR_LOAD)
+            access = 1;
+        else if (insn->type == AIR_ASSIGN || is_direct_assignment(insn))
+            access = 0;
+        else if (insn->type == AIR_LOAD_ADDR && insn->ops[1]->type == AOP_SYMBOL && map_contains_key(l->addresses, (void*) insn->ops[0]->content.reg))
+            continue;
+        else
+            access = SIZE_MAX;
+        for (size_t i = 0; i < insn->noops; ++i)
+        {
+            air_insn_operand_t* op = insn->ops[i];
+            if (!op) continue;
+            symbol_t* sy = NULL;
+            if (op->type == AOP_SYMBOL)
+                sy = op->content.sy;
+            else if (op->type == AOP_INDIRECT_SYMBOL)
+                sy = op->content.insy.sy;
+            if (sy)
+            {
+                if (i != access || op->type != AOP_SYMBOL || (access == 0 && !locals_is_whole(insn, sy)))
+                    locals_escape(l, sy);
+                continue;
+            }
+            regid_t regs[2] = { INVALID_VREGID, INVALID_VREGID };
+            if (op->type == AOP_REGISTER)
+                regs[0] = op->content.reg;
+            else if (op->type == AOP_INDIRECT_REGISTER)
+                regs[0] = op->content.inreg.id, regs[1] = op->content.inreg.roffset;
+            for (size_t j = 0; j < 2; ++j)
+            {
+                symbol_t* sy = map_get(l->addresses, (void*) regs[j]);
+                if (!sy) continue;
+                if (i != access || j || op->type != AOP_INDIRECT_REGISTER || !locals_operand(l, op) ||
+                    (access == 0 && !locals_is_whole(insn, sy)))
+                    locals_escape(l, sy);
+            }
+        }
+    }
+    return l;
+}
+
+static void locals_delete(locals_t* l)
+{
+    if (!l) return;
+    map_delete(l->indices);
+    map_delete(l->addresses);
+    vector_delete(l->symbols);
+    free(l);
+}
+
+/*
+
+dead code elimination. three things go, over and over until none of them turns anything up:
 
-becomes:
+    - whatever is in a block control can't reach (other than its labels and declarations).
+    - stores to locals that nothing reads afterward. this only goes for locals whose every access
+      can be seen (see locals_t): one whose address goes anywhere else (into a call, into
+      arithmetic, etc.) could be read through it, so its stores all stay. which locals are live
+      where comes from a backward pass over the control-flow graph.
+    - instructions without side effects whose temporaries go unused, along with whatever they
+      used that then goes unused too.
 
-int _2 = 5;
+volatile objects are left alone, as are function calls and anything else that does something
+besides give its temporary a value.
 
 */
 
-// static bool try_inline_integer_constant(air_insn_t* insn, air_routine_t* routine, air_t* air)
-// {
-//     if (!insn) return false;
-//     if (insn->type != AIR_LOAD) return false;
-//     if (insn->ops[1]->type != AOP_INTEGER_CONSTANT) return false;
-//     regid_t reg = insn->ops[0]->content.reg;
-//     unsigned long long value = insn->ops[1]->content.ic;
-//     for (air_insn_t* trace = insn->next; trace; trace = trace->next)
-//     {
-//         for (size_t i = 0; i < trace->noops; ++i)
-//         {
-//             air_insn_operand_t* op = trace->ops[i];
-//             if (!op) continue;
-//             if (op->type == AOP_REGISTER && op->content.reg == reg)
-//             {
-//                 op->type = AOP_INTEGER_CONSTANT;
-//                 op->content.ic = value;
-//             }
-//         }
-//     }
-//     air_insn_remove(insn);
-//     return true;
-// }
-
-// static bool try_simplify_integer_add(air_insn_t* insn, air_routine_t* routine, air_t* air)
-// {
-//     if (!insn) return false;
-//     if (insn->type != AIR_ADD) return false;
-//     if (insn->ops[1]->type != AOP_INTEGER_CONSTANT ||
-//         insn->ops[2]->type != AOP_INTEGER_CONSTANT)
-//         return false;
-//     unsigned long long result = insn->ops[1]->content.ic + insn->ops[2]->content.ic;
-//     if (!representable(result, insn->ct->class))
-//         return false;
-//     air_insn_operand_delete(insn->ops[1]);
-//     air_insn_operand_delete(insn->ops[2]);
-//     insn->ops[1] = air_insn_integer_constant_operand_init(result);
-//     insn->noops = 2;
-//     insn->type = AIR_LOAD;
-//     return true;
-// }
-
-// static bool constexpr_simplification(air_routine_t* routine, air_t* air)
-// {
-//     bool success = false;
-//     for (air_insn_t* insn = routine->insns; insn;)
-//     {
-//         air_insn_t* next = insn->next;
-//         switch (insn->type)
-//         {
-//             case AIR_LOAD:
-//                 success |= try_inline_integer_constant(insn, routine, air);
-//                 break;
-//             case AIR_ADD:
-//                 success |= try_simplify_integer_add(insn, routine, air);
-//                 break;
-//             default:
-//                 break;
-//         }
-//         insn = next;
-//     }
-//     return success;
-// }
+typedef struct dce
+{
+    air_routine_t* routine;
+    cfg_t* cfg;
+    locals_t* locals;
+} dce_t;
+
+// removes the stores to locals that aren't read before they're written again or the routine returns
+static size_t dce_remove_dead_stores(dce_t* d)
+{
+    size_t n = d->locals->symbols->size + 1, nblocks = d->cfg->blocks->size;
+    // which locals each block reads before writing, writes before reading, and has live on the way in
+    bool* gen = calloc(nblocks * n, sizeof(bool));
+    bool* kill = calloc(nblocks * n, sizeof(bool));
+    bool* live = calloc(nblocks * n, sizeof(bool));
+    bool* out = calloc(n, sizeof(bool));
+    VECTOR_FOR(cfg_block_t*, scanned, d->cfg->rpo)
+    {
+        if (scanned == d->cfg->exit || !scanned->first) continue;
+        bool* g = gen + scanned->id * n, * k = kill + scanned->id * n;
+        for (air_insn_t* insn = scanned->last, * stop = scanned->first->prev; insn != stop; insn = insn->prev)
+        {
+            size_t local = locals_store(d->locals, insn);
+            if (local && !is_direct_assignment(insn))
+                k[local] = true, g[local] = false;
+            if ((local = locals_load(d->locals, insn)))
+                g[local] = true;
+        }
+    }
+
+    // live-in = gen + (live-out - kill), visiting in postorder so it settles quickly
+    for (bool changed = true; changed;)
+    {
+        changed = false;
+        for (size_t i = d->cfg->rpo->size; i--;)
+        {
+            cfg_block_t* block = vector_get(d->cfg->rpo, i);
+            if (block == d->cfg->exit) continue;
+            memset(out, 0, n * sizeof(bool));
+            VECTOR_FOR(cfg_block_t*, succ, block->succs)
+            {
+                if (succ == d->cfg->exit) continue;
+                for (size_t l = 1; l < n; ++l)
+                    out[l] |= live[succ->id * n + l];
+            }
+            bool* g = gen + block->id * n, * k = kill + block->id * n, * in = live + block->id * n;
+            for (size_t l = 1; l < n; ++l)
+            {
+                bool value = g[l] || (out[l] && !k[l]);
+                if (value != in[l])
+                    in[l] = value, changed = true;
+            }
+        }
+    }
+
+    size_t removed = 0;
+    VECTOR_FOR(cfg_block_t*, block, d->cfg->rpo)
+    {
+        if (block == d->cfg->exit || !block->first) continue;
+        memset(out, 0, n * sizeof(bool));
+        VECTOR_FOR(cfg_block_t*, succ, block->succs)
+        {
+            if (succ == d->cfg->exit) continue;
+            for (size_t l = 1; l < n; ++l)
+                out[l] |= live[succ->id * n + l];
+        }
+        for (air_insn_t* insn = block->last, * stop = block->first->prev; insn != stop;)
+        {
+            air_insn_t* prev = insn->prev;
+            size_t local = locals_store(d->locals, insn);
+            if (local && !out[local])
+            {
+                air_insn_remove(insn);
+                ++removed;
+            }
+            else
+            {
+                if (local && !is_direct_assignment(insn))
+                    out[local] = false;
+                if ((local = locals_load(d->locals, insn)))
+                    out[local] = true;
+            }
+            insn = prev;
+        }
+    }
+
+    free(gen);
+    free(kill);
+    free(live);
+    free(out);
+    return removed;
+}
+
+// whether a load reads a volatile object
+static bool reads_volatile(air_insn_t* insn, air_routine_t* routine)
+{
+    if (insn->type != AIR_LOAD)
+        return false;
+    air_insn_operand_t* op = insn->ops[1];
+    if (op->type == AOP_SYMBOL || op->type == AOP_INDIRECT_SYMBOL)
+    {
+        symbol_t* sy = op->type == AOP_SYMBOL ? op->content.sy : op->content.insy.sy;
+        return sy->type && (sy->type->qualifiers & TQ_B_VOLATILE);
+    }
+    if (op->type == AOP_INDIRECT_REGISTER)
+    {
+        air_insn_t* def = vector_get(air_defuse_definitions(routine->defuse, op->content.inreg.id), 0);
+        return !def || !def->ct || def->ct->class != CTC_POINTER || !def->ct->derived_from ||
+            (def->ct->derived_from->qualifiers & TQ_B_VOLATILE);
+    }
+    return false;
+}
+
+// whether an instruction does nothing besides give its temporary a value (reading a volatile object counts as something)
+static bool dce_is_pure(air_insn_t* insn, air_routine_t* routine)
+{
+    return air_insn_creates_temporary(insn) && insn->ops[0]->type == AOP_REGISTER &&
+        !air_insn_produces_side_effect(insn) && !reads_volatile(insn, routine);
+}
+
+static bool dce_is_unused(air_routine_t* routine, regid_t reg)
+{
+    vector_t* uses = air_defuse_uses(routine->defuse, reg);
+    return !uses || !uses->size;
+}
+
+// removes the instructions whose temporaries go unused, and then whatever only they used
+static size_t dce_remove_unused(air_routine_t* routine)
+{
+    vector_t* worklist = vector_init();
+    for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
+    {
+        if (dce_is_pure(insn, routine) && dce_is_unused(routine, insn->ops[0]->content.reg))
+            vector_add(worklist, insn);
+    }
+    size_t removed = 0;
+    while (worklist->size)
+    {
+        air_insn_t* insn = vector_pop(worklist);
+        // what this one used might not be used by anything else
+        vector_t* used = vector_init();
+        for (size_t i = 1; i < insn->noops; ++i)
+        {
+            air_insn_operand_t* op = insn->ops[i];
+            if (!op) continue;
+            regid_t regs[2] = { INVALID_VREGID, INVALID_VREGID };
+            if (op->type == AOP_REGISTER)
+                regs[0] = op->content.reg;
+            else if (op->type == AOP_INDIRECT_REGISTER)
+                regs[0] = op->content.inreg.id, regs[1] = op->content.inreg.roffset;
+            // once each, so nothing goes on the worklist twice
+            for (size_t j = 0; j < 2; ++j)
+            {
+                if (regs[j] != INVALID_VREGID && !vector_contains(used, (void*) regs[j], (comparator_t) regid_comparator))
+                    vector_add(used, (void*) regs[j]);
+            }
+        }
+        air_insn_remove(insn);
+        ++removed;
+        VECTOR_FOR(regid_t, reg, used)
+        {
+            if (!dce_is_unused(routine, reg))
+                continue;
+            vector_t* defs = air_defuse_definitions(routine->defuse, reg);
+            if (!defs) continue;
+            VECTOR_FOR(air_insn_t*, def, defs)
+            {
+                if (dce_is_pure(def, routine))
+                    vector_add(worklist, def);
+            }
+        }
+        vector_delete(used);
+    }
+    vector_delete(worklist);
+    return removed;
+}
+
+// empties out the blocks control can't reach, except for their labels and declarations
+static size_t dce_remove_unreachable(cfg_t* cfg)
+{
+    size_t removed = 0;
+    VECTOR_FOR(cfg_block_t*, block, cfg->blocks)
+    {
+        if (block->rpo != SIZE_MAX || !block->first)
+            continue;
+        for (air_insn_t* insn = block->first, * end = block->last->next; insn != end;)
+        {
+            air_insn_t* next = insn->next;
+            if (insn->prev && insn->type != AIR_LABEL && insn->type != AIR_DECLARE)
+            {
+                air_insn_remove(insn);
+                ++removed;
+            }
+            insn = next;
+        }
+    }
+    return removed;
+}
+
+static void eliminate_dead_code(air_routine_t* routine)
+{
+    size_t total = 0;
+    for (size_t removed = 1; removed;)
+    {
+        dce_t d = {
+            .routine = routine,
+            .cfg = cfg_init(routine),
+            .locals = locals_find(routine)
+        };
+        removed = dce_remove_unreachable(d.cfg);
+        if (removed)
+        {
+            for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
+            {
+                if (insn->type == AIR_PHI)
+                    prune_phi(insn);
+            }
+        }
+        removed += dce_remove_dead_stores(&d);
+        cfg_delete(d.cfg);
+        locals_delete(d.locals);
+        removed += dce_remove_unused(routine);
+        total += removed;
+    }
+    if (get_program_options()->iflag)
+        printf("dead code elimination in %s: %zu instructions removed\n", symbol_get_name(routine->sy), total);
+}
+
+/*
+
+an estimate of how many temporaries are live at each instruction of a routine, for passes that make
+temporaries live longer. the allocator can't spill, so running it out of registers doesn't make
+the code slower, it makes it not compile. a temporary is live from just after its definition to
+its last use, or to the end of a loop it's used in but defined outside of (see cfg_live_until),
+which is how the allocator sees it too. integers and pointers are counted apart from floats and
+doubles since they go in different registers. the counts are kept in segment trees so that adding
+to or asking about a stretch of the routine takes logarithmic time.
+
+*/
+
+// well under what the allocator has, leaving room for what localize pins down (arguments, return values, divisions, shifts)
+#define MAX_INTEGER_PRESSURE 8
+#define MAX_SSE_PRESSURE 6
+
+typedef struct pressure
+{
+    air_routine_t* routine;
+    cfg_t* cfg;
+    vector_t* insns; // <air_insn_t*> in routine order
+    long* max[2]; // integer and sse segment trees: the most live over each node's stretch
+    long* added[2]; // and what was added to all of that stretch
+    map_t* ends; // <regid_t, size_t> position of each temporary's last use (+ 1)
+} pressure_t;
+
+static void pressure_tree_add(long* max, long* added, size_t node, size_t lo, size_t hi, size_t from, size_t to, long delta)
+{
+    if (to < lo || hi < from)
+        return;
+    if (from <= lo && hi <= to)
+    {
+        max[node] += delta;
+        added[node] += delta;
+        return;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    pressure_tree_add(max, added, node * 2 + 1, lo, mid, from, to, delta);
+    pressure_tree_add(max, added, node * 2 + 2, mid + 1, hi, from, to, delta);
+    max[node] = (max[node * 2 + 1] > max[node * 2 + 2] ? max[node * 2 + 1] : max[node * 2 + 2]) + added[node];
+}
+
+static long pressure_tree_max(long* max, long* added, size_t node, size_t lo, size_t hi, size_t from, size_t to)
+{
+    if (to < lo || hi < from)
+        return 0;
+    if (from <= lo && hi <= to)
+        return max[node];
+    size_t mid = lo + (hi - lo) / 2;
+    long left = pressure_tree_max(max, added, node * 2 + 1, lo, mid, from, to);
+    long right = pressure_tree_max(max, added, node * 2 + 2, mid + 1, hi, from, to);
+    return (left > right ? left : right) + added[node];
+}
+
+static size_t pressure_class(c_type_t* ct)
+{
+    return ct && type_is_sse_floating(ct) ? 1 : 0;
+}
+
+static size_t pressure_position(pressure_t* p, air_insn_t* insn)
+{
+    return air_insn_vector_search(p->insns, insn->order);
+}
+
+// adds to how many temporaries are live from one position to another (both included)
+static void pressure_add(pressure_t* p, c_type_t* ct, size_t from, size_t to, long delta)
+{
+    if (from > to)
+        return;
+    size_t class = pressure_class(ct);
+    pressure_tree_add(p->max[class], p->added[class], 0, 0, p->insns->size - 1, from, to, delta);
+}
+
+// whether one more temporary can be live from one position to another (both included)
+static bool pressure_fits(pressure_t* p, c_type_t* ct, size_t from, size_t to)
+{
+    if (from > to)
+        return true;
+    size_t class = pressure_class(ct);
+    long most = pressure_tree_max(p->max[class], p->added[class], 0, 0, p->insns->size - 1, from, to);
+    return most + 1 <= (class ? MAX_SSE_PRESSURE : MAX_INTEGER_PRESSURE);
+}
+
+// whether there's a function call at a position from one to another (the last not included)
+static bool pressure_crosses_call(pressure_t* p, size_t from, size_t to)
+{
+    if (from >= to)
+        return false;
+    vector_t* calls = p->routine->defuse->calls;
+    size_t i = air_insn_vector_search(calls, ((air_insn_t*) vector_get(p->insns, from))->order);
+    if (i >= calls->size)
+        return false;
+    air_insn_t* call = vector_get(calls, i);
+    return call->order < ((air_insn_t*) vector_get(p->insns, to))->order;
+}
+
+// position of the last use of a temporary as it would be if it were defined by def (the definition itself if it's unused)
+static size_t pressure_find_end(pressure_t* p, air_insn_t* def, regid_t reg)
+{
+    size_t end = pressure_position(p, def);
+    vector_t* uses = air_defuse_uses(p->routine->defuse, reg);
+    if (!uses)
+        return end;
+    VECTOR_FOR(air_insn_t*, use, uses)
+    {
+        size_t pos = pressure_position(p, cfg_live_until(p->cfg, def, use));
+        if (pos > end)
+            end = pos;
+    }
+    return end;
+}
+
+// position of the last use of a temporary (the definition itself if it's unused)
+static size_t pressure_end(pressure_t* p, regid_t reg)
+{
+    return (size_t) map_get(p->ends, (void*) reg) - 1;
+}
+
+static void pressure_set_end(pressure_t* p, regid_t reg, size_t end)
+{
+    map_add(p->ends, (void*) reg, (void*) (end + 1));
+}
+
+static pressure_t* pressure_init(air_routine_t* routine, cfg_t* cfg)
+{
+    pressure_t* p = calloc(1, sizeof *p);
+    p->routine = routine;
+    p->cfg = cfg;
+    p->insns = vector_init();
+    p->ends = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+    for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
+        vector_add(p->insns, insn);
+    size_t nodes = p->insns->size * 4;
+    for (size_t class = 0; class < 2; ++class)
+    {
+        p->max[class] = calloc(nodes, sizeof(long));
+        p->added[class] = calloc(nodes, sizeof(long));
+    }
+    VECTOR_FOR(air_insn_t*, def, p->insns)
+    {
+        if (!air_insn_creates_temporary(def) || def->ops[0]->type != AOP_REGISTER)
+            continue;
+        regid_t reg = def->ops[0]->content.reg;
+        if (reg <= NO_PHYSICAL_REGISTERS || map_contains_key(p->ends, (void*) reg))
+            continue;
+        size_t end = pressure_find_end(p, def, reg);
+        pressure_add(p, def->ct, pressure_position(p, def) + 1, end, 1);
+        pressure_set_end(p, reg, end);
+    }
+    return p;
+}
+
+static void pressure_delete(pressure_t* p)
+{
+    if (!p) return;
+    vector_delete(p->insns);
+    map_delete(p->ends);
+    for (size_t class = 0; class < 2; ++class)
+    {
+        free(p->max[class]);
+        free(p->added[class]);
+    }
+    free(p);
+}
+
+/*
+
+global value numbering (the dominator-based kind, after Briggs, Cooper, and Simpson). the dominator
+tree is walked from the entry, and every computation that depends on nothing but its operands gets
+a key made of what it does, its type, and the value numbers of its operands. a computation whose key
+was already seen in a block dominating it has the same value as the one seen first, so its uses are
+pointed at that one's temporary instead and it goes away. keys live in a table that forgets
+whatever a block added once the walk is done with the block and its subtree, so only dominating
+computations are ever found. additions, multiplications, equality, and the bitwise operations don't
+care about the order of their operands, so those are sorted first.
+
+loads are computations too, as long as nothing could have changed what they read in between. a
+load from a local whose every access can be seen (see locals_t) is keyed by the local and how many
+times it has been written, and any other load is keyed by the state of memory, which changes with
+every store or function call that could go anywhere. a block only carries on with what's known
+about memory from its immediate dominator if that's the only way into it; anywhere control comes
+together, nothing is known.
+
+temporaries that are defined more than once (or merged by a phi, which amounts to the same thing
+once phis go away) don't have one value, so nothing defined by or using one is numbered. constants
+and addresses of symbols are numbered but never replaced, since it's cheaper to make them again
+than to keep them in a register. reusing a temporary makes it live longer, so it's only done when
+it doesn't keep more temporaries live than the registers can hold (see pressure_t) and doesn't keep
+the temporary live across a function call where it didn't have to be before (which costs a
+callee-saved register, and there are only five of those and no floating ones). otherwise, the
+later computation stays and is the one reused from then on.
+
+*/
+
+typedef struct gvn_operand
+{
+    air_insn_operand_type_t type;
+    c_type_t* ct;
+    unsigned long long content[4];
+} gvn_operand_t;
+
+typedef struct gvn_key
+{
+    air_insn_type_t type;
+    c_type_t* ct;
+    // the state of memory a load reads (or for a local, the epoch and version it reads)
+    unsigned long long memory;
+    unsigned long long version;
+    gvn_operand_t ops[2];
+} gvn_key_t;
+
+typedef struct gvn
+{
+    air_routine_t* routine;
+    cfg_t* cfg;
+    locals_t* locals;
+    pressure_t* pressure;
+    map_t* table; // <gvn_key_t*, void*> first instruction computing each value (or for a local, how many times it's been written)
+    vector_t* undo_keys; // <gvn_key_t*> what the table had before each change made to it, so it can be put back
+    vector_t* undo_values; // <void*>
+    map_t* numbers; // <regid_t, regid_t> temporary holding the same value first, for temporaries that aren't the first
+    map_t* unstable; // <regid_t, bool> temporaries that don't hold one value
+    vector_t* replaced; // <air_insn_t*> instructions whose uses now use an earlier temporary
+    unsigned long long next; // for memory states, epochs, and versions of locals (never 0)
+    unsigned long long memory; // state of memory at the current instruction
+    unsigned long long epoch; // changes wherever control comes together, where the versions of locals no longer say anything
+    unsigned long long* memory_at_end; // by block
+    unsigned long long* epoch_at_end; // by block
+} gvn_t;
+
+static int gvn_key_comparator(gvn_key_t* k1, gvn_key_t* k2)
+{
+    return memcmp(k1, k2, sizeof *k1);
+}
+
+// FNV-1a over the bytes of the key (which are all set, padding included)
+static unsigned long gvn_key_hash(gvn_key_t* k)
+{
+    unsigned long h = 14695981039346656037UL;
+    unsigned char* bytes = (unsigned char*) k;
+    for (size_t i = 0; i < sizeof *k; ++i)
+    {
+        h ^= bytes[i];
+        h *= 1099511628211UL;
+    }
+    return h;
+}
+
+// whether an instruction of this type computes its temporary's value from nothing but its operands (and for loads, memory)
+static bool computes_value(air_insn_type_t type)
+{
+    switch (type)
+    {
+        case AIR_LOAD:
+        case AIR_LOAD_ADDR:
+        case AIR_ADD:
+        case AIR_SUBTRACT:
+        case AIR_MULTIPLY:
+        case AIR_DIVIDE:
+        case AIR_MODULO:
+        case AIR_NEGATE:
+        case AIR_POSATE:
+        case AIR_COMPLEMENT:
+        case AIR_NOT:
+        case AIR_SEXT:
+        case AIR_ZEXT:
+        case AIR_S2D:
+        case AIR_D2S:
+        case AIR_S2SI:
+        case AIR_S2UI:
+        case AIR_D2SI:
+        case AIR_D2UI:
+        case AIR_SI2S:
+        case AIR_UI2S:
+        case AIR_SI2D:
+        case AIR_UI2D:
+        case AIR_SHIFT_LEFT:
+        case AIR_SHIFT_RIGHT:
+        case AIR_SIGNED_SHIFT_RIGHT:
+        case AIR_LESS_EQUAL:
+        case AIR_LESS:
+        case AIR_GREATER_EQUAL:
+        case AIR_GREATER:
+        case AIR_EQUAL:
+        case AIR_INEQUAL:
+        case AIR_AND:
+        case AIR_XOR:
+        case AIR_OR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool gvn_is_commutative(air_insn_type_t type)
+{
+    switch (type)
+    {
+        case AIR_ADD:
+        case AIR_MULTIPLY:
+        case AIR_EQUAL:
+        case AIR_INEQUAL:
+        case AIR_AND:
+        case AIR_XOR:
+        case AIR_OR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// whether a value of this type fits in one register
+static bool fits_register(c_type_t* ct)
+{
+    return ct && (type_is_integer(ct) || ct->class == CTC_POINTER || type_is_sse_floating(ct));
+}
+
+// whether it's cheaper to compute again than to keep around
+static bool is_rematerializable(air_insn_t* insn)
+{
+    return (insn->type == AIR_LOAD && insn->ops[1]->type == AOP_INTEGER_CONSTANT) ||
+        (insn->type == AIR_LOAD_ADDR && insn->ops[1]->type == AOP_SYMBOL);
+}
+
+static regid_t gvn_number(gvn_t* g, regid_t reg)
+{
+    regid_t first = (regid_t) map_get(g->numbers, (void*) reg);
+    return first ? first : reg;
+}
+
+static bool gvn_is_unstable(gvn_t* g, regid_t reg)
+{
+    return reg != INVALID_VREGID && map_contains_key(g->unstable, (void*) reg);
+}
+
+// fills in the key for an operand, returning whether it has a value that can be numbered
+static bool gvn_operand(gvn_t* g, air_insn_operand_t* op, gvn_operand_t* key)
+{
+    key->type = op->type;
+    key->ct = op->ct;
+    switch (op->type)
+    {
+        case AOP_REGISTER:
+            if (gvn_is_unstable(g, op->content.reg))
+                return false;
+            key->content[0] = gvn_number(g, op->content.reg);
+            return true;
+        case AOP_INDIRECT_REGISTER:
+            if (gvn_is_unstable(g, op->content.inreg.id) || gvn_is_unstable(g, op->content.inreg.roffset))
+                return false;
+            key->content[0] = gvn_number(g, op->content.inreg.id);
+            key->content[1] = op->content.inreg.roffset == INVALID_VREGID ? INVALID_VREGID : gvn_number(g, op->content.inreg.roffset);
+            key->content[2] = op->content.inreg.offset;
+            key->content[3] = op->content.inreg.factor;
+            return true;
+        case AOP_SYMBOL:
+            key->content[0] = (unsigned long long) op->content.sy;
+            return true;
+        case AOP_INDIRECT_SYMBOL:
+            key->content[0] = (unsigned long long) op->content.insy.sy;
+            key->content[1] = op->content.insy.offset;
+            return true;
+        case AOP_INTEGER_CONSTANT:
+            key->content[0] = op->content.ic;
+            return true;
+        default:
+            return false;
+    }
+}
+
+// how many times a local has been written so far (0 if not yet in this state of memory)
+static unsigned long long gvn_version(gvn_t* g, symbol_t* sy)
+{
+    gvn_key_t key;
+    memset(&key, 0, sizeof key);
+    key.type = AIR_DECLARE;
+    key.ops[0].type = AOP_SYMBOL;
+    key.ops[0].content[0] = (unsigned long long) sy;
+    return (unsigned long long) map_get(g->table, &key);
+}
+
+// fills in the key for an instruction, returning whether it computes something that can be numbered
+static bool gvn_key(gvn_t* g, air_insn_t* insn, gvn_key_t* key)
+{
+    memset(key, 0, sizeof *key);
+    if (!computes_value(insn->type) || !fits_register(insn->ct) || insn->noops > 3 ||
+        insn->ops[0]->type != AOP_REGISTER || insn->ops[0]->content.reg <= NO_PHYSICAL_REGISTERS ||
+        gvn_is_unstable(g, insn->ops[0]->content.reg) || reads_volatile(insn, g->routine))
+        return false;
+    key->type = insn->type;
+    key->ct = insn->ct;
+    for (size_t i = 1; i < insn->noops; ++i)
+    {
+        if (!gvn_operand(g, insn->ops[i], &key->ops[i - 1]))
+            return false;
+    }
+    if (gvn_is_commutative(insn->type) && insn->noops == 3 && memcmp(&key->ops[0], &key->ops[1], sizeof key->ops[0]) > 0)
+    {
+        gvn_operand_t op = key->ops[0];
+        key->ops[0] = key->ops[1];
+        key->ops[1] = op;
+    }
+    if (insn->type != AIR_LOAD)
+        return true;
+    air_insn_operand_t* src = insn->ops[1];
+    if (src->type != AOP_SYMBOL && src->type != AOP_INDIRECT_SYMBOL && src->type != AOP_INDIRECT_REGISTER)
+        return true;
+    size_t local = locals_operand(g->locals, src);
+    if (local)
+    {
+        // by the local itself, whether it's read by name or through its address
+        symbol_t* sy = vector_get(g->locals->symbols, local - 1);
+        memset(&key->ops[0], 0, sizeof key->ops[0]);
+        key->ops[0].type = AOP_SYMBOL;
+        key->ops[0].content[0] = (unsigned long long) sy;
+        key->memory = g->epoch;
+        key->version = gvn_version(g, sy);
+    }
+    else
+        key->memory = g->memory;
+    return true;
+}
+
+// changes the table in a way that's undone when the walk leaves the current block
+static void gvn_set(gvn_t* g, gvn_key_t* key, void* value)
+{
+    gvn_key_t* copy = malloc(sizeof *copy);
+    memcpy(copy, key, sizeof *copy);
+    void* old = map_get(g->table, key);
+    if (old)
+        map_add(g->table, key, value);
+    else
+    {
+        gvn_key_t* kept = malloc(sizeof *kept);
+        memcpy(kept, key, sizeof *kept);
+        map_add(g->table, kept, value);
+    }
+    vector_add(g->undo_keys, copy);
+    vector_add(g->undo_values, old);
+}
+
+static void gvn_undo(gvn_t* g, size_t mark)
+{
+    while (g->undo_keys->size > mark)
+    {
+        gvn_key_t* key = vector_pop(g->undo_keys);
+        void* old = vector_pop(g->undo_values);
+        if (old)
+            map_add(g->table, key, old);
+        else
+            map_remove(g->table, key);
+        free(key);
+    }
+}
+
+// points an operand's uses of one temporary at another
+static void rename_operand(air_insn_operand_t* op, regid_t from, regid_t to)
+{
+    if (op->type == AOP_REGISTER && op->content.reg == from)
+        op->content.reg = to;
+    else if (op->type == AOP_INDIRECT_REGISTER)
+    {
+        if (op->content.inreg.id == from)
+            op->content.inreg.id = to;
+        if (op->content.inreg.roffset == from)
+            op->content.inreg.roffset = to;
+    }
+}
+
+// points the uses of what an instruction computes at what an earlier one computed, if that's worth it
+static bool gvn_replace(gvn_t* g, air_insn_t* insn, air_insn_t* first)
+{
+    pressure_t* p = g->pressure;
+    regid_t reg = insn->ops[0]->content.reg;
+    regid_t with = first->ops[0]->content.reg;
+    vector_t* uses = air_defuse_uses(g->routine->defuse, reg);
+    if (!uses || !uses->size)
+    {
+        pressure_add(p, insn->ct, pressure_position(p, insn) + 1, pressure_end(p, reg), -1);
+        vector_add(g->replaced, insn);
+        return true;
+    }
+    size_t end = pressure_end(p, with);
+    size_t new_end = end;
+    VECTOR_FOR(air_insn_t*, use, uses)
+    {
+        // the allocator's live ranges run forward through the routine
+        if (use->order <= first->order)
+            return false;
+        size_t pos = pressure_position(p, cfg_live_until(g->cfg, first, use));
+        if (pos > new_end)
+            new_end = pos;
+    }
+    size_t start = pressure_position(p, insn) + 1, old_end = pressure_end(p, reg);
+    if (new_end > end)
+    {
+        if (pressure_crosses_call(p, end, new_end))
+            return false;
+        pressure_add(p, insn->ct, start, old_end, -1);
+        if (!pressure_fits(p, first->ct, end + 1, new_end))
+        {
+            pressure_add(p, insn->ct, start, old_end, 1);
+            return false;
+        }
+        pressure_add(p, first->ct, end + 1, new_end, 1);
+        pressure_set_end(p, with, new_end);
+    }
+    else
+        pressure_add(p, insn->ct, start, old_end, -1);
+
+    vector_t* users = vector_copy(uses);
+    VECTOR_FOR(air_insn_t*, user, users)
+    {
+        air_defuse_t* defuse = air_insn_unindex(user);
+        for (size_t j = 0; j < user->noops; ++j)
+        {
+            if (user->ops[j])
+                rename_operand(user->ops[j], reg, with);
+        }
+        air_insn_index(user, defuse);
+    }
+    vector_delete(users);
+    vector_add(g->replaced, insn);
+    return true;
+}
+
+static void gvn_visit(gvn_t* g, air_insn_t* insn)
+{
+    gvn_key_t key;
+    if (gvn_key(g, insn, &key))
+    {
+        regid_t reg = insn->ops[0]->content.reg;
+        air_insn_t* first = map_get(g->table, &key);
+        if (!first)
+            gvn_set(g, &key, insn);
+        else if (is_rematerializable(insn) || gvn_replace(g, insn, first))
+            map_add(g->numbers, (void*) reg, (void*) first->ops[0]->content.reg);
+        else
+            // kept, so the ones after it use it instead
+            gvn_set(g, &key, insn);
+    }
+
+    size_t local = locals_store(g->locals, insn);
+    if (local)
+    {
+        gvn_key_t version;
+        memset(&version, 0, sizeof version);
+        version.type = AIR_DECLARE;
+        version.ops[0].type = AOP_SYMBOL;
+        version.ops[0].content[0] = (unsigned long long) vector_get(g->locals->symbols, local - 1);
+        gvn_set(g, &version, (void*) ++g->next);
+    }
+    else if (air_insn_produces_side_effect(insn) || insn->type == AIR_MEMSET)
+        g->memory = ++g->next;
+}
+
+static void gvn_visit_block(gvn_t* g, cfg_block_t* block)
+{
+    if (block->preds->size == 1 && vector_get(block->preds, 0) == block->idom)
+    {
+        g->memory = g->memory_at_end[block->idom->id];
+        g->epoch = g->epoch_at_end[block->idom->id];
+    }
+    else
+    {
+        g->memory = ++g->next;
+        g->epoch = ++g->next;
+    }
+    CFG_BLOCK_FOR(insn, block)
+        gvn_visit(g, insn);
+    g->memory_at_end[block->id] = g->memory;
+    g->epoch_at_end[block->id] = g->epoch;
+}
+
+// temporaries that aren't given one value once: defined more than once, assigned to, or merged by a phi
+static map_t* find_unstable_temporaries(air_routine_t* routine)
+{
+    map_t* unstable = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+    for (air_insn_t* insn = routine->insns; insn; insn = insn->next)
+    {
+        if (insn->type == AIR_PHI)
+        {
+            for (size_t i = 1; i < insn->noops; ++i)
+            {
+                if (insn->ops[i]->type == AOP_REGISTER)
+                    map_add(unstable, (void*) insn->ops[i]->content.reg, (void*) true);
+            }
+        }
+        if (!insn->noops || !insn->ops[0] || insn->ops[0]->type != AOP_REGISTER)
+            continue;
+        regid_t reg = insn->ops[0]->content.reg;
+        vector_t* defs = air_defuse_definitions(routine->defuse, reg);
+        if (!air_insn_creates_temporary(insn) || (defs && defs->size > 1))
+            map_add(unstable, (void*) reg, (void*) true);
+    }
+    return unstable;
+}
+
+// walks the dominator tree, leaving each block's additions to the table in place for its subtree
+static void gvn_walk(gvn_t* g)
+{
+    size_t n = g->cfg->blocks->size + 1;
+    vector_t** children = calloc(n, sizeof(vector_t*));
+    VECTOR_FOR(cfg_block_t*, block, g->cfg->rpo)
+    {
+        if (block == g->cfg->exit || !block->idom)
+            continue;
+        if (!children[block->idom->id])
+            children[block->idom->id] = vector_init();
+        vector_add(children[block->idom->id], block);
+    }
+
+    cfg_block_t** stack = calloc(n, sizeof(cfg_block_t*));
+    size_t* marks = calloc(n, sizeof(size_t));
+    size_t* visited = calloc(n, sizeof(size_t));
+    size_t depth = 0;
+    cfg_block_t* entry = vector_get(g->cfg->rpo, 0);
+    marks[depth] = g->undo_keys->size;
+    stack[depth++] = entry;
+    gvn_visit_block(g, entry);
+    while (depth)
+    {
+        cfg_block_t* block = stack[depth - 1];
+        vector_t* kids = children[block->id];
+        if (kids && visited[depth - 1] < kids->size)
+        {
+            cfg_block_t* child = vector_get(kids, visited[depth - 1]++);
+            marks[depth] = g->undo_keys->size;
+            visited[depth] = 0;
+            stack[depth++] = child;
+            gvn_visit_block(g, child);
+            continue;
+        }
+        gvn_undo(g, marks[--depth]);
+    }
+
+    for (size_t i = 0; i < n; ++i)
+        vector_delete(children[i]);
+    free(children);
+    free(stack);
+    free(marks);
+    free(visited);
+}
+
+static void eliminate_common_subexpressions(air_routine_t* routine)
+{
+    if (!routine->insns)
+        return;
+    gvn_t g = {
+        .routine = routine,
+        .cfg = cfg_init(routine),
+        .locals = locals_find(routine),
+        .table = map_init((comparator_t) gvn_key_comparator, (hash_function_t) gvn_key_hash),
+        .undo_keys = vector_init(),
+        .undo_values = vector_init(),
+        .numbers = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash),
+        .unstable = find_unstable_temporaries(routine),
+        .replaced = vector_init()
+    };
+    map_set_deleters(g.table, free, NULL);
+    g.pressure = pressure_init(routine, g.cfg);
+    g.memory_at_end = calloc(g.cfg->blocks->size + 1, sizeof(unsigned long long));
+    g.epoch_at_end = calloc(g.cfg->blocks->size + 1, sizeof(unsigned long long));
+    gvn_walk(&g);
+
+    pressure_delete(g.pressure);
+    cfg_delete(g.cfg);
+    VECTOR_FOR(air_insn_t*, insn, g.replaced)
+        air_insn_remove(insn);
+    if (get_program_options()->iflag)
+        printf("common subexpression elimination in %s: %zu instructions replaced\n", symbol_get_name(routine->sy), (size_t) g.replaced->size);
+    locals_delete(g.locals);
+    map_delete(g.table);
+    vector_delete(g.undo_keys);
+    vector_delete(g.undo_values);
+    map_delete(g.numbers);
+    map_delete(g.unstable);
+    vector_delete(g.replaced);
+    free(g.memory_at_end);
+    free(g.epoch_at_end);
+}
+
+/*
+
+loop-invariant code motion. whatever a loop computes the same way every time around moves out in
+front of it, into its preheader: the block that control enters the loop from. loops without one (more
+than one way in from outside, or a conditional jump straight to the header) are left alone. loops
+are taken innermost first, so something invariant in a whole nest can move out of each loop in turn.
+
+an instruction is invariant if it computes its value from nothing but its operands (see
+computes_value) and every operand is defined outside of the loop or by something already moved out.
+loads are too if nothing in the loop can change what they read: a local whose every access can be
+seen (see locals_t) that the loop never writes, or any other object named outright if the loop
+doesn't store anywhere but such locals or call anything. the preheader runs even when the loop body
+never does, so nothing that could trap moves: no loads through pointers and no divisions.
+
+what's moved out stays live through the whole loop, so it has to fit in the registers (see
+pressure_t) and can't be live across a function call in the loop. constants and addresses of symbols
+are cheap to make again, so they only get whatever room is left over once everything else has
+moved.
+
+*/
+
+typedef struct licm
+{
+    air_routine_t* routine;
+    cfg_t* cfg;
+    locals_t* locals;
+    map_t* unstable; // <regid_t, bool> temporaries that don't hold one value
+    pressure_t* pressure;
+    cfg_loop_t* loop;
+    cfg_block_t* preheader;
+    air_insn_t* anchor; // what moved instructions go in front of
+    map_t* moved; // <regid_t, bool> temporaries of the instructions moving out
+    vector_t* moving; // <air_insn_t*> in the order they go
+    bool clobbers; // whether the loop stores somewhere other than the locals it can see or calls anything
+    bool* written; // <bool> by local, whether the loop writes it
+} licm_t;
+
+// finds the block control enters a loop from and what to put code running on the way in in front of, returning whether there's such a place
+static bool find_preheader(cfg_loop_t* loop, cfg_block_t** preheader, air_insn_t** anchor)
+{
+    cfg_block_t* header = loop->header;
+    cfg_block_t* found = NULL;
+    VECTOR_FOR(cfg_block_t*, pred, header->preds)
+    {
+        if (cfg_loop_contains(loop, pred))
+            continue;
+        if (found)
+            return false;
+        found = pred;
+    }
+    // an empty block has nothing to anchor the moved instructions to
+    if (!found || !found->first)
+        return false;
+    *preheader = found;
+    // a jump to the loop (for and while loops), or falling into it (do loops)
+    if (found->succs->size == 1 && found->last->type == AIR_JMP)
+        *anchor = found->last;
+    else if (found->last->next == header->first)
+        *anchor = header->first;
+    else
+        return false;
+    return true;
+}
+
+static void licm_find_writes(licm_t* l)
+{
+    l->clobbers = false;
+    l->written = calloc(l->locals->symbols->size + 1, sizeof(bool));
+    VECTOR_FOR(cfg_block_t*, block, l->loop->blocks)
+    {
+        CFG_BLOCK_FOR(insn, block)
+        {
+            size_t local = locals_store(l->locals, insn);
+            if (local)
+                l->written[local - 1] = true;
+            else if (air_insn_produces_side_effect(insn) || insn->type == AIR_MEMSET)
+                l->clobbers = true;
+        }
+    }
+}
+
+// whether a temporary has the same value everywhere in the loop
+static bool licm_is_invariant_temporary(licm_t* l, regid_t reg)
+{
+    if (reg == INVALID_VREGID || map_contains_key(l->moved, (void*) reg))
+        return true;
+    if (map_contains_key(l->unstable, (void*) reg))
+        return false;
+    air_insn_t* def = vector_get(air_defuse_definitions(l->routine->defuse, reg), 0);
+    return def && !cfg_loop_contains(l->loop, cfg_find_block(l->cfg, def));
+}
+
+static bool licm_is_invariant(licm_t* l, air_insn_t* insn)
+{
+    if (!computes_value(insn->type) || insn->type == AIR_DIVIDE || insn->type == AIR_MODULO ||
+        !fits_register(insn->ct) || insn->noops > 3 || insn->ops[0]->type != AOP_REGISTER)
+        return false;
+    regid_t reg = insn->ops[0]->content.reg;
+    if (reg <= NO_PHYSICAL_REGISTERS || map_contains_key(l->unstable, (void*) reg) ||
+        map_contains_key(l->moved, (void*) reg) || reads_volatile(insn, l->routine))
+        return false;
+    for (size_t i = 1; i < insn->noops; ++i)
+    {
+        air_insn_operand_t* op = insn->ops[i];
+        switch (op->type)
+        {
+            case AOP_REGISTER:
+                if (!licm_is_invariant_temporary(l, op->content.reg))
+                    return false;
+                break;
+            case AOP_INDIRECT_REGISTER:
+                if (!licm_is_invariant_temporary(l, op->content.inreg.id) ||
+                    !licm_is_invariant_temporary(l, op->content.inreg.roffset))
+                    return false;
+                break;
+            case AOP_SYMBOL:
+            case AOP_INDIRECT_SYMBOL:
+            case AOP_INTEGER_CONSTANT:
+                break;
+            default:
+                return false;
+        }
+    }
+    if (insn->type != AIR_LOAD)
+        return true;
+    air_insn_operand_t* src = insn->ops[1];
+    size_t local = locals_operand(l->locals, src);
+    if (local)
+        return !l->written[local - 1];
+    if (src->type == AOP_SYMBOL || src->type == AOP_INDIRECT_SYMBOL)
+        return !l->clobbers;
+    // anything else could be a pointer that's only good while the loop runs
+    return src->type != AOP_INDIRECT_REGISTER;
+}
+
+// position of the last use of a temporary once it and whatever uses it that's moving out are in the preheader
+static size_t licm_find_end(licm_t* l, regid_t reg)
+{
+    pressure_t* p = l->pressure;
+    size_t end = pressure_position(p, l->anchor);
+    vector_t* uses = air_defuse_uses(l->routine->defuse, reg);
+    if (!uses)
+        return end;
+    VECTOR_FOR(air_insn_t*, use, uses)
+    {
+        if (air_insn_creates_temporary(use) && use->ops[0]->type == AOP_REGISTER &&
+            map_contains_key(l->moved, (void*) use->ops[0]->content.reg))
+            continue;
+        size_t pos = pressure_position(p, cfg_live_until(l->cfg, l->preheader->last, use));
+        if (pos > end)
+            end = pos;
+    }
+    return end;
+}
+
+// whether the instruction's temporary can stay live through the loop, counting it as such if so
+static bool licm_fits(licm_t* l, air_insn_t* insn)
+{
+    pressure_t* p = l->pressure;
+    regid_t reg = insn->ops[0]->content.reg;
+    size_t start = pressure_position(p, l->anchor);
+    size_t end = licm_find_end(l, reg);
+    if (pressure_crosses_call(p, start, end))
+        return false;
+    size_t old_start = pressure_position(p, insn) + 1, old_end = pressure_end(p, reg);
+    pressure_add(p, insn->ct, old_start, old_end, -1);
+    if (!pressure_fits(p, insn->ct, start, end))
+    {
+        pressure_add(p, insn->ct, old_start, old_end, 1);
+        return false;
+    }
+    pressure_add(p, insn->ct, start, end, 1);
+    pressure_set_end(p, reg, end);
+    return true;
+}
+
+// moves an instruction out, along with the ends of the live ranges of what it uses that's moving out too
+static void licm_move(licm_t* l, air_insn_t* insn)
+{
+    pressure_t* p = l->pressure;
+    map_add(l->moved, (void*) insn->ops[0]->content.reg, (void*) true);
+    vector_add(l->moving, insn);
+    for (size_t i = 1; i < insn->noops; ++i)
+    {
+        air_insn_operand_t* op = insn->ops[i];
+        regid_t regs[2] = { INVALID_VREGID, INVALID_VREGID };
+        if (op->type == AOP_REGISTER)
+            regs[0] = op->content.reg;
+        else if (op->type == AOP_INDIRECT_REGISTER)
+            regs[0] = op->content.inreg.id, regs[1] = op->content.inreg.roffset;
+        for (size_t j = 0; j < 2; ++j)
+        {
+            if (regs[j] == INVALID_VREGID || !map_contains_key(l->moved, (void*) regs[j]))
+                continue;
+            air_insn_t* def = vector_get(air_defuse_definitions(l->routine->defuse, regs[j]), 0);
+            size_t end = licm_find_end(l, regs[j]), old_end = pressure_end(p, regs[j]);
+            if (end < old_end)
+            {
+                pressure_add(p, def->ct, end + 1, old_end, -1);
+                pressure_set_end(p, regs[j], end);
+            }
+        }
+    }
+}
+
+// picks what can move out of the loop, first everything that's costly to compute and then what isn't
+static void licm_find_invariants(licm_t* l)
+{
+    for (int cheap = 0; cheap < 2; ++cheap)
+    {
+        for (bool found = true; found;)
+        {
+            found = false;
+            VECTOR_FOR(cfg_block_t*, block, l->loop->blocks)
+            {
+                CFG_BLOCK_FOR(insn, block)
+                {
+                    if (is_rematerializable(insn) != cheap || !licm_is_invariant(l, insn) || !licm_fits(l, insn))
+                        continue;
+                    licm_move(l, insn);
+                    found = true;
+                }
+            }
+        }
+    }
+}
+
+// moves what's invariant in a loop out to its preheader, returning how many instructions moved
+static size_t licm_hoist(licm_t* l)
+{
+    if (!find_preheader(l->loop, &l->preheader, &l->anchor))
+        return 0;
+    l->pressure = pressure_init(l->routine, l->cfg);
+    l->moved = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+    l->moving = vector_init();
+    licm_find_writes(l);
+    licm_find_invariants(l);
+    size_t count = l->moving->size;
+    VECTOR_FOR(air_insn_t*, insn, l->moving)
+        air_insn_move_before(insn, l->anchor);
+    pressure_delete(l->pressure);
+    map_delete(l->moved);
+    vector_delete(l->moving);
+    free(l->written);
+    return count;
+}
+
+static void hoist_loop_invariants(air_routine_t* routine)
+{
+    if (!routine->insns)
+        return;
+    cfg_t* cfg = cfg_init(routine);
+    // loops are found again each time code moves, so they're told apart by the labels heading them
+    vector_t* headers = vector_init();
+    for (size_t i = cfg->loops->size; i-- > 0;)
+        vector_add(headers, ((cfg_loop_t*) vector_get(cfg->loops, i))->header->first);
+    licm_t l = {
+        .routine = routine,
+        .cfg = cfg,
+        .locals = locals_find(routine),
+        .unstable = find_unstable_temporaries(routine)
+    };
+    size_t total = 0;
+    VECTOR_FOR(air_insn_t*, label, headers)
+    {
+        l.loop = NULL;
+        VECTOR_FOR(cfg_loop_t*, loop, cfg->loops)
+        {
+            if (loop->header->first == label)
+                l.loop = loop;
+        }
+        if (!l.loop)
+            continue;
+        size_t moved = licm_hoist(&l);
+        if (moved)
+            cfg_rebuild(cfg);
+        total += moved;
+    }
+    if (get_program_options()->iflag)
+        printf("loop-invariant code motion in %s: %zu instructions hoisted\n", symbol_get_name(routine->sy), total);
+    vector_delete(headers);
+    locals_delete(l.locals);
+    map_delete(l.unstable);
+    cfg_delete(cfg);
+}
+
+/*
+
+strength reduction of induction variables. a loop's counter is a local whose every access can be
+seen (see locals_t) that the loop changes in just one place, by adding or subtracting a constant in
+a block every way back around to the header goes through. addresses computed off of it, like
+a + i * 8 with a invariant, each get a pointer of their own that starts out in the preheader where
+the counter does and moves right after the counter does, so the multiplication, the addition, and
+reading the counter back out of memory go away.
+
+if all the loop does with the counter otherwise is compare it against something invariant, and
+nothing after the loop reads it, the counter goes too: the comparisons are made against where one
+of the pointers will be once the counter gets to what it's compared against instead. the pointers
+are compared as signed 64-bit integers, same as the counter would be widened to, which they can't
+overflow (user-space addresses are well under half of the address space).
+
+the pointers are carried around the loop by phi instructions at its header, and remove_phi_instructions
+only renames what comes before one, so only loops that are tested at the bottom (for and while loops,
+entered by a jump to the test) are done. like what licm moves out, each pointer has to fit in the
+registers through the whole loop, and loops with calls in them are left alone.
+
+*/
+
+// a pointer moving through memory alongside a loop's counter, standing in for base + counter * scale
+typedef struct ivsr_pointer
+{
+    regid_t base;
+    long long scale;
+    c_type_t* ct;
+    regid_t top; // what it is at the top of the loop (a phi)
+    regid_t stepped; // what it is after the counter's been changed
+} ivsr_pointer_t;
+
+// an operand to point at one of the pointers, or an addition whose result is one
+typedef struct ivsr_rewrite
+{
+    air_insn_t* insn;
+    size_t index; // of the operand (0 for an addition)
+    ivsr_pointer_t* pointer;
+    bool stepped;
+} ivsr_rewrite_t;
+
+typedef struct ivsr
+{
+    air_routine_t* routine;
+    air_t* air;
+    cfg_t* cfg;
+    locals_t* locals;
+    map_t* unstable; // <regid_t, bool> temporaries that don't hold one value
+    pressure_t* pressure;
+    cfg_loop_t* loop;
+    cfg_block_t* preheader;
+    air_insn_t* anchor; // what code running on the way into the loop goes in front of
+    size_t start, end; // positions of the anchor and the end of the loop
+    symbol_t* counter;
+    air_insn_t* step; // where the loop changes the counter
+    long long by; // and by how much
+    bool* reachable; // <bool> by block, whether control can get there from the step without going back around
+    vector_t* pointers; // <ivsr_pointer_t*>
+    vector_t* rewrites; // <ivsr_rewrite_t*> addresses
+    vector_t* tests; // <ivsr_rewrite_t*> comparisons of the counter against something invariant (index is the counter's)
+    bool kept; // whether anything else needs the counter
+} ivsr_t;
+
+// whether a temporary has the same value everywhere in the loop
+static bool ivsr_is_invariant(ivsr_t* s, regid_t reg)
+{
+    if (reg == INVALID_VREGID || map_contains_key(s->unstable, (void*) reg))
+        return false;
+    air_insn_t* def = vector_get(air_defuse_definitions(s->routine->defuse, reg), 0);
+    return def && !cfg_loop_contains(s->loop, cfg_find_block(s->cfg, def));
+}
+
+// the constant a step adds, directly or through a temporary loaded with one (e.g., hoisted out by LICM)
+static air_insn_operand_t* ivsr_step_amount(ivsr_t* s, air_insn_t* step)
+{
+    air_insn_operand_t* op = step->ops[1];
+    if (op->type == AOP_REGISTER)
+    {
+        vector_t* defs = air_defuse_definitions(s->routine->defuse, op->content.reg);
+        air_insn_t* def = defs && defs->size == 1 ? vector_get(defs, 0) : NULL;
+        if (!def || def->type != AIR_LOAD)
+            return NULL;
+        op = def->ops[1];
+    }
+    return op->type == AOP_INTEGER_CONSTANT ? op : NULL;
+}
+
+// the one place the loop changes a local, if it's a counter's step
+static air_insn_t* ivsr_find_step(ivsr_t* s, size_t local)
+{
+    air_insn_t* step = NULL;
+    VECTOR_FOR(cfg_block_t*, block, s->loop->blocks)
+    {
+        CFG_BLOCK_FOR(insn, block)
+        {
+            if (locals_store(s->locals, insn) != local)
+                continue;
+            if (step)
+                return NULL;
+            step = insn;
+        }
+    }
+    symbol_t* sy = vector_get(s->locals->symbols, local - 1);
+    if (!step || (step->type != AIR_DIRECT_ADD && step->type != AIR_DIRECT_SUBTRACT) ||
+        !ivsr_step_amount(s, step) || !type_is_signed_integer(sy->type) || !locals_is_whole(step, sy))
+        return NULL;
+    cfg_block_t* at = cfg_find_block(s->cfg, step);
+    if (at->loop != s->loop)
+        return NULL;
+    VECTOR_FOR(cfg_block_t*, latch, s->loop->latches)
+    {
+        if (!cfg_dominates(at, latch))
+            return NULL;
+    }
+    return step;
+}
+
+// marks the blocks control can get to from the step's without going through the header
+static void ivsr_find_reachable(ivsr_t* s)
+{
+    s->reachable = calloc(s->cfg->blocks->size + 1, sizeof(bool));
+    vector_t* worklist = vector_init();
+    vector_add(worklist, cfg_find_block(s->cfg, s->step));
+    while (worklist->size)
+    {
+        cfg_block_t* block = vector_pop(worklist);
+        VECTOR_FOR(cfg_block_t*, succ, block->succs)
+        {
+            if (succ == s->loop->header || !cfg_loop_contains(s->loop, succ) || s->reachable[succ->id])
+                continue;
+            s->reachable[succ->id] = true;
+            vector_add(worklist, succ);
+        }
+    }
+    vector_delete(worklist);
+}
+
+// whether a read of the counter sees it after the step (1), before it (0), or could see either (-1)
+static int ivsr_version(ivsr_t* s, air_insn_t* read)
+{
+    cfg_block_t* block = cfg_find_block(s->cfg, read);
+    cfg_block_t* at = cfg_find_block(s->cfg, s->step);
+    if (block == at)
+        return read->order > s->step->order;
+    if (cfg_dominates(at, block))
+        return 1;
+    return s->reachable[block->id] ? -1 : 0;
+}
+
+// the pointer standing in for base + counter * scale, or NULL if there's no room for one
+static ivsr_pointer_t* ivsr_pointer(ivsr_t* s, regid_t base, long long scale)
+{
+    VECTOR_FOR(ivsr_pointer_t*, existing, s->pointers)
+    {
+        if (existing->base == base && existing->scale == scale)
+            return existing;
+    }
+    air_insn_t* def = vector_get(air_defuse_definitions(s->routine->defuse, base), 0);
+    if (!def->ct || def->ct->class != CTC_POINTER || !pressure_fits(s->pressure, def->ct, s->start, s->end))
+        return NULL;
+    pressure_add(s->pressure, def->ct, s->start, s->end, 1);
+    ivsr_pointer_t* pointer = calloc(1, sizeof *pointer);
+    pointer->base = base;
+    pointer->scale = scale;
+    pointer->ct = def->ct;
+    vector_add(s->pointers, pointer);
+    return pointer;
+}
+
+static void ivsr_add_rewrite(vector_t* rewrites, air_insn_t* insn, size_t index, ivsr_pointer_t* pointer, int version)
+{
+    ivsr_rewrite_t* rewrite = calloc(1, sizeof *rewrite);
+    rewrite->insn = insn;
+    rewrite->index = index;
+    rewrite->pointer = pointer;
+    rewrite->stepped = version == 1;
+    vector_add(rewrites, rewrite);
+}
+
+// whether what's after the step can be used by an instruction (phi renaming only goes backward through the routine)
+static bool ivsr_can_see(ivsr_t* s, air_insn_t* insn, int version)
+{
+    return version == 0 || insn->order < s->loop->header->first->order;
+}
+
+// finds how an instruction uses an offset that's some multiple of the counter to make addresses, returning whether that's all it does with it
+static bool ivsr_plan_addresses(ivsr_t* s, air_insn_t* insn, regid_t offset, long long scale, int version, vector_t* rewrites)
+{
+    if (!ivsr_can_see(s, insn, version))
+        return false;
+    if (insn->type == AIR_ADD && insn->ct && insn->ct->class == CTC_POINTER &&
+        insn->ops[1]->type == AOP_REGISTER && insn->ops[2]->type == AOP_REGISTER)
+    {
+        regid_t base = insn->ops[1]->content.reg == offset ? insn->ops[2]->content.reg : insn->ops[1]->content.reg;
+        if (base == offset || !ivsr_is_invariant(s, base))
+            return false;
+        vector_t* uses = air_defuse_uses(s->routine->defuse, insn->ops[0]->content.reg);
+        if (uses)
+        {
+            VECTOR_FOR(air_insn_t*, use, uses)
+            {
+                if (!ivsr_can_see(s, use, version))
+                    return false;
+            }
+        }
+        ivsr_pointer_t* pointer = ivsr_pointer(s, base, scale);
+        if (!pointer)
+            return false;
+        ivsr_add_rewrite(rewrites, insn, 0, pointer, version);
+        return true;
+    }
+    bool found = false;
+    for (size_t i = 0; i < insn->noops; ++i)
+    {
+        air_insn_operand_t* op = insn->ops[i];
+        if (!op) continue;
+        if (op->type == AOP_REGISTER && op->content.reg == offset)
+            return false;
+        if (op->type != AOP_INDIRECT_REGISTER || (op->content.inreg.id != offset && op->content.inreg.roffset != offset))
+            continue;
+        regid_t base = op->content.inreg.id == offset ? op->content.inreg.roffset : op->content.inreg.id;
+        long long factor = op->content.inreg.factor ? op->content.inreg.factor : 1;
+        if (op->content.inreg.id == offset && factor != 1)
+            return false;
+        if (base == offset || !ivsr_is_invariant(s, base))
+            return false;
+        ivsr_pointer_t* pointer = ivsr_pointer(s, base, scale * factor);
+        if (!pointer)
+            return false;
+        ivsr_add_rewrite(rewrites, insn, i, pointer, version);
+        found = true;
+    }
+    return found;
+}
+
+// whether an instruction compares the counter (read into a temporary) against something invariant
+static bool ivsr_is_test(ivsr_t* s, air_insn_t* insn, regid_t reg)
+{
+    switch (insn->type)
+    {
+        case AIR_LESS_EQUAL:
+        case AIR_LESS:
+        case AIR_GREATER_EQUAL:
+        case AIR_GREATER:
+        case AIR_EQUAL:
+        case AIR_INEQUAL:
+            break;
+        default:
+            return false;
+    }
+    air_insn_operand_t* op1 = insn->ops[1];
+    air_insn_operand_t* op2 = insn->ops[2];
+    if (op1->type != AOP_REGISTER || !op1->ct || op1->ct->class != s->counter->type->class)
+        return false;
+    air_insn_operand_t* other = op1->content.reg == reg ? op2 : op1;
+    if (other->type == AOP_REGISTER && other->content.reg == reg)
+        return false;
+    return other->type == AOP_INTEGER_CONSTANT || (other->type == AOP_REGISTER && ivsr_is_invariant(s, other->content.reg));
+}
+
+// finds what a read of the counter is used for
+static void ivsr_plan_read(ivsr_t* s, air_insn_t* read)
+{
+    int version = ivsr_version(s, read);
+    regid_t reg = read->ops[0]->content.reg;
+    vector_t* uses = air_defuse_uses(s->routine->defuse, reg);
+    if (!uses)
+        return;
+    VECTOR_FOR(air_insn_t*, use, uses)
+    {
+        if (version < 0)
+        {
+            s->kept = true;
+            break;
+        }
+        vector_t* rewrites = vector_init();
+        bool planned = false;
+        if (use->type == AIR_MULTIPLY && use->ct && use->ct->class == s->counter->type->class &&
+            use->ops[1]->type == AOP_REGISTER && use->ops[2]->type == AOP_INTEGER_CONSTANT && use->ops[1]->content.reg == reg)
+        {
+            long long scale = (long long) sccp_extend(use->ops[2]->content.ic, sccp_width(use->ct), true);
+            vector_t* scaled = air_defuse_uses(s->routine->defuse, use->ops[0]->content.reg);
+            planned = scale > 0 && scaled && scaled->size;
+            if (planned)
+            {
+                VECTOR_FOR(air_insn_t*, user, scaled)
+                {
+                    if (!ivsr_plan_addresses(s, user, use->ops[0]->content.reg, scale, version, rewrites))
+                    {
+                        planned = false;
+                        break;
+                    }
+                }
+            }
+        }
+        else if (ivsr_plan_addresses(s, use, reg, 1, version, rewrites))
+            planned = true;
+        else if (ivsr_is_test(s, use, reg) && ivsr_can_see(s, use, version))
+        {
+            ivsr_add_rewrite(s->tests, use, use->ops[1]->type == AOP_REGISTER && use->ops[1]->content.reg == reg ? 1 : 2, NULL, version);
+            planned = true;
+        }
+        if (planned)
+        {
+            VECTOR_FOR(ivsr_rewrite_t*, rewrite, rewrites)
+                vector_add(s->rewrites, rewrite);
+        }
+        else
+        {
+            VECTOR_FOR(ivsr_rewrite_t*, rewrite, rewrites)
+                free(rewrite);
+            s->kept = true;
+        }
+        vector_delete(rewrites);
+    }
+}
+
+// whether anything outside of the loop reads the counter
+static bool ivsr_is_read_outside(ivsr_t* s, size_t local)
+{
+    for (air_insn_t* insn = s->routine->insns; insn; insn = insn->next)
+    {
+        if (locals_load(s->locals, insn) == local && !cfg_loop_contains(s->loop, cfg_find_block(s->cfg, insn)))
+            return true;
+    }
+    return false;
+}
+
+// adds an instruction computing something on the way into the loop, returning its temporary
+static regid_t ivsr_emit(ivsr_t* s, air_insn_type_t type, c_type_t* ct, air_insn_operand_t* op1, air_insn_operand_t* op2)
+{
+    air_t* air = s->air;
+    air_insn_t* insn = air_insn_init(type, op2 ? 3 : 2);
+    insn->ct = type_canonical(TYPES, ct);
+    insn->ops[0] = air_insn_register_operand_init(air->next_available_temporary++);
+    insn->ops[1] = op1;
+    if (op2)
+        insn->ops[2] = op2;
+    cfg_block_insert_before(s->preheader, insn, s->anchor);
+    return insn->ops[0]->content.reg;
+}
+
+// computes base + value * scale on the way into the loop, value being a register holding something the counter's type or a constant
+static regid_t ivsr_emit_address(ivsr_t* s, ivsr_pointer_t* pointer, air_insn_operand_t* value)
+{
+    air_t* air = s->air;
+    if (value->type == AOP_INTEGER_CONSTANT)
+    {
+        long long offset = (long long) sccp_extend(value->content.ic, sccp_width(s->counter->type), true) * pointer->scale;
+        air_insn_operand_delete(value);
+        return ivsr_emit(s, AIR_ADD, pointer->ct, air_insn_register_operand_init(pointer->base),
+            air_insn_integer_constant_operand_init((unsigned long long) offset));
+    }
+    c_type_t* wide = type_canonical_basic(TYPES, CTC_LONG_INT);
+    regid_t reg = value->content.reg;
+    if (type_size(s->counter->type) < type_size(wide))
+    {
+        value->ct = type_canonical(TYPES, s->counter->type);
+        reg = ivsr_emit(s, AIR_SEXT, wide, value, NULL);
+    }
+    else
+        air_insn_operand_delete(value);
+    if (pointer->scale != 1)
+        reg = ivsr_emit(s, AIR_MULTIPLY, wide, air_insn_register_operand_init(reg),
+            air_insn_integer_constant_operand_init((unsigned long long) pointer->scale));
+    return ivsr_emit(s, AIR_ADD, pointer->ct, air_insn_register_operand_init(pointer->base), air_insn_register_operand_init(reg));
+}
+
+// starts a pointer off on the way into the loop and moves it along with the counter
+static void ivsr_emit_pointer(ivsr_t* s, ivsr_pointer_t* pointer, regid_t counter)
+{
+    air_t* air = s->air;
+    regid_t start = ivsr_emit_address(s, pointer, air_insn_register_operand_init(counter));
+    pointer->top = air->next_available_temporary++;
+    pointer->stepped = air->next_available_temporary++;
+
+    air_insn_t* phi = air_insn_init(AIR_PHI, 3);
+    phi->ct = type_canonical(TYPES, pointer->ct);
+    phi->ops[0] = air_insn_register_operand_init(pointer->top);
+    phi->ops[1] = air_insn_register_operand_init(start);
+    phi->ops[2] = air_insn_register_operand_init(pointer->stepped);
+    cfg_block_insert_after(s->loop->header, phi, s->loop->header->first);
+
+    air_insn_t* step = air_insn_init(AIR_ADD, 3);
+    step->ct = type_canonical(TYPES, pointer->ct);
+    step->ops[0] = air_insn_register_operand_init(pointer->stepped);
+    step->ops[1] = air_insn_register_operand_init(pointer->top);
+    step->ops[2] = air_insn_integer_constant_operand_init((unsigned long long) (s->by * pointer->scale));
+    cfg_block_insert_after(cfg_find_block(s->cfg, s->step), step, s->step);
+
+    map_add(s->unstable, (void*) start, (void*) true);
+    map_add(s->unstable, (void*) pointer->stepped, (void*) true);
+}
+
+static void ivsr_rewrite_address(ivsr_t* s, ivsr_rewrite_t* rewrite)
+{
+    air_insn_t* insn = rewrite->insn;
+    regid_t with = rewrite->stepped ? rewrite->pointer->stepped : rewrite->pointer->top;
+    if (rewrite->index == 0)
+    {
+        // the addition's result is just the pointer
+        regid_t reg = insn->ops[0]->content.reg;
+        vector_t* uses = air_defuse_uses(s->routine->defuse, reg);
+        if (!uses)
+            return;
+        vector_t* users = vector_copy(uses);
+        VECTOR_FOR(air_insn_t*, user, users)
+        {
+            air_defuse_t* defuse = air_insn_unindex(user);
+            for (size_t i = 0; i < user->noops; ++i)
+            {
+                if (user->ops[i])
+                    rename_operand(user->ops[i], reg, with);
+            }
+            air_insn_index(user, defuse);
+        }
+        vector_delete(users);
+        return;
+    }
+    air_defuse_t* defuse = air_insn_unindex(insn);
+    air_insn_operand_t* op = insn->ops[rewrite->index];
+    op->content.inreg.id = with;
+    op->content.inreg.roffset = INVALID_VREGID;
+    op->content.inreg.factor = 1;
+    air_insn_index(insn, defuse);
+}
+
+static void ivsr_rewrite_test(ivsr_t* s, ivsr_rewrite_t* test, map_t* ends)
+{
+    air_t* air = s->air;
+    air_insn_t* insn = test->insn;
+    ivsr_pointer_t* pointer = vector_get(s->pointers, 0);
+    air_insn_operand_t* other = insn->ops[test->index == 1 ? 2 : 1];
+    regid_t end = INVALID_VREGID;
+    if (other->type == AOP_REGISTER)
+    {
+        end = (regid_t) map_get(ends, (void*) other->content.reg);
+        if (end == INVALID_VREGID)
+        {
+            end = ivsr_emit_address(s, pointer, air_insn_register_operand_init(other->content.reg));
+            map_add(ends, (void*) other->content.reg, (void*) end);
+        }
+    }
+    else
+        end = ivsr_emit_address(s, pointer, air_insn_integer_constant_operand_init(other->content.ic));
+    c_type_t* wide = type_canonical_basic(TYPES, CTC_LONG_INT);
+    air_defuse_t* defuse = air_insn_unindex(insn);
+    for (size_t i = 1; i < 3; ++i)
+    {
+        air_insn_operand_delete(insn->ops[i]);
+        insn->ops[i] = air_insn_register_operand_init(i == test->index ? (test->stepped ? pointer->stepped : pointer->top) : end);
+        insn->ops[i]->ct = wide;
+    }
+    air_insn_index(insn, defuse);
+}
+
+// reduces the addresses computed off of one counter, returning how many were
+static size_t ivsr_reduce(ivsr_t* s, size_t local, size_t* eliminated)
+{
+    air_t* air = s->air;
+    s->counter = vector_get(s->locals->symbols, local - 1);
+    s->by = (long long) sccp_extend(ivsr_step_amount(s, s->step)->content.ic, sccp_width(s->counter->type), true);
+    if (s->step->type == AIR_DIRECT_SUBTRACT)
+        s->by = -s->by;
+    s->pointers = vector_init();
+    s->rewrites = vector_init();
+    s->tests = vector_init();
+    s->kept = false;
+    ivsr_find_reachable(s);
+
+    VECTOR_FOR(cfg_block_t*, block, s->loop->blocks)
+    {
+        CFG_BLOCK_FOR(insn, block)
+        {
+            if (insn->type == AIR_LOAD && locals_load(s->locals, insn) == local)
+                ivsr_plan_read(s, insn);
+        }
+    }
+
+    size_t count = s->rewrites->size;
+    if (count)
+    {
+        // the tests need where they stop to stay live through the loop too
+        ivsr_pointer_t* first = vector_get(s->pointers, 0);
+        bool eliminate = !s->kept && !ivsr_is_read_outside(s, local);
+        for (size_t i = 0; eliminate && i < s->tests->size; ++i)
+        {
+            eliminate = pressure_fits(s->pressure, first->ct, s->start, s->end);
+            if (eliminate)
+                pressure_add(s->pressure, first->ct, s->start, s->end, 1);
+        }
+
+        air_insn_t* load = air_insn_init(AIR_LOAD, 2);
+        load->ct = type_canonical(TYPES, s->counter->type);
+        load->ops[0] = air_insn_register_operand_init(air->next_available_temporary++);
+        load->ops[1] = air_insn_symbol_operand_init(s->counter);
+        cfg_block_insert_before(s->preheader, load, s->anchor);
+        VECTOR_FOR(ivsr_pointer_t*, pointer, s->pointers)
+            ivsr_emit_pointer(s, pointer, load->ops[0]->content.reg);
+        VECTOR_FOR(ivsr_rewrite_t*, rewrite, s->rewrites)
+            ivsr_rewrite_address(s, rewrite);
+        if (eliminate)
+        {
+            map_t* ends = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+            VECTOR_FOR(ivsr_rewrite_t*, test, s->tests)
+                ivsr_rewrite_test(s, test, ends);
+            map_delete(ends);
+            cfg_block_remove(cfg_find_block(s->cfg, s->step), s->step);
+            ++*eliminated;
+        }
+    }
+
+    for (size_t i = 0; i < s->pointers->size; ++i)
+        free(vector_get(s->pointers, i));
+    for (size_t i = 0; i < s->rewrites->size; ++i)
+        free(vector_get(s->rewrites, i));
+    for (size_t i = 0; i < s->tests->size; ++i)
+        free(vector_get(s->tests, i));
+    vector_delete(s->pointers);
+    vector_delete(s->rewrites);
+    vector_delete(s->tests);
+    free(s->reachable);
+    return count;
+}
+
+// reduces the addresses computed off of a loop's counters, returning how many were
+static size_t ivsr_reduce_loop(ivsr_t* s, size_t* eliminated)
+{
+    cfg_loop_t* loop = s->loop;
+    if (!find_preheader(loop, &s->preheader, &s->anchor) || s->anchor->type != AIR_JMP)
+        return 0;
+    VECTOR_FOR(cfg_block_t*, latch, loop->latches)
+    {
+        if (latch->id > loop->header->id)
+            return 0;
+    }
+    size_t count = 0;
+    for (size_t local = 1; local <= s->locals->symbols->size; ++local)
+    {
+        if (!map_get(s->locals->indices, vector_get(s->locals->symbols, local - 1)))
+            continue;
+        s->step = ivsr_find_step(s, local);
+        if (!s->step)
+            continue;
+        s->pressure = pressure_init(s->routine, s->cfg);
+        s->start = pressure_position(s->pressure, s->anchor);
+        s->end = pressure_position(s->pressure, cfg_loop_last(s->cfg, loop));
+        if (!pressure_crosses_call(s->pressure, s->start, s->end))
+            count += ivsr_reduce(s, local, eliminated);
+        pressure_delete(s->pressure);
+    }
+    return count;
+}
+
+static void reduce_induction_variables(air_routine_t* routine, air_t* air)
+{
+    if (!routine->insns)
+        return;
+    ivsr_t s = {
+        .routine = routine,
+        .air = air,
+        .cfg = cfg_init(routine),
+        .locals = locals_find(routine),
+        .unstable = find_unstable_temporaries(routine)
+    };
+    size_t reduced = 0, eliminated = 0;
+    // innermost first, so a nested loop's pointers start off in the loop around it
+    for (size_t i = s.cfg->loops->size; i-- > 0;)
+    {
+        s.loop = vector_get(s.cfg->loops, i);
+        reduced += ivsr_reduce_loop(&s, &eliminated);
+    }
+    if (get_program_options()->iflag)
+        printf("induction variable strength reduction in %s: %zu addresses reduced, %zu counters eliminated\n",
+            symbol_get_name(routine->sy), reduced, eliminated);
+    locals_delete(s.locals);
+    map_delete(s.unstable);
+    cfg_delete(s.cfg);
+}
 
 void opt1(air_t* air, opt1_options_t* options)
 {
     if (!options) return;
     VECTOR_FOR(air_routine_t*, routine, air->routines)
     {
-        // if (get_program_options()->xflag)
-            // while (constexpr_simplification(routine, air));
+        air_routine_index(routine);
+        if (options->propagate_constants)
+            propagate_constants(routine, air);
+        if (options->eliminate_common_subexpressions)
+            eliminate_common_subexpressions(routine);
+        if (options->hoist_loop_invariants)
+            hoist_loop_invariants(routine);
+        if (options->reduce_induction_variables)
+            reduce_induction_variables(routine, air);
+        if (options->eliminate_dead_code)
+            eliminate_dead_code(routine);
         air_insn_t* last = NULL;
         for (air_insn_t* insn = routine->insns; insn;)
         {
@@ -179,5 +2724,6 @@ void opt1(air_t* air, opt1_options_t* options)
             else
                 last = last->prev;
         }
+        air_routine_unindex(routine);
     }
 }
@@ -6,8 +6,6 @@
 
 #include "ecc.h"
 
-#define MAX_ERROR_LEN 4096
-
 #define parse_errorf(row, col, msg) \
     if (row) \
         errorf("[%d:%d] %s\n", row, col, msg); \
@@ -72,8 +70,7 @@ RULES TO FOLLOW:
     token_t* token = *tokens;
 
 #define init_syn(t) \
-    syntax_component_t* syn = calloc(1, sizeof *syn); \
-    syn->type = (t); \
+    syntax_component_t* syn = syntax_component_init((t), tlu); \
     if (token) syn->row = token->row, syn->col = token->col; \
     syn->parent = parent;
 
@@ -86,22 +83,13 @@ RULES TO FOLLOW:
         return name; \
     }
 
-// updates status with fail for the given request and prepares error for printing if needed
+// updates status with fail for the given request and records the error if it's the deepest so far.
+// msg must be a string literal, it is kept as-is and only printed if it ends up being reported.
 // does NOT free anything.
-#define fail_parse(token, fmt, ...) \
+#define fail_parse(token, msg) \
     fail_status; \
     if (req == EXPECTED) \
-    { \
-        char buffer[MAX_ERROR_LEN]; \
-        snprintf(buffer, MAX_ERROR_LEN, fmt, ## __VA_ARGS__); \
-        syntax_component_t* err = calloc(1, sizeof *err); \
-        err->type = SC_ERROR; \
-        err->err_message = strdup(buffer); \
-        err->err_depth = depth; \
-        err->row = (token) ? (token)->row : 0; \
-        err->col = (token) ? (token)->col : 0; \
-        vector_add(tlu->tlu_errors, err); \
-    }
+        record_parse_error(tlu, (token), depth, (msg));
 
 // does NOT deallocate syntax elements
 #define advance_token \
@@ -110,7 +98,7 @@ RULES TO FOLLOW:
         fail_parse(token, "unexpected end of file"); \
         return NULL; \
     } \
-    token = token->next;
+    token = token_next(token);
 
 #define next_depth (depth + 1)
 
@@ -141,6 +129,197 @@ typedef enum parse_request_code
 
 typedef syntax_component_t* (*parse_function_t)(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent);
 
+// only the deepest error is ever reported (i.e., the one to give the best description of what went wrong),
+// so the translation unit keeps a single slot for it instead of every failure along the way.
+// on equal depth, the first error wins.
+static void record_parse_error_at(syntax_component_t* tlu, int row, int col, int depth, const char* message)
+{
+    syntax_component_t* err = tlu->tlu_error;
+    if (err->err_message && depth <= err->err_depth)
+        return;
+    err->err_message = message;
+    err->err_depth = depth;
+    err->row = row;
+    err->col = col;
+}
+
+static void record_parse_error(syntax_component_t* tlu, token_t* token, int depth, const char* message)
+{
+    record_parse_error_at(tlu, token ? token->row : 0, token ? token->col : 0, depth, message);
+}
+
+static syntax_component_t* error_slot_init(void)
+{
+    return syntax_component_init(SC_ERROR, NULL);
+}
+
+/*
+
+packrat memo for ambiguous parse sites.
+
+the parser tries alternatives in order and throws away whatever it built for the ones that
+didn't work out, which for nested expressions means parsing the same tokens again at every level
+(e.g., an assignment expression parses its unary operand, finds no assignment operator, and then
+parses the very same operand again as the start of a conditional expression).
+
+results are kept per (rule, starting token): whether the rule matched there, where it ended,
+the deepest error recorded while trying it (relative to the depth it was tried at, so it can be
+recorded again as if the attempt was repeated), and a discarded FOUND result, if the caller
+that threw it away handed it back with parse_memo_stash.
+
+the memo is cleared after every external declaration since the tokens it refers to are released.
+
+*/
+
+typedef enum parse_memo_rule
+{
+    PMR_UNARY_EXPRESSION = 1
+} parse_memo_rule_t;
+
+typedef struct parse_memo_entry
+{
+    parse_memo_rule_t rule;
+    token_t* start;
+    parse_status_code_t status;
+    token_t* end;
+    syntax_component_t* node;
+    const char* err_message;
+    int err_row;
+    int err_col;
+    int err_depth;
+} parse_memo_entry_t;
+
+typedef struct parse_memo
+{
+    parse_memo_entry_t* entries;
+    size_t capacity; // always a power of two
+    size_t size;
+} parse_memo_t;
+
+#define PARSE_MEMO_INITIAL_CAPACITY 64
+
+static size_t parse_memo_index(parse_memo_t* memo, parse_memo_rule_t rule, token_t* start)
+{
+    size_t mask = memo->capacity - 1;
+    size_t i = ((((uintptr_t) start) >> 4) * 31 + rule) & mask;
+    for (; memo->entries[i].start && (memo->entries[i].start != start || memo->entries[i].rule != rule); i = (i + 1) & mask);
+    return i;
+}
+
+static parse_memo_entry_t* parse_memo_lookup(syntax_component_t* tlu, parse_memo_rule_t rule, token_t* start)
+{
+    parse_memo_t* memo = tlu->tlu_memo;
+    if (!memo || !start)
+        return NULL;
+    parse_memo_entry_t* entry = &memo->entries[parse_memo_index(memo, rule, start)];
+    return entry->start ? entry : NULL;
+}
+
+static parse_memo_entry_t* parse_memo_add(syntax_component_t* tlu, parse_memo_rule_t rule, token_t* start)
+{
+    if (!tlu->tlu_memo)
+    {
+        tlu->tlu_memo = calloc(1, sizeof(parse_memo_t));
+        tlu->tlu_memo->capacity = PARSE_MEMO_INITIAL_CAPACITY;
+        tlu->tlu_memo->entries = calloc(PARSE_MEMO_INITIAL_CAPACITY, sizeof(parse_memo_entry_t));
+    }
+    parse_memo_t* memo = tlu->tlu_memo;
+    if ((memo->size + 1) * 4 > memo->capacity * 3)
+    {
+        parse_memo_entry_t* old = memo->entries;
+        size_t old_capacity = memo->capacity;
+        memo->capacity *= 2;
+        memo->entries = calloc(memo->capacity, sizeof(parse_memo_entry_t));
+        for (size_t i = 0; i < old_capacity; ++i)
+            if (old[i].start)
+                memo->entries[parse_memo_index(memo, old[i].rule, old[i].start)] = old[i];
+        free(old);
+    }
+    parse_memo_entry_t* entry = &memo->entries[parse_memo_index(memo, rule, start)];
+    if (!entry->start)
+    {
+        ++memo->size;
+        entry->rule = rule;
+        entry->start = start;
+    }
+    return entry;
+}
+
+// hands a FOUND result back to the memo instead of freeing it, so the next attempt at the same position can take it
+static void parse_memo_stash(syntax_component_t* tlu, parse_memo_rule_t rule, token_t* start, syntax_component_t* node)
+{
+    parse_memo_entry_t* entry = parse_memo_lookup(tlu, rule, start);
+    if (!entry || entry->status != FOUND || entry->node)
+    {
+        free_syntax(node, tlu);
+        return;
+    }
+    entry->node = node;
+}
+
+// frees results nobody picked up and forgets everything
+static void parse_memo_clear(syntax_component_t* tlu)
+{
+    parse_memo_t* memo = tlu->tlu_memo;
+    if (!memo || !memo->size)
+        return;
+    for (size_t i = 0; i < memo->capacity; ++i)
+        free_syntax(memo->entries[i].node, tlu);
+    memset(memo->entries, 0, memo->capacity * sizeof(parse_memo_entry_t));
+    memo->size = 0;
+}
+
+static void parse_memo_delete(syntax_component_t* tlu)
+{
+    parse_memo_clear(tlu);
+    if (tlu->tlu_memo)
+        free(tlu->tlu_memo->entries);
+    free(tlu->tlu_memo);
+    tlu->tlu_memo = NULL;
+}
+
+// state of the error slot before a memoized attempt, see parse_memo_begin and parse_memo_end
+typedef struct parse_memo_error
+{
+    const char* message;
+    int row;
+    int col;
+    int depth;
+} parse_memo_error_t;
+
+// empties the error slot so that only the errors of the attempt end up in it
+static parse_memo_error_t parse_memo_begin(syntax_component_t* tlu)
+{
+    syntax_component_t* err = tlu->tlu_error;
+    parse_memo_error_t saved = { err->err_message, err->row, err->col, err->err_depth };
+    err->err_message = NULL;
+    return saved;
+}
+
+// saves the attempt's deepest error in the entry and puts back the slot as if the attempt's errors were recorded in it directly
+static void parse_memo_end(syntax_component_t* tlu, parse_memo_entry_t* entry, parse_memo_error_t saved, int depth)
+{
+    syntax_component_t* err = tlu->tlu_error;
+    entry->err_message = err->err_message;
+    entry->err_row = err->row;
+    entry->err_col = err->col;
+    entry->err_depth = err->err_depth - depth;
+    if (saved.message && (!err->err_message || err->err_depth <= saved.depth))
+    {
+        err->err_message = saved.message;
+        err->row = saved.row;
+        err->col = saved.col;
+        err->err_depth = saved.depth;
+    }
+}
+
+// records the errors of a memoized attempt again, as repeating the attempt at the given depth would have
+static void parse_memo_replay(syntax_component_t* tlu, parse_memo_entry_t* entry, int depth)
+{
+    if (entry->err_message)
+        record_parse_error_at(tlu, entry->err_row, entry->err_col, depth + entry->err_depth, entry->err_message);
+}
+
 syntax_component_t* parse_declarator(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent);
 syntax_component_t* parse_type_specifier(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent);
 syntax_component_t* parse_type_qualifier(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent);
@@ -505,7 +684,7 @@ syntax_component_t* parse_type_specifier(token_t** tokens, parse_request_code_t
         fail_parse(token, "expected type specifier, got EOF");
         return NULL;
     }
-    init_syn(SC_UNKNOWN);
+    init_syn(SC_BASIC_TYPE_SPECIFIER);
     bool is = token->type == T_KEYWORD &&
         (token->keyword == KW_VOID ||
         token->keyword == KW_CHAR ||
@@ -521,7 +700,6 @@ syntax_component_t* parse_type_specifier(token_t** tokens, parse_request_code_t
         token->keyword == KW_IMAGINARY);
     if (is)
     {
-        syn->type = SC_BASIC_TYPE_SPECIFIER;
         switch (token->keyword)
         {
             case KW_VOID: syn->bts = BTS_VOID; break;
@@ -1276,21 +1454,12 @@ syntax_component_t* parse_initializer(token_t** tokens, parse_request_code_t req
     return inlist;
 }
 
-// 6.7
-// to be resolved: 
-syntax_component_t* parse_init_declarator(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent)
+// parses the optional initializer of an init declarator whose declarator has already been parsed.
+// the caller is responsible for filling in ideclr_declarator.
+syntax_component_t* parse_partial_init_declarator(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent)
 {
     init_parse;
     init_syn(SC_INIT_DECLARATOR);
-    parse_status_code_t declr_stat = UNKNOWN_STATUS;
-    syn->ideclr_declarator = parse_declarator(&token, EXPECTED, &declr_stat, tlu, next_depth, syn);
-    if (declr_stat == ABORT)
-    {
-        // ISO: 6.7 (1)
-        fail_status;
-        free_syntax(syn, tlu);
-        return NULL;
-    }
     if (is_punctuator(token, P_ASSIGNMENT))
     {
         advance_token;
@@ -1308,6 +1477,33 @@ syntax_component_t* parse_init_declarator(token_t** tokens, parse_request_code_t
     return syn;
 }
 
+// 6.7
+// to be resolved: 
+syntax_component_t* parse_init_declarator(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent)
+{
+    init_parse;
+    parse_status_code_t declr_stat = UNKNOWN_STATUS;
+    syntax_component_t* declr = parse_declarator(&token, EXPECTED, &declr_stat, tlu, next_depth, parent);
+    if (declr_stat == ABORT)
+    {
+        // ISO: 6.7 (1)
+        fail_status;
+        return NULL;
+    }
+    parse_status_code_t ideclr_stat = UNKNOWN_STATUS;
+    syntax_component_t* syn = parse_partial_init_declarator(&token, EXPECTED, &ideclr_stat, tlu, depth, parent);
+    if (ideclr_stat == ABORT)
+    {
+        fail_status;
+        free_syntax(declr, tlu);
+        return NULL;
+    }
+    link_to_parent(declr);
+    syn->ideclr_declarator = declr;
+    update_status(FOUND);
+    return syn;
+}
+
 // 6.7
 // to be resolved: 6.7.1 (5), 6.7.1 (6)
 syntax_component_t* parse_declaration(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent)
@@ -1448,8 +1644,7 @@ syntax_component_t* parse_string_literal(token_t** tokens, parse_request_code_t
         syn->strl_reg = strdup(token->string_literal.value_reg);
     if (token->string_literal.value_wide)
         syn->strl_wide = strdup_wide(token->string_literal.value_wide);
-    syn->strl_length = calloc(1, sizeof *syn->strl_length);
-    syn->strl_length->type = SC_INTEGER_CONSTANT;
+    syn->strl_length = syntax_component_init(SC_INTEGER_CONSTANT, tlu);
     syn->strl_length->intc = syn->strl_reg ? strlen(syn->strl_reg) + 1 : wcslen(syn->strl_wide) + 1;
     syn->strl_length->ctype = make_basic_type(C_TYPE_SIZE_T);
     syn->ctype = make_basic_type(CTC_ARRAY);
@@ -1973,7 +2168,7 @@ syntax_component_t* parse_sizeof_type_expression(token_t** tokens, parse_request
     return syn;
 }
 
-syntax_component_t* parse_unary_expression(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent)
+static syntax_component_t* parse_unary_expression_alternatives(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent)
 {
     init_parse;
     try_expression(postfix, pfexpr)
@@ -1987,6 +2182,45 @@ syntax_component_t* parse_unary_expression(token_t** tokens, parse_request_code_
     try_expression(not, nexpr)
     try_expression(sizeof, soexpr)
     try_expression(sizeof_type, sotexpr)
+    fail_status;
+    return NULL;
+}
+
+// memoized, see parse_memo_t
+syntax_component_t* parse_unary_expression(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent)
+{
+    init_parse;
+    syntax_component_t* uexpr = NULL;
+    parse_memo_entry_t* entry = parse_memo_lookup(tlu, PMR_UNARY_EXPRESSION, token);
+    if (entry && (entry->status == NOT_FOUND || entry->node))
+    {
+        parse_memo_replay(tlu, entry, depth);
+        if (entry->status == FOUND)
+        {
+            uexpr = entry->node;
+            entry->node = NULL;
+            link_to_specific_parent(uexpr, parent);
+            token = entry->end;
+        }
+    }
+    else if (!token)
+        uexpr = parse_unary_expression_alternatives(&token, OPTIONAL, NULL, tlu, depth, parent);
+    else
+    {
+        token_t* start = token;
+        parse_memo_error_t saved = parse_memo_begin(tlu);
+        parse_status_code_t uexpr_stat = UNKNOWN_STATUS;
+        uexpr = parse_unary_expression_alternatives(&token, OPTIONAL, &uexpr_stat, tlu, depth, parent);
+        entry = parse_memo_add(tlu, PMR_UNARY_EXPRESSION, start);
+        entry->status = uexpr_stat;
+        entry->end = token;
+        parse_memo_end(tlu, entry, saved, depth);
+    }
+    if (uexpr)
+    {
+        update_status(FOUND);
+        return uexpr;
+    }
     fail_parse(token, "expected unary expression");
     return NULL;
 }
@@ -2038,123 +2272,84 @@ syntax_component_t* parse_cast_expression(token_t** tokens, parse_request_code_t
 
 /*
 
-logical-or-expression :=
-    logical-and-expression logical-or-expression'
+the binary operators from logical OR (lowest precedence) up to multiplicative (highest) are all left
+associative, so they're parsed by precedence climbing in one routine instead of one function per level:
 
-logical-or-expression' :=
-    || logical-and-expression logical-or-expression'
-    e
+binary-expression(p) :=
+    cast-expression (op binary-expression(precedence(op) + 1))*    for every op with precedence(op) >= p
 
 */
 
-// operator_name: the operator(s) to define a parse function for
-// suboperator_name: the type of operator which has expression which composes these expressions
-// otype1-4: the syntax element types corresponding to the operators to handle here
-// op1-4: the operators corresponding to otype1-4
-#define define_basic_parse_expression(operator_name, suboperator_name, otype1, otype2, otype3, otype4, op1, op2, op3, op4) \
-    syntax_component_t* parse_##operator_name##_expression(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent) \
-    { \
-        init_parse; \
-        parse_status_code_t lhs_stat = UNKNOWN_STATUS; \
-        syntax_component_t* lhs = parse_##suboperator_name##_expression(&token, EXPECTED, &lhs_stat, tlu, next_depth, parent); \
-        if (lhs_stat == ABORT) \
-        { \
-            fail_status; \
-            return NULL; \
-        } \
-        for (;;) \
-        { \
-            if (!is_punctuator(token, (op1)) && \
-                !is_punctuator(token, (op2)) && \
-                !is_punctuator(token, (op3)) && \
-                !is_punctuator(token, (op4))) \
-                break; \
-            punctuator_type_t op = token->punctuator; \
-            advance_token; \
-            parse_status_code_t rhs_stat = UNKNOWN_STATUS; \
-            syntax_component_t* rhs = parse_##suboperator_name##_expression(&token, EXPECTED, &rhs_stat, tlu, next_depth, parent); \
-            if (rhs_stat == ABORT) \
-            { \
-                fail_status; \
-                free_syntax(lhs, tlu); \
-                return NULL; \
-            } \
-            syntax_component_type_t otype = SC_UNKNOWN; \
-            if (op == (op1)) otype = (otype1); \
-            if (op == (op2)) otype = (otype2); \
-            if (op == (op3)) otype = (otype3); \
-            if (op == (op4)) otype = (otype4); \
-            init_syn(otype); \
-            syn->bexpr_lhs = lhs; \
-            link_to_specific_parent(syn->bexpr_lhs, syn); \
-            syn->bexpr_rhs = rhs; \
-            link_to_specific_parent(syn->bexpr_rhs, syn); \
-            lhs = syn; \
-        } \
-        update_status(FOUND); \
-        return lhs; \
-    }
-
-define_basic_parse_expression(
-    multiplicative,
-    cast,
-    SC_MULTIPLICATION_EXPRESSION, SC_DIVISION_EXPRESSION, SC_MODULAR_EXPRESSION, SC_UNKNOWN,
-    P_ASTERISK, P_SLASH, P_PERCENT, 0
-)
-define_basic_parse_expression(
-    additive,
-    multiplicative,
-    SC_ADDITION_EXPRESSION, SC_SUBTRACTION_EXPRESSION, SC_UNKNOWN, SC_UNKNOWN,
-    P_PLUS, P_MINUS, 0, 0
-)
-define_basic_parse_expression(
-    shift,
-    additive,
-    SC_BITWISE_LEFT_EXPRESSION, SC_BITWISE_RIGHT_EXPRESSION, SC_UNKNOWN, SC_UNKNOWN,
-    P_LEFT_SHIFT, P_RIGHT_SHIFT, 0, 0
-)
-define_basic_parse_expression(
-    relational,
-    shift,
-    SC_LESS_EXPRESSION, SC_GREATER_EXPRESSION, SC_LESS_EQUAL_EXPRESSION, SC_GREATER_EQUAL_EXPRESSION,
-    P_LESS, P_GREATER, P_LESS_EQUAL, P_GREATER_EQUAL
-)
-define_basic_parse_expression(
-    equality,
-    relational,
-    SC_EQUALITY_EXPRESSION, SC_INEQUALITY_EXPRESSION, SC_UNKNOWN, SC_UNKNOWN,
-    P_EQUAL, P_INEQUAL, 0, 0
-)
-define_basic_parse_expression(
-    bitwise_and,
-    equality,
-    SC_BITWISE_AND_EXPRESSION, SC_UNKNOWN, SC_UNKNOWN, SC_UNKNOWN,
-    P_AND, 0, 0, 0
-)
-define_basic_parse_expression(
-    bitwise_xor,
-    bitwise_and,
-    SC_BITWISE_XOR_EXPRESSION, SC_UNKNOWN, SC_UNKNOWN, SC_UNKNOWN,
-    P_CARET, 0, 0, 0
-)
-define_basic_parse_expression(
-    bitwise_or,
-    bitwise_xor, 
-    SC_BITWISE_OR_EXPRESSION, SC_UNKNOWN, SC_UNKNOWN, SC_UNKNOWN,
-    P_PIPE, 0, 0, 0
-)
-define_basic_parse_expression(
-    logical_and,
-    bitwise_or,
-    SC_LOGICAL_AND_EXPRESSION, SC_UNKNOWN, SC_UNKNOWN, SC_UNKNOWN,
-    P_LOGICAL_AND, 0, 0, 0
-)
-define_basic_parse_expression(
-    logical_or,
-    logical_and,
-    SC_LOGICAL_OR_EXPRESSION, SC_UNKNOWN, SC_UNKNOWN, SC_UNKNOWN,
-    P_LOGICAL_OR, 0, 0, 0
-)
+typedef struct binary_operator
+{
+    int precedence; // 0 if the punctuator isn't a binary operator
+    syntax_component_type_t type;
+} binary_operator_t;
+
+#define BINARY_PRECEDENCE_LOWEST 1
+#define BINARY_PRECEDENCE_LEVELS 10
+
+static const binary_operator_t BINARY_OPERATORS[P_NO_ELEMENTS] = {
+    [P_LOGICAL_OR] = { 1, SC_LOGICAL_OR_EXPRESSION },
+    [P_LOGICAL_AND] = { 2, SC_LOGICAL_AND_EXPRESSION },
+    [P_PIPE] = { 3, SC_BITWISE_OR_EXPRESSION },
+    [P_CARET] = { 4, SC_BITWISE_XOR_EXPRESSION },
+    [P_AND] = { 5, SC_BITWISE_AND_EXPRESSION },
+    [P_EQUAL] = { 6, SC_EQUALITY_EXPRESSION },
+    [P_INEQUAL] = { 6, SC_INEQUALITY_EXPRESSION },
+    [P_LESS] = { 7, SC_LESS_EXPRESSION },
+    [P_GREATER] = { 7, SC_GREATER_EXPRESSION },
+    [P_LESS_EQUAL] = { 7, SC_LESS_EQUAL_EXPRESSION },
+    [P_GREATER_EQUAL] = { 7, SC_GREATER_EQUAL_EXPRESSION },
+    [P_LEFT_SHIFT] = { 8, SC_BITWISE_LEFT_EXPRESSION },
+    [P_RIGHT_SHIFT] = { 8, SC_BITWISE_RIGHT_EXPRESSION },
+    [P_PLUS] = { 9, SC_ADDITION_EXPRESSION },
+    [P_MINUS] = { 9, SC_SUBTRACTION_EXPRESSION },
+    [P_ASTERISK] = { 10, SC_MULTIPLICATION_EXPRESSION },
+    [P_SLASH] = { 10, SC_DIVISION_EXPRESSION },
+    [P_PERCENT] = { 10, SC_MODULAR_EXPRESSION }
+};
+
+static const binary_operator_t* binary_operator(token_t* token)
+{
+    if (!token || token->type != T_PUNCTUATOR || !BINARY_OPERATORS[token->punctuator].precedence)
+        return NULL;
+    return &BINARY_OPERATORS[token->punctuator];
+}
+
+// operands are parsed as deep as they were when every precedence level had its own function,
+// so the error that ends up being reported for a bad operand doesn't change
+syntax_component_t* parse_binary_expression(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent, int precedence)
+{
+    init_parse;
+    parse_status_code_t lhs_stat = UNKNOWN_STATUS;
+    syntax_component_t* lhs = parse_cast_expression(&token, EXPECTED, &lhs_stat, tlu, depth + BINARY_PRECEDENCE_LEVELS, parent);
+    if (lhs_stat == ABORT)
+    {
+        fail_status;
+        return NULL;
+    }
+    for (const binary_operator_t* op; (op = binary_operator(token)) && op->precedence >= precedence;)
+    {
+        advance_token;
+        parse_status_code_t rhs_stat = UNKNOWN_STATUS;
+        syntax_component_t* rhs = parse_binary_expression(&token, EXPECTED, &rhs_stat, tlu, depth, parent, op->precedence + 1);
+        if (rhs_stat == ABORT)
+        {
+            fail_status;
+            free_syntax(lhs, tlu);
+            return NULL;
+        }
+        init_syn(op->type);
+        syn->bexpr_lhs = lhs;
+        link_to_specific_parent(syn->bexpr_lhs, syn);
+        syn->bexpr_rhs = rhs;
+        link_to_specific_parent(syn->bexpr_rhs, syn);
+        lhs = syn;
+    }
+    update_status(FOUND);
+    return lhs;
+}
 
 syntax_component_t* parse_conditional_expression(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent, syntax_component_type_t type)
 {
@@ -2162,7 +2357,7 @@ syntax_component_t* parse_conditional_expression(token_t** tokens, parse_request
     init_syn(type);
 
     parse_status_code_t loexpr_stat = UNKNOWN_STATUS;
-    syn->cexpr_condition = parse_logical_or_expression(&token, EXPECTED, &loexpr_stat, tlu, next_depth, syn);
+    syn->cexpr_condition = parse_binary_expression(&token, EXPECTED, &loexpr_stat, tlu, next_depth, syn, BINARY_PRECEDENCE_LOWEST);
     if (loexpr_stat == ABORT)
     {
         fail_status;
@@ -2214,9 +2409,8 @@ syntax_component_t* parse_if_directive_expression(token_t* tokens, char* error)
         return NULL;
     
     // dummy translation unit
-    syntax_component_t* tlu = calloc(1, sizeof *tlu);
-    tlu->type = SC_TRANSLATION_UNIT;
-    tlu->tlu_errors = vector_init();
+    syntax_component_t* tlu = syntax_component_init(SC_TRANSLATION_UNIT, NULL);
+    tlu->tlu_error = error_slot_init();
     tlu->tlu_external_declarations = vector_init();
     tlu->tlu_st = symbol_table_init();
 
@@ -2224,20 +2418,30 @@ syntax_component_t* parse_if_directive_expression(token_t* tokens, char* error)
     syntax_component_t* expr = parse_conditional_expression(&tokens, EXPECTED, &stat, tlu, 1, tlu, SC_CONDITIONAL_EXPRESSION);
     if (stat == ABORT)
     {
-        syntax_component_t* err = NULL;
-        VECTOR_FOR(syntax_component_t*, s, tlu->tlu_errors)
-            if (!err || s->err_depth > err->err_depth)
-                err = s;
+        syntax_component_t* err = tlu->tlu_error;
         snerrorf(error, MAX_ERROR_LENGTH, "[%d:%d] %s\n", err->row, err->col, err->err_message);
     }
+    parse_memo_delete(tlu);
     free_syntax(tlu, tlu);
+    // the expression outlives the dummy translation unit, so it mustn't lead back to it
+    if (expr)
+        expr->parent = NULL;
     return expr;
 }
 
+// without an assignment operator, the unary expression is the start of a conditional expression instead,
+// so it's handed to the memo to be picked up again rather than being parsed twice
+static void discard_assignment_lhs(syntax_component_t* tlu, syntax_component_t* syn, token_t* start)
+{
+    parse_memo_stash(tlu, PMR_UNARY_EXPRESSION, start, syn->bexpr_lhs);
+    syn->bexpr_lhs = NULL;
+    free_syntax(syn, tlu);
+}
+
 syntax_component_t* parse_actual_assignment_expression(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent)
 {
     init_parse;
-    init_syn(SC_UNKNOWN);
+    init_syn(SC_ASSIGNMENT_EXPRESSION);
     parse_status_code_t uexpr_stat = UNKNOWN_STATUS;
     syn->bexpr_lhs = parse_unary_expression(&token, EXPECTED, &uexpr_stat, tlu, next_depth, syn);
     if (uexpr_stat == ABORT)
@@ -2249,7 +2453,7 @@ syntax_component_t* parse_actual_assignment_expression(token_t** tokens, parse_r
     if (!token || token->type != T_PUNCTUATOR)
     {
         fail_parse(token, "expected an assignment operator for assignment expression");
-        free_syntax(syn, tlu);
+        discard_assignment_lhs(tlu, syn, *tokens);
         return NULL;
     }
     switch (token->punctuator)
@@ -2268,7 +2472,7 @@ syntax_component_t* parse_actual_assignment_expression(token_t** tokens, parse_r
         default:
         {
             fail_parse(token, "expected an assignment operator for assignment expression");
-            free_syntax(syn, tlu);
+            discard_assignment_lhs(tlu, syn, *tokens);
             return NULL;
         }
     }
@@ -2873,49 +3077,103 @@ syntax_component_t* parse_compound_statement(token_t** tokens, parse_request_cod
     return syn;
 }
 
-// reminder: define body earlier so that symbols defined in the parameter list are in scope for the function
-// update: i don't think this matters ^
-
-// 6.9.1
-syntax_component_t* parse_function_definition(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent)
+// 6.9
+// the declaration specifiers and declarator of an external declaration are parsed once, and the token
+// after them decides whether it's a function definition or a declaration, so nothing is parsed twice.
+syntax_component_t* parse_external_declaration(token_t** tokens, parse_request_code_t req, parse_status_code_t* stat, syntax_component_t* tlu, int depth, syntax_component_t* parent)
 {
     init_parse;
-    init_syn(SC_FUNCTION_DEFINITION);
+    init_syn(SC_DECLARATION);
     parse_status_code_t declspecs_stat = UNKNOWN_STATUS;
-    syn->fdef_declaration_specifiers = parse_declaration_specifiers(&token, EXPECTED, &declspecs_stat, tlu, next_depth, syn);
-    link_vector_to_parent(syn->fdef_declaration_specifiers);
+    syn->decl_declaration_specifiers = parse_declaration_specifiers(&token, EXPECTED, &declspecs_stat, tlu, next_depth, syn);
+    link_vector_to_parent(syn->decl_declaration_specifiers);
     if (declspecs_stat == ABORT)
     {
+        // ISO: 6.7 (1)
         fail_status;
         free_syntax(syn, tlu);
         return NULL;
     }
+    syn->decl_init_declarators = vector_init();
+    if (is_punctuator(token, P_SEMICOLON))
+    {
+        advance_token;
+        update_status(FOUND);
+        return syn;
+    }
     parse_status_code_t declr_stat = UNKNOWN_STATUS;
-    syn->fdef_declarator = parse_declarator(&token, EXPECTED, &declr_stat, tlu, next_depth, syn);
+    syntax_component_t* declr = parse_declarator(&token, EXPECTED, &declr_stat, tlu, next_depth, syn);
     if (declr_stat == ABORT)
     {
         fail_status;
         free_syntax(syn, tlu);
         return NULL;
     }
-    syn->fdef_knr_declarations = vector_init();
-    for (;;)
+
+    // anything but an initializer or the rest of a declaration means a function body (or K&R declarations) follows
+    if (!is_punctuator(token, P_ASSIGNMENT) && !is_punctuator(token, P_COMMA) && !is_punctuator(token, P_SEMICOLON))
     {
-        parse_status_code_t decl_stat = UNKNOWN_STATUS;
-        syntax_component_t* knr_decl = parse_declaration(&token, OPTIONAL, &decl_stat, tlu, next_depth, syn);
-        if (decl_stat == NOT_FOUND)
-            break;
-        vector_add(syn->fdef_knr_declarations, knr_decl);
+        syntax_component_t* fdef = syntax_component_init(SC_FUNCTION_DEFINITION, tlu);
+        fdef->row = syn->row, fdef->col = syn->col;
+        fdef->parent = parent;
+        fdef->fdef_declaration_specifiers = syn->decl_declaration_specifiers;
+        fdef->fdef_declarator = declr;
+        syn->decl_declaration_specifiers = NULL;
+        free_syntax(syn, tlu);
+        syn = fdef;
+        link_vector_to_parent(syn->fdef_declaration_specifiers);
+        link_to_parent(declr);
+        syn->fdef_knr_declarations = vector_init();
+        for (;;)
+        {
+            parse_status_code_t decl_stat = UNKNOWN_STATUS;
+            syntax_component_t* knr_decl = parse_declaration(&token, OPTIONAL, &decl_stat, tlu, next_depth, syn);
+            if (decl_stat == NOT_FOUND)
+                break;
+            vector_add(syn->fdef_knr_declarations, knr_decl);
+        }
+        parse_status_code_t cstmt_stat = UNKNOWN_STATUS;
+        syn->fdef_body = parse_compound_statement(&token, EXPECTED, &cstmt_stat, tlu, next_depth, syn);
+        // TODO: add __func__ symbol declaration at beginning of compound statement
+        if (cstmt_stat == ABORT)
+        {
+            fail_status;
+            free_syntax(syn, tlu);
+            return NULL;
+        }
+        update_status(FOUND);
+        return syn;
     }
-    parse_status_code_t cstmt_stat = UNKNOWN_STATUS;
-    syn->fdef_body = parse_compound_statement(&token, EXPECTED, &cstmt_stat, tlu, next_depth, syn);
-    // TODO: add __func__ symbol declaration at beginning of compound statement
-    if (cstmt_stat == ABORT)
+
+    parse_status_code_t initdecl_stat = UNKNOWN_STATUS;
+    syntax_component_t* initdecl = parse_partial_init_declarator(&token, EXPECTED, &initdecl_stat, tlu, next_depth, syn);
+    if (initdecl_stat == ABORT)
     {
         fail_status;
+        free_syntax(declr, tlu);
         free_syntax(syn, tlu);
         return NULL;
     }
+    link_to_specific_parent(declr, initdecl);
+    initdecl->ideclr_declarator = declr;
+    vector_add(syn->decl_init_declarators, initdecl);
+    while (is_punctuator(token, P_COMMA))
+    {
+        advance_token;
+        initdecl_stat = UNKNOWN_STATUS;
+        initdecl = parse_init_declarator(&token, OPTIONAL, &initdecl_stat, tlu, next_depth, syn);
+        if (initdecl_stat == NOT_FOUND)
+            break;
+        vector_add(syn->decl_init_declarators, initdecl);
+    }
+    if (!is_punctuator(token, P_SEMICOLON))
+    {
+        // ISO: 6.7 (1)
+        fail_parse(token, "expected semicolon at the end of a declaration");
+        free_syntax(syn, tlu);
+        return NULL;
+    }
+    advance_token;
     update_status(FOUND);
     return syn;
 }
@@ -2929,46 +3187,49 @@ syntax_component_t* parse_translation_unit(token_t** tokens, parse_request_code_
     init_syn(SC_TRANSLATION_UNIT);
     tlu = syn;
     syn->tlu_external_declarations = vector_init();
-    syn->tlu_errors = vector_init();
+    syn->tlu_error = error_slot_init();
     syn->tlu_st = symbol_table_init();
+    token_stream_t* stream = token ? token->stream : NULL;
     while (token)
     {
-        parse_status_code_t funcdef_stat = UNKNOWN_STATUS;
-        syntax_component_t* funcdef = parse_function_definition(&token, OPTIONAL, &funcdef_stat, tlu, next_depth, syn);
-        if (funcdef_stat == FOUND)
-        {
-            vector_add(syn->tlu_external_declarations, funcdef);
-            continue;
-        }
-        parse_status_code_t decl_stat = UNKNOWN_STATUS;
-        syntax_component_t* decl = parse_declaration(&token, OPTIONAL, &decl_stat, tlu, next_depth, syn);
-        if (decl_stat == FOUND)
+        parse_status_code_t edecl_stat = UNKNOWN_STATUS;
+        syntax_component_t* edecl = parse_external_declaration(&token, EXPECTED, &edecl_stat, tlu, next_depth, syn);
+        if (edecl_stat == FOUND)
         {
-            vector_add(syn->tlu_external_declarations, decl);
+            vector_add(syn->tlu_external_declarations, edecl);
+            // nothing ever backtracks past an external declaration, so its tokens (and what's memoized about them) can go
+            parse_memo_clear(tlu);
+            token_stream_release(stream, token);
             continue;
         }
         // ISO: 6.9 (1)
         fail_parse(token, "translation unit cannot be empty");
+        parse_memo_delete(tlu);
         return syn;
     }
+    parse_memo_delete(tlu);
     update_status(FOUND);
     return syn;
 }
 
 // parse a sequence of tokens into a tree.
-// takes a linked list of tokens
-syntax_component_t* parse(token_t* tokens)
+// takes a stream of tokens, which are pulled as the parser needs them
+syntax_component_t* parse(token_stream_t* stream)
 {
+    token_t* tokens = token_stream_first(stream);
     parse_status_code_t tlu_stat = UNKNOWN_STATUS;
     syntax_component_t* tlu = parse_translation_unit(&tokens, EXPECTED, &tlu_stat, NULL, 1, NULL);
-    // if it failed, find the deepest error (i.e., the one to give the best description of what went wrong) and print it
+    // if tokenizing fails at any point, that error is reported instead of whatever the parser ran into
+    if (tlu_stat == ABORT && !token_stream_drain(stream))
+    {
+        free_syntax(tlu, tlu);
+        return NULL;
+    }
+    // if it failed, print the deepest error
     if (tlu_stat == ABORT)
     {
-        syntax_component_t* err = NULL;
-        VECTOR_FOR(syntax_component_t*, s, tlu->tlu_errors)
-            if (!err || s->err_depth > err->err_depth)
-                err = s;
-        if (err)
+        syntax_component_t* err = tlu->tlu_error;
+        if (err->err_message)
         {
             parse_errorf(err->row, err->col, err->err_message);
         }
@@ -0,0 +1,480 @@
+#define _DEFAULT_SOURCE 1
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ecc.h"
+
+/*
+
+precompiled header (PCH) file layout (integers are in host byte order, the file is not meant to be portable):
+    - magic "ECCPCH", u32 format version
+    - u64 fingerprint of the options the snapshot was built under
+    - u32 dependency count, followed by each dependency: string path, i64 mtime (s), i64 mtime (ns), i64 size
+        - the first dependency is always the header itself
+    - u32 macro count, followed by each macro: string name, u8 function-like, u8 variadic,
+        u32 parameter count + parameter strings (function-like only), token list
+    - token list for the preprocessed contents of the header
+
+a string is a u32 length followed by that many bytes (no terminator).
+a token list is a u32 count followed by each token: u8 type, u8 flags, u32 row, u32 col, type-dependent payload.
+
+*/
+
+#define PCH_MAGIC "ECCPCH"
+#define PCH_MAGIC_LENGTH 6
+#define PCH_VERSION 1
+#define PCH_EXTENSION ".pch"
+
+#define PCH_FLAG_CAN_START_DIRECTIVE 0x1
+#define PCH_FLAG_ARGUMENT_CONTENT 0x2
+
+typedef struct pch_reader
+{
+    unsigned char* data;
+    size_t length;
+    size_t pos;
+    bool bad;
+} pch_reader_t;
+
+// everything that could change how a header is found or expanded goes in here
+static uint64_t pch_fingerprint(void)
+{
+    buffer_t* buf = buffer_init();
+    char version[MAX_STRINGIFIED_INTEGER_LENGTH + 1];
+    snprintf(version, sizeof(version), "%d:%zu", PCH_VERSION, sizeof(preprocessing_token_t));
+    buffer_append_str(buf, version);
+    for (int i = 0; i < NO_ANGLED_INCLUDE_SEARCH_DIRECTORIES; ++i)
+    {
+        buffer_append(buf, '\n');
+        buffer_append_str(buf, (char*) ANGLED_INCLUDE_SEARCH_DIRECTORIES[i]);
+    }
+    // some search directories are relative, so the working directory matters too
+    char* cwd = getcwd(NULL, 0);
+    buffer_append(buf, '\n');
+    if (cwd)
+        buffer_append_str(buf, cwd);
+    free(cwd);
+    buffer_append(buf, '\n');
+    buffer_append_str(buf, get_home_directory());
+    char* str = buffer_export(buf);
+    buffer_delete(buf);
+    uint64_t fp = hash(str);
+    free(str);
+    return fp;
+}
+
+char* pch_filepath(char* header)
+{
+    size_t length = strlen(header);
+    char* path = malloc(length + sizeof(PCH_EXTENSION));
+    memcpy(path, header, length);
+    memcpy(path + length, PCH_EXTENSION, sizeof(PCH_EXTENSION));
+    return path;
+}
+
+static char* canonical_path(char* path)
+{
+    char* resolved = realpath(path, NULL);
+    return resolved ? resolved : strdup(path);
+}
+
+static void write_u8(FILE* file, uint8_t x) { fwrite(&x, sizeof x, 1, file); }
+static void write_u32(FILE* file, uint32_t x) { fwrite(&x, sizeof x, 1, file); }
+static void write_u64(FILE* file, uint64_t x) { fwrite(&x, sizeof x, 1, file); }
+
+static void write_string(FILE* file, char* str)
+{
+    uint32_t length = str ? strlen(str) : 0;
+    write_u32(file, length);
+    fwrite(str, 1, length, file);
+}
+
+static void write_token(FILE* file, preprocessing_token_t* token)
+{
+    write_u8(file, token->type);
+    write_u8(file, (token->can_start_directive ? PCH_FLAG_CAN_START_DIRECTIVE : 0) |
+        (token->argument_content ? PCH_FLAG_ARGUMENT_CONTENT : 0));
+    write_u32(file, token->row);
+    write_u32(file, token->col);
+    switch (token->type)
+    {
+        case PPT_HEADER_NAME:
+            write_u8(file, token->header_name.quote_delimited);
+            write_string(file, token->header_name.name);
+            break;
+        case PPT_IDENTIFIER:
+            write_string(file, token->identifier);
+            break;
+        case PPT_PP_NUMBER:
+            write_string(file, token->pp_number);
+            break;
+        case PPT_CHARACTER_CONSTANT:
+            write_u8(file, token->character_constant.wide);
+            write_string(file, token->character_constant.value);
+            break;
+        case PPT_STRING_LITERAL:
+            write_u8(file, token->string_literal.wide);
+            write_string(file, token->string_literal.value);
+            break;
+        case PPT_PUNCTUATOR:
+            write_u32(file, token->punctuator);
+            break;
+        case PPT_WHITESPACE:
+            write_string(file, token->whitespace);
+            break;
+        case PPT_OTHER:
+            write_u8(file, token->other);
+            break;
+        default:
+            break;
+    }
+}
+
+static void write_token_list(FILE* file, preprocessing_token_t* tokens)
+{
+    uint32_t count = 0;
+    for (preprocessing_token_t* token = tokens; token; token = token->next)
+        ++count;
+    write_u32(file, count);
+    for (preprocessing_token_t* token = tokens; token; token = token->next)
+        write_token(file, token);
+}
+
+static bool write_dependency(FILE* file, char* path)
+{
+    struct stat st;
+    if (stat(path, &st))
+        return false;
+    char* canon = canonical_path(path);
+    write_string(file, canon);
+    free(canon);
+    write_u64(file, (uint64_t) st.st_mtim.tv_sec);
+    write_u64(file, (uint64_t) st.st_mtim.tv_nsec);
+    write_u64(file, (uint64_t) st.st_size);
+    return true;
+}
+
+// writes a PCH for the header at the given path into target
+bool pch_emit(char* header, char* target)
+{
+    FILE* file = fopen(header, "r");
+    if (!file)
+    {
+        errorf("file '%s' not found\n", header);
+        return false;
+    }
+    preprocessing_token_t* tokens = lex(file, true);
+    fclose(file);
+    if (!tokens) return false;
+
+    time_t t = time(NULL);
+
+    preprocessing_settings_t settings;
+    settings.translation_time = &t;
+    settings.filepath = header;
+    char pp_error[MAX_ERROR_LENGTH];
+    settings.error = pp_error;
+    settings.error[0] = '\0';
+    settings.table = preprocessing_table_init();
+    settings.dependencies = vector_init();
+
+    bool success = preprocess(&tokens, &settings);
+    if (!success)
+        printf("%s", settings.error);
+
+    FILE* out = success ? fopen(target, "wb") : NULL;
+    if (success && !out)
+    {
+        errorf("could not open '%s' for writing\n", target);
+        success = false;
+    }
+
+    if (success)
+    {
+        fwrite(PCH_MAGIC, 1, PCH_MAGIC_LENGTH, out);
+        write_u32(out, PCH_VERSION);
+        write_u64(out, pch_fingerprint());
+
+        write_u32(out, settings.dependencies->size + 1);
+        success &= write_dependency(out, header);
+        VECTOR_FOR(char*, dep, settings.dependencies)
+            success &= write_dependency(out, dep);
+
+        preprocessing_table_t* table = settings.table;
+        uint32_t count = 0;
+        for (unsigned i = 0; i < table->capacity; ++i)
+            count += table->key[i] != NULL;
+        write_u32(out, count);
+        for (unsigned i = 0; i < table->capacity; ++i)
+        {
+            if (!table->key[i])
+                continue;
+            write_string(out, table->key[i]);
+            vector_t* params = table->v_id_list[i];
+            write_u8(out, params != NULL);
+            write_u8(out, table->v_variadic_list[i]);
+            if (params)
+            {
+                write_u32(out, params->size);
+                VECTOR_FOR(char*, param, params)
+                    write_string(out, param);
+            }
+            write_token_list(out, table->v_repl_list[i]);
+        }
+
+        write_token_list(out, tokens);
+
+        success &= !ferror(out);
+        fclose(out);
+        if (!success)
+        {
+            errorf("failed to write precompiled header '%s'\n", target);
+            remove(target);
+        }
+    }
+
+    pp_token_delete_all(tokens);
+    preprocessing_table_delete(settings.table);
+    vector_deep_delete(settings.dependencies, free);
+    return success;
+}
+
+static bool read_bytes(pch_reader_t* r, void* dest, size_t n)
+{
+    if (r->bad || r->length - r->pos < n)
+        return !(r->bad = true);
+    memcpy(dest, r->data + r->pos, n);
+    r->pos += n;
+    return true;
+}
+
+static uint8_t read_u8(pch_reader_t* r) { uint8_t x = 0; read_bytes(r, &x, sizeof x); return x; }
+static uint32_t read_u32(pch_reader_t* r) { uint32_t x = 0; read_bytes(r, &x, sizeof x); return x; }
+static uint64_t read_u64(pch_reader_t* r) { uint64_t x = 0; read_bytes(r, &x, sizeof x); return x; }
+
+static char* read_string(pch_reader_t* r)
+{
+    uint32_t length = read_u32(r);
+    if (r->bad || r->length - r->pos < length)
+        return (r->bad = true, NULL);
+    char* str = malloc(length + 1);
+    memcpy(str, r->data + r->pos, length);
+    str[length] = '\0';
+    r->pos += length;
+    return str;
+}
+
+static preprocessing_token_t* read_token(pch_reader_t* r)
+{
+    preprocessing_token_t* token = calloc(1, sizeof *token);
+    token->type = read_u8(r);
+    uint8_t flags = read_u8(r);
+    token->can_start_directive = (flags & PCH_FLAG_CAN_START_DIRECTIVE) != 0;
+    token->argument_content = (flags & PCH_FLAG_ARGUMENT_CONTENT) != 0;
+    token->row = read_u32(r);
+    token->col = read_u32(r);
+    switch (token->type)
+    {
+        case PPT_HEADER_NAME:
+            token->header_name.quote_delimited = read_u8(r);
+            token->header_name.name = read_string(r);
+            break;
+        case PPT_IDENTIFIER:
+            token->identifier = read_string(r);
+            break;
+        case PPT_PP_NUMBER:
+            token->pp_number = read_string(r);
+            break;
+        case PPT_CHARACTER_CONSTANT:
+            token->character_constant.wide = read_u8(r);
+            token->character_constant.value = read_string(r);
+            break;
+        case PPT_STRING_LITERAL:
+            token->string_literal.wide = read_u8(r);
+            token->string_literal.value = read_string(r);
+            break;
+        case PPT_PUNCTUATOR:
+            token->punctuator = read_u32(r);
+            break;
+        case PPT_WHITESPACE:
+            token->whitespace = read_string(r);
+            break;
+        case PPT_OTHER:
+            token->other = read_u8(r);
+            break;
+        case PPT_COMMENT:
+        case PPT_PLACEHOLDER:
+            break;
+        default:
+            r->bad = true;
+            break;
+    }
+    return token;
+}
+
+static preprocessing_token_t* read_token_list(pch_reader_t* r)
+{
+    uint32_t count = read_u32(r);
+    preprocessing_token_t* head = NULL;
+    preprocessing_token_t* current = NULL;
+    for (uint32_t i = 0; i < count && !r->bad; ++i)
+    {
+        preprocessing_token_t* token = read_token(r);
+        token->prev = current;
+        if (current)
+            current = current->next = token;
+        else
+            head = current = token;
+    }
+    return head;
+}
+
+static bool check_dependencies(pch_reader_t* r, char* header)
+{
+    uint32_t count = read_u32(r);
+    if (!count)
+        return false;
+    bool valid = true;
+    for (uint32_t i = 0; i < count && !r->bad; ++i)
+    {
+        char* path = read_string(r);
+        uint64_t sec = read_u64(r);
+        uint64_t nsec = read_u64(r);
+        uint64_t size = read_u64(r);
+        if (!path || !valid)
+        {
+            free(path);
+            continue;
+        }
+        if (i == 0)
+        {
+            char* canon = canonical_path(header);
+            valid = streq(canon, path);
+            free(canon);
+        }
+        struct stat st;
+        if (valid && (stat(path, &st) ||
+            (uint64_t) st.st_mtim.tv_sec != sec ||
+            (uint64_t) st.st_mtim.tv_nsec != nsec ||
+            (uint64_t) st.st_size != size))
+            valid = false;
+        free(path);
+    }
+    return valid && !r->bad;
+}
+
+/*
+
+tries to load the PCH for the header at the given path (i.e., <header>.pch).
+on success, the snapshot's macros are added to the table and its token stream is returned through tokens.
+returns false (leaving the table untouched) if there is no PCH or if it is stale/unusable.
+
+*/
+bool pch_load(char* header, preprocessing_table_t* table, preprocessing_token_t** tokens)
+{
+    char* path = pch_filepath(header);
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        free(path);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) || st.st_size < PCH_MAGIC_LENGTH)
+    {
+        close(fd);
+        free(path);
+        return false;
+    }
+
+    void* data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        free(path);
+        return false;
+    }
+
+    pch_reader_t r = { .data = data, .length = st.st_size, .pos = 0, .bad = false };
+
+    if (memcmp(r.data, PCH_MAGIC, PCH_MAGIC_LENGTH))
+    {
+        munmap(data, st.st_size);
+        free(path);
+        return false;
+    }
+    r.pos = PCH_MAGIC_LENGTH;
+
+    if (read_u32(&r) != PCH_VERSION || read_u64(&r) != pch_fingerprint() || !check_dependencies(&r, header))
+    {
+        if (get_program_options()->iflag)
+            infof("precompiled header '%s' is stale, ignoring it\n", path);
+        munmap(data, st.st_size);
+        free(path);
+        return false;
+    }
+
+    // decode everything before touching the table so a corrupt file can't leave it half-filled
+    uint32_t count = read_u32(&r);
+    vector_t* keys = vector_init();
+    vector_t* repls = vector_init();
+    vector_t* params = vector_init();
+    vector_t* variadics = vector_init();
+    for (uint32_t i = 0; i < count && !r.bad; ++i)
+    {
+        vector_add(keys, read_string(&r));
+        bool function_like = read_u8(&r);
+        vector_add(variadics, (void*) (uintptr_t) read_u8(&r));
+        vector_t* ids = NULL;
+        if (function_like)
+        {
+            ids = vector_init();
+            uint32_t noparams = read_u32(&r);
+            for (uint32_t j = 0; j < noparams && !r.bad; ++j)
+                vector_add(ids, read_string(&r));
+        }
+        vector_add(params, ids);
+        vector_add(repls, read_token_list(&r));
+    }
+    preprocessing_token_t* stream = r.bad ? NULL : read_token_list(&r);
+
+    bool success = !r.bad;
+    for (unsigned i = 0; i < keys->size; ++i)
+    {
+        char* key = vector_get(keys, i);
+        preprocessing_token_t* repl = vector_get(repls, i);
+        vector_t* ids = vector_get(params, i);
+        if (success && key)
+            preprocessing_table_add(table, key, repl, NULL, ids, (bool) (uintptr_t) vector_get(variadics, i));
+        free(key);
+        pp_token_delete_all(repl);
+        vector_deep_delete(ids, free);
+    }
+    vector_delete(keys);
+    vector_delete(repls);
+    vector_delete(params);
+    vector_delete(variadics);
+
+    munmap(data, st.st_size);
+
+    if (!success)
+    {
+        pp_token_delete_all(stream);
+        warnf("precompiled header '%s' is corrupt, ignoring it\n", path);
+        free(path);
+        return false;
+    }
+
+    if (get_program_options()->iflag)
+        infof("using precompiled header '%s'\n", path);
+
+    free(path);
+    *tokens = stream;
+    return true;
+}
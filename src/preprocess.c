@@ -1892,17 +1892,16 @@ static int check_if_condition(preprocessing_component_t* condition, preprocessin
     }
     error_delete_all(errors);
 
-    constexpr_t* ce = constexpr_evaluate_integer(expr);
-    if (!constexpr_evaluation_succeeded(ce))
+    constexpr_t ce;
+    constexpr_evaluate_integer(expr, &ce);
+    if (!constexpr_evaluation_succeeded(&ce))
     {
         (void) fail(condition->start, "#if/#elif directive expression must be a constant expression and have a representable value for its type");
-        constexpr_delete(ce);
         return 2;
     }
-    constexpr_convert_class(ce, CTC_UNSIGNED_LONG_LONG_INT);
-    uint64_t value = constexpr_as_u64(ce);
+    constexpr_convert_class(&ce, CTC_UNSIGNED_LONG_LONG_INT);
+    uint64_t value = constexpr_as_u64(&ce);
 
-    constexpr_delete(ce);
     token_delete_all(tokens);
     free_syntax(expr, NULL);
 
@@ -2029,6 +2028,9 @@ bool preprocess_include_file(FILE* file, char* path, preprocessing_state_t* stat
     settings.filepath = path;
     settings.error = state->settings->error;
     settings.table = state->table;
+    settings.dependencies = state->settings->dependencies;
+    if (settings.dependencies)
+        vector_add(settings.dependencies, strdup(path));
     if (!preprocess(&pp_tokens, &settings))
         return false;
     
@@ -2076,8 +2078,12 @@ bool preprocess_include_line(preprocessing_component_t* comp, preprocessing_stat
         return false;
     }
 
+    // a header included before any macro has been defined will always preprocess
+    // the same way, so a precompiled snapshot of it can be used instead (unless we're building one)
     preprocessing_token_t* included = NULL;
-    if (!preprocess_include_file(file, path, state, &included))
+    bool precompiled = !state->table->size && !state->settings->dependencies &&
+        pch_load(path, state->table, &included);
+    if (!precompiled && !preprocess_include_file(file, path, state, &included))
     {
         free(path);
         fclose(file);
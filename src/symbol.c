@@ -229,12 +229,10 @@ void symbol_print(symbol_t* sy, int (*printer)(const char*, ...))
         namespace_print(sy->ns, printer);
     else
         printer("(none)");
-    if (sy->data)
+    if (sy->image)
     {
         printer(", initial value:");
-        int64_t size = type_size(sy->type);
-        for (int64_t i = 0; i < size; ++i)
-            printer(" %02X", sy->data[i]);
+        image_print(sy->image, printer);
     }
     if (sy->addresses)
     {
@@ -242,7 +240,9 @@ void symbol_print(symbol_t* sy, int (*printer)(const char*, ...))
         VECTOR_FOR(init_address_t*, ia, sy->addresses)
         {
             if (i != 0) printer("; ");
-            printer("&%s + %lld (data + %llu)", symbol_get_name(ia->sy), *((int64_t*) (sy->data + ia->data_location)), ia->data_location);
+            int64_t offset;
+            image_read(sy->image, ia->data_location, &offset, POINTER_WIDTH);
+            printer("&%s + %lld (data + %llu)", symbol_get_name(ia->sy), offset, ia->data_location);
         }
     }
     printer(" }");
@@ -254,7 +254,7 @@ void symbol_delete(symbol_t* sy)
     type_delete(sy->type);
     namespace_delete(sy->ns);
     vector_deep_delete(sy->addresses, free);
-    free(sy->data);
+    image_delete(sy->image);
     free(sy->name);
     free(sy);
 }
@@ -267,23 +267,93 @@ static void symbol_delete_list(symbol_t* sy)
     symbol_delete(sy);
 }
 
-// this impl optionally asks for a ptr to retrieve the index of the element as well
-static symbol_t* symbol_table_get_internal(symbol_table_t* t, char* k, int* i)
+static unsigned long symbol_index_hash(unsigned sid, char* name)
 {
-    unsigned long index = hash(k) % t->capacity;
-    unsigned long oidx = index;
-    do
+    unsigned long h = (name ? hash(name) : 0) ^ (sid * 0x9E3779B97F4A7C15UL);
+    return h ^ (h >> 29);
+}
+
+static bool symbol_index_entry_empty(symbol_index_entry_t* e)
+{
+    return !e->sid && !e->name;
+}
+
+static symbol_index_t* symbol_index_init(void)
+{
+    symbol_index_t* idx = calloc(1, sizeof *idx);
+    idx->capacity = 64;
+    idx->entries = calloc(idx->capacity, sizeof(symbol_index_entry_t));
+    return idx;
+}
+
+static void symbol_index_delete(symbol_index_t* idx)
+{
+    if (!idx) return;
+    free(idx->entries);
+    free(idx);
+}
+
+// finds the entry with the given key, or if 'insert' is set, claims an empty one for it (with a zeroed value)
+static symbol_index_entry_t* symbol_index_find(symbol_index_t* idx, unsigned sid, char* name, bool insert)
+{
+    if (insert && (idx->size + 1) * 2 > idx->capacity)
     {
-        if (t->key[index] != NULL && !strcmp(t->key[index], k))
+        symbol_index_entry_t* old = idx->entries;
+        unsigned old_capacity = idx->capacity;
+        idx->capacity *= 2;
+        idx->entries = calloc(idx->capacity, sizeof(symbol_index_entry_t));
+        for (unsigned i = 0; i < old_capacity; ++i)
         {
-            if (i) *i = index;
-            return t->value[index];
+            if (symbol_index_entry_empty(&old[i]))
+                continue;
+            unsigned j = symbol_index_hash(old[i].sid, old[i].name) & (idx->capacity - 1);
+            for (; !symbol_index_entry_empty(&idx->entries[j]); j = (j + 1) & (idx->capacity - 1));
+            idx->entries[j] = old[i];
         }
-        index = (index + 1 == t->capacity ? 0 : index + 1);
+        free(old);
     }
-    while (index != oidx);
-    if (i) *i = -1;
-    return NULL;
+    unsigned mask = idx->capacity - 1;
+    for (unsigned i = symbol_index_hash(sid, name) & mask;; i = (i + 1) & mask)
+    {
+        symbol_index_entry_t* e = &idx->entries[i];
+        if (symbol_index_entry_empty(e))
+        {
+            if (!insert)
+                return NULL;
+            e->sid = sid;
+            e->name = name;
+            ++(idx->size);
+            return e;
+        }
+        if (e->sid == sid && (e->name == name || (e->name && name && !strcmp(e->name, name))))
+            return e;
+    }
+}
+
+// removes an entry, shifting back the ones after it so that no probe sequence is broken
+static void symbol_index_remove(symbol_index_t* idx, symbol_index_entry_t* e)
+{
+    unsigned mask = idx->capacity - 1;
+    unsigned i = e - idx->entries;
+    for (unsigned j = (i + 1) & mask; !symbol_index_entry_empty(&idx->entries[j]); j = (j + 1) & mask)
+    {
+        unsigned home = symbol_index_hash(idx->entries[j].sid, idx->entries[j].name) & mask;
+        if (((j - home) & mask) >= ((j - i) & mask))
+        {
+            idx->entries[i] = idx->entries[j];
+            i = j;
+        }
+    }
+    memset(&idx->entries[i], 0, sizeof(symbol_index_entry_t));
+    --(idx->size);
+}
+
+// this impl optionally asks for a ptr to retrieve the index of the element as well
+static symbol_t* symbol_table_get_internal(symbol_table_t* t, char* k, int* i)
+{
+    symbol_index_entry_t* e = k ? symbol_index_find(t->names, 0, k, false) : NULL;
+    if (i) *i = e ? (int) e->slot : -1;
+    return e ? t->value[e->slot] : NULL;
 }
 
 symbol_table_t* symbol_table_init(void)
@@ -293,12 +363,17 @@ symbol_table_t* symbol_table_init(void)
     memset(t->key, 0, 50 * sizeof(char*));
     t->value = calloc(50, sizeof(symbol_t*));
     memset(t->value, 0, 50 * sizeof(symbol_t*));
+    t->last = calloc(50, sizeof(symbol_t*));
     t->size = 0;
     t->capacity = 50;
     t->unique_types = vector_init();
+    t->names = symbol_index_init();
+    t->declarers = symbol_index_init();
+    t->scopes = symbol_index_init();
     return t;
 }
 
+// entries keep their slots when resizing, so the name index stays valid
 symbol_table_t* symbol_table_resize(symbol_table_t* t)
 {
     unsigned old_capacity = t->capacity;
@@ -306,9 +381,33 @@ symbol_table_t* symbol_table_resize(symbol_table_t* t)
     memset(t->key + old_capacity, 0, (t->capacity - old_capacity) * sizeof(char*));
     t->value = realloc(t->value, t->capacity * sizeof(symbol_t*));
     memset(t->value + old_capacity, 0, (t->capacity - old_capacity) * sizeof(char*));
+    t->last = realloc(t->last, t->capacity * sizeof(symbol_t*));
+    memset(t->last + old_capacity, 0, (t->capacity - old_capacity) * sizeof(symbol_t*));
     return t;
 }
 
+// indexes a symbol by its declarer and by the scope it was declared in.
+// the scope is worked out once here instead of on every lookup, the one catch being function
+// parameters: they get added while their declarator still sits in a plain declaration, so they
+// end up under the function declarator even if it turns out to start a function definition
+// (see symbol_table_resolve for how that is handled)
+static void symbol_table_index(symbol_table_t* t, char* k, symbol_t* sy)
+{
+    if (!sy->declarer)
+        return;
+    symbol_index_entry_t* e = symbol_index_find(t->declarers, sy->declarer->sid, NULL, true);
+    if (!e->sy)
+        e->sy = sy;
+    syntax_component_t* scope = syntax_get_scope(sy->declarer);
+    if (!scope)
+        return;
+    sy->scope = scope->sid;
+    e = symbol_index_find(t->scopes, scope->sid, k, true);
+    symbol_t** end = &e->sy;
+    for (; *end; end = &(*end)->scope_next);
+    *end = sy;
+}
+
 symbol_t* symbol_table_add(symbol_table_t* t, char* k, symbol_t* sy)
 {
     if (t->size >= t->capacity)
@@ -317,11 +416,12 @@ symbol_t* symbol_table_add(symbol_table_t* t, char* k, symbol_t* sy)
     symbol_t* ex = symbol_table_get_internal(t, k, &exi);
     if (ex) // append to the end
     {
-        uint64_t disambiguator = 1;
-        symbol_t* last = ex;
-        for (; last->next; last = last->next, ++disambiguator);
+        symbol_t* last = t->last[exi];
         last->next = sy;
-        sy->disambiguator = disambiguator;
+        sy->prev = last;
+        sy->disambiguator = last->disambiguator + 1;
+        t->last[exi] = sy;
+        symbol_table_index(t, t->key[exi], sy);
         return sy;
     }
     else
@@ -333,7 +433,10 @@ symbol_t* symbol_table_add(symbol_table_t* t, char* k, symbol_t* sy)
         {
             t->key[i] = strdup(k);
             t->value[i] = sy;
+            t->last[i] = sy;
             ++(t->size);
+            symbol_index_find(t->names, 0, t->key[i], true)->slot = i;
+            symbol_table_index(t, t->key[i], sy);
             break;
         }
         i = (i + 1) % t->capacity;
@@ -363,38 +466,112 @@ symbol_t* symbol_table_get_by_classes(symbol_table_t* t, char* k, c_type_class_t
 // uses an exact identifier object as opposed to just a name
 symbol_t* symbol_table_get_syn_id(symbol_table_t* t, syntax_component_t* id)
 {
-    symbol_t* sylist = symbol_table_get_all(t, syntax_get_identifier_name(id));
-    for (; sylist && sylist->declarer != id; sylist = sylist->next);
-    return sylist;
+    if (!id) return NULL;
+    symbol_index_entry_t* e = symbol_index_find(t->declarers, id->sid, NULL, false);
+    return e ? e->sy : NULL;
 }
 
-// given a contextualized id (syntax element id), find the symbol, NULL if cannot find
-// functions just as symbol_table_get_syn_id for declaring identifiers
-// also takes a namespace 'ns' as an argument for searching only in a given namespace, NULL will ignore namespaces entirely
-symbol_t* symbol_table_lookup(symbol_table_t* t, syntax_component_t* id, c_namespace_t* ns)
+// checks the symbols declared with a name in one scope against the best match found so far.
+// 'filed' is the scope the symbols were indexed under and 'scope' the one they are actually in.
+// the closest scope wins, and between symbols in the same scope, the one declared first does.
+static void symbol_table_consider(symbol_table_t* t, syntax_component_t* id, c_namespace_t* ns,
+    syntax_component_t* filed, syntax_component_t* scope, symbol_t** found, int* distance, vector_t* same_scope)
 {
-    if (!id) return NULL;
-    symbol_t* sylist = symbol_table_get_all(t, syntax_get_identifier_name(id));
+    symbol_index_entry_t* e = symbol_index_find(t->scopes, filed->sid, syntax_get_identifier_name(id), false);
+    if (!e)
+        return;
+    syntax_component_t* idscope = NULL;
+    int d = 0;
+    bool measured = false;
+    for (symbol_t* sy = e->sy; sy; sy = sy->scope_next)
+    {
+        if (sy->declarer == id)
+            continue;
+        if (ns && !namespace_equals(ns, sy->ns))
+            continue;
+        if (!measured)
+        {
+            idscope = syntax_get_scope(id);
+            d = symbol_get_scope_distance(idscope, scope);
+            measured = true;
+        }
+        if (d < *distance || (d == *distance && sy->disambiguator < (*found)->disambiguator))
+        {
+            *distance = d;
+            *found = sy;
+        }
+        if (same_scope && scope == idscope)
+            vector_add(same_scope, sy);
+    }
+}
+
+// finds the symbol an identifier refers to by looking at each scope enclosing it, as opposed to
+// going through every symbol with its name.
+// parameters indexed under the function declarator of a function definition are in the scope of
+// its body, so they are looked at there and skipped anywhere else.
+static symbol_t* symbol_table_resolve(symbol_table_t* t, syntax_component_t* id, c_namespace_t* ns, vector_t* same_scope)
+{
+    if (!syntax_get_identifier_name(id))
+        return NULL;
     symbol_t* found = NULL;
     int distance = INT_MAX;
-    for (; sylist; sylist = sylist->next)
+    for (syntax_component_t* scope = id->parent; scope; scope = scope->parent)
     {
-        if (sylist->declarer == id)
-            return sylist;
-        c_namespace_t* sns = sylist->ns;
-        if (symbol_in_scope(sylist, id) && (!ns || namespace_equals(ns, sns)))
+        switch (scope->type)
         {
-            int d = symbol_get_scope_distance(syntax_get_scope(id), symbol_get_scope(sylist));
-            if (d < distance)
+            case SC_FUNCTION_DECLARATOR:
+                if (syntax_get_declarator_function_definition(scope))
+                    break;
+                // fallthrough
+            case SC_TRANSLATION_UNIT:
+            case SC_FUNCTION_DEFINITION:
+            case SC_IF_STATEMENT:
+            case SC_SWITCH_STATEMENT:
+            case SC_DO_STATEMENT:
+            case SC_WHILE_STATEMENT:
+            case SC_FOR_STATEMENT:
+                symbol_table_consider(t, id, ns, scope, scope, &found, &distance, same_scope);
+                break;
+            case SC_COMPOUND_STATEMENT:
             {
-                distance = d;
-                found = sylist;
+                symbol_table_consider(t, id, ns, scope, scope, &found, &distance, same_scope);
+                syntax_component_t* fdef = scope->parent;
+                if (!fdef || fdef->type != SC_FUNCTION_DEFINITION || fdef->fdef_body != scope)
+                    break;
+                for (syntax_component_t* declr = fdef->fdef_declarator; declr;)
+                {
+                    if (declr->type == SC_FUNCTION_DECLARATOR)
+                        symbol_table_consider(t, id, ns, declr, scope, &found, &distance, same_scope);
+                    if (declr->type == SC_DECLARATOR)
+                        declr = declr->declr_direct;
+                    else if (declr->type == SC_FUNCTION_DECLARATOR)
+                        declr = declr->fdeclr_direct;
+                    else if (declr->type == SC_ARRAY_DECLARATOR)
+                        declr = declr->adeclr_direct;
+                    else
+                        declr = NULL;
+                }
+                break;
             }
+            default:
+                break;
         }
     }
     return found;
 }
 
+// given a contextualized id (syntax element id), find the symbol, NULL if cannot find
+// functions just as symbol_table_get_syn_id for declaring identifiers
+// also takes a namespace 'ns' as an argument for searching only in a given namespace, NULL will ignore namespaces entirely
+symbol_t* symbol_table_lookup(symbol_table_t* t, syntax_component_t* id, c_namespace_t* ns)
+{
+    if (!id) return NULL;
+    symbol_t* sy = symbol_table_get_syn_id(t, id);
+    if (sy)
+        return sy;
+    return symbol_table_resolve(t, id, ns, NULL);
+}
+
 // 3 return values here:
 //  - actual return value: the symbol representing the identifier given as an arg, if any (must be declaring)
 //  - symbols: duplicate entries in the symbol table (i.e., same namespace and scope)
@@ -403,76 +580,72 @@ symbol_t* symbol_table_count(symbol_table_t* t, syntax_component_t* id, c_namesp
 {
     if (symbols) *symbols = vector_init();
     if (first) *first = false;
-    symbol_t* sylist = symbol_table_get_all(t, syntax_get_identifier_name(id));
-    symbol_t* found = NULL;
-    int distance = INT_MAX;
-    for (; sylist; sylist = sylist->next)
+    symbol_t* declared = symbol_table_get_syn_id(t, id);
+    symbol_t* found = symbol_table_resolve(t, id, ns, symbols ? *symbols : NULL);
+    if (symbols)
     {
-        if (sylist->declarer == id)
+        // duplicates are listed in the order they were declared
+        if (declared)
+            vector_add(*symbols, declared);
+        void** data = (*symbols)->data;
+        for (unsigned i = 1; i < (*symbols)->size; ++i)
         {
-            if (symbols && first && (*symbols)->size == 0)
-                *first = true;
-            if (symbols)
-                vector_add(*symbols, sylist);
-            found = sylist;
-            continue;
-        }
-        c_namespace_t* sns = sylist->ns;
-        if (symbol_in_scope(sylist, id) && (!ns || namespace_equals(ns, sns)))
-        {
-            syntax_component_t* slscope = symbol_get_scope(sylist);
-            syntax_component_t* idscope = syntax_get_scope(id);
-            int d = symbol_get_scope_distance(idscope, slscope);
-            if (d < distance)
-            {
-                distance = d;
-                found = sylist;
-            }
-            if (symbols && slscope == idscope) vector_add(*symbols, sylist);
+            void* sy = data[i];
+            unsigned j = i;
+            for (; j > 0 && ((symbol_t*) data[j - 1])->disambiguator > ((symbol_t*) sy)->disambiguator; --j)
+                data[j] = data[j - 1];
+            data[j] = sy;
         }
+        if (first && declared)
+            *first = data[0] == declared;
     }
+    // a declaring id only gives way to closer symbols declared before it
+    if (declared && (!found || declared->disambiguator > found->disambiguator))
+        return declared;
     return found;
 }
 
 // removes a symbol from the table
 symbol_t* symbol_table_remove(symbol_table_t* t, syntax_component_t* id)
 {
-    char* k = id->id;
-    unsigned long index = hash(k) % t->capacity;
-    for (unsigned long i = index;;)
+    symbol_index_entry_t* e = symbol_index_find(t->declarers, id->sid, NULL, false);
+    if (!e)
+        return NULL;
+    symbol_t* sy = e->sy;
+    symbol_index_remove(t->declarers, e);
+    int i;
+    symbol_table_get_internal(t, syntax_get_identifier_name(id), &i);
+    if (i == -1)
+        return sy;
+
+    e = symbol_index_find(t->scopes, sy->scope, t->key[i], false);
+    if (e)
     {
-        if (t->key[i] != NULL && !strcmp(t->key[i], k))
-        {
-            symbol_t* prev = NULL;
-            symbol_t* sy = t->value[i];
-            symbol_t* sylist = sy;
-            for (; sylist; prev = sylist, sylist = sylist->next)
-            {
-                if (sylist->declarer == id)
-                {
-                    if (prev)
-                        prev->next = sylist->next;
-                    else
-                        sy = sylist->next;
-                    break;
-                }
-            }
-            if (!sylist)
-                return NULL;
-            if (!sy)
-            {
-                free(t->key[i]);
-                t->key[i] = NULL;
-                --(t->size);
-            }
-            t->value[i] = sy;
-            return sylist;
-        }
-        i = (i + 1) % t->capacity;
-        if (i == index)
-            break;
+        symbol_t** link = &e->sy;
+        for (; *link && *link != sy; link = &(*link)->scope_next);
+        if (*link)
+            *link = sy->scope_next;
+        if (!e->sy)
+            symbol_index_remove(t->scopes, e);
     }
-    return NULL;
+
+    if (sy->prev)
+        sy->prev->next = sy->next;
+    else
+        t->value[i] = sy->next;
+    if (sy->next)
+        sy->next->prev = sy->prev;
+    else
+        t->last[i] = sy->prev;
+    sy->next = sy->prev = sy->scope_next = NULL;
+    if (!t->value[i])
+    {
+        symbol_index_remove(t->names, symbol_index_find(t->names, 0, t->key[i], false));
+        free(t->key[i]);
+        t->key[i] = NULL;
+        --(t->size);
+    }
+    return sy;
 }
 
 void symbol_table_print(symbol_table_t* t, int (*printer)(const char*, ...))
@@ -503,9 +676,18 @@ void symbol_table_delete(symbol_table_t* t, bool free_contents)
             symbol_delete_list(t->value[i]);
         free(t->key[i]);
     }
-    vector_deep_delete(t->unique_types, (void (*)(void*)) symbol_type_delete);
+    // a struct or union is always completed (and so added here) before any struct or union that has it as a member,
+    // so going backwards never looks at a member type that's already been freed
+    for (unsigned i = t->unique_types->size; i-- > 0;)
+        symbol_type_delete(vector_get(t->unique_types, i));
+    vector_delete(t->unique_types);
+    type_table_delete(t->types);
+    symbol_index_delete(t->names);
+    symbol_index_delete(t->declarers);
+    symbol_index_delete(t->scopes);
     free(t->key);
     free(t->value);
+    free(t->last);
     free(t);
 }
 
@@ -1,6 +1,7 @@
 // this file contains some utility functions for working with the behemoth that is syntax_component_t.
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdlib.h>
 #include <errno.h>
@@ -372,16 +373,11 @@ static c_type_t* get_type_by_designation(syntax_component_t* desig, syntax_compo
         {
             if (trace->class != CTC_STRUCTURE && trace->class != CTC_UNION)
                 return NULL;
-            c_type_t* old = trace;
-            VECTOR_FOR(char*, member_name, trace->struct_union.member_names)
-            {
-                if (!streq(designator->id, member_name))
-                    continue;
-                trace = vector_get(trace->struct_union.member_types, i);
-                break;
-            }
-            if (old == trace)
+            long long index = -1;
+            type_get_struct_union_member_info(trace, designator->id, &index, NULL);
+            if (index == -1)
                 return NULL;
+            trace = vector_get(trace->struct_union.member_types, index);
         }
         else
         {
@@ -422,8 +418,8 @@ c_namespace_t* syntax_get_namespace(syntax_component_t* id)
     }
     if (syn->type == SC_ENUM_SPECIFIER)
         return make_basic_namespace(NSC_ENUM);
-    if (syn->memexpr_id == id && (syn->type == SC_MEMBER_EXPRESSION ||
-        syn->type == SC_DEREFERENCE_MEMBER_EXPRESSION))
+    if ((syn->type == SC_MEMBER_EXPRESSION || syn->type == SC_DEREFERENCE_MEMBER_EXPRESSION) &&
+        syn->memexpr_id == id)
     {
         c_type_t* ty = syn->memexpr_expression->ctype;
         if (syn->type == SC_DEREFERENCE_MEMBER_EXPRESSION)
@@ -671,47 +667,6 @@ bool syntax_has_initializer(syntax_component_t* id)
     return true;
 }
 
-int64_t syntax_get_full_initialization_offset(syntax_component_t* initializer)
-{
-    if (!initializer)
-        return -1;
-    if (!syntax_is_expression_type(initializer->type) && initializer->type != SC_INITIALIZER_LIST)
-        return 0;
-    if (initializer->initializer_offset == -1)
-        return -1;
-    int64_t upper = syntax_get_full_initialization_offset(initializer->parent);
-    if (upper == -1)
-        return -1;
-    return upper + initializer->initializer_offset;
-}
-
-typedef struct contains_traverser
-{
-    syntax_traverser_t base;
-    syntax_component_type_t type;
-    bool found;
-} contains_traverser_t;
-
-void contains_default_after(syntax_traverser_t* trav, syntax_component_t* syn)
-{
-    contains_traverser_t* ctrav = (contains_traverser_t*) trav;
-    if (syn->type == ctrav->type)
-        ctrav->found = true;
-}
-
-bool syntax_contains_subelement(syntax_component_t* syn, syntax_component_type_t type)
-{
-    contains_traverser_t* trav = (contains_traverser_t*) traverse_init(syn, sizeof(contains_traverser_t));
-    trav->type = type;
-    trav->found = false;
-
-    traverse((syntax_traverser_t*) trav);
-
-    bool found = trav->found;
-    traverse_delete((syntax_traverser_t*) trav);
-    return found;
-}
-
 // ps - print structure
 // pf - print field
 #define ps(fmt, ...) { for (unsigned i = 0; i < indent; ++i) printer("  "); printer(fmt, ##__VA_ARGS__); }
@@ -1333,11 +1288,13 @@ static void print_syntax_indented(syntax_component_t* s, unsigned indent, int (*
     }
     if ((s->type == SC_INITIALIZER_LIST || syntax_is_expression_type(s->type)) && s->parent->type == SC_INITIALIZER_LIST)
     {
-        pf("offset for initialization: %lld\n", s->initializer_offset, printer);
-        if (s->initializer_ctype)
+        syntax_component_t* tlu = syntax_get_translation_unit(s);
+        c_type_t* ct = tlu ? syntax_get_initializer_ctype(tlu, s) : NULL;
+        pf("offset for initialization: %lld\n", tlu ? syntax_get_initializer_offset(tlu, s) : 0, printer);
+        if (ct)
         {
             pf("object initialization type: ");
-            type_humanized_print(s->initializer_ctype, printer);
+            type_humanized_print(ct, printer);
             pf("\n");
         }
     }
@@ -1364,6 +1321,198 @@ void print_syntax(syntax_component_t* s, int (*printer)(const char* fmt, ...))
     print_syntax_indented(s, 0, printer);
 }
 
+// the size of a node up to the end of the given member of its payload
+#define PAYLOAD_END(member) (offsetof(syntax_component_t, member) + sizeof(((syntax_component_t*) NULL)->member))
+
+// how much of syntax_component_t a node of the given type needs, i.e., everything up to the end of its payload
+size_t syntax_component_size(syntax_component_type_t type)
+{
+    switch (type)
+    {
+        case SC_ERROR: return PAYLOAD_END(err_depth);
+        case SC_TRANSLATION_UNIT: return PAYLOAD_END(tlu_last_sid);
+        case SC_FUNCTION_DEFINITION: return PAYLOAD_END(fdef_body);
+        case SC_DECLARATION: return PAYLOAD_END(decl_init_declarators);
+        case SC_INIT_DECLARATOR: return PAYLOAD_END(ideclr_initializer);
+        case SC_STORAGE_CLASS_SPECIFIER: return PAYLOAD_END(scs);
+        case SC_BASIC_TYPE_SPECIFIER: return PAYLOAD_END(bts);
+        case SC_TYPE_QUALIFIER: return PAYLOAD_END(tq);
+        case SC_FUNCTION_SPECIFIER: return PAYLOAD_END(fs);
+        case SC_STRUCT_UNION_SPECIFIER: return PAYLOAD_END(sus_declarations);
+        case SC_STRUCT_DECLARATION: return PAYLOAD_END(sdecl_declarators);
+        case SC_STRUCT_DECLARATOR: return PAYLOAD_END(sdeclr_bits_expression);
+        case SC_ENUM_SPECIFIER: return PAYLOAD_END(enums_enumerators);
+        case SC_ENUMERATOR: return PAYLOAD_END(enumr_value);
+        case SC_IDENTIFIER:
+        case SC_TYPEDEF_NAME:
+        case SC_ENUMERATION_CONSTANT:
+        case SC_DECLARATOR_IDENTIFIER:
+        case SC_PRIMARY_EXPRESSION_IDENTIFIER:
+        case SC_PRIMARY_EXPRESSION_ENUMERATION_CONSTANT:
+            return PAYLOAD_END(id);
+        case SC_STRING_LITERAL: return PAYLOAD_END(strl_length);
+        case SC_CHARACTER_CONSTANT: return PAYLOAD_END(charc_wide);
+        case SC_FLOATING_CONSTANT: return PAYLOAD_END(floc_id);
+        case SC_INTEGER_CONSTANT: return PAYLOAD_END(intc);
+        case SC_DECLARATOR: return PAYLOAD_END(declr_direct);
+        case SC_POINTER: return PAYLOAD_END(ptr_type_qualifiers);
+        case SC_ARRAY_DECLARATOR: return PAYLOAD_END(adeclr_length_expression);
+        case SC_FUNCTION_DECLARATOR: return PAYLOAD_END(fdeclr_knr_identifiers);
+        case SC_PARAMETER_DECLARATION: return PAYLOAD_END(pdecl_declr);
+        case SC_ABSTRACT_DECLARATOR: return PAYLOAD_END(abdeclr_direct);
+        case SC_ABSTRACT_ARRAY_DECLARATOR: return PAYLOAD_END(abadeclr_length_expression);
+        case SC_ABSTRACT_FUNCTION_DECLARATOR: return PAYLOAD_END(abfdeclr_parameter_declarations);
+        case SC_LABELED_STATEMENT: return PAYLOAD_END(lstmt_value);
+        case SC_COMPOUND_STATEMENT: return PAYLOAD_END(cstmt_block_items);
+        case SC_EXPRESSION_STATEMENT: return PAYLOAD_END(estmt_expression);
+        case SC_IF_STATEMENT: return PAYLOAD_END(ifstmt_else);
+        case SC_SWITCH_STATEMENT: return PAYLOAD_END(swstmt_default);
+        case SC_DO_STATEMENT: return PAYLOAD_END(dostmt_body);
+        case SC_WHILE_STATEMENT: return PAYLOAD_END(whstmt_body);
+        case SC_FOR_STATEMENT: return PAYLOAD_END(forstmt_body);
+        case SC_GOTO_STATEMENT: return PAYLOAD_END(gtstmt_label_id);
+        case SC_CONTINUE_STATEMENT:
+        case SC_BREAK_STATEMENT:
+            return offsetof(syntax_component_t, id);
+        case SC_RETURN_STATEMENT: return PAYLOAD_END(retstmt_expression);
+        case SC_INITIALIZER_LIST: return PAYLOAD_END(inlist_has_semantics);
+        case SC_DESIGNATION: return PAYLOAD_END(desig_designators);
+        case SC_EXPRESSION: return PAYLOAD_END(expr_expressions);
+        case SC_ASSIGNMENT_EXPRESSION:
+        case SC_MULTIPLICATION_ASSIGNMENT_EXPRESSION:
+        case SC_DIVISION_ASSIGNMENT_EXPRESSION:
+        case SC_MODULAR_ASSIGNMENT_EXPRESSION:
+        case SC_ADDITION_ASSIGNMENT_EXPRESSION:
+        case SC_SUBTRACTION_ASSIGNMENT_EXPRESSION:
+        case SC_BITWISE_LEFT_ASSIGNMENT_EXPRESSION:
+        case SC_BITWISE_RIGHT_ASSIGNMENT_EXPRESSION:
+        case SC_BITWISE_AND_ASSIGNMENT_EXPRESSION:
+        case SC_BITWISE_OR_ASSIGNMENT_EXPRESSION:
+        case SC_BITWISE_XOR_ASSIGNMENT_EXPRESSION:
+        case SC_LOGICAL_OR_EXPRESSION:
+        case SC_LOGICAL_AND_EXPRESSION:
+        case SC_BITWISE_OR_EXPRESSION:
+        case SC_BITWISE_XOR_EXPRESSION:
+        case SC_BITWISE_AND_EXPRESSION:
+        case SC_EQUALITY_EXPRESSION:
+        case SC_INEQUALITY_EXPRESSION:
+        case SC_GREATER_EQUAL_EXPRESSION:
+        case SC_LESS_EQUAL_EXPRESSION:
+        case SC_GREATER_EXPRESSION:
+        case SC_LESS_EXPRESSION:
+        case SC_BITWISE_RIGHT_EXPRESSION:
+        case SC_BITWISE_LEFT_EXPRESSION:
+        case SC_SUBTRACTION_EXPRESSION:
+        case SC_ADDITION_EXPRESSION:
+        case SC_MODULAR_EXPRESSION:
+        case SC_DIVISION_EXPRESSION:
+        case SC_MULTIPLICATION_EXPRESSION:
+            return PAYLOAD_END(bexpr_rhs);
+        case SC_CONDITIONAL_EXPRESSION:
+        case SC_CONSTANT_EXPRESSION:
+            return PAYLOAD_END(cexpr_else);
+        case SC_CAST_EXPRESSION: return PAYLOAD_END(caexpr_operand);
+        case SC_PREFIX_INCREMENT_EXPRESSION:
+        case SC_PREFIX_DECREMENT_EXPRESSION:
+        case SC_REFERENCE_EXPRESSION:
+        case SC_DEREFERENCE_EXPRESSION:
+        case SC_PLUS_EXPRESSION:
+        case SC_MINUS_EXPRESSION:
+        case SC_COMPLEMENT_EXPRESSION:
+        case SC_NOT_EXPRESSION:
+        case SC_SIZEOF_EXPRESSION:
+        case SC_SIZEOF_TYPE_EXPRESSION:
+        case SC_POSTFIX_INCREMENT_EXPRESSION:
+        case SC_POSTFIX_DECREMENT_EXPRESSION:
+            return PAYLOAD_END(uexpr_operand);
+        case SC_COMPOUND_LITERAL: return PAYLOAD_END(cl_inlist);
+        case SC_FUNCTION_CALL_EXPRESSION: return PAYLOAD_END(fcallexpr_args);
+        case SC_INTRINSIC_CALL_EXPRESSION: return PAYLOAD_END(icallexpr_args);
+        case SC_SUBSCRIPT_EXPRESSION: return PAYLOAD_END(subsexpr_index_expression);
+        case SC_TYPE_NAME: return PAYLOAD_END(tn_declarator);
+        case SC_DEREFERENCE_MEMBER_EXPRESSION:
+        case SC_MEMBER_EXPRESSION:
+            return PAYLOAD_END(memexpr_id);
+        default: return sizeof(syntax_component_t);
+    }
+}
+
+#undef PAYLOAD_END
+
+// allocates a zeroed node of the given type and gives it the next syntax id in the translation unit
+syntax_component_t* syntax_component_init(syntax_component_type_t type, syntax_component_t* tlu)
+{
+    syntax_component_t* syn = calloc(1, syntax_component_size(type));
+    syn->type = type;
+    if (tlu)
+        syn->sid = ++tlu->tlu_last_sid;
+    return syn;
+}
+
+static void initializer_info_delete(initializer_info_t* info)
+{
+    if (!info) return;
+    type_delete(info->ctype);
+    free(info);
+}
+
+static initializer_info_t* find_initializer_info(syntax_component_t* tlu, syntax_component_t* initializer)
+{
+    if (!tlu->tlu_initializers)
+        return NULL;
+    return map_get(tlu->tlu_initializers, (void*) (uintptr_t) initializer->sid);
+}
+
+static initializer_info_t* get_initializer_info(syntax_component_t* tlu, syntax_component_t* initializer)
+{
+    if (!tlu->tlu_initializers)
+    {
+        tlu->tlu_initializers = map_init((comparator_t) regid_comparator, (hash_function_t) regid_hash);
+        map_set_deleters(tlu->tlu_initializers, NULL, (void (*)(void*)) initializer_info_delete);
+    }
+    initializer_info_t* info = find_initializer_info(tlu, initializer);
+    if (!info)
+    {
+        info = calloc(1, sizeof *info);
+        map_add(tlu->tlu_initializers, (void*) (uintptr_t) initializer->sid, info);
+    }
+    return info;
+}
+
+int64_t syntax_get_initializer_offset(syntax_component_t* tlu, syntax_component_t* initializer)
+{
+    initializer_info_t* info = find_initializer_info(tlu, initializer);
+    return info ? info->offset : 0;
+}
+
+void syntax_set_initializer_offset(syntax_component_t* tlu, syntax_component_t* initializer, int64_t offset)
+{
+    get_initializer_info(tlu, initializer)->offset = offset;
+}
+
+// sets both at once, with one lookup (takes ownership of the type)
+void syntax_set_initializer(syntax_component_t* tlu, syntax_component_t* initializer, int64_t offset, c_type_t* ct)
+{
+    initializer_info_t* info = get_initializer_info(tlu, initializer);
+    info->offset = offset;
+    type_delete(info->ctype);
+    info->ctype = ct;
+}
+
+c_type_t* syntax_get_initializer_ctype(syntax_component_t* tlu, syntax_component_t* initializer)
+{
+    initializer_info_t* info = find_initializer_info(tlu, initializer);
+    return info ? info->ctype : NULL;
+}
+
+// takes ownership of the type
+void syntax_set_initializer_ctype(syntax_component_t* tlu, syntax_component_t* initializer, c_type_t* ct)
+{
+    initializer_info_t* info = get_initializer_info(tlu, initializer);
+    type_delete(info->ctype);
+    info->ctype = ct;
+}
+
 // free a syntax component and EVERYTHING IT HAS UNDERNEATH IT.
 void free_syntax(syntax_component_t* syn, syntax_component_t* tlu)
 {
@@ -1372,14 +1521,14 @@ void free_syntax(syntax_component_t* syn, syntax_component_t* tlu)
     switch (syn->type)
     {
         case SC_ERROR:
-        {
-            free(syn->err_message);
             break;
-        }
         case SC_TRANSLATION_UNIT:
         {
             deep_free_syntax_vector(syn->tlu_external_declarations, s1);
-            deep_free_syntax_vector(syn->tlu_errors, s2);
+            free_syntax(syn->tlu_error, tlu);
+            // initializer and constant expression types can share parts with symbol types, so they go first
+            map_delete(syn->tlu_initializers);
+            map_delete(syn->tlu_constexprs);
             symbol_table_delete(syn->tlu_st, true);
             break;
         }
@@ -1701,8 +1850,6 @@ void free_syntax(syntax_component_t* syn, syntax_component_t* tlu)
             break;
         }
     }
-    type_delete(syn->initializer_ctype);
-    syn->initializer_ctype = NULL;
     type_delete(syn->ctype);
     syn->ctype = NULL;
     air_insn_delete_all(syn->code);
@@ -1816,41 +1963,68 @@ unsigned long long constexpr_cast_type(unsigned long long value, c_type_class_t
     return r;
 }
 
+static int digit_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// parses an integer suffix (u, l, ul, lu, ll, ull, llu, any case), returns false if str isn't one
+static bool parse_integer_suffix(char* str, bool* is_unsigned, int* longs)
+{
+    *is_unsigned = false;
+    *longs = 0;
+    if (*str == 'u' || *str == 'U')
+        *is_unsigned = true, ++str;
+    if (*str == 'l' || *str == 'L')
+    {
+        ++*longs, ++str;
+        if (*str == 'l' || *str == 'L')
+            ++*longs, ++str;
+    }
+    if (!*is_unsigned && (*str == 'u' || *str == 'U'))
+        *is_unsigned = true, ++str;
+    return !*str;
+}
+
+// digits and suffix are read in one pass
 unsigned long long process_integer_constant(char* con, c_type_class_t* class)
 {
     int radix = 10;
-    if (starts_with_ignore_case(con, "0x"))
+    if (con[0] == '0' && (con[1] == 'x' || con[1] == 'X'))
     {
         radix = 16;
         con += 2;
     }
-    else if (starts_with_ignore_case(con, "0") && strlen(con) > 1 && con[1] >= '0' && con[2] <= '9')
-    {
+    else if (con[0] == '0')
         radix = 8;
-        ++con;
+    char* digits = con;
+    unsigned long long full = 0;
+    bool overflow = false;
+    for (int d; (d = digit_value(*con)) != -1 && d < radix; ++con)
+    {
+        if (full > (UNSIGNED_LONG_LONG_INT_MAX - d) / radix)
+            overflow = true;
+        full = full * radix + d;
     }
-    char* end = NULL;
-    unsigned long long full = strtoull(con, &end, radix);
-    if (errno == ERANGE || !end || (*end &&
-        !streq_ignore_case(end, "ull") &&
-        !streq_ignore_case(end, "llu") &&
-        !streq_ignore_case(end, "ll") &&
-        !streq_ignore_case(end, "ul") &&
-        !streq_ignore_case(end, "lu") &&
-        !streq_ignore_case(end, "l") &&
-        !streq_ignore_case(end, "u")))
+    bool is_unsigned = false;
+    int longs = 0;
+    if (overflow || con == digits || !parse_integer_suffix(con, &is_unsigned, &longs))
     {
-        errno = 0;
         *class = CTC_ERROR;
         return 0ULL;
     }
-    if (ends_with_ignore_case(con, "ull") ||
-        ends_with_ignore_case(con, "llu"))
+    if (is_unsigned && longs == 2)
     {
         *class = CTC_UNSIGNED_LONG_LONG_INT;
         return full;
     }
-    if (ends_with_ignore_case(con, "ll"))
+    if (longs == 2)
     {
         *class = CTC_LONG_LONG_INT;
         if (radix == 10)
@@ -1862,8 +2036,7 @@ unsigned long long process_integer_constant(char* con, c_type_class_t* class)
         }
         return (long long) full;
     }
-    if (ends_with_ignore_case(con, "ul") ||
-        ends_with_ignore_case(con, "lu"))
+    if (is_unsigned && longs == 1)
     {
         *class = CTC_UNSIGNED_LONG_INT;
         if (full > UNSIGNED_LONG_INT_MAX)
@@ -1873,7 +2046,7 @@ unsigned long long process_integer_constant(char* con, c_type_class_t* class)
         }
         return (long long) full;
     }
-    if (ends_with_ignore_case(con, "l"))
+    if (longs == 1)
     {
         *class = CTC_LONG_INT;
 
@@ -1902,7 +2075,7 @@ unsigned long long process_integer_constant(char* con, c_type_class_t* class)
             return (long long) full;
         return full;
     }
-    if (ends_with_ignore_case(con, "u"))
+    if (is_unsigned)
     {
         *class = CTC_UNSIGNED_INT;
 
@@ -1944,31 +2117,270 @@ unsigned long long process_integer_constant(char* con, c_type_class_t* class)
     return full;
 }
 
-long double process_floating_constant(char* con, c_type_class_t* class)
+// an IEEE 754 binary format that the Eisel-Lemire algorithm can produce
+typedef struct binary_float_format
 {
-    char* end = NULL;
-    long double value = strtold(con, &end);
+    int mantissa_bits;
+    int minimum_exponent;
+    int infinite_power;
+    // below or above these powers of ten, everything is zero or infinity
+    int smallest_power_of_ten;
+    int largest_power_of_ten;
+    // the only powers of ten where a product can land exactly halfway between two floats
+    int min_exponent_round_to_even;
+    int max_exponent_round_to_even;
+    // powers of ten that are exactly representable
+    int max_exponent_fast_path;
+} binary_float_format_t;
+
+static const binary_float_format_t BINARY32_FORMAT = { 23, -127, 0xFF, -65, 38, -17, 10, 10 };
+static const binary_float_format_t BINARY64_FORMAT = { 52, -1023, 0x7FF, -342, 308, -4, 23, 22 };
+
+static const float FLOAT_POWERS_OF_TEN[] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+static const double DOUBLE_POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
 
-    if (end && (streq(end, "f") || streq(end, "F")))
+Eisel-Lemire: computes the bits of the float closest to w * 10^q (w must be nonzero for a nonzero result).
+the product of w and a 128-bit approximation of 5^q always has enough precision to round correctly
+(Mushtak & Lemire, "Fast number parsing without fallback").
+
+*/
+static uint64_t eisel_lemire(int64_t q, uint64_t w, const binary_float_format_t* fmt)
+{
+    uint64_t infinity = (uint64_t) fmt->infinite_power << fmt->mantissa_bits;
+    if (!w || q < fmt->smallest_power_of_ten)
+        return 0;
+    if (q > fmt->largest_power_of_ten)
+        return infinity;
+    int lz = __builtin_clzll(w);
+    w <<= lz;
+
+    int index = 2 * (q - FLOAT_POWER_OF_FIVE_MIN);
+    unsigned __int128 product = (unsigned __int128) w * POWERS_OF_FIVE_128[index];
+    uint64_t high = (uint64_t) (product >> 64);
+    uint64_t low = (uint64_t) product;
+    uint64_t precision_mask = UINT64_MAX >> (fmt->mantissa_bits + 3);
+    // only need the lower half of the power if the bits we keep could still be carried into
+    if ((high & precision_mask) == precision_mask)
     {
-        *class = CTC_FLOAT;
-        return value;
+        uint64_t second = (uint64_t) (((unsigned __int128) w * POWERS_OF_FIVE_128[index + 1]) >> 64);
+        low += second;
+        if (second > low)
+            ++high;
     }
 
-    if (end && (streq(end, "l") || streq(end, "L")))
+    int upperbit = (int) (high >> 63);
+    int shift = upperbit + 64 - fmt->mantissa_bits - 3;
+    uint64_t mantissa = high >> shift;
+    // floor(log2(10^q)) + 63
+    int64_t power2 = ((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz - fmt->minimum_exponent;
+
+    // subnormal
+    if (power2 <= 0)
     {
-        *class = CTC_LONG_DOUBLE;
-        return value;
+        if (-power2 + 1 >= 64)
+            return 0;
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        power2 = mantissa < (1ULL << fmt->mantissa_bits) ? 0 : 1;
+        return ((uint64_t) power2 << fmt->mantissa_bits) | mantissa;
     }
 
-    if (errno == ERANGE || !end || *end)
+    // exactly halfway, round to even instead of up
+    if (low <= 1 && q >= fmt->min_exponent_round_to_even && q <= fmt->max_exponent_round_to_even &&
+        (mantissa & 3) == 1 && (mantissa << shift) == high)
+        mantissa &= ~1ULL;
+
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (2ULL << fmt->mantissa_bits))
     {
-        errno = 0;
-        *class = CTC_ERROR;
+        mantissa = 1ULL << fmt->mantissa_bits;
+        ++power2;
+    }
+    mantissa &= ~(1ULL << fmt->mantissa_bits);
+    if (power2 >= fmt->infinite_power)
+        return infinity;
+    return ((uint64_t) power2 << fmt->mantissa_bits) | mantissa;
+}
+
+/*
+
+parses a decimal floating constant (no suffix) into w * 10^q, returning false if it isn't one.
+only the first 19 significant digits fit into w, *exact is false if a nonzero digit past those was dropped.
+
+*/
+static bool parse_decimal_float(char* con, char** end, uint64_t* w, int64_t* q, bool* exact)
+{
+    uint64_t mantissa = 0;
+    int64_t exponent = 0;
+    int digits = 0;
+    bool truncated = false;
+    char* start = con;
+    // leading zeros leave the mantissa at zero and don't count as digits
+    for (int d; (d = *con - '0') >= 0 && d <= 9; ++con)
+    {
+        if (digits < 19)
+        {
+            mantissa = mantissa * 10 + d;
+            digits += mantissa != 0;
+        }
+        else
+        {
+            truncated |= d != 0;
+            ++exponent;
+        }
+    }
+    bool dot = *con == '.';
+    if (dot)
+    {
+        for (int d; (d = *++con - '0') >= 0 && d <= 9;)
+        {
+            if (digits < 19)
+            {
+                mantissa = mantissa * 10 + d;
+                digits += mantissa != 0;
+                --exponent;
+            }
+            else
+                truncated |= d != 0;
+        }
+    }
+    if (con - start == dot)
+        return false;
+    bool has_exponent = false;
+    if (*con == 'e' || *con == 'E')
+    {
+        ++con;
+        bool negative = false;
+        if (*con == '+' || *con == '-')
+            negative = *con++ == '-';
+        if (*con < '0' || *con > '9')
+            return false;
+        int64_t e = 0;
+        for (; *con >= '0' && *con <= '9'; ++con)
+            if (e < 100000) e = e * 10 + (*con - '0');
+        exponent += negative ? -e : e;
+        has_exponent = true;
+    }
+    // no period or exponent makes it an integer constant
+    if (!dot && !has_exponent)
+        return false;
+    *end = con;
+    *w = mantissa;
+    *q = exponent;
+    *exact = !truncated;
+    return true;
+}
+
+// correctly rounded float/double bits for w * 10^q, false if it can't be decided without the rest of the digits
+static bool decimal_to_binary(uint64_t w, int64_t q, bool exact, const binary_float_format_t* fmt, uint64_t* bits)
+{
+    // Clinger's fast path: w and 10^q are both exact, so one IEEE operation rounds correctly
+    if (exact && q >= -fmt->max_exponent_fast_path && q <= fmt->max_exponent_fast_path &&
+        w <= (2ULL << fmt->mantissa_bits))
+    {
+        if (fmt == &BINARY32_FORMAT)
+        {
+            float f = (float) w;
+            f = q < 0 ? f / FLOAT_POWERS_OF_TEN[-q] : f * FLOAT_POWERS_OF_TEN[q];
+            uint32_t b;
+            memcpy(&b, &f, sizeof b);
+            *bits = b;
+        }
+        else
+        {
+            double d = (double) w;
+            d = q < 0 ? d / DOUBLE_POWERS_OF_TEN[-q] : d * DOUBLE_POWERS_OF_TEN[q];
+            memcpy(bits, &d, sizeof d);
+        }
+        return true;
+    }
+    *bits = eisel_lemire(q, w, fmt);
+    // the real mantissa is somewhere in [w, w + 1), so if both ends round the same way we're good
+    return exact || *bits == eisel_lemire(q, w + 1, fmt);
+}
+
+long double process_floating_constant(char* con, c_type_class_t* class)
+{
+    *class = CTC_ERROR;
+
+    bool hex = con[0] == '0' && (con[1] == 'x' || con[1] == 'X');
+    char* suffix = NULL;
+    uint64_t w = 0, bits = 0;
+    int64_t q = 0;
+    bool exact = false;
+    long double value = 0.0L;
+    if (hex)
+    {
+        // f is a hexadecimal digit too, only being last makes it a suffix
+        suffix = con + strlen(con);
+        char last = suffix[-1];
+        if (last == 'f' || last == 'F' || last == 'l' || last == 'L')
+            --suffix;
+    }
+    // a decimal constant's digits end where its suffix starts
+    else if (!parse_decimal_float(con, &suffix, &w, &q, &exact))
+        return 0.0L;
+
+    c_type_class_t c = CTC_DOUBLE;
+    if (*suffix == 'f' || *suffix == 'F')
+        c = CTC_FLOAT;
+    else if (*suffix == 'l' || *suffix == 'L')
+        c = CTC_LONG_DOUBLE;
+    if (suffix[c != CTC_DOUBLE])
+        return 0.0L;
+    const binary_float_format_t* fmt = c == CTC_FLOAT ? &BINARY32_FORMAT : &BINARY64_FORMAT;
+
+    // hexadecimal floating constants need a binary exponent
+    if (hex && !contains_char(con, 'p') && !contains_char(con, 'P'))
         return 0.0L;
+
+    if (!hex && c != CTC_LONG_DOUBLE && decimal_to_binary(w, q, exact, fmt, &bits))
+    {
+        if (c == CTC_FLOAT)
+        {
+            uint32_t b = bits;
+            float f;
+            memcpy(&f, &b, sizeof f);
+            value = f;
+        }
+        else
+        {
+            double d;
+            memcpy(&d, &bits, sizeof d);
+            value = d;
+        }
+    }
+    else
+    {
+        // slow path: long doubles, hexadecimal constants, and too many digits to decide
+        char* str = substrdup(con, 0, suffix - con - 1);
+        char* str_end = NULL;
+        if (c == CTC_FLOAT)
+            value = strtof(str, &str_end);
+        else if (c == CTC_DOUBLE)
+            value = strtod(str, &str_end);
+        else
+            value = strtold(str, &str_end);
+        bool consumed = str_end && !*str_end;
+        free(str);
+        if (!consumed)
+            return 0.0L;
     }
 
-    *class = CTC_DOUBLE;
+    // ISO: 6.4.4 (2)
+    if (value == value && (value - value) != (value - value))
+        return 0.0L;
+    *class = c;
     return value;
 }
 
@@ -2007,15 +2419,15 @@ unsigned long long evaluate_enumeration_constant(syntax_component_t* enumr)
         offset = orig_idx - idx;
     }
     c_type_class_t c = CTC_ERROR;
-    constexpr_t* ce = constexpr_evaluate_integer(enumr->enumr_expression);
-    if (!constexpr_evaluation_succeeded(ce))
+    constexpr_t ce;
+    constexpr_evaluate_integer(enumr->enumr_expression, &ce);
+    if (!constexpr_evaluation_succeeded(&ce))
     {
-        constexpr_delete(ce);
         assert_fail;
     }
-    c = ce->ct->class;
-    constexpr_convert_class(ce, CTC_INT);
-    int result = constexpr_as_i32(ce);
+    c = ce.ct->class;
+    constexpr_convert_class(&ce, CTC_INT);
+    int result = constexpr_as_i32(&ce);
     if (c == CTC_ERROR)
         assert_fail;
     if ((get_integer_type_conversion_rank(c) > get_integer_type_conversion_rank(CTC_INT)) || c == CTC_UNSIGNED_INT)
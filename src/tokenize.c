@@ -147,11 +147,24 @@ void token_delete_all(token_t* token)
     token_delete(token);
 }
 
+// returns the keyword the identifier spells, -1 if it isn't one
+int keyword_lookup(char* id)
+{
+    size_t length = strlen(id);
+    if (length < KEYWORD_MIN_LENGTH || length > KEYWORD_MAX_LENGTH)
+        return -1;
+    unsigned char* s = (unsigned char*) id;
+    int entry = KEYWORD_HASH_TABLE[KEYWORD_HASH(s[0], s[1], s[length - 1], length)];
+    if (!entry || strcmp(KEYWORDS[entry - 1], id))
+        return -1;
+    return entry - 1;
+}
+
 token_t* tokenize_identifier(preprocessing_token_t* pp_token, tokenizing_settings_t* settings)
 {
     if (!pp_token || pp_token->type != PPT_IDENTIFIER)
         return fail_token("expected identifier");
-    int idx = contains((void**) KEYWORDS, KW_ELEMENTS, pp_token->identifier, (int (*)(void*, void*)) strcmp);
+    int idx = keyword_lookup(pp_token->identifier);
     init_token(idx == -1 ? T_IDENTIFIER : T_KEYWORD);
     if (idx == -1)
         token->identifier = strdup(pp_token->identifier);
@@ -250,6 +263,35 @@ token_t* tokenize_character_constant(preprocessing_token_t* pp_token, tokenizing
     return token;
 }
 
+// tokenizes a single preprocessing token. returns false on failure,
+// otherwise *token is set to the new token (or NULL if the preprocessing token doesn't make one)
+static bool tokenize_one(preprocessing_token_t* pp_token, tokenizing_settings_t* settings, token_t** token)
+{
+    *token = NULL;
+    switch (pp_token->type)
+    {
+        case PPT_IDENTIFIER:
+            *token = tokenize_identifier(pp_token, settings);
+            break;
+        case PPT_PUNCTUATOR:
+            *token = tokenize_punctuator(pp_token, settings);
+            break;
+        case PPT_STRING_LITERAL:
+            *token = tokenize_string_literal(pp_token, settings);
+            break;
+        case PPT_PP_NUMBER:
+            *token = tokenize_pp_number(pp_token, settings);
+            break;
+        case PPT_CHARACTER_CONSTANT:
+            *token = tokenize_character_constant(pp_token, settings);
+            break;
+        // ignore everything else
+        default:
+            return true;
+    }
+    return *token != NULL;
+}
+
 token_t* tokenize_sequence(preprocessing_token_t* pp_tokens, preprocessing_token_t* end, tokenizing_settings_t* settings)
 {
     token_t* head = NULL;
@@ -257,32 +299,13 @@ token_t* tokenize_sequence(preprocessing_token_t* pp_tokens, preprocessing_token
     for (; pp_tokens && pp_tokens != end; pp_tokens = pp_tokens->next)
     {
         token_t* token = NULL;
-        switch (pp_tokens->type)
-        {
-            case PPT_IDENTIFIER:
-                token = tokenize_identifier(pp_tokens, settings);
-                break;
-            case PPT_PUNCTUATOR:
-                token = tokenize_punctuator(pp_tokens, settings);
-                break;
-            case PPT_STRING_LITERAL:
-                token = tokenize_string_literal(pp_tokens, settings);
-                break;
-            case PPT_PP_NUMBER:
-                token = tokenize_pp_number(pp_tokens, settings);
-                break;
-            case PPT_CHARACTER_CONSTANT:
-                token = tokenize_character_constant(pp_tokens, settings);
-                break;
-            // ignore everything else
-            default:
-                continue;
-        }
-        if (!token)
+        if (!tokenize_one(pp_tokens, settings, &token))
         {
             token_delete_all(head);
             return NULL;
         }
+        if (!token)
+            continue;
         if (current)
             current = current->next = token;
         else
@@ -291,8 +314,118 @@ token_t* tokenize_sequence(preprocessing_token_t* pp_tokens, preprocessing_token
     return head;
 }
 
-// translation phase 7 (part I)
-token_t* tokenize(preprocessing_token_t* pp_tokens, tokenizing_settings_t* settings)
+/*
+
+translation phase 7 (part I)
+
+tokens are produced on demand as the parser advances (see token_next), and preprocessing tokens
+are freed as soon as they've been tokenized. the parser releases tokens it can no longer backtrack
+to (see token_stream_release), so only the tokens of the external declaration being parsed are alive.
+
+*/
+struct token_stream
+{
+    // preprocessing tokens not yet tokenized (owned by the stream)
+    preprocessing_token_t* pp_tokens;
+    tokenizing_settings_t* settings;
+    // oldest token that hasn't been released
+    token_t* head;
+    // most recently tokenized token
+    token_t* tail;
+    size_t live;
+    size_t peak;
+    bool failed;
+};
+
+token_stream_t* token_stream_init(preprocessing_token_t* pp_tokens, tokenizing_settings_t* settings)
+{
+    token_stream_t* stream = calloc(1, sizeof *stream);
+    stream->pp_tokens = pp_tokens;
+    stream->settings = settings;
+    if (get_program_options()->iflag)
+        printf("<<tokenizer output>>\n");
+    return stream;
+}
+
+// tokenizes until a token is produced and appends it, returns NULL at the end of the stream or on failure
+static token_t* token_stream_pull(token_stream_t* stream)
+{
+    while (!stream->failed && stream->pp_tokens)
+    {
+        preprocessing_token_t* pp_token = stream->pp_tokens;
+        token_t* token = NULL;
+        stream->failed = !tokenize_one(pp_token, stream->settings, &token);
+        stream->pp_tokens = pp_token->next;
+        if (stream->pp_tokens)
+            stream->pp_tokens->prev = NULL;
+        pp_token_delete(pp_token);
+        if (!token)
+            continue;
+        if (get_program_options()->iflag)
+        {
+            token_print(token, printf);
+            printf("\n");
+        }
+        token->stream = stream;
+        if (stream->tail)
+            stream->tail = stream->tail->next = token;
+        else
+            stream->head = stream->tail = token;
+        if (++stream->live > stream->peak)
+            stream->peak = stream->live;
+        return token;
+    }
+    return NULL;
+}
+
+token_t* token_stream_first(token_stream_t* stream)
+{
+    if (!stream->head)
+        token_stream_pull(stream);
+    return stream->head;
+}
+
+token_t* token_next(token_t* token)
+{
+    if (!token) return NULL;
+    if (!token->next && token->stream)
+        token_stream_pull(token->stream);
+    return token->next;
+}
+
+// frees every token before until (or all of them if until is NULL)
+void token_stream_release(token_stream_t* stream, token_t* until)
+{
+    if (!stream) return;
+    while (stream->head && stream->head != until)
+    {
+        token_t* next = stream->head->next;
+        token_delete(stream->head);
+        --stream->live;
+        stream->head = next;
+    }
+    if (!stream->head)
+        stream->tail = NULL;
+}
+
+// tokenizes (and frees) whatever is left of the stream, returns false if tokenizing failed at any point
+bool token_stream_drain(token_stream_t* stream)
+{
+    while (token_stream_pull(stream))
+        token_stream_release(stream, NULL);
+    return !stream->failed;
+}
+
+// the largest number of tokens alive at once
+size_t token_stream_peak(token_stream_t* stream)
+{
+    return stream->peak;
+}
+
+void token_stream_delete(token_stream_t* stream)
 {
-    return tokenize_sequence(pp_tokens, NULL, settings);
+    if (!stream) return;
+    token_stream_release(stream, NULL);
+    pp_token_delete_all(stream->pp_tokens);
+    free(stream);
 }
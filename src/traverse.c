@@ -4,8 +4,33 @@
 
 #define max(x, y) ((x) > (y) ? (x) : (y))
 
-#define BEFORE trav->before[syn->type] ? trav->before[syn->type](trav, syn) : trav->default_before(trav, syn)
-#define AFTER trav->after[syn->type] ? trav->after[syn->type](trav, syn) : trav->default_after(trav, syn)
+// the passes visiting the tree together in one walk, in the order they visit each node
+typedef struct walk
+{
+    syntax_traverser_t** passes;
+    unsigned count;
+} walk_t;
+
+// the most places any one kind of syntax element keeps its children in
+#define MAX_SLOTS 4
+
+// a place where a syntax element keeps a child (or a vector of them). the walk holds on to the place
+// rather than the child so that it's read only when the walk gets to it, since visitors may still
+// change it while earlier siblings are being visited
+typedef struct slot
+{
+    syntax_component_t** child;
+    vector_t** children;
+} slot_t;
+
+// a syntax element on the path from the root of the walk down to where it currently is. its slots
+// are found again every time it's come back to rather than kept here, which keeps frames small
+typedef struct frame
+{
+    syntax_component_t* syn;
+    unsigned slot; // the slot being walked
+    unsigned element; // the next child to walk within that slot
+} frame_t;
 
 static void no_action(syntax_traverser_t* trav, syntax_component_t* syn) {}
 
@@ -24,40 +49,41 @@ void traverse_delete(syntax_traverser_t* trav)
     free(trav);
 }
 
-#define traverse_vector(trav, v) if (v) { VECTOR_FOR(syntax_component_t*, s, (v)) traverse_syntax(trav, s); }
+#define CHILD(c) slots[n++] = (slot_t) { .child = &(c) }
+#define CHILDREN(v) slots[n++] = (slot_t) { .children = &(v) }
 
-static void traverse_syntax(syntax_traverser_t* trav, syntax_component_t* syn)
+// finds where syn keeps its children, in the order they're walked
+static unsigned syntax_slots(syntax_component_t* syn, slot_t* slots)
 {
-    if (!syn) return;
-    BEFORE;
+    unsigned n = 0;
     switch (syn->type)
     {
         case SC_TRANSLATION_UNIT:
         {
-            traverse_vector(trav, syn->tlu_external_declarations);
+            CHILDREN(syn->tlu_external_declarations);
             break;
         }
         // SC_FUNCTION_DEFINITION - fdef
         case SC_FUNCTION_DEFINITION:
         {
-            traverse_syntax(trav, syn->fdef_body);
-            traverse_vector(trav, syn->fdef_declaration_specifiers);
-            traverse_syntax(trav, syn->fdef_declarator);
-            traverse_vector(trav, syn->fdef_knr_declarations);
+            CHILD(syn->fdef_body);
+            CHILDREN(syn->fdef_declaration_specifiers);
+            CHILD(syn->fdef_declarator);
+            CHILDREN(syn->fdef_knr_declarations);
             break;
         }
         // SC_DECLARATION - decl
         case SC_DECLARATION:
         {
-            traverse_vector(trav, syn->decl_declaration_specifiers);
-            traverse_vector(trav, syn->decl_init_declarators);
+            CHILDREN(syn->decl_declaration_specifiers);
+            CHILDREN(syn->decl_init_declarators);
             break;
         }
         // SC_INIT_DECLARATOR - ideclr
         case SC_INIT_DECLARATOR:
         {
-            traverse_syntax(trav, syn->ideclr_declarator);
-            traverse_syntax(trav, syn->ideclr_initializer);
+            CHILD(syn->ideclr_declarator);
+            CHILD(syn->ideclr_initializer);
             break;
         }
         // SC_STORAGE_CLASS_SPECIFIER - scs
@@ -89,207 +115,207 @@ static void traverse_syntax(syntax_traverser_t* trav, syntax_component_t* syn)
         // SC_STRUCT_UNION_SPECIFIER - sus
         case SC_STRUCT_UNION_SPECIFIER:
         {
-            traverse_syntax(trav, syn->sus_id);
-            traverse_vector(trav, syn->sus_declarations);
+            CHILD(syn->sus_id);
+            CHILDREN(syn->sus_declarations);
             break;
         }
 
         // SC_STRUCT_DECLARATION - sdecl
         case SC_STRUCT_DECLARATION:
         {
-            traverse_vector(trav, syn->sdecl_specifier_qualifier_list);
-            traverse_vector(trav, syn->sdecl_declarators);
+            CHILDREN(syn->sdecl_specifier_qualifier_list);
+            CHILDREN(syn->sdecl_declarators);
             break;
         }
 
         // SC_STRUCT_DECLARATOR - sdeclr
         case SC_STRUCT_DECLARATOR:
         {
-            traverse_syntax(trav, syn->sdeclr_declarator);
-            traverse_syntax(trav, syn->sdeclr_bits_expression);
+            CHILD(syn->sdeclr_declarator);
+            CHILD(syn->sdeclr_bits_expression);
             break;
         }
 
         // SC_ENUM_SPECIFIER - enums
         case SC_ENUM_SPECIFIER:
         {
-            traverse_syntax(trav, syn->enums_id);
-            traverse_vector(trav, syn->enums_enumerators);
+            CHILD(syn->enums_id);
+            CHILDREN(syn->enums_enumerators);
             break;
         }
 
         // SC_ENUMERATOR - enumr
         case SC_ENUMERATOR:
         {
-            traverse_syntax(trav, syn->enumr_expression);
-            traverse_syntax(trav, syn->enumr_constant);
+            CHILD(syn->enumr_expression);
+            CHILD(syn->enumr_constant);
             break;
         }
 
         // SC_DECLARATOR - declr
         case SC_DECLARATOR:
         {
-            traverse_vector(trav, syn->declr_pointers);
-            traverse_syntax(trav, syn->declr_direct);
+            CHILDREN(syn->declr_pointers);
+            CHILD(syn->declr_direct);
             break;
         }
 
         // SC_POINTER - ptr
         case SC_POINTER:
         {
-            traverse_vector(trav, syn->ptr_type_qualifiers);
+            CHILDREN(syn->ptr_type_qualifiers);
             break;
         }
 
         // SC_ARRAY_DECLARATOR - adeclr
         case SC_ARRAY_DECLARATOR:
         {
-            traverse_syntax(trav, syn->adeclr_direct);
-            traverse_syntax(trav, syn->adeclr_length_expression);
-            traverse_vector(trav, syn->adeclr_type_qualifiers);
+            CHILD(syn->adeclr_direct);
+            CHILD(syn->adeclr_length_expression);
+            CHILDREN(syn->adeclr_type_qualifiers);
             break;
         }
 
         // SC_FUNCTION_DECLARATOR - fdeclr
         case SC_FUNCTION_DECLARATOR:
         {
-            traverse_syntax(trav, syn->fdeclr_direct);
-            traverse_vector(trav, syn->fdeclr_knr_identifiers);
-            traverse_vector(trav, syn->fdeclr_parameter_declarations);
+            CHILD(syn->fdeclr_direct);
+            CHILDREN(syn->fdeclr_knr_identifiers);
+            CHILDREN(syn->fdeclr_parameter_declarations);
             break;
         }
 
         // SC_PARAMETER_DECLARATION - pdecl
         case SC_PARAMETER_DECLARATION:
         {
-            traverse_syntax(trav, syn->pdecl_declr);
-            traverse_vector(trav, syn->pdecl_declaration_specifiers);
+            CHILD(syn->pdecl_declr);
+            CHILDREN(syn->pdecl_declaration_specifiers);
             break;
         }
 
         // SC_ABSTRACT_DECLARATOR - abdeclr
         case SC_ABSTRACT_DECLARATOR:
         {
-            traverse_syntax(trav, syn->abdeclr_direct);
-            traverse_vector(trav, syn->abdeclr_pointers);
+            CHILD(syn->abdeclr_direct);
+            CHILDREN(syn->abdeclr_pointers);
             break;
         }
 
         // SC_ABSTRACT_ARRAY_DECLARATOR - abadeclr
         case SC_ABSTRACT_ARRAY_DECLARATOR:
         {
-            traverse_syntax(trav, syn->abadeclr_direct);
-            traverse_syntax(trav, syn->abadeclr_length_expression);
+            CHILD(syn->abadeclr_direct);
+            CHILD(syn->abadeclr_length_expression);
             break;
         }
 
         // SC_ABSTRACT_FUNCTION_DECLARATOR - abfdeclr
         case SC_ABSTRACT_FUNCTION_DECLARATOR:
         {
-            traverse_syntax(trav, syn->abfdeclr_direct);
-            traverse_vector(trav, syn->abfdeclr_parameter_declarations);
+            CHILD(syn->abfdeclr_direct);
+            CHILDREN(syn->abfdeclr_parameter_declarations);
             break;
         }
 
         // SC_LABELED_STATEMENT - lstmt
         case SC_LABELED_STATEMENT:
         {
-            traverse_syntax(trav, syn->lstmt_case_expression);
-            traverse_syntax(trav, syn->lstmt_id);
-            traverse_syntax(trav, syn->lstmt_stmt);
+            CHILD(syn->lstmt_case_expression);
+            CHILD(syn->lstmt_id);
+            CHILD(syn->lstmt_stmt);
             break;
         }
 
         // SC_COMPOUND_STATEMENT - cstmt
         case SC_COMPOUND_STATEMENT:
         {
-            traverse_vector(trav, syn->cstmt_block_items);
+            CHILDREN(syn->cstmt_block_items);
             break;
         }
 
         // SC_EXPRESSION_STATEMENT - estmt
         case SC_EXPRESSION_STATEMENT:
         {
-            traverse_syntax(trav, syn->estmt_expression);
+            CHILD(syn->estmt_expression);
             break;
         }
 
         // SC_IF_STATEMENT - ifstmt
         case SC_IF_STATEMENT:
         {
-            traverse_syntax(trav, syn->ifstmt_condition);
-            traverse_syntax(trav, syn->ifstmt_body);
-            traverse_syntax(trav, syn->ifstmt_else);
+            CHILD(syn->ifstmt_condition);
+            CHILD(syn->ifstmt_body);
+            CHILD(syn->ifstmt_else);
             break;
         }
 
         // SC_SWITCH_STATEMENT - swstmt
         case SC_SWITCH_STATEMENT:
         {
-            traverse_syntax(trav, syn->swstmt_condition);
-            traverse_syntax(trav, syn->swstmt_body);
+            CHILD(syn->swstmt_condition);
+            CHILD(syn->swstmt_body);
             break;
         }
 
         // SC_DO_STATEMENT - dostmt
         case SC_DO_STATEMENT:
         {
-            traverse_syntax(trav, syn->dostmt_condition);
-            traverse_syntax(trav, syn->dostmt_body);
+            CHILD(syn->dostmt_condition);
+            CHILD(syn->dostmt_body);
             break;
         }
 
         // SC_WHILE_STATEMENT - whstmt
         case SC_WHILE_STATEMENT:
         {
-            traverse_syntax(trav, syn->whstmt_condition);
-            traverse_syntax(trav, syn->whstmt_body);
+            CHILD(syn->whstmt_condition);
+            CHILD(syn->whstmt_body);
             break;
         }
 
         // SC_FOR_STATEMENT - forstmt
         case SC_FOR_STATEMENT:
         {
-            traverse_syntax(trav, syn->forstmt_init);
-            traverse_syntax(trav, syn->forstmt_condition);
-            traverse_syntax(trav, syn->forstmt_post);
-            traverse_syntax(trav, syn->forstmt_body);
+            CHILD(syn->forstmt_init);
+            CHILD(syn->forstmt_condition);
+            CHILD(syn->forstmt_post);
+            CHILD(syn->forstmt_body);
             break;
         }
 
         // SC_GOTO_STATEMENT - gtstmt
         case SC_GOTO_STATEMENT:
         {
-            traverse_syntax(trav, syn->gtstmt_label_id);
+            CHILD(syn->gtstmt_label_id);
             break;
         }
 
         // SC_RETURN_STATEMENT - retstmt
         case SC_RETURN_STATEMENT:
         {
-            traverse_syntax(trav, syn->retstmt_expression);
+            CHILD(syn->retstmt_expression);
             break;
         }
 
         // SC_INITIALIZER_LIST - inlist
         case SC_INITIALIZER_LIST:
         {
-            traverse_vector(trav, syn->inlist_designations);
-            traverse_vector(trav, syn->inlist_initializers);
+            CHILDREN(syn->inlist_designations);
+            CHILDREN(syn->inlist_initializers);
             break;
         }
 
         // SC_DESIGNATION - desig
         case SC_DESIGNATION:
         {
-            traverse_vector(trav, syn->desig_designators);
+            CHILDREN(syn->desig_designators);
             break;
         }
 
         // SC_EXPRESSION - expr
         case SC_EXPRESSION:
         {
-            traverse_vector(trav, syn->expr_expressions);
+            CHILDREN(syn->expr_expressions);
             break;
         }
 
@@ -343,25 +369,25 @@ static void traverse_syntax(syntax_traverser_t* trav, syntax_component_t* syn)
         case SC_BITWISE_OR_ASSIGNMENT_EXPRESSION:
         case SC_BITWISE_XOR_ASSIGNMENT_EXPRESSION:
         {
-            traverse_syntax(trav, syn->bexpr_lhs);
-            traverse_syntax(trav, syn->bexpr_rhs);
+            CHILD(syn->bexpr_lhs);
+            CHILD(syn->bexpr_rhs);
             break;
         }
 
         // SC_CONDITIONAL_EXPRESSION - cexpr
         case SC_CONDITIONAL_EXPRESSION:
         {
-            traverse_syntax(trav, syn->cexpr_condition);
-            traverse_syntax(trav, syn->cexpr_if);
-            traverse_syntax(trav, syn->cexpr_else);
+            CHILD(syn->cexpr_condition);
+            CHILD(syn->cexpr_if);
+            CHILD(syn->cexpr_else);
             break;
         }
 
         // SC_CAST_EXPRESSION - caexpr
         case SC_CAST_EXPRESSION:
         {
-            traverse_syntax(trav, syn->caexpr_type_name);
-            traverse_syntax(trav, syn->caexpr_operand);
+            CHILD(syn->caexpr_type_name);
+            CHILD(syn->caexpr_operand);
             break;
         }
 
@@ -392,46 +418,46 @@ static void traverse_syntax(syntax_traverser_t* trav, syntax_component_t* syn)
         case SC_POSTFIX_INCREMENT_EXPRESSION:
         case SC_POSTFIX_DECREMENT_EXPRESSION:
         {
-            traverse_syntax(trav, syn->uexpr_operand);
+            CHILD(syn->uexpr_operand);
             break;
         }
 
         // SC_COMPOUND_LITERAL - inlexpr
         case SC_COMPOUND_LITERAL:
         {
-            traverse_syntax(trav, syn->cl_type_name);
-            traverse_syntax(trav, syn->cl_inlist);
+            CHILD(syn->cl_type_name);
+            CHILD(syn->cl_inlist);
             break;
         }
 
         // SC_FUNCTION_CALL_EXPRESSION - fcallexpr
         case SC_FUNCTION_CALL_EXPRESSION:
         {
-            traverse_syntax(trav, syn->fcallexpr_expression);
-            traverse_vector(trav, syn->fcallexpr_args);
+            CHILD(syn->fcallexpr_expression);
+            CHILDREN(syn->fcallexpr_args);
             break;
         }
 
         // SC_INTRINSIC_CALL_EXPRESSION - fcallexpr
         case SC_INTRINSIC_CALL_EXPRESSION:
         {
-            traverse_vector(trav, syn->icallexpr_args);
+            CHILDREN(syn->icallexpr_args);
             break;
         }
 
         // SC_SUBSCRIPT_EXPRESSION - subsexpr
         case SC_SUBSCRIPT_EXPRESSION:
         {
-            traverse_syntax(trav, syn->subsexpr_expression);
-            traverse_syntax(trav, syn->subsexpr_index_expression);
+            CHILD(syn->subsexpr_expression);
+            CHILD(syn->subsexpr_index_expression);
             break;
         }
 
         // SC_TYPE_NAME - tn
         case SC_TYPE_NAME:
         {
-            traverse_vector(trav, syn->tn_specifier_qualifier_list);
-            traverse_syntax(trav, syn->tn_declarator);
+            CHILDREN(syn->tn_specifier_qualifier_list);
+            CHILD(syn->tn_declarator);
             break;
         }
 
@@ -441,18 +467,170 @@ static void traverse_syntax(syntax_traverser_t* trav, syntax_component_t* syn)
         case SC_DEREFERENCE_MEMBER_EXPRESSION:
         case SC_MEMBER_EXPRESSION:
         {
-            traverse_syntax(trav, syn->memexpr_expression);
-            traverse_syntax(trav, syn->memexpr_id);
+            CHILD(syn->memexpr_expression);
+            CHILD(syn->memexpr_id);
             break;
         }
 
         default:
             break;
     }
-    AFTER;
+    return n;
+}
+
+#undef CHILD
+#undef CHILDREN
+
+static void visit(walk_t* walk, syntax_component_t* syn, bool before)
+{
+    for (unsigned p = 0; p < walk->count; ++p)
+    {
+        syntax_traverser_t* trav = walk->passes[p];
+        if (before)
+            trav->before[syn->type] ? trav->before[syn->type](trav, syn) : trav->default_before(trav, syn);
+        else
+            trav->after[syn->type] ? trav->after[syn->type](trav, syn) : trav->default_after(trav, syn);
+    }
+}
+
+// moves a frame on to its next child, if it has any left
+static syntax_component_t* frame_next_child(frame_t* f)
+{
+    slot_t slots[MAX_SLOTS];
+    unsigned noslots = syntax_slots(f->syn, slots);
+    for (; f->slot < noslots; ++f->slot, f->element = 0)
+    {
+        slot_t* s = &slots[f->slot];
+        vector_t* v = s->children ? *s->children : NULL;
+        unsigned count = s->child ? 1 : (v ? v->size : 0);
+        while (f->element < count)
+        {
+            unsigned e = f->element++;
+            syntax_component_t* child = s->child ? *s->child : v->data[e];
+            if (!child)
+                continue;
+            // the walk comes back for the next sibling once it's done with this child, so start loading it now
+            if (v && f->element < count)
+                __builtin_prefetch(v->data[f->element]);
+            else if (f->slot + 1 < noslots && slots[f->slot + 1].child)
+                __builtin_prefetch(*slots[f->slot + 1].child);
+            return child;
+        }
+    }
+    return NULL;
+}
+
+/*
+
+walks the tree depth-first, calling the before visitors of a syntax element before walking its
+children and the after visitors once they're all done, just like recursing into every child would.
+the path down from the root is kept on a stack of frames on the heap instead of the call stack,
+so there's no limit on how deep the tree can be.
+
+*/
+static void traverse_syntax(walk_t* walk, syntax_component_t* root)
+{
+    if (!root) return;
+    unsigned capacity = 64;
+    frame_t* stack = malloc(capacity * sizeof *stack);
+    unsigned depth = 0;
+    for (syntax_component_t* syn = root; syn;)
+    {
+        visit(walk, syn, true);
+        if (depth == capacity)
+            stack = realloc(stack, (capacity <<= 1) * sizeof *stack);
+        frame_t* f = &stack[depth++];
+        f->syn = syn;
+        f->slot = 0;
+        f->element = 0;
+        // go back up until something still has a child to walk
+        while (!(syn = frame_next_child(f)))
+        {
+            visit(walk, f->syn, false);
+            if (!--depth)
+                break;
+            f = &stack[depth - 1];
+        }
+    }
+    free(stack);
 }
 
 void traverse(syntax_traverser_t* trav)
 {
-    traverse_syntax(trav, trav->tlu);
+    walk_t walk = { .passes = &trav, .count = 1 };
+    traverse_syntax(&walk, trav->tlu);
+}
+
+/*
+
+a traversal schedule runs several passes over the same tree in as few walks as it can.
+
+every pass is given the walk it runs in when it's added: passes that only need other passes to have
+visited a node before they do (TD_NODE) share a walk with them and visit every node right after them,
+while passes that need others to be done with the whole tree first (TD_TREE) are pushed to a later walk.
+a pass can only depend on passes added before it, so adding order is always a valid visiting order.
+
+*/
+
+traversal_schedule_t* traversal_schedule_init(syntax_component_t* root)
+{
+    traversal_schedule_t* ts = calloc(1, sizeof *ts);
+    ts->root = root;
+    ts->passes = vector_init();
+    ts->walks = vector_init();
+    return ts;
+}
+
+// does NOT free the passes
+void traversal_schedule_delete(traversal_schedule_t* ts)
+{
+    if (!ts) return;
+    vector_delete(ts->passes);
+    vector_delete(ts->walks);
+    free(ts);
+}
+
+void traversal_schedule_add(traversal_schedule_t* ts, syntax_traverser_t* trav)
+{
+    vector_add(ts->passes, trav);
+    vector_add(ts->walks, (void*) 0);
+}
+
+static int traversal_schedule_find(traversal_schedule_t* ts, syntax_traverser_t* trav)
+{
+    VECTOR_FOR(syntax_traverser_t*, pass, ts->passes)
+    {
+        if (pass == trav)
+            return i;
+    }
+    return -1;
+}
+
+void traversal_schedule_depend(traversal_schedule_t* ts, syntax_traverser_t* trav, syntax_traverser_t* on, traversal_dependency_t dependency)
+{
+    int t = traversal_schedule_find(ts, trav);
+    int o = traversal_schedule_find(ts, on);
+    if (t == -1 || o == -1 || o >= t) assert_fail;
+    uint64_t walk = (uint64_t) vector_get(ts->walks, o) + (dependency == TD_TREE);
+    if (walk > (uint64_t) vector_get(ts->walks, t))
+        ts->walks->data[t] = (void*) walk;
+}
+
+void traversal_schedule_run(traversal_schedule_t* ts)
+{
+    syntax_traverser_t** passes = calloc(ts->passes->size, sizeof *passes);
+    unsigned done = 0;
+    for (uint64_t w = 0; done < ts->passes->size; ++w)
+    {
+        walk_t walk = { .passes = passes, .count = 0 };
+        VECTOR_FOR(syntax_traverser_t*, trav, ts->passes)
+        {
+            if ((uint64_t) vector_get(ts->walks, i) == w)
+                passes[walk.count++] = trav;
+        }
+        if (walk.count)
+            traverse_syntax(&walk, ts->root);
+        done += walk.count;
+    }
+    free(passes);
 }
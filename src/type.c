@@ -12,6 +12,10 @@ how types work (mainly so i don't forget):
     the same instance of the struct/union/enum type will be used each time it is needed or used in a derived data structure.
  - in the same manner, type_delete will NOT delete any structs, unions, or enums. these data structures must be deleted with symbol_type_delete, which
     should only be used by the symbol table (because the symbols in the symbol table are the only owners of these types)
+ - canonical types (see type_canonical) are owned by the type table of the translation unit and shared by everything using an identical type,
+    so they must never be modified. type_delete leaves them alone, and type_copy makes an ordinary copy of them that the caller may change.
+    type_share hands back the canonical type itself, for holders that never change the types they keep.
+    the types of expressions are interned as soon as each expression is analyzed, and AIR generation and everything after it use canonical types.
 
 */
 
@@ -62,12 +66,23 @@ c_type_t* type_copy(c_type_t* ct)
     return nct;
 }
 
+// like type_copy, but canonical types are shared instead of copied
+c_type_t* type_share(c_type_t* ct)
+{
+    if (ct && ct->canonical)
+        return ct;
+    return type_copy(ct);
+}
+
 bool type_is_compatible(c_type_t* t1, c_type_t* t2)
 {
     if (!t1 && !t2) return true;
     if (!t1) return false;
     if (!t2) return false;
     if (t1 == t2) return true;
+    // two different canonical types are never compatible unless one of them can be completed or composed
+    if (t1->exact && t2->exact)
+        return false;
     if (t1->class != t2->class)
         return false;
     if (t1->qualifiers != t2->qualifiers)
@@ -101,22 +116,19 @@ bool type_is_compatible(c_type_t* t1, c_type_t* t2)
                     if (!bitexpr1 || !bitexpr2)
                         return false;
 
-                    constexpr_t* ce1 = constexpr_evaluate_integer(bitexpr1);
-                    constexpr_t* ce2 = constexpr_evaluate_integer(bitexpr2);
-                    if (!constexpr_evaluation_succeeded(ce1) || !constexpr_evaluation_succeeded(ce2))
+                    constexpr_t ce1, ce2;
+                    constexpr_evaluate_integer(bitexpr1, &ce1);
+                    constexpr_evaluate_integer(bitexpr2, &ce2);
+                    if (!constexpr_evaluation_succeeded(&ce1) || !constexpr_evaluation_succeeded(&ce2))
                     {
-                        constexpr_delete(ce1);
-                        constexpr_delete(ce2);
                         return false;
                     }
-                    constexpr_convert_class(ce1, CTC_LONG_LONG_INT);
-                    constexpr_convert_class(ce2, CTC_LONG_LONG_INT);
+                    constexpr_convert_class(&ce1, CTC_LONG_LONG_INT);
+                    constexpr_convert_class(&ce2, CTC_LONG_LONG_INT);
 
-                    int64_t v1 = constexpr_as_i64(ce1);
-                    int64_t v2 = constexpr_as_i64(ce2);
+                    int64_t v1 = constexpr_as_i64(&ce1);
+                    int64_t v2 = constexpr_as_i64(&ce2);
 
-                    constexpr_delete(ce1);
-                    constexpr_delete(ce2);
 
                     if (v1 != v2)
                         return false;
@@ -153,22 +165,19 @@ bool type_is_compatible(c_type_t* t1, c_type_t* t2)
                         continue;
                     if (!bitexpr1 || !bitexpr2)
                         return false;
-                    constexpr_t* ce1 = constexpr_evaluate_integer(bitexpr1);
-                    constexpr_t* ce2 = constexpr_evaluate_integer(bitexpr2);
-                    if (!constexpr_evaluation_succeeded(ce1) || !constexpr_evaluation_succeeded(ce2))
+                    constexpr_t ce1, ce2;
+                    constexpr_evaluate_integer(bitexpr1, &ce1);
+                    constexpr_evaluate_integer(bitexpr2, &ce2);
+                    if (!constexpr_evaluation_succeeded(&ce1) || !constexpr_evaluation_succeeded(&ce2))
                     {
-                        constexpr_delete(ce1);
-                        constexpr_delete(ce2);
                         return false;
                     }
-                    constexpr_convert_class(ce1, CTC_LONG_LONG_INT);
-                    constexpr_convert_class(ce2, CTC_LONG_LONG_INT);
+                    constexpr_convert_class(&ce1, CTC_LONG_LONG_INT);
+                    constexpr_convert_class(&ce2, CTC_LONG_LONG_INT);
 
-                    int64_t v1 = constexpr_as_i64(ce1);
-                    int64_t v2 = constexpr_as_i64(ce2);
+                    int64_t v1 = constexpr_as_i64(&ce1);
+                    int64_t v2 = constexpr_as_i64(&ce2);
 
-                    constexpr_delete(ce1);
-                    constexpr_delete(ce2);
 
                     if (v1 != v2)
                         return false;
@@ -273,15 +282,26 @@ c_type_t* type_compose(c_type_t* t1, c_type_t* t2)
     return composed ? composed : type_copy(t1);
 }
 
+static bool type_node_equals(c_type_t* t1, c_type_t* t2);
+
 bool type_is_compatible_ignore_qualifiers(c_type_t* t1, c_type_t* t2)
 {
-    c_type_t* nq1 = type_copy(t1);
-    c_type_t* nq2 = type_copy(t2);
-    nq1->qualifiers = nq2->qualifiers = 0;
-    bool result = type_is_compatible(nq1, nq2);
-    type_delete(nq1);
-    type_delete(nq2);
-    return result;
+    if (!t1 || !t2 || t1->qualifiers == t2->qualifiers)
+        return type_is_compatible(t1, t2);
+    // exact canonical types are only compatible with themselves, so they only have to match apart from their qualifiers
+    if (t1->exact && t2->exact)
+    {
+        c_type_t requalified = *t2;
+        requalified.qualifiers = t1->qualifiers;
+        return type_node_equals(t1, &requalified);
+    }
+    // compare unqualified stand-ins that share everything else with the originals
+    c_type_t nq1 = *t1;
+    c_type_t nq2 = *t2;
+    nq1.qualifiers = nq2.qualifiers = 0;
+    nq1.canonical = nq2.canonical = false;
+    nq1.exact = nq2.exact = false;
+    return type_is_compatible(&nq1, &nq2);
 }
 
 unsigned char qualifiers_to_bitfield(vector_t* quals)
@@ -509,10 +529,7 @@ bool type_is_character(c_type_t* ct)
 bool type_is_wchar_compatible(c_type_t* ct)
 {
     if (!ct) return false;
-    c_type_t* wcharct = make_basic_type(C_TYPE_WCHAR_T);
-    bool c = type_is_compatible(ct, wcharct);
-    type_delete(wcharct);
-    return c;
+    return type_is_compatible(ct, type_basic(C_TYPE_WCHAR_T));
 }
 
 bool type_is_vla(c_type_t* ct)
@@ -541,15 +558,14 @@ int64_t type_get_array_length(c_type_t* ct)
         return ct->array.length;
     if (!ct->array.length_expression)
         return -1;
-    constexpr_t* ce = constexpr_evaluate_integer(ct->array.length_expression);
-    if (!constexpr_evaluation_succeeded(ce))
+    constexpr_t ce;
+    constexpr_evaluate_integer(ct->array.length_expression, &ce);
+    if (!constexpr_evaluation_succeeded(&ce))
     {
-        constexpr_delete(ce);
         return -1;
     }
-    constexpr_convert_class(ce, CTC_LONG_LONG_INT);
-    ct->array.length = constexpr_as_i64(ce);
-    constexpr_delete(ce);
+    constexpr_convert_class(&ce, CTC_LONG_LONG_INT);
+    ct->array.length = constexpr_as_i64(&ce);
     return ct->array.length;
 }
 
@@ -568,15 +584,14 @@ int64_t type_get_member_bitfield_length(c_type_t* ct, size_t index)
     }
     if (ct->struct_union.member_bitfield_lengths[index] != -1)
         return ct->struct_union.member_bitfield_lengths[index];
-    constexpr_t* ce = constexpr_evaluate_integer(bitfield);
-    if (!constexpr_evaluation_succeeded(ce))
+    constexpr_t ce;
+    constexpr_evaluate_integer(bitfield, &ce);
+    if (!constexpr_evaluation_succeeded(&ce))
     {
-        constexpr_delete(ce);
         return -1;
     }
-    constexpr_convert_class(ce, CTC_LONG_LONG_INT);
-    ct->struct_union.member_bitfield_lengths[index] = constexpr_as_i64(ce);
-    constexpr_delete(ce);
+    constexpr_convert_class(&ce, CTC_LONG_LONG_INT);
+    ct->struct_union.member_bitfield_lengths[index] = constexpr_as_i64(&ce);
     return ct->struct_union.member_bitfield_lengths[index];
 }
 
@@ -602,9 +617,12 @@ c_type_t* default_argument_promotions(c_type_t* ct)
 c_type_t* strip_qualifiers(c_type_t* ct)
 {
     if (!ct) return NULL;
-    ct->qualifiers = 0;
-    for (c_type_t* d = ct->derived_from; d; d = d->derived_from)
+    for (c_type_t* d = ct; d; d = d->derived_from)
+    {
+        if (d->canonical)
+            assert_fail;
         d->qualifiers = 0;
+    }
     return ct;
 }
 
@@ -769,28 +787,111 @@ c_type_t* usual_arithmetic_conversions_result_type(c_type_t* t1, c_type_t* t2)
     return conv_t2;
 }
 
-void type_get_struct_union_member_info(c_type_t* ct, char* name, long long* index, int64_t* offset)
+static void struct_layout_delete(struct_layout_t* layout)
 {
-    if (index) *index = -1;
-    if (offset) *offset = 0;
-    if (!ct) return;
-    if (ct->class != CTC_STRUCTURE && ct->class != CTC_UNION) return;
-    VECTOR_FOR(c_type_t*, mt, ct->struct_union.member_types)
+    if (!layout) return;
+    free(layout->offsets);
+    free(layout->index);
+    free(layout);
+}
+
+// finds the slot in the member name index that holds name, or the empty slot where it would go
+static unsigned struct_layout_slot(struct_layout_t* layout, vector_t* names, char* name)
+{
+    unsigned mask = layout->capacity - 1;
+    unsigned i = hash(name) & mask;
+    for (; layout->index[i] != -1; i = (i + 1) & mask)
     {
-        char* mn = vector_get(ct->struct_union.member_names, i);
-        if (streq(mn, name))
+        if (streq(vector_get(names, layout->index[i]), name))
+            break;
+    }
+    return i;
+}
+
+static struct_layout_t* struct_layout_init(c_type_t* ct)
+{
+    vector_t* names = ct->struct_union.member_names;
+    vector_t* types = ct->struct_union.member_types;
+    struct_layout_t* layout = calloc(1, sizeof *layout);
+    layout->count = types->size;
+    layout->offsets = calloc(types->size + 1, sizeof(int64_t));
+    layout->settled = true;
+
+    // keep the index at most half full, and on a repeated name keep the first member like a scan would
+    for (layout->capacity = 8; layout->capacity < 2 * names->size; layout->capacity <<= 1);
+    layout->index = malloc(layout->capacity * sizeof(int));
+    for (unsigned i = 0; i < layout->capacity; ++i)
+        layout->index[i] = -1;
+    VECTOR_FOR(char*, name, names)
+    {
+        unsigned slot = struct_layout_slot(layout, names, name);
+        if (layout->index[slot] == -1)
+            layout->index[slot] = i;
+    }
+
+    long long size = 0;
+    long long alignment = -1;
+    bool incomplete = false;
+    VECTOR_FOR(c_type_t*, mt, types)
+    {
+        long long msize = type_size(mt);
+        long long ma = type_alignment(mt);
+        if (ma > alignment)
+            alignment = ma;
+        if (msize == -1)
         {
-            if (index) *index = i;
-            return;
+            // a flexible array member is the only member allowed to have an unknown size, and it never gets one.
+            // anything else might just not be known yet (e.g., an array length that can't be evaluated so far)
+            bool flexible = i == types->size - 1 && mt->class == CTC_ARRAY;
+            if (!flexible)
+                incomplete = true;
+            if (!flexible || mt->array.length_expression)
+                layout->settled = false;
         }
-        if (offset)
+        if (ct->class == CTC_UNION)
         {
-            long long size = type_size(mt);
-            long long alignment = type_alignment(mt);
-            *offset += (alignment - (*offset % alignment)) % alignment;
-            *offset += size != -1 ? size : 0;
+            // every member of a union starts at its beginning
+            if (msize > size)
+                size = msize;
+            continue;
         }
+        if (ma > 0)
+            size += (ma - (size % ma)) % ma;
+        layout->offsets[i] = size;
+        size += msize != -1 ? msize : 0;
     }
+    if (alignment > 0)
+        size += (alignment - (size % alignment)) % alignment;
+    layout->size = ct->class == CTC_STRUCTURE && incomplete ? -1 : size;
+    layout->alignment = alignment;
+    return layout;
+}
+
+// gets the layout of a complete struct or union type, which is made on first use and kept on the type.
+// returns NULL for anything else
+struct_layout_t* type_get_struct_union_layout(c_type_t* ct)
+{
+    if (!ct) return NULL;
+    if (ct->class != CTC_STRUCTURE && ct->class != CTC_UNION) return NULL;
+    if (!ct->struct_union.member_types || !ct->struct_union.member_names) return NULL;
+    struct_layout_t* layout = ct->struct_union.layout;
+    // a layout made while members were still being added or while some member's size was unknown is redone
+    if (layout && layout->settled && layout->count == ct->struct_union.member_types->size)
+        return layout;
+    struct_layout_delete(layout);
+    return ct->struct_union.layout = struct_layout_init(ct);
+}
+
+void type_get_struct_union_member_info(c_type_t* ct, char* name, long long* index, int64_t* offset)
+{
+    if (index) *index = -1;
+    if (offset) *offset = 0;
+    struct_layout_t* layout = type_get_struct_union_layout(ct);
+    if (!layout || !name) return;
+    int i = layout->index[struct_layout_slot(layout, ct->struct_union.member_names, name)];
+    if (i == -1) return;
+    if (index) *index = i;
+    if (offset) *offset = layout->offsets[i];
 }
 
 bool type_has_flexible_array_member(c_type_t* ct)
@@ -837,14 +938,8 @@ long long type_alignment(c_type_t* ct)
         case CTC_STRUCTURE:
         case CTC_UNION:
         {
-            long long mma = -1;
-            VECTOR_FOR(c_type_t*, mt, ct->struct_union.member_types)
-            {
-                long long ma = type_alignment(mt);
-                if (ma > mma)
-                    mma = ma;
-            }
-            return mma;
+            struct_layout_t* layout = type_get_struct_union_layout(ct);
+            return layout ? layout->alignment : -1;
         }
         case CTC_VOID:
         case CTC_ERROR:
@@ -900,51 +995,10 @@ long long type_size(c_type_t* ct)
             return length * dsize;
         }
         case CTC_STRUCTURE:
-        {
-            long long size = 0;
-            long long mma = -1;
-            // int64_t max_bitfield_length = -1;
-            VECTOR_FOR(c_type_t*, mct, ct->struct_union.member_types)
-            {
-                // int64_t bitfield_length = type_get_member_bitfield_length(ct, i);
-                // if (bitfield_length != -1)
-                // {
-                //     if (max_bitfield_length == -1)
-                //         max_bitfield_length = bitfield_length;
-                //     else
-                //         max_bitfield_length += bitfield_length;
-                // }
-                // else if (max_bitfield_length != -1)
-                // {
-                    
-                //     max_bitfield_length = -1;
-                // }
-                long long msize = type_size(mct);
-                long long ma = type_alignment(mct);
-                if (ma > mma)
-                    mma = ma;
-                if (msize == -1)
-                {
-                    // flexible array member
-                    if (i == ct->struct_union.member_types->size - 1 && mct->class == CTC_ARRAY)
-                        continue;
-                    return -1;
-                }
-                size += (ma - (size % ma)) % ma;
-                size += msize;
-            }
-            return size + (mma - (size % mma)) % mma;
-        }
         case CTC_UNION:
         {
-            long long size = 0;
-            VECTOR_FOR(c_type_t*, mct, ct->struct_union.member_types)
-            {
-                long long msize = type_size(mct);
-                if (msize > size)
-                    size = msize;
-            }
-            return size;
+            struct_layout_t* layout = type_get_struct_union_layout(ct);
+            return layout ? layout->size : -1;
         }
         case CTC_VOID:
         case CTC_ERROR:
@@ -1016,7 +1070,7 @@ void type_humanized_print(c_type_t* ct, int (*printer)(const char*, ...))
 
 static void type_delete_internal(c_type_t* ct, bool ignore_owned)
 {
-    if (!ct) return;
+    if (!ct || ct->canonical) return;
     if (ignore_owned && (ct->class == CTC_STRUCTURE || ct->class == CTC_UNION || ct->class == CTC_ENUMERATED))
         return;
     type_delete_internal(ct->derived_from, ignore_owned);
@@ -1029,6 +1083,7 @@ static void type_delete_internal(c_type_t* ct, bool ignore_owned)
             vector_deep_delete(ct->struct_union.member_names, free);
             vector_delete(ct->struct_union.member_bitfields);
             free(ct->struct_union.member_bitfield_lengths);
+            struct_layout_delete(ct->struct_union.layout);
             break;
         case CTC_FUNCTION:
             vector_deep_delete(ct->function.param_types, (void (*)(void*)) type_delete);
@@ -1053,6 +1108,218 @@ void symbol_type_delete(c_type_t* ct)
     type_delete_internal(ct, false);
 }
 
+static bool type_class_is_basic(c_type_class_t class)
+{
+    return class != CTC_ENUMERATED &&
+        class != CTC_ARRAY &&
+        class != CTC_STRUCTURE &&
+        class != CTC_UNION &&
+        class != CTC_FUNCTION &&
+        class != CTC_POINTER;
+}
+
+// the canonical basic types, indexed by class and then by qualifiers. they don't depend on anything in a translation unit,
+// so every type table hands out these same ones, and so do constant expressions (which may not have a translation unit)
+static c_type_t basic_types[(CTC_ERROR + 1) * (TQ_B_ALL + 1)];
+
+static c_type_t* basic_type(c_type_class_t class, unsigned char qualifiers)
+{
+    c_type_t* ct = &basic_types[class * (TQ_B_ALL + 1) + qualifiers];
+    if (!ct->canonical)
+    {
+        ct->class = class;
+        ct->qualifiers = qualifiers;
+        ct->canonical = true;
+        ct->exact = type_class_is_basic(class);
+    }
+    return ct;
+}
+
+// the canonical unqualified type of the given class, the same one type_canonical gives for it
+c_type_t* type_basic(c_type_class_t class)
+{
+    return basic_type(class, 0);
+}
+
+type_table_t* type_table_init(void)
+{
+    type_table_t* tt = calloc(1, sizeof *tt);
+    tt->capacity = 256;
+    tt->types = calloc(tt->capacity, sizeof(c_type_t*));
+    return tt;
+}
+
+void type_table_delete(type_table_t* tt)
+{
+    if (!tt) return;
+    for (unsigned i = 0; i < tt->capacity; ++i)
+    {
+        c_type_t* ct = tt->types[i];
+        if (!ct)
+            continue;
+        if (ct->class == CTC_FUNCTION)
+            vector_delete(ct->function.param_types);
+        free(ct);
+    }
+    free(tt->types);
+    free(tt);
+}
+
+// hashes the fields of a type that has canonical types for everything it is derived from
+static unsigned long type_node_hash(c_type_t* ct)
+{
+    unsigned long h = ((unsigned long) ct->class << 16) ^ ((unsigned long) ct->qualifiers << 8) ^ ct->function_specifiers;
+    h = h * 31 + (uintptr_t) ct->derived_from;
+    switch (ct->class)
+    {
+        case CTC_ARRAY:
+            h = h * 31 + (ct->array.length_expression ? (uintptr_t) ct->array.length_expression : ct->array.length);
+            h = h * 31 + ct->array.unspecified_size;
+            break;
+        case CTC_FUNCTION:
+            h = h * 31 + (ct->function.param_types != NULL) + 2 * ct->function.variadic;
+            if (ct->function.param_types)
+            {
+                VECTOR_FOR(c_type_t*, pt, ct->function.param_types)
+                    h = h * 31 + (uintptr_t) pt;
+            }
+            break;
+        default:
+            break;
+    }
+    return h ^ (h >> 29);
+}
+
+static bool type_node_equals(c_type_t* t1, c_type_t* t2)
+{
+    if (t1->class != t2->class ||
+        t1->qualifiers != t2->qualifiers ||
+        t1->function_specifiers != t2->function_specifiers ||
+        t1->derived_from != t2->derived_from)
+        return false;
+    switch (t1->class)
+    {
+        case CTC_ARRAY:
+            if (t1->array.length_expression || t2->array.length_expression)
+                return t1->array.length_expression == t2->array.length_expression;
+            return t1->array.length == t2->array.length && t1->array.unspecified_size == t2->array.unspecified_size;
+        case CTC_FUNCTION:
+            if (t1->function.variadic != t2->function.variadic)
+                return false;
+            if (!t1->function.param_types || !t2->function.param_types)
+                return t1->function.param_types == t2->function.param_types;
+            if (t1->function.param_types->size != t2->function.param_types->size)
+                return false;
+            return !memcmp(t1->function.param_types->data, t2->function.param_types->data, t1->function.param_types->size * sizeof(void*));
+        default:
+            return true;
+    }
+}
+
+static c_type_t** type_table_slot(type_table_t* tt, c_type_t* ct)
+{
+    unsigned mask = tt->capacity - 1;
+    unsigned i = type_node_hash(ct) & mask;
+    for (; tt->types[i] && !type_node_equals(tt->types[i], ct); i = (i + 1) & mask);
+    return &tt->types[i];
+}
+
+// gets the canonical type identical to the given one, interning it if it is the first of its kind.
+// the given type is left alone and still belongs to the caller.
+c_type_t* type_canonical(type_table_t* tt, c_type_t* ct)
+{
+    if (!ct || ct->canonical)
+        return ct;
+    // structs, unions, and enums are unique already
+    if (ct->class == CTC_STRUCTURE || ct->class == CTC_UNION || ct->class == CTC_ENUMERATED)
+        return ct;
+    if (type_class_is_basic(ct->class) && !ct->function_specifiers && !(ct->qualifiers & ~TQ_B_ALL))
+        return basic_type(ct->class, ct->qualifiers);
+
+    c_type_t key = { 0 };
+    key.class = ct->class;
+    key.qualifiers = ct->qualifiers;
+    key.function_specifiers = ct->function_specifiers;
+    key.derived_from = type_canonical(tt, ct->derived_from);
+    if (ct->class == CTC_ARRAY)
+    {
+        key.array.length_expression = ct->array.length_expression;
+        key.array.length = ct->array.length;
+        key.array.unspecified_size = ct->array.unspecified_size;
+    }
+    else if (ct->class == CTC_FUNCTION)
+    {
+        key.function.variadic = ct->function.variadic;
+        if (ct->function.param_types)
+        {
+            key.function.param_types = vector_init();
+            VECTOR_FOR(c_type_t*, pt, ct->function.param_types)
+                vector_add(key.function.param_types, type_canonical(tt, pt));
+        }
+    }
+
+    c_type_t** slot = type_table_slot(tt, &key);
+    if (*slot)
+    {
+        if (key.class == CTC_FUNCTION)
+            vector_delete(key.function.param_types);
+        return *slot;
+    }
+
+    c_type_t* nct = malloc(sizeof *nct);
+    *nct = key;
+    nct->canonical = true;
+    // arrays and functions without prototypes are compatible with types other than themselves,
+    // and so is anything derived from them or from a struct, union, or enum
+    nct->exact = !nct->function_specifiers && nct->derived_from && nct->derived_from->exact;
+    if (nct->class == CTC_ARRAY || (nct->class == CTC_FUNCTION && !nct->function.param_types))
+        nct->exact = false;
+    if (nct->exact && nct->class == CTC_FUNCTION)
+    {
+        VECTOR_FOR(c_type_t*, pt, nct->function.param_types)
+            nct->exact = nct->exact && pt->exact;
+    }
+    *slot = nct;
+    if (++(tt->size) * 2 > tt->capacity)
+    {
+        c_type_t** old = tt->types;
+        unsigned old_capacity = tt->capacity;
+        tt->capacity *= 2;
+        tt->types = calloc(tt->capacity, sizeof(c_type_t*));
+        for (unsigned i = 0; i < old_capacity; ++i)
+            if (old[i])
+                *type_table_slot(tt, old[i]) = old[i];
+        free(old);
+    }
+    return nct;
+}
+
+// the canonical counterpart of the given type without its qualifiers.
+// structs, unions, and enums aren't interned and are given back as they are.
+c_type_t* type_canonical_unqualified(type_table_t* tt, c_type_t* ct)
+{
+    if (!ct || !ct->qualifiers || ct->class == CTC_STRUCTURE || ct->class == CTC_UNION || ct->class == CTC_ENUMERATED)
+        return type_canonical(tt, ct);
+    c_type_t nq = *ct;
+    nq.qualifiers = 0;
+    nq.canonical = nq.exact = false;
+    return type_canonical(tt, &nq);
+}
+
+c_type_t* type_canonical_basic(type_table_t* tt, c_type_class_t class)
+{
+    c_type_t ct = { .class = class };
+    return type_canonical(tt, &ct);
+}
+
+// the canonical counterpart of make_reference_type
+c_type_t* type_canonical_reference(type_table_t* tt, c_type_t* ct)
+{
+    if (!ct) return NULL;
+    c_type_t ref = { .class = CTC_POINTER, .derived_from = ct->class != CTC_ARRAY ? ct : ct->derived_from };
+    return type_canonical(tt, &ref);
+}
+
 #define ADD_ERROR(syn, fmt, ...) errors = error_list_add(errors, error_init(syn, false, fmt, ## __VA_ARGS__ ))
 #define ADD_WARNING(syn, fmt, ...) errors = error_list_add(errors, error_init(syn, true, fmt, ## __VA_ARGS__ ))
 
@@ -65,10 +65,11 @@ char* substrdup(const char* str, size_t start, size_t end)
 {
     if (start > end)
         return NULL;
-    size_t length = end - start;
+    // end is inclusive
+    size_t length = end - start + 1;
     char* dup = malloc(length + 1);
+    strncpy(dup, str + start, length);
     dup[length] = '\0';
-    strncpy(dup, str + start, length + 1);
     return dup;
 }
 
@@ -28,6 +28,30 @@ vector_t* vector_add(vector_t* v, void* el)
     return v;
 }
 
+// inserts the element at the index, moving everything from there on back by one
+vector_t* vector_insert(vector_t* v, unsigned index, void* el)
+{
+    if (index >= v->size)
+        return vector_add(v, el);
+    if (v->size >= v->capacity)
+        vector_resize(v, v->capacity + (v->capacity / 2));
+    memmove(v->data + index + 1, v->data + index, (v->size - index) * sizeof(void*));
+    v->data[index] = el;
+    ++(v->size);
+    return v;
+}
+
+// removes the element at the index, moving everything after it up by one
+void* vector_remove(vector_t* v, unsigned index)
+{
+    if (index >= v->size)
+        return NULL;
+    void* el = v->data[index];
+    memmove(v->data + index, v->data + index + 1, (v->size - index - 1) * sizeof(void*));
+    --(v->size);
+    return el;
+}
+
 void* vector_pop(vector_t* v)
 {
     if (v->size == 0)
@@ -147,7 +147,7 @@ void x86_insn_delete_all(x86_insn_t* insns)
 void x86_asm_data_delete(x86_asm_data_t* data)
 {
     if (!data) return;
-    free(data->data);
+    image_delete(data->image);
     vector_deep_delete(data->addresses, (deleter_t) x86_asm_init_address_delete);
     free(data->label);
     free(data);
@@ -267,6 +267,8 @@ bool x86_insn_uses_suffix(x86_insn_t* insn)
         case X86I_SKIP:
         case X86I_SETA:
         case X86I_SETNB:
+        case X86I_SETB:
+        case X86I_SETBE:
         case X86I_SETP:
         case X86I_SETNP:
         case X86I_CVTTSD2SI:
@@ -347,6 +349,8 @@ uint8_t x86_insn_writes(x86_insn_t* insn)
         case X86I_SETG:
         case X86I_SETA:
         case X86I_SETNB:
+        case X86I_SETB:
+        case X86I_SETBE:
         case X86I_SETP:
         case X86I_SETNP:
         case X86I_NOT:
@@ -573,6 +577,16 @@ void x86_write_insn(x86_insn_t* insn, FILE* file)
             x86_write_operand(insn->op1, X86SZ_BYTE, file);
             break;
 
+        case X86I_SETB:
+            fprintf(file, INDENT "setb ");
+            x86_write_operand(insn->op1, X86SZ_BYTE, file);
+            break;
+
+        case X86I_SETBE:
+            fprintf(file, INDENT "setbe ");
+            x86_write_operand(insn->op1, X86SZ_BYTE, file);
+            break;
+
         case X86I_SETP:
             fprintf(file, INDENT "setp ");
             x86_write_operand(insn->op1, X86SZ_BYTE, file);
@@ -691,19 +705,28 @@ void x86_write_insn(x86_insn_t* insn, FILE* file)
     fprintf(file, "\n");
 }
 
+// data with nothing but zeros in it (and no addresses) can go in .bss and take no space in the object file
+static bool x86_data_is_zero(x86_asm_data_t* data)
+{
+    return !data->addresses->size && image_is_zero(data->image);
+}
+
 void x86_write_data(x86_asm_data_t* data, FILE* out)
 {
     fprintf(out, "    .align %lu\n", data->alignment);
     fprintf(out, "%s:\n", data->label);
-    for (size_t i = 0, j = 0; i < data->length;)
+    image_t* im = data->image;
+    for (uint64_t i = 0, j = 0, k = 0; i < im->size;)
     {
-        if (data->addresses && j < data->addresses->size)
+        uint64_t stop = im->size;
+        if (j < data->addresses->size)
         {
             x86_asm_init_address_t* ia = vector_get(data->addresses, j);
             if (i == ia->data_location)
             {
                 ++j;
-                int64_t offset = *((int64_t*) (data->data + ia->data_location));
+                int64_t offset;
+                image_read(im, ia->data_location, &offset, POINTER_WIDTH);
                 if (ia->label)
                 {
                     if (offset != 0)
@@ -716,15 +739,37 @@ void x86_write_data(x86_asm_data_t* data, FILE* out)
                 i += POINTER_WIDTH;
                 continue;
             }
+            if (ia->data_location < i)
+            {
+                ++j;
+                continue;
+            }
+            stop = ia->data_location;
         }
-        if (i + UNSIGNED_LONG_LONG_INT_WIDTH <= data->length)
-            fprintf(out, "    .quad 0x%llX\n", *((unsigned long long*) (data->data + i))), i += UNSIGNED_LONG_LONG_INT_WIDTH;
-        else if (i + UNSIGNED_INT_WIDTH <= data->length)
-            fprintf(out, "    .long 0x%X\n", *((unsigned*) (data->data + i))), i += UNSIGNED_INT_WIDTH;
-        else if (i + UNSIGNED_SHORT_INT_WIDTH <= data->length)
-            fprintf(out, "    .word 0x%X\n", *((unsigned short*) (data->data + i))), i += UNSIGNED_SHORT_INT_WIDTH;
+
+        // the zeros up to the next run (or address) are emitted all at once
+        for (; k < im->noruns && im->runs[k].offset + im->runs[k].length <= i; ++k);
+        image_run_t* run = k < im->noruns ? &im->runs[k] : NULL;
+        if (!run || run->offset > i)
+        {
+            if (run && run->offset < stop)
+                stop = run->offset;
+            fprintf(out, "    .zero %llu\n", (unsigned long long) (stop - i));
+            i = stop;
+            continue;
+        }
+
+        if (run->offset + run->length < stop)
+            stop = run->offset + run->length;
+        uint8_t* bytes = run->bytes + (i - run->offset);
+        if (i + UNSIGNED_LONG_LONG_INT_WIDTH <= stop)
+            fprintf(out, "    .quad 0x%llX\n", *((unsigned long long*) bytes)), i += UNSIGNED_LONG_LONG_INT_WIDTH;
+        else if (i + UNSIGNED_INT_WIDTH <= stop)
+            fprintf(out, "    .long 0x%X\n", *((unsigned*) bytes)), i += UNSIGNED_INT_WIDTH;
+        else if (i + UNSIGNED_SHORT_INT_WIDTH <= stop)
+            fprintf(out, "    .word 0x%X\n", *((unsigned short*) bytes)), i += UNSIGNED_SHORT_INT_WIDTH;
         else
-            fprintf(out, "    .byte 0x%X\n", *((unsigned char*) (data->data + i))), i += UNSIGNED_CHAR_WIDTH;
+            fprintf(out, "    .byte 0x%X\n", *bytes), i += UNSIGNED_CHAR_WIDTH;
     }
 }
 
@@ -847,10 +892,25 @@ void x86_write_routine(x86_asm_routine_t* routine, FILE* out)
 
 void x86_asm_file_write(x86_asm_file_t* file, FILE* out)
 {
-    if (file->data->size)
-        fprintf(out, "    .data\n");
+    size_t nobss = 0;
     VECTOR_FOR(x86_asm_data_t*, data, file->data)
-        x86_write_data(data, out);
+        nobss += x86_data_is_zero(data);
+    if (file->data->size > nobss)
+        fprintf(out, "    .data\n");
+    for (unsigned i = 0; i < file->data->size; ++i)
+    {
+        x86_asm_data_t* data = vector_get(file->data, i);
+        if (!x86_data_is_zero(data))
+            x86_write_data(data, out);
+    }
+    if (nobss)
+        fprintf(out, "    .bss\n");
+    for (unsigned i = 0; i < file->data->size; ++i)
+    {
+        x86_asm_data_t* data = vector_get(file->data, i);
+        if (x86_data_is_zero(data))
+            x86_write_data(data, out);
+    }
     if (file->rodata->size)
         fprintf(out, "    .section .rodata\n");
     VECTOR_FOR(x86_asm_data_t*, rodata, file->rodata)
@@ -1238,15 +1298,11 @@ static symbol_t* x86_64_get_sse_zero_checker(c_type_class_t class, x86_asm_file_
     x86_asm_data_t* data = calloc(1, sizeof *data);
     data->readonly = true;
     data->alignment = 16;
-    data->length = 16;
-    data->data = malloc(data->length);
+    data->image = image_init(16);
+    data->addresses = vector_init();
     data->label = strdup(checker->name);
-    unsigned long long* uint64_data = (unsigned long long*) data->data;
-    if (is_float)
-        uint64_data[0] = 0x7FFFFFFF;
-    else
-        uint64_data[0] = 0x7FFFFFFFFFFFFFFF;
-    uint64_data[1] = 0;
+    unsigned long long mask = is_float ? 0x7FFFFFFF : 0x7FFFFFFFFFFFFFFF;
+    image_write(data->image, 0, &mask, UNSIGNED_LONG_LONG_INT_WIDTH);
     vector_add(file->rodata, data);
     return checker;
 }
@@ -1449,6 +1505,7 @@ x86_insn_t* x86_generate_relational_equality_operator(air_insn_t* ainsn, x86_asm
     if (!opt) assert_fail;
 
     bool opt_sse = type_is_sse_floating(opt);
+    bool opt_unsigned = type_is_unsigned_integer(opt) || opt->class == CTC_POINTER;
 
     x86_insn_type_t type = X86I_UNKNOWN;
     switch (ainsn->type)
@@ -1459,7 +1516,7 @@ x86_insn_t* x86_generate_relational_equality_operator(air_insn_t* ainsn, x86_asm
                 type = X86I_SETNB;
                 break;
             }
-            type = X86I_SETLE;
+            type = opt_unsigned ? X86I_SETBE : X86I_SETLE;
             break;
         case AIR_LESS: 
             if (opt_sse)
@@ -1467,7 +1524,7 @@ x86_insn_t* x86_generate_relational_equality_operator(air_insn_t* ainsn, x86_asm
                 type = X86I_SETA;
                 break;
             }
-            type = X86I_SETL;
+            type = opt_unsigned ? X86I_SETB : X86I_SETL;
             break;
         case AIR_GREATER_EQUAL:
             if (opt_sse)
@@ -1475,7 +1532,7 @@ x86_insn_t* x86_generate_relational_equality_operator(air_insn_t* ainsn, x86_asm
                 type = X86I_SETNB;
                 break;
             }
-            type = X86I_SETGE;
+            type = opt_unsigned ? X86I_SETNB : X86I_SETGE;
             break;
         case AIR_GREATER:
             if (opt_sse)
@@ -1483,7 +1540,7 @@ x86_insn_t* x86_generate_relational_equality_operator(air_insn_t* ainsn, x86_asm
                 type = X86I_SETA;
                 break;
             }
-            type = X86I_SETG;
+            type = opt_unsigned ? X86I_SETA : X86I_SETG;
             break;
         case AIR_EQUAL:
             type = X86I_SETE;
@@ -1504,7 +1561,8 @@ x86_insn_t* x86_generate_relational_equality_operator(air_insn_t* ainsn, x86_asm
         // TODO: support long doubles and complex numbers
         assert_fail;
 
-    cmp->size = c_type_to_x86_operand_size(ainsn->ct);
+    // integers and pointers are compared at their own width
+    cmp->size = c_type_to_x86_operand_size(opt_sse ? ainsn->ct : opt);
 
     // flip operands for SSE <= and <
     if (opt_sse && (ainsn->type == AIR_LESS_EQUAL || ainsn->type == AIR_LESS))
@@ -1811,19 +1869,22 @@ static symbol_t* x86_64_get_sse_i64_limit(c_type_class_t class, x86_asm_file_t*
     x86_asm_data_t* data = calloc(1, sizeof *data);
     data->readonly = true;
     data->label = strdup(limit->name);
+    data->addresses = vector_init();
     if (is_float)
     {
+        float value = 9223372036854775808.0f;
         limit->type = make_basic_type(CTC_FLOAT);
-        data->alignment = data->length = FLOAT_WIDTH;
-        data->data = malloc(data->length);
-        *((float*) (data->data)) = 9223372036854775808.0f;
+        data->alignment = FLOAT_WIDTH;
+        data->image = image_init(FLOAT_WIDTH);
+        image_write(data->image, 0, &value, FLOAT_WIDTH);
     }
     else
     {
+        double value = 9223372036854775808.0;
         limit->type = make_basic_type(CTC_DOUBLE);
-        data->alignment = data->length = DOUBLE_WIDTH;
-        data->data = malloc(data->length);
-        *((double*) (data->data)) = 9223372036854775808.0;
+        data->alignment = DOUBLE_WIDTH;
+        data->image = image_init(DOUBLE_WIDTH);
+        image_write(data->image, 0, &value, DOUBLE_WIDTH);
     }
     vector_add(file->rodata, data);
     return limit;
@@ -2266,11 +2327,7 @@ x86_asm_data_t* x86_generate_data(air_data_t* adata, x86_asm_file_t* file)
 {
     x86_asm_data_t* data = calloc(1, sizeof *data);
     data->alignment = type_alignment(adata->sy->type);
-    long long size = type_size(adata->sy->type);
-    if (size == -1)
-        assert_fail;
-    data->data = malloc(size);
-    memcpy(data->data, adata->data, size);
+    data->image = image_copy(adata->image);
     data->addresses = vector_init();
     if (adata->addresses)
     {
@@ -2288,7 +2345,6 @@ x86_asm_data_t* x86_generate_data(air_data_t* adata, x86_asm_file_t* file)
             vector_add(data->addresses, aia);
         }
     }
-    data->length = size;
     if (x86_symbol_requires_disambiguation(adata->sy))
         data->label = symbol_get_disambiguated_name(adata->sy);
     else
@@ -0,0 +1,75 @@
+    .section .rodata
+    .align 1
+__sl1:
+    .quad 0x275D305B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA272748
+    .byte 0x0
+    .align 1
+__sl2:
+    .quad 0x275D315B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA272765
+    .byte 0x0
+    .align 1
+__sl3:
+    .quad 0x28666F657A697327
+    .quad 0x6F68732027297378
+    .quad 0x6175716520646C75
+    .quad 0xA27303227206C
+    .align 1
+__sl4:
+    .quad 0x28666F657A697327
+    .quad 0x6F68732027297378
+    .quad 0x20746F6E20646C75
+    .quad 0x3827206C61757165
+    .word 0xA27
+    .byte 0x0
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $64, %rsp
+    movq $8583909746840200520, %rax
+    movq %rax, -54(%rbp)
+    movl $1684828783, -46(%rbp)
+    movw $33, -42(%rbp)
+    leaq -54(%rbp), %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $72, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    leaq -54(%rbp), %rax
+    movl $1, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $101, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    jmp .LS3
+.LS3:
+    jmp .LS4
+.LS4:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
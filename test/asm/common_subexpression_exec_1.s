@@ -0,0 +1,444 @@
+    .bss
+    .align 4
+g:
+    .zero 4
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x5F65726F66656227
+    .quad 0x332868636E617262
+    .quad 0x272931202C34202C
+    .quad 0x20646C756F687320
+    .quad 0x3327206C61757165
+    .long 0xA2739
+    .align 1
+__sl1:
+    .quad 0x5F65726F66656227
+    .quad 0x332868636E617262
+    .quad 0x272930202C34202C
+    .quad 0x20646C756F687320
+    .quad 0x3327206C61757165
+    .long 0xA2737
+    .align 1
+__sl2:
+    .quad 0x686361655F6E6927
+    .quad 0x202C36286D72615F
+    .quad 0x7320272931202C33
+    .quad 0x716520646C756F68
+    .quad 0x27303227206C6175
+    .word 0xA
+    .align 1
+__sl3:
+    .quad 0x686361655F6E6927
+    .quad 0x202C36286D72615F
+    .quad 0x7320272930202C33
+    .quad 0x716520646C756F68
+    .quad 0x27303327206C6175
+    .word 0xA
+    .align 1
+__sl4:
+    .quad 0x6574756D6D6F6327
+    .quad 0x272937202C362864
+    .quad 0x20646C756F687320
+    .quad 0x3127206C61757165
+    .long 0xA273936
+    .byte 0x0
+    .align 1
+__sl5:
+    .quad 0x6D6F635F746F6E27
+    .quad 0x2C3528646574756D
+    .quad 0x6F68732027293220
+    .quad 0x6175716520646C75
+    .quad 0xA2730373227206C
+    .byte 0x0
+    .align 1
+__sl6:
+    .quad 0x775F6C61636F6C27
+    .quad 0x625F6E6574746972
+    .quad 0x31286E6565777465
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0x31313227
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl7:
+    .quad 0x745F65726F747327
+    .quad 0x6F5F6867756F7268
+    .quad 0x696F705F72656874
+    .quad 0x2C7626287265746E
+    .quad 0x6873202729762620
+    .quad 0x75716520646C756F
+    .quad 0xA27393427206C61
+    .byte 0x0
+    .align 1
+__sl8:
+    .quad 0x65625F6C6C616327
+    .quad 0x2729286E65657774
+    .quad 0x20646C756F687320
+    .quad 0x3227206C61757165
+    .long 0xA2736
+    .text
+set_g:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    leaq g(%rip), %rdi
+    movl -4(%rbp), %eax
+    movl %eax, (%rdi)
+    leave
+    ret
+before_branch:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    movl %edx, -12(%rbp)
+    movl -4(%rbp), %eax
+    movl -8(%rbp), %edi
+    imull %edi, %eax
+    movl $7, %edi
+    addl %edi, %eax
+    movl -12(%rbp), %edi
+    cmpl $0, %edi
+    je .LS1
+    leaq -20(%rbp), %rdi
+    movl $1, %edx
+    movl %eax, %esi
+    addl %edx, %esi
+    movl %esi, (%rdi)
+    jmp .LS2
+.LS1:
+    leaq -20(%rbp), %rdi
+    movl $1, %esi
+    subl %esi, %eax
+    movl %eax, (%rdi)
+.LS2:
+    movl -20(%rbp), %eax
+    movl -4(%rbp), %edi
+    movl -8(%rbp), %esi
+    imull %esi, %edi
+    movl $7, %esi
+    addl %esi, %edi
+    addl %edi, %eax
+    movl %eax, %edi
+    movl %edi, %eax
+    leave
+    ret
+in_each_arm:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    movl %edx, -12(%rbp)
+    movl -12(%rbp), %esi
+    cmpl $0, %esi
+    je .LS3
+    leaq -16(%rbp), %rdx
+    movl -4(%rbp), %esi
+    movl -8(%rbp), %eax
+    xorl %eax, %esi
+    movl $3, %eax
+    imull %eax, %esi
+    movl %esi, (%rdx)
+    jmp .LS4
+.LS3:
+    leaq -16(%rbp), %rsi
+    movl -4(%rbp), %edx
+    movl -8(%rbp), %eax
+    xorl %eax, %edx
+    movl $5, %eax
+    imull %eax, %edx
+    movl %edx, (%rsi)
+.LS4:
+    movl -16(%rbp), %esi
+    movl -4(%rbp), %edx
+    movl -8(%rbp), %eax
+    xorl %eax, %edx
+    addl %edx, %esi
+    movl %esi, %eax
+    leave
+    ret
+commuted:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    movl -4(%rbp), %eax
+    movl -8(%rbp), %edi
+    movl %eax, %esi
+    imull %edi, %esi
+    subl %esi, %esi
+    addl %edi, %eax
+    imull %eax, %eax
+    addl %eax, %esi
+    movl %esi, %edi
+    movl %edi, %eax
+    leave
+    ret
+not_commuted:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    pushq %rbx
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    movl -4(%rbp), %edi
+    movl -8(%rbp), %esi
+    movl %edi, %eax
+    subl %esi, %eax
+    movl $100, %ecx
+    imull %ecx, %eax
+    movl %eax, %ecx
+    movl %esi, %eax
+    subl %edi, %eax
+    movl $10, %edx
+    imull %edx, %eax
+    addl %eax, %ecx
+    movl %ecx, %edx
+    movl %esi, %ecx
+    movl %edi, %eax
+    shll %cl, %eax
+    movl %edi, %ecx
+    shll %cl, %esi
+    movl %esi, %edi
+    cmpl %edi, %eax
+    sete %al
+    andq $1, %rax
+    addl %eax, %edx
+    movl %edx, %edi
+    movl %edi, %eax
+    popq %rbx
+    leave
+    ret
+local_written_between:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    pushq %rbx
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %edi
+    movl %edi, -8(%rbp)
+    movl -8(%rbp), %edi
+    movl $1, %eax
+    addl %eax, %edi
+    movl %edi, -12(%rbp)
+    leaq -8(%rbp), %rdi
+    movl $10, %eax
+    movl %eax, (%rdi)
+    movl -8(%rbp), %edi
+    movl $1, %eax
+    addl %eax, %edi
+    movl %edi, -16(%rbp)
+    movl -12(%rbp), %edi
+    movl $100, %eax
+    imull %eax, %edi
+    movl -16(%rbp), %eax
+    addl %eax, %edi
+    movl %edi, %eax
+    popq %rbx
+    leave
+    ret
+store_through_other_pointer:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    pushq %rbx
+    movq %rdi, -8(%rbp)
+    movq %rsi, -16(%rbp)
+    movq -8(%rbp), %rax
+    movl (%rax), %eax
+    movl %eax, -20(%rbp)
+    movq -16(%rbp), %rax
+    movl $9, %edi
+    movl %edi, (%rax)
+    movl -20(%rbp), %eax
+    movl $10, %edi
+    imull %edi, %eax
+    movq -8(%rbp), %rdi
+    movl (%rdi), %edi
+    addl %edi, %eax
+    movl %eax, %edi
+    movl %edi, %eax
+    popq %rbx
+    leave
+    ret
+call_between:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    pushq %rbx
+    leaq g(%rip), %rax
+    movl $1, %edi
+    movl %edi, (%rax)
+    movl g(%rip), %eax
+    movl $1, %edi
+    addl %edi, %eax
+    movl %eax, -4(%rbp)
+    movl $5, %eax
+    movl %eax, %edi
+    call set_g
+    movl -4(%rbp), %eax
+    movl $10, %edi
+    imull %edi, %eax
+    movl g(%rip), %edi
+    movl $1, %esi
+    addl %esi, %edi
+    addl %edi, %eax
+    movl %eax, %edi
+    movl %edi, %eax
+    popq %rbx
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl $3, %eax
+    movl $4, %edi
+    movl $1, %esi
+    movl %esi, %edx
+    movl %edi, %esi
+    movl %eax, %edi
+    call before_branch
+    movl $39, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS5
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS5:
+    movl $3, %eax
+    movl $4, %edi
+    xorl %esi, %esi
+    movl %esi, %edx
+    movl %edi, %esi
+    movl %eax, %edi
+    call before_branch
+    movl $37, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS6
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS6:
+    movl $6, %eax
+    movl $3, %edi
+    movl $1, %esi
+    movl %esi, %edx
+    movl %edi, %esi
+    movl %eax, %edi
+    call in_each_arm
+    movl $20, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS7
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS7:
+    movl $6, %eax
+    movl $3, %edi
+    xorl %esi, %esi
+    movl %esi, %edx
+    movl %edi, %esi
+    movl %eax, %edi
+    call in_each_arm
+    movl $30, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS8
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS8:
+    movl $6, %eax
+    movl $7, %edi
+    movl %edi, %esi
+    movl %eax, %edi
+    call commuted
+    movl $169, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS9
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS9:
+    movl $5, %eax
+    movl $2, %edi
+    movl %edi, %esi
+    movl %eax, %edi
+    call not_commuted
+    movl $270, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS10
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS10:
+    movl $1, %eax
+    movl %eax, %edi
+    call local_written_between
+    movl $211, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS11
+    leaq __sl6(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS11:
+    movl $4, %eax
+    movl %eax, -4(%rbp)
+    leaq -4(%rbp), %rax
+    leaq -4(%rbp), %rdi
+    movq %rdi, %rsi
+    movq %rax, %rdi
+    call store_through_other_pointer
+    movl $49, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS12
+    leaq __sl7(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS12:
+    call call_between
+    movl $26, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS13
+    leaq __sl8(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS13:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
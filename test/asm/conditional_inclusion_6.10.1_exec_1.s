@@ -0,0 +1,52 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x7320276165726127
+    .quad 0x716520646C756F68
+    .quad 0x27323127206C6175
+    .word 0xA
+    .align 1
+__sl1:
+    .quad 0x276E65736F686327
+    .quad 0x20646C756F687320
+    .quad 0x3327206C61757165
+    .word 0xA27
+    .byte 0x0
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    leaq -4(%rbp), %rax
+    movl $12, %edi
+    movl %edi, (%rax)
+    movl -4(%rbp), %eax
+    movl $12, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    leaq -8(%rbp), %rax
+    movl $3, %edi
+    movl %edi, (%rax)
+    movl -8(%rbp), %eax
+    movl $3, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
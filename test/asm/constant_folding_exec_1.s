@@ -0,0 +1,406 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x69655F656D617327
+    .quad 0x7961775F72656874
+    .quad 0x2729293028646928
+    .quad 0x20646C756F687320
+    .quad 0x3427206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl1:
+    .quad 0x69655F656D617327
+    .quad 0x7961775F72656874
+    .quad 0x2729293128646928
+    .quad 0x20646C756F687320
+    .quad 0x3427206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl2:
+    .quad 0x6572656666696427
+    .quad 0x5F686361655F746E
+    .quad 0x3028646928796177
+    .quad 0x756F687320272929
+    .quad 0x6C6175716520646C
+    .long 0x27352720
+    .word 0xA
+    .align 1
+__sl3:
+    .quad 0x6572656666696427
+    .quad 0x5F686361655F746E
+    .quad 0x3128646928796177
+    .quad 0x756F687320272929
+    .quad 0x6C6175716520646C
+    .long 0x27342720
+    .word 0xA
+    .align 1
+__sl4:
+    .quad 0x7961775F656E6F27
+    .quad 0x272928796C6E6F5F
+    .quad 0x20646C756F687320
+    .quad 0x3727206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl5:
+    .quad 0x635F74726F687327
+    .quad 0x6928746975637269
+    .quad 0x7320272929312864
+    .quad 0x716520646C756F68
+    .quad 0xA273127206C6175
+    .byte 0x0
+    .align 1
+__sl6:
+    .quad 0x6F665F7466656C27
+    .quad 0x69745F6E75725F72
+    .quad 0x293028646928656D
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0xA273227
+    .byte 0x0
+    .align 1
+__sl7:
+    .quad 0x65776F7272616E27
+    .quad 0x6F68732027292864
+    .quad 0x6175716520646C75
+    .long 0x3127206C
+    .word 0xA27
+    .byte 0x0
+    .align 4
+__fc0:
+    .long 0x3F800000
+    .align 4
+__fc1:
+    .long 0x40400000
+    .align 4
+__fc2:
+    .long 0x40400000
+    .align 1
+__sl8:
+    .quad 0x2027647269687427
+    .quad 0x6520646C756F6873
+    .quad 0x6E6F27206C617571
+    .quad 0x66302E33202F2065
+    .word 0xA27
+    .byte 0x0
+    .align 4
+__fold0:
+    .long 0x3EAAAAAB
+    .text
+id:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+same_either_way:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %eax
+    cmpl $0, %eax
+    je .LE1
+    jmp .LE2
+.LE1:
+.LE2:
+    movl $4, %edi
+    movl %edi, %eax
+    leave
+    ret
+different_each_way:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %eax
+    cmpl $0, %eax
+    je .LE3
+    movl $4, %edi
+    jmp .LE4
+.LE3:
+    movl $5, %edi
+.LE4:
+    movl %edi, %eax
+    leave
+    ret
+one_way_only:
+    pushq %rbp
+    movq %rsp, %rbp
+    jmp .LE5
+.LE5:
+.LE6:
+    movl $7, %edi
+    movl %edi, %eax
+    leave
+    ret
+short_circuit:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %eax
+    cmpl $0, %eax
+    je .LE7
+    jmp .LE7
+.LE7:
+.LE8:
+    jmp .LE9
+.LE9:
+.LE10:
+    jmp .LE11
+.LE11:
+.LE12:
+    movl $1, %edi
+    movl %edi, %eax
+    leave
+    ret
+left_for_run_time:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %eax
+    cmpl $0, %eax
+    je .LE13
+    movl $1, %edi
+    xorl %esi, %esi
+    movl %edi, %eax
+    xorl %edx, %edx
+    idivl %esi
+    movl %eax, %edi
+    movl $2147483648, %esi
+    movl $4294967295, %ecx
+    movl %esi, %eax
+    xorl %edx, %edx
+    idivl %ecx
+    addl %eax, %edi
+    movl %edi, %esi
+    jmp .LE14
+.LE13:
+    movl $2, %esi
+.LE14:
+    movl %esi, %eax
+    leave
+    ret
+narrowed:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl $300, %eax
+    movb %al, -1(%rbp)
+    movl $128, %eax
+    movb %al, -2(%rbp)
+    movl $4294967295, %eax
+    movl %eax, -8(%rbp)
+    movq $2147483648, %rax
+    movq %rax, -16(%rbp)
+    movb -1(%rbp), %al
+    movl $44, %edi
+    movzx %al, %eax
+    cmpl %edi, %eax
+    sete %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LE15
+    movb -2(%rbp), %al
+    movl $4294967168, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    sete %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LE15
+    movl $1, %eax
+    jmp .LE16
+.LE15:
+    xorl %eax, %eax
+.LE16:
+    cmpl $0, %eax
+    je .LE17
+    movl -8(%rbp), %eax
+    movl $4294967295, %edi
+    cmpl %edi, %eax
+    sete %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LE17
+    movl $1, %eax
+    jmp .LE18
+.LE17:
+    xorl %eax, %eax
+.LE18:
+    cmpl $0, %eax
+    je .LE19
+    movq -16(%rbp), %rax
+    movq $2147483648, %rdi
+    cmpq %rdi, %rax
+    sete %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LE19
+    movl $1, %eax
+    jmp .LE20
+.LE19:
+    xorl %eax, %eax
+.LE20:
+    cmpl $0, %eax
+    je .LE21
+    movl $1, %edi
+    jmp .LE22
+.LE21:
+    xorl %edi, %edi
+.LE22:
+    movl %edi, %eax
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    xorl %eax, %eax
+    movl %eax, %edi
+    call id
+    movl %eax, %edi
+    call same_either_way
+    movl $4, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS23
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS23:
+    movl $1, %eax
+    movl %eax, %edi
+    call id
+    movl %eax, %edi
+    call same_either_way
+    movl $4, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS24
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS24:
+    xorl %eax, %eax
+    movl %eax, %edi
+    call id
+    movl %eax, %edi
+    call different_each_way
+    movl $5, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS25
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS25:
+    movl $1, %eax
+    movl %eax, %edi
+    call id
+    movl %eax, %edi
+    call different_each_way
+    movl $4, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS26
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS26:
+    call one_way_only
+    movl $7, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS27
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS27:
+    movl $1, %eax
+    movl %eax, %edi
+    call id
+    movl %eax, %edi
+    call short_circuit
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS28
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS28:
+    xorl %eax, %eax
+    movl %eax, %edi
+    call id
+    movl %eax, %edi
+    call left_for_run_time
+    movl $2, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS29
+    leaq __sl6(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS29:
+    call narrowed
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS30
+    leaq __sl7(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS30:
+    movss __fold0(%rip), %xmm0
+    movss %xmm0, -4(%rbp)
+    movl $1, %eax
+    movl %eax, %edi
+    call id
+    cvtsi2ssl %eax, %xmm0
+    movss %xmm0, -8(%rbp)
+    movss -4(%rbp), %xmm0
+    movss -8(%rbp), %xmm1
+    movss __fc2(%rip), %xmm2
+    divss %xmm2, %xmm1
+    ucomiss %xmm1, %xmm0
+    setp %al
+    ucomiss %xmm1, %xmm0
+    je .LGEN1
+    movl $1, %eax
+.LGEN1:
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS31
+    leaq __sl8(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS31:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
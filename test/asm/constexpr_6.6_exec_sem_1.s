@@ -0,0 +1,949 @@
+    .data
+    .align 4
+v1:
+    .long 0x5
+    .align 4
+v3:
+    .long 0x61
+    .align 4
+v4:
+    .long 0x5
+    .align 4
+v5:
+    .long 0xC
+    .align 4
+v6:
+    .long 0xFFFFFFF1
+    .align 4
+v7:
+    .long 0x3
+    .align 4
+v8:
+    .long 0x5
+    .align 4
+v9:
+    .long 0x10
+    .align 4
+v10:
+    .long 0x4
+    .align 4
+v12:
+    .long 0xFFFFFFFE
+    .align 4
+v13:
+    .long 0x5
+    .align 4
+v14:
+    .long 0x7
+    .align 4
+v15:
+    .long 0x6
+    .align 4
+v16:
+    .long 0x8
+    .align 4
+v17:
+    .long 0x1
+    .align 4
+v19:
+    .long 0x1
+    .align 4
+v20:
+    .long 0x1
+    .align 4
+v21:
+    .long 0x1
+    .align 4
+v22:
+    .long 0x1
+    .align 4
+v23:
+    .long 0x1
+    .align 4
+v25:
+    .long 0x1
+    .align 4
+v26:
+    .long 0x1
+    .align 4
+v27:
+    .long 0x3
+    .align 4
+v28:
+    .long 0x4
+    .align 4
+v29:
+    .long 0x8
+    .align 4
+v30:
+    .long 0x40A00000
+    .align 8
+v31:
+    .quad 0x4020000000000000
+    .align 8
+v32:
+    .quad 0x0
+    .align 8
+v33:
+    .quad 0xFF
+    .align 4
+v34:
+    .quad 0x200000001
+    .align 8
+v35:
+    .quad v34
+    .align 8
+v36:
+    .quad v34+4
+    .align 4
+v37:
+    .quad 0x400000003
+    .align 8
+v38:
+    .quad v37+4
+    .align 8
+v39:
+    .quad v37+4
+    .align 4
+__cl0:
+    .quad 0x700000005
+    .align 8
+v40:
+    .quad __cl0
+    .align 8
+v41:
+    .quad __sl0
+    .align 8
+v43:
+    .quad 0x0
+    .align 8
+v44:
+    .quad 0x30
+    .align 8
+v45:
+    .quad 0x30
+    .align 8
+v46:
+    .quad 0x10
+    .bss
+    .align 4
+v2:
+    .zero 4
+    .align 4
+v11:
+    .zero 4
+    .align 4
+v18:
+    .zero 4
+    .align 4
+v24:
+    .zero 4
+    .align 8
+v42:
+    .zero 8
+    .section .rodata
+    .align 4
+__fc0:
+    .long 0x40A00000
+    .align 4
+__fc1:
+    .long 0x40A00000
+    .align 4
+__fc2:
+    .long 0x41000000
+    .align 1
+__sl0:
+    .quad 0x77202C6F6C6C6548
+    .long 0x646C726F
+    .word 0x21
+    .align 1
+__sl1:
+    .quad 0x6F68732027317627
+    .quad 0x6175716520646C75
+    .long 0x3527206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl2:
+    .quad 0x6F68732027327627
+    .quad 0x6175716520646C75
+    .quad 0x31565F314527206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl3:
+    .quad 0x6F68732027337627
+    .quad 0x6175716520646C75
+    .quad 0xA2727612727206C
+    .byte 0x0
+    .align 1
+__sl4:
+    .quad 0x6F68732027347627
+    .quad 0x6175716520646C75
+    .long 0x3527206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl5:
+    .quad 0x6F68732027357627
+    .quad 0x6175716520646C75
+    .quad 0xA27323127206C
+    .align 1
+__sl6:
+    .quad 0x6F68732027367627
+    .quad 0x6175716520646C75
+    .quad 0xA2735312D27206C
+    .byte 0x0
+    .align 1
+__sl7:
+    .quad 0x6F68732027377627
+    .quad 0x6175716520646C75
+    .long 0x3327206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl8:
+    .quad 0x6F68732027387627
+    .quad 0x6175716520646C75
+    .long 0x3527206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl9:
+    .quad 0x6F68732027397627
+    .quad 0x6175716520646C75
+    .quad 0xA27363127206C
+    .align 1
+__sl10:
+    .quad 0x6873202730317627
+    .quad 0x75716520646C756F
+    .quad 0xA273427206C61
+    .align 1
+__sl11:
+    .quad 0x6873202731317627
+    .quad 0x75716520646C756F
+    .quad 0xA273027206C61
+    .align 1
+__sl12:
+    .quad 0x6873202732317627
+    .quad 0x75716520646C756F
+    .quad 0xA27322D27206C61
+    .byte 0x0
+    .align 1
+__sl13:
+    .quad 0x6873202733317627
+    .quad 0x75716520646C756F
+    .quad 0xA273527206C61
+    .align 1
+__sl14:
+    .quad 0x6873202734317627
+    .quad 0x75716520646C756F
+    .quad 0xA273727206C61
+    .align 1
+__sl15:
+    .quad 0x6873202735317627
+    .quad 0x75716520646C756F
+    .quad 0xA273627206C61
+    .align 1
+__sl16:
+    .quad 0x6873202736317627
+    .quad 0x75716520646C756F
+    .quad 0xA273827206C61
+    .align 1
+__sl17:
+    .quad 0x6873202737317627
+    .quad 0x75716520646C756F
+    .quad 0xA273127206C61
+    .align 1
+__sl18:
+    .quad 0x6873202738317627
+    .quad 0x75716520646C756F
+    .quad 0xA273027206C61
+    .align 1
+__sl19:
+    .quad 0x6873202739317627
+    .quad 0x75716520646C756F
+    .quad 0xA273127206C61
+    .align 1
+__sl20:
+    .quad 0x6873202730327627
+    .quad 0x75716520646C756F
+    .quad 0xA273127206C61
+    .align 1
+__sl21:
+    .quad 0x6873202731327627
+    .quad 0x75716520646C756F
+    .quad 0xA273127206C61
+    .align 1
+__sl22:
+    .quad 0x6873202732327627
+    .quad 0x75716520646C756F
+    .quad 0xA273127206C61
+    .align 1
+__sl23:
+    .quad 0x6873202733327627
+    .quad 0x75716520646C756F
+    .quad 0xA273127206C61
+    .align 1
+__sl24:
+    .quad 0x6873202734327627
+    .quad 0x75716520646C756F
+    .quad 0xA273027206C61
+    .align 1
+__sl25:
+    .quad 0x6873202735327627
+    .quad 0x75716520646C756F
+    .quad 0xA273127206C61
+    .align 1
+__sl26:
+    .quad 0x6873202736327627
+    .quad 0x75716520646C756F
+    .quad 0xA273127206C61
+    .align 1
+__sl27:
+    .quad 0x6873202737327627
+    .quad 0x75716520646C756F
+    .quad 0xA273327206C61
+    .align 1
+__sl28:
+    .quad 0x6873202738327627
+    .quad 0x75716520646C756F
+    .quad 0xA273427206C61
+    .align 1
+__sl29:
+    .quad 0x6873202739327627
+    .quad 0x75716520646C756F
+    .quad 0xA273827206C61
+    .align 4
+__fc3:
+    .long 0x40A00000
+    .align 1
+__sl30:
+    .quad 0x6873202730337627
+    .quad 0x75716520646C756F
+    .quad 0x66302E3527206C61
+    .word 0xA27
+    .byte 0x0
+    .align 8
+__fc4:
+    .quad 0x4020000000000000
+    .align 1
+__sl31:
+    .quad 0x6873202731337627
+    .quad 0x75716520646C756F
+    .quad 0x27302E3827206C61
+    .word 0xA
+    .align 1
+__sl32:
+    .quad 0x6873202732337627
+    .quad 0x75716520646C756F
+    .quad 0x746E692827206C61
+    .long 0x3020292A
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl33:
+    .quad 0x6873202733337627
+    .quad 0x75716520646C756F
+    .quad 0x746E692827206C61
+    .quad 0x274646783020292A
+    .word 0xA
+    .align 1
+__sl34:
+    .quad 0x6873202735337627
+    .quad 0x75716520646C756F
+    .quad 0x2734337627206C61
+    .word 0xA
+    .align 1
+__sl35:
+    .quad 0x7320273633762A27
+    .quad 0x716520646C756F68
+    .quad 0xA273227206C6175
+    .byte 0x0
+    .align 1
+__sl36:
+    .quad 0x7320273833762A27
+    .quad 0x716520646C756F68
+    .quad 0xA273427206C6175
+    .byte 0x0
+    .align 1
+__sl37:
+    .quad 0x7320273933762A27
+    .quad 0x716520646C756F68
+    .quad 0xA273427206C6175
+    .byte 0x0
+    .align 1
+__sl38:
+    .quad 0x31733E2D30347627
+    .quad 0x756F68732027316D
+    .quad 0x6C6175716520646C
+    .long 0x27352720
+    .word 0xA
+    .align 1
+__sl39:
+    .quad 0x31733E2D30347627
+    .quad 0x756F68732027326D
+    .quad 0x6C6175716520646C
+    .long 0x27372720
+    .word 0xA
+    .align 1
+__sl40:
+    .quad 0x5B293134762A2827
+    .quad 0x756F687320275D30
+    .quad 0x6C6175716520646C
+    .quad 0xA272748272720
+    .align 1
+__sl41:
+    .quad 0x6873202732347627
+    .quad 0x75716520646C756F
+    .quad 0x696F762827206C61
+    .quad 0xA273020292A64
+    .align 1
+__sl42:
+    .quad 0x6873202733347627
+    .quad 0x75716520646C756F
+    .quad 0x696F762827206C61
+    .quad 0xA273020292A64
+    .align 1
+__sl43:
+    .quad 0x6873202734347627
+    .quad 0x75716520646C756F
+    .quad 0x746E692827206C61
+    .quad 0x273033783020292A
+    .word 0xA
+    .align 1
+__sl44:
+    .quad 0x6873202735347627
+    .quad 0x75716520646C756F
+    .quad 0x746E692827206C61
+    .quad 0x273033783020292A
+    .word 0xA
+    .align 1
+__sl45:
+    .quad 0x6873202736347627
+    .quad 0x75716520646C756F
+    .quad 0x746E692827206C61
+    .quad 0x273031783020292A
+    .word 0xA
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    pushq %r15
+    movl v1(%rip), %edi
+    movl $5, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS7
+    leaq __sl1(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS7:
+    movl v2(%rip), %edi
+    xorl %esi, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS8
+    leaq __sl2(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS8:
+    movl v3(%rip), %edi
+    movl $97, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS9
+    leaq __sl3(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS9:
+    movl v4(%rip), %edi
+    movl $5, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS10
+    leaq __sl4(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS10:
+    movl v5(%rip), %edi
+    movl $12, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS11
+    leaq __sl5(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS11:
+    movl v6(%rip), %edi
+    movl $4294967281, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS12
+    leaq __sl6(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS12:
+    movl v7(%rip), %edi
+    movl $3, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS13
+    leaq __sl7(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS13:
+    movl v8(%rip), %edi
+    movl $5, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS14
+    leaq __sl8(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS14:
+    movl v9(%rip), %edi
+    movl $16, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS15
+    leaq __sl9(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS15:
+    movl v10(%rip), %edi
+    movl $4, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS16
+    leaq __sl10(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS16:
+    movl v11(%rip), %edi
+    xorl %esi, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS17
+    leaq __sl11(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS17:
+    movl v12(%rip), %edi
+    movl $4294967294, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS18
+    leaq __sl12(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS18:
+    movl v13(%rip), %edi
+    movl $5, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS19
+    leaq __sl13(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS19:
+    movl v14(%rip), %edi
+    movl $7, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS20
+    leaq __sl14(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS20:
+    movl v15(%rip), %edi
+    movl $6, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS21
+    leaq __sl15(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS21:
+    movl v16(%rip), %edi
+    movl $8, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS22
+    leaq __sl16(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS22:
+    movl v17(%rip), %edi
+    movl $1, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS23
+    leaq __sl17(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS23:
+    movl v18(%rip), %edi
+    xorl %esi, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS24
+    leaq __sl18(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS24:
+    movl v19(%rip), %edi
+    movl $1, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS25
+    leaq __sl19(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS25:
+    movl v20(%rip), %edi
+    movl $1, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS26
+    leaq __sl20(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS26:
+    movl v21(%rip), %edi
+    movl $1, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS27
+    leaq __sl21(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS27:
+    movl v22(%rip), %edi
+    movl $1, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS28
+    leaq __sl22(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS28:
+    movl v23(%rip), %edi
+    movl $1, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS29
+    leaq __sl23(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS29:
+    movl v24(%rip), %edi
+    xorl %esi, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS30
+    leaq __sl24(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS30:
+    movl v25(%rip), %edi
+    movl $1, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS31
+    leaq __sl25(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS31:
+    movl v26(%rip), %edi
+    movl $1, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS32
+    leaq __sl26(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS32:
+    movl v27(%rip), %edi
+    movl $3, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS33
+    leaq __sl27(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS33:
+    movl v28(%rip), %edi
+    movl $4, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS34
+    leaq __sl28(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS34:
+    movl v29(%rip), %edi
+    movl $8, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS35
+    leaq __sl29(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS35:
+    movss v30(%rip), %xmm0
+    movss __fc3(%rip), %xmm1
+    ucomiss %xmm1, %xmm0
+    setp %dil
+    ucomiss %xmm1, %xmm0
+    je .LGEN1
+    movl $1, %edi
+.LGEN1:
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS36
+    leaq __sl30(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS36:
+    movsd v31(%rip), %xmm0
+    movsd __fc4(%rip), %xmm1
+    ucomisd %xmm1, %xmm0
+    setp %dil
+    ucomisd %xmm1, %xmm0
+    je .LGEN2
+    movl $1, %edi
+.LGEN2:
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS37
+    leaq __sl31(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS37:
+    movq v32(%rip), %rdi
+    xorl %esi, %esi
+    cmpq %rsi, %rdi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS38
+    leaq __sl32(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS38:
+    movq v33(%rip), %rdi
+    movl $255, %esi
+    cmpq %rsi, %rdi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS39
+    leaq __sl33(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS39:
+    movq v35(%rip), %rdi
+    leaq v34(%rip), %rsi
+    cmpq %rsi, %rdi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS40
+    leaq __sl34(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS40:
+    movq v36(%rip), %rdi
+    movl (%rdi), %edi
+    movl $2, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS41
+    leaq __sl35(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS41:
+    movq v38(%rip), %rdi
+    movl (%rdi), %edi
+    movl $4, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS42
+    leaq __sl36(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS42:
+    movq v39(%rip), %rdi
+    movl (%rdi), %edi
+    movl $4, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS43
+    leaq __sl37(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS43:
+    movq v40(%rip), %rdi
+    movl (%rdi), %edi
+    movl $5, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS44
+    leaq __sl38(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS44:
+    movq v40(%rip), %rdi
+    movl 4(%rdi), %edi
+    movl $7, %esi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS45
+    leaq __sl39(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS45:
+    movq v41(%rip), %rdi
+    xorl %esi, %esi
+    movb (%rdi, %rsi, 1), %dil
+    movl $72, %esi
+    movsx %dil, %edi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS46
+    leaq __sl40(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS46:
+    movq v42(%rip), %rdi
+    xorl %esi, %esi
+    cmpq %rsi, %rdi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS47
+    leaq __sl41(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS47:
+    movq v43(%rip), %rdi
+    xorl %esi, %esi
+    cmpq %rsi, %rdi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS48
+    leaq __sl42(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS48:
+    movq v44(%rip), %rdi
+    movl $48, %esi
+    cmpq %rsi, %rdi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS49
+    leaq __sl43(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS49:
+    movq v45(%rip), %rdi
+    movl $48, %esi
+    cmpq %rsi, %rdi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS50
+    leaq __sl44(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS50:
+    movq v46(%rip), %rdi
+    movl $16, %esi
+    cmpq %rsi, %rdi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS51
+    leaq __sl45(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS51:
+    xorl %esi, %esi
+    movl %esi, %eax
+    popq %r15
+    leave
+    ret
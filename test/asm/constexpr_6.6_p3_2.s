@@ -0,0 +1,32 @@
+    .data
+    .align 4
+b:
+    .long 0x4
+    .align 4
+c:
+    .long 0x4
+    .align 4
+d:
+    .long 0x4
+    .align 4
+e:
+    .long 0x4
+    .align 4
+f:
+    .long 0x4
+    .align 4
+h:
+    .long 0x4
+    .align 4
+i:
+    .long 0x4
+    .bss
+    .align 4
+a:
+    .zero 4
+    .text
+g:
+    pushq %rbp
+    movq %rsp, %rbp
+    leave
+    ret
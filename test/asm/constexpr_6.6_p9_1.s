@@ -0,0 +1,14 @@
+    .data
+    .align 8
+b:
+    .quad a
+    .align 8
+ys:
+    .quad xs
+    .bss
+    .align 4
+a:
+    .zero 200
+    .align 4
+xs:
+    .zero 20
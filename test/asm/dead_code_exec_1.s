@@ -0,0 +1,458 @@
+    .bss
+    .align 4
+trail:
+    .zero 4
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x6972777265766F27
+    .quad 0x272935286E657474
+    .quad 0x20646C756F687320
+    .quad 0x3727206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl1:
+    .quad 0x6867756F72687427
+    .quad 0x6464615F6E776F5F
+    .quad 0x2729352873736572
+    .quad 0x20646C756F687320
+    .quad 0x3127206C61757165
+    .long 0xA2730
+    .align 1
+__sl2:
+    .quad 0x656E5F6461657227
+    .quad 0x28706972745F7478
+    .quad 0x6F68732027293031
+    .quad 0x6175716520646C75
+    .quad 0xA27363327206C
+    .align 1
+__sl3:
+    .quad 0x6E6F5F6461657227
+    .quad 0x2931287961775F65
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2731
+    .align 1
+__sl4:
+    .quad 0x6E6F5F6461657227
+    .quad 0x2930287961775F65
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2732
+    .align 1
+__sl5:
+    .quad 0x6465706163736527
+    .quad 0x6F68732027293528
+    .quad 0x6175716520646C75
+    .long 0x3827206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl6:
+    .quad 0x5F796C7472617027
+    .quad 0x286E657474697277
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .quad 0x3032303130783027
+    .long 0x27303033
+    .word 0xA
+    .align 1
+__sl7:
+    .quad 0x5F646573756E7527
+    .quad 0x2873746C75736572
+    .quad 0x756F687320272934
+    .quad 0x6C6175716520646C
+    .long 0x27342720
+    .word 0xA
+    .align 1
+__sl8:
+    .quad 0x20276C6961727427
+    .quad 0x6520646C756F6873
+    .quad 0x323127206C617571
+    .long 0xA2733
+    .align 1
+__sl9:
+    .quad 0x6C6974616C6F7627
+    .quad 0x7373656363615F65
+    .quad 0x6873202729287365
+    .quad 0x75716520646C756F
+    .quad 0xA273227206C61
+    .align 1
+__sl10:
+    .quad 0x68636165726E7527
+    .quad 0x27293628656C6261
+    .quad 0x20646C756F687320
+    .quad 0x3627206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl11:
+    .quad 0x20276C6961727427
+    .quad 0x6520646C756F6873
+    .quad 0x323127206C617571
+    .long 0xA2733
+    .text
+mark:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    pushq %rbx
+    movl %edi, -4(%rbp)
+    leaq trail(%rip), %rax
+    movl trail(%rip), %edi
+    movl $10, %esi
+    imull %esi, %edi
+    movl -4(%rbp), %esi
+    addl %esi, %edi
+    movl %edi, (%rax)
+    movl -4(%rbp), %edi
+    movl %edi, %eax
+    popq %rbx
+    leave
+    ret
+store:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    movq -8(%rbp), %rdi
+    movl -12(%rbp), %esi
+    movl %esi, (%rdi)
+    leave
+    ret
+overwritten:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %eax
+    leaq -8(%rbp), %rdi
+    movl $2, %esi
+    addl %esi, %eax
+    movl %eax, (%rdi)
+    movl -8(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+through_own_address:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    leaq -8(%rbp), %rax
+    movl -4(%rbp), %edi
+    movl $2, %esi
+    imull %esi, %edi
+    movl %edi, (%rax)
+    movl -8(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+read_next_trip:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    xorl %edi, %edi
+    movl %edi, -8(%rbp)
+    xorl %edi, %edi
+    movl %edi, -12(%rbp)
+    xorl %edi, %edi
+    movl %edi, -16(%rbp)
+    movl -4(%rbp), %esi
+    leaq -8(%rbp), %rdi
+    leaq -12(%rbp), %rdx
+    leaq -16(%rbp), %rcx
+    jmp .LS2
+.LS1:
+    movl -12(%rbp), %eax
+    addl %eax, (%rdi)
+    movl -16(%rbp), %eax
+    movl %eax, (%rdx)
+    addl $1, (%rcx)
+.LS2:
+    movl -16(%rbp), %eax
+    cmpl %esi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS1
+    movl -8(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+read_one_way:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl $1, %eax
+    movl %eax, -8(%rbp)
+    movl -4(%rbp), %eax
+    cmpl $0, %eax
+    je .LS3
+    movl -8(%rbp), %edi
+    movl %edi, %eax
+    jmp .LR6
+.LS3:
+    leaq -8(%rbp), %rax
+    movl $2, %edi
+    movl %edi, (%rax)
+    movl -8(%rbp), %edi
+    movl %edi, %eax
+.LR6:
+    leave
+    ret
+escaped:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %eax
+    movl %eax, -8(%rbp)
+    leaq -8(%rbp), %rax
+    movq %rax, -16(%rbp)
+    movq -16(%rbp), %rax
+    movl -4(%rbp), %edi
+    movl $1, %esi
+    addl %esi, %edi
+    movl %edi, %esi
+    movq %rax, %rdi
+    call store
+    leaq -8(%rbp), %rax
+    movl -4(%rbp), %edi
+    movl $2, %esi
+    addl %esi, %edi
+    movl %edi, (%rax)
+    movq -16(%rbp), %rax
+    movl (%rax), %edi
+    movl $1, %esi
+    addl %esi, %edi
+    movl %edi, %esi
+    movq %rax, %rdi
+    call store
+    movl -8(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+partly_written:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl $16909060, %eax
+    movl %eax, -4(%rbp)
+    leaq -4(%rbp), %rax
+    xorl %edi, %edi
+    movb %dil, (%rax)
+    movl -4(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+unused_results:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl $1, %edi
+    call mark
+    movl %eax, %edi
+    movl $2, %edi
+    call mark
+    movl %eax, %edi
+    movl $3, %edi
+    call mark
+    movl %eax, %edi
+    cmpl $0, %edi
+    je .LE4
+    jmp .LE5
+.LE4:
+.LE5:
+    movl -4(%rbp), %esi
+    movl %esi, %eax
+    leave
+    ret
+volatile_accesses:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl $1, %eax
+    movl %eax, -4(%rbp)
+    leaq -4(%rbp), %rax
+    movl $2, %edi
+    movl %edi, (%rax)
+    movl -4(%rbp), %eax
+    movl -4(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+unreachable:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    jmp .LL1
+.LL1:
+    movl -4(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    pushq %rbx
+    movl $5, %eax
+    movl %eax, %edi
+    call overwritten
+    movl $7, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS6
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS6:
+    movl $5, %eax
+    movl %eax, %edi
+    call through_own_address
+    movl $10, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS7
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS7:
+    movl $10, %eax
+    movl %eax, %edi
+    call read_next_trip
+    movl $36, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS8
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS8:
+    movl $1, %eax
+    movl %eax, %edi
+    call read_one_way
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS9
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS9:
+    xorl %eax, %eax
+    movl %eax, %edi
+    call read_one_way
+    movl $2, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS10
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS10:
+    movl $5, %eax
+    movl %eax, %edi
+    call escaped
+    movl $8, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS11
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS11:
+    call partly_written
+    movl $16909056, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS12
+    leaq __sl6(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS12:
+    movl $4, %eax
+    movl %eax, %edi
+    call unused_results
+    movl $4, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS13
+    leaq __sl7(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS13:
+    movl trail(%rip), %eax
+    movl $123, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS14
+    leaq __sl8(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS14:
+    call volatile_accesses
+    movl $2, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS15
+    leaq __sl9(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS15:
+    movl $6, %eax
+    movl %eax, %edi
+    call unreachable
+    movl $6, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS16
+    leaq __sl10(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS16:
+    movl trail(%rip), %eax
+    movl $123, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS17
+    leaq __sl11(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS17:
+    xorl %edi, %edi
+    movl %edi, %eax
+    popq %rbx
+    leave
+    ret
@@ -0,0 +1,42 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x756F687320274127
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 1
+__sl1:
+    .quad 0x756F687320274227
+    .quad 0x6C6175716520646C
+    .long 0x27312720
+    .word 0xA
+    .align 1
+__sl2:
+    .quad 0x756F687320274327
+    .quad 0x6C6175716520646C
+    .long 0x27322720
+    .word 0xA
+    .align 1
+__sl3:
+    .quad 0x756F687320274427
+    .quad 0x6C6175716520646C
+    .long 0x27332720
+    .word 0xA
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    jmp .LS1
+.LS1:
+    jmp .LS2
+.LS2:
+    jmp .LS3
+.LS3:
+    jmp .LS4
+.LS4:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
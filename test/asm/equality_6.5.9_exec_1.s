@@ -0,0 +1,154 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x3031783028746127
+    .quad 0x7530303030303030
+    .quad 0x7461203D3D20296C
+    .quad 0x732027296C753028
+    .quad 0x716520646C756F68
+    .quad 0xA273027206C6175
+    .byte 0x0
+    .align 1
+__sl1:
+    .quad 0x3031783028746127
+    .quad 0x7531303030303030
+    .quad 0x7461203D2120296C
+    .quad 0x732027296C753128
+    .quad 0x716520646C756F68
+    .quad 0xA273127206C6175
+    .byte 0x0
+    .align 1
+__sl2:
+    .quad 0x3031783028746127
+    .quad 0x7530303030303030
+    .quad 0x2730203D2120296C
+    .quad 0x20646C756F687320
+    .quad 0x3127206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl3:
+    .quad 0x7461203D3D203027
+    .quad 0x3030303031783028
+    .quad 0x27296C7530303030
+    .quad 0x20646C756F687320
+    .quad 0x3027206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl4:
+    .quad 0x296C753028746127
+    .quad 0x73202730203D3D20
+    .quad 0x716520646C756F68
+    .quad 0xA273127206C6175
+    .byte 0x0
+    .text
+at:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movq %rdi, -8(%rbp)
+    movq -8(%rbp), %rdi
+    movq %rdi, %rax
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    movq $4294967296, %rax
+    movq %rax, %rdi
+    call at
+    movq %rax, %rbx
+    xorq %rax, %rax
+    movq %rax, %rdi
+    call at
+    cmpq %rax, %rbx
+    sete %al
+    andq $1, %rax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    movq $4294967297, %rax
+    movq %rax, %rdi
+    call at
+    movq %rax, %rbx
+    movq $1, %rax
+    movq %rax, %rdi
+    call at
+    cmpq %rax, %rbx
+    setne %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    movq $4294967296, %rax
+    movq %rax, %rdi
+    call at
+    xorl %edi, %edi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS3
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS3:
+    movq $4294967296, %rax
+    movq %rax, %rdi
+    call at
+    movq %rax, %rdi
+    xorl %eax, %eax
+    cmpq %rdi, %rax
+    sete %al
+    andq $1, %rax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS4
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS4:
+    xorq %rax, %rax
+    movq %rax, %rdi
+    call at
+    xorl %edi, %edi
+    cmpq %rdi, %rax
+    sete %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS5
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS5:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
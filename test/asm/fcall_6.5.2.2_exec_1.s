@@ -0,0 +1,46 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x202C35286D757327
+    .quad 0x756F687320272933
+    .quad 0x6C6175716520646C
+    .long 0x27382720
+    .word 0xA
+    .text
+    .globl sum
+sum:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    movl -4(%rbp), %eax
+    movl -8(%rbp), %edi
+    addl %edi, %eax
+    movl %eax, %edi
+    movl %edi, %eax
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    movl $5, %eax
+    movl $3, %edi
+    movl %edi, %esi
+    movl %eax, %edi
+    call sum
+    movl $8, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
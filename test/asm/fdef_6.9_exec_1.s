@@ -0,0 +1,305 @@
+    .data
+    .align 4
+a:
+    .long 0x1
+    .align 4
+c:
+    .long 0x3
+    .align 4
+table:
+    .quad 0x500000004
+    .long 0x6
+    .align 8
+cursor:
+    .quad table+4
+    .align 4
+unit:
+    .quad 0x100000001
+    .align 8
+op:
+    .quad twice
+    .bss
+    .align 4
+b:
+    .zero 4
+    .align 4
+origin:
+    .zero 8
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x756F687320276127
+    .quad 0x6C6175716520646C
+    .long 0x27312720
+    .word 0xA
+    .align 1
+__sl1:
+    .quad 0x756F687320276227
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 1
+__sl2:
+    .quad 0x756F687320276327
+    .quad 0x6C6175716520646C
+    .long 0x27332720
+    .word 0xA
+    .align 1
+__sl3:
+    .quad 0x726F737275632A27
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2735
+    .align 1
+__sl4:
+    .quad 0x2E6E696769726F27
+    .quad 0x202B207473726966
+    .quad 0x732E6E696769726F
+    .quad 0x732027646E6F6365
+    .quad 0x716520646C756F68
+    .quad 0xA273027206C6175
+    .byte 0x0
+    .align 1
+__sl5:
+    .quad 0x69662E74696E7527
+    .quad 0x6E75202B20747372
+    .quad 0x6E6F6365732E7469
+    .quad 0x6C756F6873202764
+    .quad 0x206C617571652064
+    .long 0xA273227
+    .byte 0x0
+    .align 1
+__sl6:
+    .quad 0x2729313228706F27
+    .quad 0x20646C756F687320
+    .quad 0x3427206C61757165
+    .long 0xA2732
+    .align 1
+__sl7:
+    .quad 0x626174286D757327
+    .quad 0x33202C5D305B656C
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0xA273727
+    .byte 0x0
+    .align 1
+__sl8:
+    .quad 0x74737269662E7027
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2732
+    .align 1
+__sl9:
+    .quad 0x6E6F6365732E7027
+    .quad 0x6C756F6873202764
+    .quad 0x206C617571652064
+    .long 0xA273127
+    .byte 0x0
+    .text
+    .globl twice
+twice:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %eax
+    movl $2, %edi
+    imull %edi, %eax
+    movl %eax, %edi
+    movl %edi, %eax
+    leave
+    ret
+    .globl sum
+sum:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    movl -4(%rbp), %eax
+    movl -8(%rbp), %edi
+    addl %edi, %eax
+    movl %eax, %edi
+    movl %edi, %eax
+    leave
+    ret
+    .globl swap
+swap:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movq %rdi, -8(%rbp)
+    movq -8(%rbp), %rax
+    movl (%rax), %edi
+    movl %edi, -12(%rbp)
+    movq %rax, %rdi
+    addq $0, %rdi
+    movl 4(%rax), %eax
+    movl %eax, (%rdi)
+    movq -8(%rbp), %rdi
+    addq $4, %rdi
+    movl -12(%rbp), %eax
+    movl %eax, (%rdi)
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl a(%rip), %edx
+    movl $1, %edi
+    cmpl %edi, %edx
+    setne %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    je .LS1
+    leaq __sl0(%rip), %rdx
+    movq %rdx, %rdi
+    call puts
+    movl %eax, %edx
+.LS1:
+    movl b(%rip), %edx
+    xorl %edi, %edi
+    cmpl %edi, %edx
+    setne %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    je .LS2
+    leaq __sl1(%rip), %rdx
+    movq %rdx, %rdi
+    call puts
+    movl %eax, %edx
+.LS2:
+    movl c(%rip), %edx
+    movl $3, %edi
+    cmpl %edi, %edx
+    setne %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    je .LS3
+    leaq __sl2(%rip), %rdx
+    movq %rdx, %rdi
+    call puts
+    movl %eax, %edx
+.LS3:
+    movq cursor(%rip), %rdx
+    movl (%rdx), %edx
+    movl $5, %edi
+    cmpl %edi, %edx
+    setne %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    je .LS4
+    leaq __sl3(%rip), %rdx
+    movq %rdx, %rdi
+    call puts
+    movl %eax, %edx
+.LS4:
+    leaq origin(%rip), %rdx
+    movl (%rdx), %edx
+    leaq origin(%rip), %rdi
+    movl 4(%rdi), %edi
+    addl %edi, %edx
+    xorl %edi, %edi
+    cmpl %edi, %edx
+    setne %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    je .LS5
+    leaq __sl4(%rip), %rdx
+    movq %rdx, %rdi
+    call puts
+    movl %eax, %edx
+.LS5:
+    leaq unit(%rip), %rdx
+    movl (%rdx), %edx
+    leaq unit(%rip), %rdi
+    movl 4(%rdi), %edi
+    addl %edi, %edx
+    movl $2, %edi
+    cmpl %edi, %edx
+    setne %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    je .LS6
+    leaq __sl5(%rip), %rdx
+    movq %rdx, %rdi
+    call puts
+    movl %eax, %edx
+.LS6:
+    movl $21, %edi
+    movq op(%rip), %rdx
+    call *%rdx
+    movl %eax, %edx
+    movl $42, %edi
+    cmpl %edi, %edx
+    setne %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    je .LS7
+    leaq __sl6(%rip), %rdx
+    movq %rdx, %rdi
+    call puts
+    movl %eax, %edx
+.LS7:
+    leaq table(%rip), %rdx
+    xorl %edi, %edi
+    movl (%rdx, %rdi, 1), %edx
+    movl $3, %edi
+    movl %edi, %esi
+    movl %edx, %edi
+    call sum
+    movl %eax, %edx
+    movl $7, %edi
+    cmpl %edi, %edx
+    setne %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    je .LS8
+    leaq __sl7(%rip), %rdx
+    movq %rdx, %rdi
+    call puts
+    movl %eax, %edx
+.LS8:
+    xorb %al, %al
+    leaq -8(%rbp), %rdi
+    movq $8, %rcx
+    rep stosb
+    movl $1, %edx
+    movl %edx, -8(%rbp)
+    movl $2, %edx
+    movl %edx, -4(%rbp)
+    leaq -8(%rbp), %rdx
+    movq %rdx, %rdi
+    call swap
+    leaq -8(%rbp), %rdx
+    movl (%rdx), %edx
+    movl $2, %edi
+    cmpl %edi, %edx
+    setne %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    je .LS9
+    leaq __sl8(%rip), %rdx
+    movq %rdx, %rdi
+    call puts
+    movl %eax, %edx
+.LS9:
+    leaq -8(%rbp), %rdx
+    movl 4(%rdx), %edx
+    movl $1, %edi
+    cmpl %edi, %edx
+    setne %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    je .LS10
+    leaq __sl9(%rip), %rdx
+    movq %rdx, %rdi
+    call puts
+    movl %eax, %edx
+.LS10:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
@@ -0,0 +1,247 @@
+    .section .rodata
+    .align 8
+__fc0:
+    .quad 0x3FB999999999999A
+    .align 8
+__fc1:
+    .quad 0x3FB999999999999A
+    .align 1
+__sl0:
+    .quad 0x68732027312E3027
+    .quad 0x75716520646C756F
+    .quad 0x2E31783027206C61
+    .quad 0x3939393939393939
+    .quad 0x342D706139393939
+    .word 0xA27
+    .byte 0x0
+    .align 8
+__fc2:
+    .quad 0x44B52D02C7E14AF6
+    .align 8
+__fc3:
+    .quad 0x44B52D02C7E14AF6
+    .align 1
+__sl1:
+    .quad 0x7320273332653127
+    .quad 0x716520646C756F68
+    .quad 0x31783027206C6175
+    .quad 0x376332306432352E
+    .quad 0x2B70366661343165
+    .long 0xA273637
+    .byte 0x0
+    .align 8
+__fc4:
+    .quad 0x405EDD2F1A9FBE77
+    .align 8
+__fc5:
+    .quad 0x405EDD2F1A9FBE77
+    .align 1
+__sl2:
+    .quad 0x3635342E33323127
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .quad 0x326464652E317830
+    .quad 0x3765626639613166
+    .long 0x362B7037
+    .word 0xA27
+    .byte 0x0
+    .align 8
+__fc6:
+    .quad 0x1
+    .align 8
+__fc7:
+    .quad 0x1
+    .align 1
+__sl3:
+    .quad 0x32332D65392E3427
+    .quad 0x6C756F6873202734
+    .quad 0x206C617571652064
+    .quad 0x3030302E30783027
+    .quad 0x3030303030303030
+    .quad 0x323230312D703130
+    .word 0xA27
+    .byte 0x0
+    .align 8
+__fc8:
+    .quad 0xFFFFFFFFFFFFF
+    .align 8
+__fc9:
+    .quad 0xFFFFFFFFFFFFF
+    .align 1
+__sl4:
+    .quad 0x37303532322E3227
+    .quad 0x3237303538353833
+    .quad 0x3830332D65313130
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .quad 0x666666662E307830
+    .quad 0x6666666666666666
+    .quad 0x27323230312D7066
+    .word 0xA
+    .align 8
+__fc10:
+    .quad 0x4340000000000000
+    .align 8
+__fc11:
+    .quad 0x4340000000000000
+    .align 1
+__sl5:
+    .quad 0x3939313730303927
+    .quad 0x3939303437343532
+    .quad 0x6F68732027302E33
+    .quad 0x6175716520646C75
+    .quad 0x313730303927206C
+    .quad 0x3034373435323939
+    .quad 0xA27302E323939
+    .align 8
+__fc12:
+    .quad 0x3FD3333333333333
+    .align 8
+__fc13:
+    .quad 0x3FD3333333333333
+    .align 1
+__sl6:
+    .quad 0x30303030332E3027
+    .quad 0x3030303030303030
+    .quad 0x3030303030303030
+    .quad 0x3030303030303030
+    .quad 0x2027313030303030
+    .quad 0x6520646C756F6873
+    .quad 0x783027206C617571
+    .quad 0x3333333333332E31
+    .quad 0x7033333333333333
+    .long 0xA27322D
+    .byte 0x0
+    .align 4
+__fc14:
+    .long 0x3DCCCCCD
+    .align 4
+__fc15:
+    .long 0x3DCCCCCD
+    .align 1
+__sl7:
+    .quad 0x73202766312E3027
+    .quad 0x716520646C756F68
+    .quad 0x31783027206C6175
+    .quad 0x706139393939392E
+    .long 0x2766342D
+    .word 0xA
+    .align 4
+__fc16:
+    .long 0x4B800000
+    .align 4
+__fc17:
+    .long 0x4B800000
+    .align 1
+__sl8:
+    .quad 0x3132373737363127
+    .quad 0x6873202766302E37
+    .quad 0x75716520646C756F
+    .quad 0x3737363127206C61
+    .quad 0x2766302E36313237
+    .word 0xA
+    .align 4
+__fc18:
+    .long 0x3F800001
+    .align 4
+__fc19:
+    .long 0x3F800001
+    .align 1
+__sl9:
+    .quad 0x30303030302E3127
+    .quad 0x3634303639353030
+    .quad 0x3039333537373434
+    .quad 0x2027663130353236
+    .quad 0x6520646C756F6873
+    .quad 0x783027206C617571
+    .quad 0x3230303030302E31
+    .long 0x27663070
+    .word 0xA
+    .align 4
+__fc20:
+    .long 0x41000000
+    .align 4
+__fc21:
+    .long 0x41000000
+    .align 1
+__sl10:
+    .quad 0x2766337031783027
+    .quad 0x20646C756F687320
+    .quad 0x3827206C61757165
+    .long 0x2766302E
+    .word 0xA
+    .align 4
+__fc22:
+    .long 0x40400000
+    .align 4
+__fc23:
+    .long 0x40400000
+    .align 1
+__sl11:
+    .quad 0x3150382E31783027
+    .quad 0x6C756F6873202746
+    .quad 0x206C617571652064
+    .quad 0xA2766302E3327
+    .align 8
+__fc24:
+    .quad 0x4014000000000000
+    .align 8
+__fc25:
+    .quad 0x4014000000000000
+    .align 1
+__sl12:
+    .quad 0x7320273165352E27
+    .quad 0x716520646C756F68
+    .quad 0x302E3527206C6175
+    .word 0xA27
+    .byte 0x0
+    .align 8
+__fc26:
+    .quad 0x3FD0000000000000
+    .align 8
+__fc27:
+    .quad 0x3FD0000000000000
+    .align 1
+__sl13:
+    .quad 0x202735322E303027
+    .quad 0x6520646C756F6873
+    .quad 0x2E3027206C617571
+    .long 0xA273532
+    .byte 0x0
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    jmp .LS1
+.LS1:
+    jmp .LS2
+.LS2:
+    jmp .LS3
+.LS3:
+    jmp .LS4
+.LS4:
+    jmp .LS5
+.LS5:
+    jmp .LS6
+.LS6:
+    jmp .LS7
+.LS7:
+    jmp .LS8
+.LS8:
+    jmp .LS9
+.LS9:
+    jmp .LS10
+.LS10:
+    jmp .LS11
+.LS11:
+    jmp .LS12
+.LS12:
+    jmp .LS13
+.LS13:
+    jmp .LS14
+.LS14:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
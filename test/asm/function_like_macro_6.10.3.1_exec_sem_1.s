@@ -0,0 +1,59 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x756F687320276227
+    .quad 0x6C6175716520646C
+    .long 0x32352720
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl1:
+    .quad 0x756F687320276127
+    .quad 0x6C6175716520646C
+    .long 0x35312720
+    .word 0xA27
+    .byte 0x0
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    pushq %rbx
+    pushq %r14
+    movl $52, %eax
+    movl %eax, -4(%rbp)
+    movl -4(%rbp), %eax
+    movl $52, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    movl $10, %eax
+    movl %eax, -8(%rbp)
+    movl -8(%rbp), %eax
+    movl $5, %edi
+    addl %edi, %eax
+    movl %eax, -12(%rbp)
+    movl -12(%rbp), %eax
+    movl $15, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    xorl %edi, %edi
+    movl %edi, %eax
+    popq %r14
+    popq %rbx
+    leave
+    ret
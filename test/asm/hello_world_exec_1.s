@@ -0,0 +1,18 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x77202C6F6C6C6568
+    .long 0x646C726F
+    .word 0x21
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
@@ -0,0 +1,52 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x756F687320276927
+    .quad 0x6C6175716520646C
+    .long 0x30312720
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl1:
+    .quad 0x756F687320276927
+    .quad 0x6C6175716520646C
+    .long 0x27352720
+    .word 0xA
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    pushq %rbx
+    movl $5, %eax
+    movl %eax, -4(%rbp)
+    movl $10, %eax
+    movl %eax, -8(%rbp)
+    movl -8(%rbp), %eax
+    movl $10, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    movl -4(%rbp), %eax
+    movl $5, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    xorl %edi, %edi
+    movl %edi, %eax
+    popq %rbx
+    leave
+    ret
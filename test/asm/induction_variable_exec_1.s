@@ -0,0 +1,1188 @@
+    .bss
+    .align 4
+trips:
+    .zero 4
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x775F746867696527
+    .quad 0x676E6F6C28656469
+    .quad 0x7320272935202C73
+    .quad 0x716520646C756F68
+    .quad 0x27353127206C6175
+    .word 0xA
+    .align 1
+__sl1:
+    .quad 0x775F746867696527
+    .quad 0x676E6F6C28656469
+    .quad 0x7320272930202C73
+    .quad 0x716520646C756F68
+    .quad 0xA273027206C6175
+    .byte 0x0
+    .align 1
+__sl2:
+    .quad 0x775F746867696527
+    .quad 0x676E6F6C28656469
+    .quad 0x202729332D202C73
+    .quad 0x6520646C756F6873
+    .quad 0x273027206C617571
+    .word 0xA
+    .align 1
+__sl3:
+    .quad 0x775F746867696527
+    .quad 0x6E6F6C2828656469
+    .quad 0x30202C3020292A67
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0xA273027
+    .byte 0x0
+    .align 1
+__sl4:
+    .quad 0x6469775F656E6F27
+    .quad 0x2C73726168632865
+    .quad 0x6F68732027293420
+    .quad 0x6175716520646C75
+    .quad 0xA2730303127206C
+    .byte 0x0
+    .align 1
+__sl5:
+    .quad 0x5F646E6F63657327
+    .quad 0x72286E6D756C6F63
+    .quad 0x272933202C73776F
+    .quad 0x20646C756F687320
+    .quad 0x3227206C61757165
+    .long 0xA2731
+    .align 1
+__sl6:
+    .quad 0x745F797265766527
+    .quad 0x2C73782864726968
+    .quad 0x6F68732027293720
+    .quad 0x6175716520646C75
+    .quad 0x34202B203127206C
+    .long 0x37202B20
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl7:
+    .quad 0x745F797265766527
+    .quad 0x2C73782864726968
+    .quad 0x6F68732027293620
+    .quad 0x6175716520646C75
+    .quad 0x34202B203127206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl8:
+    .quad 0x7261776E776F6427
+    .quad 0x2934202C73782864
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA273031
+    .byte 0x0
+    .align 1
+__sl9:
+    .quad 0x7261776E776F6427
+    .quad 0x2931202C73782864
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2731
+    .align 1
+__sl10:
+    .quad 0x7261776E776F6427
+    .quad 0x2930202C73782864
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2730
+    .align 1
+__sl11:
+    .quad 0x655F6F745F707527
+    .quad 0x7828796C74636178
+    .quad 0x7320272933202C73
+    .quad 0x716520646C756F68
+    .quad 0xA273627206C6175
+    .byte 0x0
+    .align 1
+__sl12:
+    .quad 0x655F6F745F707527
+    .quad 0x7828796C74636178
+    .quad 0x7320272930202C73
+    .quad 0x716520646C756F68
+    .quad 0xA273027206C6175
+    .byte 0x0
+    .align 1
+__sl13:
+    .quad 0x7320275D305B6327
+    .quad 0x716520646C756F68
+    .quad 0x27313127206C6175
+    .word 0xA
+    .align 1
+__sl14:
+    .quad 0x7320275D335B6327
+    .quad 0x716520646C756F68
+    .quad 0x27343427206C6175
+    .word 0xA
+    .align 1
+__sl15:
+    .quad 0x7320275D325B6127
+    .quad 0x716520646C756F68
+    .quad 0xA273627206C6175
+    .byte 0x0
+    .align 1
+__sl16:
+    .quad 0x6574686769657727
+    .quad 0x272934202C622864
+    .quad 0x20646C756F687320
+    .quad 0x3227206C61757165
+    .quad 0x2B203036202B2030
+    .long 0x30323120
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl17:
+    .quad 0x66615F6461657227
+    .quad 0x202C737828726574
+    .quad 0x756F687320272933
+    .quad 0x6C6175716520646C
+    .quad 0xA273330362720
+    .align 1
+__sl18:
+    .quad 0x66615F6461657227
+    .quad 0x202C737828726574
+    .quad 0x6F6873202729322D
+    .quad 0x6175716520646C75
+    .long 0x3027206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl19:
+    .quad 0x6465707065747327
+    .quad 0x732865636977745F
+    .quad 0x2936202C7370696B
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .quad 0x202B2032202D2031
+    .quad 0x202B2034202B2033
+    .long 0xA2735
+    .align 1
+__sl20:
+    .quad 0x656E6769736E7527
+    .quad 0x65746E756F635F64
+    .quad 0x7534202C73782872
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0x27303127
+    .word 0xA
+    .align 1
+__sl21:
+    .quad 0x656E6769736E7527
+    .quad 0x65746E756F635F64
+    .quad 0x7530202C73782872
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0xA273027
+    .byte 0x0
+    .align 1
+__sl22:
+    .quad 0x61635F6874697727
+    .quad 0x33202C7378286C6C
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0xA273627
+    .byte 0x0
+    .align 1
+__sl23:
+    .quad 0x2027737069727427
+    .quad 0x6520646C756F6873
+    .quad 0x273327206C617571
+    .word 0xA
+    .text
+tick:
+    pushq %rbp
+    movq %rsp, %rbp
+    leaq trips(%rip), %rax
+    addl $1, (%rax)
+    leave
+    ret
+eight_wide:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorq %rax, %rax
+    movq %rax, -24(%rbp)
+    xorl %eax, %eax
+    movl %eax, -28(%rbp)
+    movl -12(%rbp), %edi
+    movq -8(%rbp), %rdx
+    leaq -24(%rbp), %rsi
+    movl -28(%rbp), %eax
+    movsx %eax, %rax
+    imulq $8, %rax
+    movq %rdx, %rcx
+    addq %rax, %rcx
+    movq %rcx, %rax
+    movsx %edi, %rdi
+    imulq $8, %rdi
+    addq %rdi, %rdx
+    movq %rdx, %rdi
+    jmp .LS2
+.LS1:
+    movq (%rax), %rdx
+    addq %rdx, (%rsi)
+    addq $8, %rax
+.LS2:
+    cmpq %rdi, %rax
+    setl %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    jne .LS1
+    movq -24(%rbp), %rdi
+    movq %rdi, %rax
+    leave
+    ret
+one_wide:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorl %eax, %eax
+    movl %eax, -16(%rbp)
+    xorl %eax, %eax
+    movl %eax, -20(%rbp)
+    movl -12(%rbp), %esi
+    movq -8(%rbp), %rdx
+    leaq -16(%rbp), %rcx
+    movl -20(%rbp), %eax
+    movsx %eax, %rax
+    movq %rdx, %rdi
+    addq %rax, %rdi
+    movq %rdi, %rax
+    movsx %esi, %rdi
+    addq %rdi, %rdx
+    movq %rdx, %rdi
+    jmp .LS4
+.LS3:
+    movb (%rax), %sil
+    movsx %sil, %esi
+    addl %esi, (%rcx)
+    addq $1, %rax
+.LS4:
+    cmpq %rdi, %rax
+    setl %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    jne .LS3
+    movl -16(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+second_column:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorl %eax, %eax
+    movl %eax, -16(%rbp)
+    xorl %eax, %eax
+    movl %eax, -20(%rbp)
+    movl -12(%rbp), %edx
+    movq -8(%rbp), %rax
+    leaq -16(%rbp), %rdi
+    movl $4, %esi
+    movl -20(%rbp), %ecx
+    movsx %ecx, %rcx
+    imulq $8, %rcx
+    movq %rax, %r8
+    addq %rcx, %r8
+    movq %r8, %rcx
+    movsx %edx, %r8
+    imulq $8, %r8
+    addq %r8, %rax
+    movq %rax, %r8
+    jmp .LS6
+.LS5:
+    movl (%rcx, %rsi, 1), %eax
+    addl %eax, (%rdi)
+    addq $8, %rcx
+.LS6:
+    cmpq %r8, %rcx
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS5
+    movl -16(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+every_third:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorl %eax, %eax
+    movl %eax, -16(%rbp)
+    xorl %eax, %eax
+    movl %eax, -20(%rbp)
+    movl -12(%rbp), %eax
+    movq -8(%rbp), %rsi
+    leaq -16(%rbp), %rdi
+    movl -20(%rbp), %edx
+    movsx %edx, %rdx
+    imulq $4, %rdx
+    movq %rdx, %rcx
+    movq %rsi, %rdx
+    addq %rcx, %rdx
+    movsx %eax, %rax
+    imulq $4, %rax
+    addq %rax, %rsi
+    jmp .LS8
+.LS7:
+    movl (%rdx), %eax
+    addl %eax, (%rdi)
+    addq $12, %rdx
+.LS8:
+    cmpq %rsi, %rdx
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS7
+    movl -16(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+downward:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorl %esi, %esi
+    movl %esi, -16(%rbp)
+    movl -12(%rbp), %esi
+    movl $1, %eax
+    subl %eax, %esi
+    movl %esi, -20(%rbp)
+    movq -8(%rbp), %rdx
+    xorl %eax, %eax
+    leaq -16(%rbp), %rcx
+    movl -20(%rbp), %esi
+    movsx %esi, %rsi
+    imulq $4, %rsi
+    movq %rdx, %r8
+    addq %rsi, %r8
+    movq %r8, %rsi
+    movsx %eax, %rax
+    imulq $4, %rax
+    addq %rax, %rdx
+    movq %rdx, %rax
+    jmp .LS10
+.LS9:
+    movl (%rsi), %r8d
+    addl %r8d, (%rcx)
+    addq $18446744073709551612, %rsi
+.LS10:
+    cmpq %rax, %rsi
+    setge %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    jne .LS9
+    movl -16(%rbp), %esi
+    movl %esi, %eax
+    leave
+    ret
+up_to_exactly:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorl %esi, %esi
+    movl %esi, -16(%rbp)
+    xorl %esi, %esi
+    movl %esi, -20(%rbp)
+    movl -12(%rbp), %edx
+    movq -8(%rbp), %rax
+    leaq -16(%rbp), %rsi
+    movl -20(%rbp), %ecx
+    movsx %ecx, %rcx
+    imulq $4, %rcx
+    movq %rax, %r8
+    addq %rcx, %r8
+    movq %r8, %rcx
+    movsx %edx, %r8
+    imulq $4, %r8
+    addq %r8, %rax
+    movq %rax, %r8
+    jmp .LS12
+.LS11:
+    movl (%rcx), %eax
+    addl %eax, (%rsi)
+    addq $4, %rcx
+.LS12:
+    cmpq %r8, %rcx
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS11
+    movl -16(%rbp), %esi
+    movl %esi, %eax
+    leave
+    ret
+in_place:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movq %rsi, -16(%rbp)
+    movq %rdx, -24(%rbp)
+    movl %ecx, -28(%rbp)
+    xorl %edi, %edi
+    movl %edi, -32(%rbp)
+    leaq -32(%rbp), %rdx
+    jmp .LS14
+.LS13:
+    movq -8(%rbp), %rdi
+    movl -32(%rbp), %esi
+    imull $4, %esi
+    addq %rsi, %rdi
+    movq -16(%rbp), %rcx
+    movl (%rcx, %rsi, 1), %ecx
+    movq -24(%rbp), %rax
+    movl (%rax, %rsi, 1), %esi
+    addl %esi, %ecx
+    movl %ecx, %esi
+    movl %esi, (%rdi)
+    addl $1, (%rdx)
+.LS14:
+    movl -32(%rbp), %edi
+    movl -28(%rbp), %esi
+    cmpl %esi, %edi
+    setl %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    jne .LS13
+    leave
+    ret
+weighted:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorl %eax, %eax
+    movl %eax, -16(%rbp)
+    xorl %eax, %eax
+    movl %eax, -20(%rbp)
+    movl -12(%rbp), %esi
+    movq -8(%rbp), %rdi
+    leaq -16(%rbp), %rdx
+    leaq -20(%rbp), %rcx
+    movl -20(%rbp), %eax
+    movsx %eax, %rax
+    imulq $4, %rax
+    addq %rax, %rdi
+    movq %rdi, %rax
+    jmp .LS16
+.LS15:
+    movl -20(%rbp), %edi
+    movl (%rax), %r8d
+    imull %edi, %r8d
+    movl %r8d, %edi
+    addl %edi, (%rdx)
+    addl $1, (%rcx)
+    addq $4, %rax
+.LS16:
+    movl -20(%rbp), %edi
+    cmpl %esi, %edi
+    setl %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    jne .LS15
+    movl -16(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+read_after:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorl %esi, %esi
+    movl %esi, -20(%rbp)
+    leaq -16(%rbp), %rsi
+    xorl %eax, %eax
+    movl %eax, (%rsi)
+    movl -12(%rbp), %edx
+    movq -8(%rbp), %rax
+    leaq -20(%rbp), %rsi
+    leaq -16(%rbp), %rcx
+    movl -16(%rbp), %r8d
+    movsx %r8d, %r8
+    imulq $4, %r8
+    addq %r8, %rax
+    movq %rax, %r8
+    jmp .LS18
+.LS17:
+    movl (%r8), %eax
+    addl %eax, (%rsi)
+    addl $1, (%rcx)
+    addq $4, %r8
+.LS18:
+    movl -16(%rbp), %r9d
+    cmpl %edx, %r9d
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS17
+    movl -20(%rbp), %esi
+    movl $100, %eax
+    imull %eax, %esi
+    addl %r9d, %esi
+    movl %esi, %eax
+    leave
+    ret
+stepped_twice:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorl %eax, %eax
+    movl %eax, -16(%rbp)
+    xorl %eax, %eax
+    movl %eax, -20(%rbp)
+    movl -12(%rbp), %edi
+    movq -8(%rbp), %rdx
+    leaq -20(%rbp), %rsi
+    leaq -16(%rbp), %rcx
+    xorl %r8d, %r8d
+    leaq -20(%rbp), %r9
+    jmp .LS21
+.LS20:
+    movl -20(%rbp), %eax
+    imull $4, %eax
+    movl (%rdx, %rax, 1), %eax
+    addl %eax, (%rcx)
+    cmpl %r8d, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS19
+    addl $1, (%r9)
+.LS19:
+    addl $1, (%rsi)
+.LS21:
+    movl -20(%rbp), %eax
+    cmpl %edi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS20
+    movl -16(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+unsigned_counter:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorl %eax, %eax
+    movl %eax, -16(%rbp)
+    xorl %eax, %eax
+    movl %eax, -20(%rbp)
+    movl -12(%rbp), %esi
+    movq -8(%rbp), %rcx
+    leaq -16(%rbp), %r8
+    leaq -20(%rbp), %r9
+    jmp .LS23
+.LS22:
+    movl -20(%rbp), %eax
+    movl $4, %edi
+    mull %edi
+    movl (%rcx, %rax, 1), %eax
+    addl %eax, (%r8)
+    addl $1, (%r9)
+.LS23:
+    movl -20(%rbp), %eax
+    cmpl %esi, %eax
+    setb %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS22
+    movl -16(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+with_call:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorl %edx, %edx
+    movl %edx, -16(%rbp)
+    xorl %edx, %edx
+    movl %edx, -20(%rbp)
+    jmp .LS25
+.LS24:
+    call tick
+    leaq -16(%rbp), %rdx
+    movq -8(%rbp), %rdi
+    movl -20(%rbp), %esi
+    imull $4, %esi
+    movl (%rdi, %rsi, 1), %edi
+    addl %edi, (%rdx)
+    leaq -20(%rbp), %rdx
+    addl $1, (%rdx)
+.LS25:
+    movl -20(%rbp), %edx
+    movl -12(%rbp), %edi
+    cmpl %edi, %edx
+    setl %dl
+    andq $1, %rdx
+    cmpl $0, %edx
+    jne .LS24
+    movl -16(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $176, %rsp
+    pushq %rbx
+    pushq %r14
+    pushq %r15
+    xorb %al, %al
+    leaq -40(%rbp), %rdi
+    movq $40, %rcx
+    rep stosb
+    movq $1, %r8
+    movq %r8, -40(%rbp)
+    movq $2, %r8
+    movq %r8, -32(%rbp)
+    movq $3, %r8
+    movq %r8, -24(%rbp)
+    movq $4, %r8
+    movq %r8, -16(%rbp)
+    movq $5, %r8
+    movq %r8, -8(%rbp)
+    leaq -40(%rbp), %r8
+    movl $5, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call eight_wide
+    movq %rax, %r8
+    movq $15, %rdi
+    cmpq %rdi, %r8
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS26
+    leaq __sl0(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS26:
+    leaq -40(%rbp), %r8
+    xorl %edi, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call eight_wide
+    movq %rax, %r8
+    xorq %rdi, %rdi
+    cmpq %rdi, %r8
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS27
+    leaq __sl1(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS27:
+    leaq -40(%rbp), %r8
+    movl $4294967293, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call eight_wide
+    movq %rax, %r8
+    xorq %rdi, %rdi
+    cmpq %rdi, %r8
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS28
+    leaq __sl2(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS28:
+    xorl %r8d, %r8d
+    xorl %edi, %edi
+    movl %edi, %esi
+    movl %r8d, %edi
+    call eight_wide
+    movq %rax, %r8
+    xorq %rdi, %rdi
+    cmpq %rdi, %r8
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS29
+    leaq __sl3(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS29:
+    xorb %al, %al
+    leaq -44(%rbp), %rdi
+    movq $4, %rcx
+    rep stosb
+    movl $10, %r8d
+    movb %r8b, -44(%rbp)
+    movl $20, %r8d
+    movb %r8b, -43(%rbp)
+    movl $30, %r8d
+    movb %r8b, -42(%rbp)
+    movl $40, %r8d
+    movb %r8b, -41(%rbp)
+    leaq -44(%rbp), %r8
+    movl $4, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call one_wide
+    movl %eax, %r8d
+    movl $100, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS30
+    leaq __sl4(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS30:
+    xorb %al, %al
+    leaq -68(%rbp), %rdi
+    movq $24, %rcx
+    rep stosb
+    movl $1, %r8d
+    movl %r8d, -68(%rbp)
+    movl $5, %r8d
+    movl %r8d, -64(%rbp)
+    movl $2, %r8d
+    movl %r8d, -60(%rbp)
+    movl $7, %r8d
+    movl %r8d, -56(%rbp)
+    movl $3, %r8d
+    movl %r8d, -52(%rbp)
+    movl $9, %r8d
+    movl %r8d, -48(%rbp)
+    leaq -68(%rbp), %r8
+    movl $3, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call second_column
+    movl %eax, %r8d
+    movl $21, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS31
+    leaq __sl5(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS31:
+    xorb %al, %al
+    leaq -96(%rbp), %rdi
+    movq $28, %rcx
+    rep stosb
+    movl $1, %r8d
+    movl %r8d, -96(%rbp)
+    movl $2, %r8d
+    movl %r8d, -92(%rbp)
+    movl $3, %r8d
+    movl %r8d, -88(%rbp)
+    movl $4, %r8d
+    movl %r8d, -84(%rbp)
+    movl $5, %r8d
+    movl %r8d, -80(%rbp)
+    movl $6, %r8d
+    movl %r8d, -76(%rbp)
+    movl $7, %r8d
+    movl %r8d, -72(%rbp)
+    leaq -96(%rbp), %r8
+    movl $7, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call every_third
+    movl %eax, %r8d
+    movl $12, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS32
+    leaq __sl6(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS32:
+    leaq -96(%rbp), %r8
+    movl $6, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call every_third
+    movl %eax, %r8d
+    movl $5, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS33
+    leaq __sl7(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS33:
+    leaq -96(%rbp), %r8
+    movl $4, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call downward
+    movl %eax, %r8d
+    movl $10, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS34
+    leaq __sl8(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS34:
+    leaq -96(%rbp), %r8
+    movl $1, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call downward
+    movl %eax, %r8d
+    movl $1, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS35
+    leaq __sl9(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS35:
+    leaq -96(%rbp), %r8
+    xorl %edi, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call downward
+    movl %eax, %r8d
+    xorl %edi, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS36
+    leaq __sl10(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS36:
+    leaq -96(%rbp), %r8
+    movl $3, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call up_to_exactly
+    movl %eax, %r8d
+    movl $6, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS37
+    leaq __sl11(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS37:
+    leaq -96(%rbp), %r8
+    xorl %edi, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call up_to_exactly
+    movl %eax, %r8d
+    xorl %edi, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS38
+    leaq __sl12(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS38:
+    xorb %al, %al
+    leaq -112(%rbp), %rdi
+    movq $16, %rcx
+    rep stosb
+    movl $1, %r8d
+    movl %r8d, -112(%rbp)
+    movl $2, %r8d
+    movl %r8d, -108(%rbp)
+    movl $3, %r8d
+    movl %r8d, -104(%rbp)
+    movl $4, %r8d
+    movl %r8d, -100(%rbp)
+    xorb %al, %al
+    leaq -128(%rbp), %rdi
+    movq $16, %rcx
+    rep stosb
+    movl $10, %r8d
+    movl %r8d, -128(%rbp)
+    movl $20, %r8d
+    movl %r8d, -124(%rbp)
+    movl $30, %r8d
+    movl %r8d, -120(%rbp)
+    movl $40, %r8d
+    movl %r8d, -116(%rbp)
+    xorb %al, %al
+    leaq -144(%rbp), %rdi
+    movq $16, %rcx
+    rep stosb
+    xorl %r8d, %r8d
+    movl %r8d, -144(%rbp)
+    leaq -144(%rbp), %r8
+    leaq -112(%rbp), %rdi
+    leaq -128(%rbp), %rsi
+    movl $4, %edx
+    movl %edx, %ecx
+    movq %rsi, %rdx
+    movq %rdi, %rsi
+    movq %r8, %rdi
+    call in_place
+    leaq -144(%rbp), %r8
+    xorl %edi, %edi
+    movl (%r8, %rdi, 1), %r8d
+    movl $11, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS39
+    leaq __sl13(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS39:
+    leaq -144(%rbp), %r8
+    movl $12, %edi
+    movl (%r8, %rdi, 1), %r8d
+    movl $44, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS40
+    leaq __sl14(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS40:
+    leaq -112(%rbp), %r8
+    leaq -112(%rbp), %rdi
+    leaq -112(%rbp), %rsi
+    movl $4, %edx
+    movl %edx, %ecx
+    movq %rsi, %rdx
+    movq %rdi, %rsi
+    movq %r8, %rdi
+    call in_place
+    leaq -112(%rbp), %r8
+    movl $8, %edi
+    movl (%r8, %rdi, 1), %r8d
+    movl $6, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS41
+    leaq __sl15(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS41:
+    leaq -128(%rbp), %r8
+    movl $4, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call weighted
+    movl %eax, %r8d
+    movl $200, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS42
+    leaq __sl16(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS42:
+    leaq -96(%rbp), %r8
+    movl $3, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call read_after
+    movl %eax, %r8d
+    movl $603, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS43
+    leaq __sl17(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS43:
+    leaq -96(%rbp), %r8
+    movl $4294967294, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call read_after
+    movl %eax, %r8d
+    xorl %edi, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS44
+    leaq __sl18(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS44:
+    xorb %al, %al
+    leaq -168(%rbp), %rdi
+    movq $24, %rcx
+    rep stosb
+    movl $1, %r8d
+    movl %r8d, -168(%rbp)
+    movl $4294967294, %r8d
+    movl %r8d, -164(%rbp)
+    movl $100, %r8d
+    movl %r8d, -160(%rbp)
+    movl $3, %r8d
+    movl %r8d, -156(%rbp)
+    movl $4, %r8d
+    movl %r8d, -152(%rbp)
+    movl $5, %r8d
+    movl %r8d, -148(%rbp)
+    leaq -168(%rbp), %r8
+    movl $6, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call stepped_twice
+    movl %eax, %r8d
+    movl $11, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS45
+    leaq __sl19(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS45:
+    leaq -96(%rbp), %r8
+    movl $4, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call unsigned_counter
+    movl %eax, %r8d
+    movl $10, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS46
+    leaq __sl20(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS46:
+    leaq -96(%rbp), %r8
+    xorl %edi, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call unsigned_counter
+    movl %eax, %r8d
+    xorl %edi, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS47
+    leaq __sl21(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS47:
+    leaq -96(%rbp), %r8
+    movl $3, %edi
+    movl %edi, %esi
+    movq %r8, %rdi
+    call with_call
+    movl %eax, %r8d
+    movl $6, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS48
+    leaq __sl22(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS48:
+    movl trips(%rip), %r8d
+    movl $3, %edi
+    cmpl %edi, %r8d
+    setne %r8b
+    andq $1, %r8
+    cmpl $0, %r8d
+    je .LS49
+    leaq __sl23(%rip), %r8
+    movq %r8, %rdi
+    call puts
+    movl %eax, %r8d
+.LS49:
+    xorl %edi, %edi
+    movl %edi, %eax
+    popq %r15
+    popq %r14
+    popq %rbx
+    leave
+    ret
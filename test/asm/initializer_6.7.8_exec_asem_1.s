@@ -0,0 +1,714 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x756F687320276927
+    .quad 0x6C6175716520646C
+    .long 0x27352720
+    .word 0xA
+    .align 1
+__sl1:
+    .quad 0x756F687320276A27
+    .quad 0x6C6175716520646C
+    .long 0x27352720
+    .word 0xA
+    .align 1
+__sl2:
+    .quad 0x68732027782E6B27
+    .quad 0x75716520646C756F
+    .quad 0xA273327206C61
+    .align 1
+__sl3:
+    .quad 0x68732027792E6B27
+    .quad 0x75716520646C756F
+    .quad 0xA273527206C61
+    .align 1
+__sl4:
+    .quad 0x68732027782E6C27
+    .quad 0x75716520646C756F
+    .quad 0xA273327206C61
+    .align 1
+__sl5:
+    .quad 0x68732027792E6C27
+    .quad 0x75716520646C756F
+    .quad 0xA273527206C61
+    .align 1
+__sl6:
+    .quad 0x68732027782E6D27
+    .quad 0x75716520646C756F
+    .quad 0xA273027206C61
+    .align 1
+__sl7:
+    .quad 0x68732027792E6D27
+    .quad 0x75716520646C756F
+    .quad 0xA273527206C61
+    .align 1
+__sl9:
+    .quad 0x28666F657A697327
+    .quad 0x6873202729727473
+    .quad 0x75716520646C756F
+    .quad 0xA273627206C61
+    .align 1
+__sl10:
+    .quad 0x275D305B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA272748
+    .byte 0x0
+    .align 1
+__sl11:
+    .quad 0x275D315B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA272765
+    .byte 0x0
+    .align 1
+__sl12:
+    .quad 0x275D325B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA27276C
+    .byte 0x0
+    .align 1
+__sl13:
+    .quad 0x275D335B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA27276C
+    .byte 0x0
+    .align 1
+__sl14:
+    .quad 0x275D345B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA27276F
+    .byte 0x0
+    .align 1
+__sl15:
+    .quad 0x275D355B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0x2727305C
+    .word 0xA
+    .align 1
+__sl17:
+    .quad 0x28666F657A697327
+    .quad 0x7320272972747377
+    .quad 0x716520646C756F68
+    .quad 0x27343227206C6175
+    .word 0xA
+    .align 1
+__sl18:
+    .quad 0x5D305B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27274827
+    .word 0xA
+    .align 1
+__sl19:
+    .quad 0x5D315B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27276527
+    .word 0xA
+    .align 1
+__sl20:
+    .quad 0x5D325B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27276C27
+    .word 0xA
+    .align 1
+__sl21:
+    .quad 0x5D335B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27276C27
+    .word 0xA
+    .align 1
+__sl22:
+    .quad 0x5D345B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27276F27
+    .word 0xA
+    .align 1
+__sl23:
+    .quad 0x5D355B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27305C27
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl24:
+    .long 0x636261
+    .align 1
+__sl25:
+    .long 0x666564
+    .align 1
+__sl26:
+    .long 0x696867
+    .align 1
+__sl27:
+    .quad 0x28666F657A697327
+    .quad 0x6F68732027293176
+    .quad 0x6175716520646C75
+    .quad 0xA27323127206C
+    .align 1
+__sl28:
+    .quad 0x305B5D305B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27612727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl29:
+    .quad 0x315B5D305B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27622727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl30:
+    .quad 0x325B5D305B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27632727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl31:
+    .quad 0x305B5D315B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27642727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl32:
+    .quad 0x315B5D315B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27652727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl33:
+    .quad 0x325B5D315B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27662727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl34:
+    .quad 0x305B5D325B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27672727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl35:
+    .quad 0x315B5D325B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27682727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl36:
+    .quad 0x325B5D325B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27692727
+    .word 0xA27
+    .byte 0x0
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $80, %rsp
+    pushq %r15
+    movl $5, %esi
+    movl %esi, -4(%rbp)
+    movl -4(%rbp), %esi
+    movl $5, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS1
+    leaq __sl0(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS1:
+    movl $5, %esi
+    movl %esi, -8(%rbp)
+    movl -8(%rbp), %esi
+    movl $5, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS2
+    leaq __sl1(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS2:
+    xorb %al, %al
+    leaq -16(%rbp), %rdi
+    movq $8, %rcx
+    rep stosb
+    movl $3, %esi
+    movl %esi, -16(%rbp)
+    movl $5, %esi
+    movl %esi, -12(%rbp)
+    leaq -16(%rbp), %rsi
+    movl (%rsi), %esi
+    movl $3, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS3
+    leaq __sl2(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS3:
+    leaq -16(%rbp), %rsi
+    movl 4(%rsi), %esi
+    movl $5, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS4
+    leaq __sl3(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS4:
+    leaq -16(%rbp), %rsi
+    movq (%rsi), %rsi
+    movq %rsi, -24(%rbp)
+    leaq -24(%rbp), %rsi
+    movl (%rsi), %esi
+    movl $3, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS5
+    leaq __sl4(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS5:
+    leaq -24(%rbp), %rsi
+    movl 4(%rsi), %esi
+    movl $5, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS6
+    leaq __sl5(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS6:
+    xorb %al, %al
+    leaq -32(%rbp), %rdi
+    movq $8, %rcx
+    rep stosb
+    movl $5, %esi
+    movl %esi, -28(%rbp)
+    leaq -32(%rbp), %rsi
+    movl (%rsi), %esi
+    xorl %edi, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS7
+    leaq __sl6(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS7:
+    leaq -32(%rbp), %rsi
+    movl 4(%rsi), %esi
+    movl $5, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS8
+    leaq __sl7(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS8:
+    movl $1819043144, -38(%rbp)
+    movw $111, -34(%rbp)
+    jmp .LS9
+.LS9:
+    leaq -38(%rbp), %rsi
+    xorl %edi, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $72, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS10
+    leaq __sl10(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS10:
+    leaq -38(%rbp), %rsi
+    movl $1, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $101, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS11
+    leaq __sl11(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS11:
+    leaq -38(%rbp), %rsi
+    movl $2, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $108, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS12
+    leaq __sl12(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS12:
+    leaq -38(%rbp), %rsi
+    movl $3, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $108, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS13
+    leaq __sl13(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS13:
+    leaq -38(%rbp), %rsi
+    movl $4, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $111, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS14
+    leaq __sl14(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS14:
+    leaq -38(%rbp), %rsi
+    movl $5, %edi
+    movb (%rsi, %rdi, 1), %sil
+    xorl %edi, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS15
+    leaq __sl15(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS15:
+    movq $433791696968, %rsi
+    movq %rsi, -64(%rbp)
+    movq $463856468076, %rsi
+    movq %rsi, -56(%rbp)
+    movq $111, %rsi
+    movq %rsi, -48(%rbp)
+    jmp .LS16
+.LS16:
+    leaq -64(%rbp), %rsi
+    xorl %edi, %edi
+    movl (%rsi, %rdi, 1), %esi
+    movl $72, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS17
+    leaq __sl18(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS17:
+    leaq -64(%rbp), %rsi
+    movl $4, %edi
+    movl (%rsi, %rdi, 1), %esi
+    movl $101, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS18
+    leaq __sl19(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS18:
+    leaq -64(%rbp), %rsi
+    movl $8, %edi
+    movl (%rsi, %rdi, 1), %esi
+    movl $108, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS19
+    leaq __sl20(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS19:
+    leaq -64(%rbp), %rsi
+    movl $12, %edi
+    movl (%rsi, %rdi, 1), %esi
+    movl $108, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS20
+    leaq __sl21(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS20:
+    leaq -64(%rbp), %rsi
+    movl $16, %edi
+    movl (%rsi, %rdi, 1), %esi
+    movl $111, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS21
+    leaq __sl22(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS21:
+    leaq -64(%rbp), %rsi
+    movl $20, %edi
+    movl (%rsi, %rdi, 1), %esi
+    xorl %edi, %edi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS22
+    leaq __sl23(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS22:
+    xorb %al, %al
+    leaq -76(%rbp), %rdi
+    movq $12, %rcx
+    rep stosb
+    movl $6513249, -76(%rbp)
+    movb $127, -72(%rbp)
+    movl $6710628, -72(%rbp)
+    movb $127, -68(%rbp)
+    movl $6908007, -68(%rbp)
+    movb $127, -64(%rbp)
+    jmp .LS23
+.LS23:
+    leaq -76(%rbp), %rsi
+    xorl %edi, %edi
+    addq %rdi, %rsi
+    xorl %edi, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $97, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS24
+    leaq __sl28(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS24:
+    leaq -76(%rbp), %rsi
+    xorl %edi, %edi
+    addq %rdi, %rsi
+    movl $1, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $98, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS25
+    leaq __sl29(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS25:
+    leaq -76(%rbp), %rsi
+    xorl %edi, %edi
+    addq %rdi, %rsi
+    movl $2, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $99, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS26
+    leaq __sl30(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS26:
+    leaq -76(%rbp), %rsi
+    movl $4, %edi
+    addq %rdi, %rsi
+    xorl %edi, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $100, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS27
+    leaq __sl31(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS27:
+    leaq -76(%rbp), %rsi
+    movl $4, %edi
+    addq %rdi, %rsi
+    movl $1, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $101, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS28
+    leaq __sl32(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS28:
+    leaq -76(%rbp), %rsi
+    movl $4, %edi
+    addq %rdi, %rsi
+    movl $2, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $102, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS29
+    leaq __sl33(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS29:
+    leaq -76(%rbp), %rsi
+    movl $8, %edi
+    addq %rdi, %rsi
+    xorl %edi, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $103, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS30
+    leaq __sl34(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS30:
+    leaq -76(%rbp), %rsi
+    movl $8, %edi
+    addq %rdi, %rsi
+    movl $1, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $104, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS31
+    leaq __sl35(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS31:
+    leaq -76(%rbp), %rsi
+    movl $8, %edi
+    addq %rdi, %rsi
+    movl $2, %edi
+    movb (%rsi, %rdi, 1), %sil
+    movl $105, %edi
+    movsx %sil, %esi
+    cmpl %edi, %esi
+    setne %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    je .LS32
+    leaq __sl36(%rip), %rsi
+    movq %rsi, %rdi
+    call puts
+    movl %eax, %esi
+.LS32:
+    xorl %edi, %edi
+    movl %edi, %eax
+    popq %r15
+    leave
+    ret
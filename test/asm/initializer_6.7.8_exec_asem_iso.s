@@ -0,0 +1,1291 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x28666F657A697327
+    .quad 0x756F687320272978
+    .quad 0x6C6175716520646C
+    .long 0x32312720
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl1:
+    .quad 0x7320275D305B7827
+    .quad 0x716520646C756F68
+    .quad 0xA273127206C6175
+    .byte 0x0
+    .align 1
+__sl2:
+    .quad 0x7320275D315B7827
+    .quad 0x716520646C756F68
+    .quad 0xA273327206C6175
+    .byte 0x0
+    .align 1
+__sl3:
+    .quad 0x7320275D325B7827
+    .quad 0x716520646C756F68
+    .quad 0xA273527206C6175
+    .byte 0x0
+    .align 1
+__sl4:
+    .quad 0x28666F657A697327
+    .quad 0x756F687320272979
+    .quad 0x6C6175716520646C
+    .long 0x38342720
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl5:
+    .quad 0x5D305B5D305B7927
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2731
+    .align 1
+__sl6:
+    .quad 0x5D315B5D305B7927
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2733
+    .align 1
+__sl7:
+    .quad 0x5D325B5D305B7927
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2735
+    .align 1
+__sl8:
+    .quad 0x5D305B5D315B7927
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2732
+    .align 1
+__sl9:
+    .quad 0x5D315B5D315B7927
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2734
+    .align 1
+__sl10:
+    .quad 0x5D325B5D315B7927
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2736
+    .align 1
+__sl11:
+    .quad 0x5D305B5D325B7927
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2733
+    .align 1
+__sl12:
+    .quad 0x5D315B5D325B7927
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2735
+    .align 1
+__sl13:
+    .quad 0x5D325B5D325B7927
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2737
+    .align 1
+__sl14:
+    .quad 0x28666F657A697327
+    .quad 0x756F687320272976
+    .quad 0x6C6175716520646C
+    .long 0x38342720
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl15:
+    .quad 0x5D305B5D305B7627
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2731
+    .align 1
+__sl16:
+    .quad 0x5D315B5D305B7627
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2733
+    .align 1
+__sl17:
+    .quad 0x5D325B5D305B7627
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2735
+    .align 1
+__sl18:
+    .quad 0x5D305B5D315B7627
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2732
+    .align 1
+__sl19:
+    .quad 0x5D315B5D315B7627
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2734
+    .align 1
+__sl20:
+    .quad 0x5D325B5D315B7627
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2736
+    .align 1
+__sl21:
+    .quad 0x5D305B5D325B7627
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2733
+    .align 1
+__sl22:
+    .quad 0x5D315B5D325B7627
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2735
+    .align 1
+__sl23:
+    .quad 0x5D325B5D325B7627
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2737
+    .align 1
+__sl24:
+    .quad 0x28666F657A697327
+    .quad 0x756F68732027297A
+    .quad 0x6C6175716520646C
+    .long 0x38342720
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl25:
+    .quad 0x5D305B5D305B7A27
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2731
+    .align 1
+__sl26:
+    .quad 0x5D305B5D315B7A27
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2732
+    .align 1
+__sl27:
+    .quad 0x5D305B5D325B7A27
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2733
+    .align 1
+__sl28:
+    .quad 0x5D305B5D335B7A27
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2734
+    .align 1
+__sl29:
+    .quad 0x28666F657A697327
+    .quad 0x756F687320272977
+    .quad 0x6C6175716520646C
+    .long 0x32332720
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl30:
+    .quad 0x5B612E5D305B7727
+    .quad 0x756F687320275D30
+    .quad 0x6C6175716520646C
+    .long 0x27312720
+    .word 0xA
+    .align 1
+__sl31:
+    .quad 0x5B612E5D315B7727
+    .quad 0x756F687320275D30
+    .quad 0x6C6175716520646C
+    .long 0x27322720
+    .word 0xA
+    .align 1
+__sl32:
+    .quad 0x28666F657A697327
+    .quad 0x756F687320272971
+    .quad 0x6C6175716520646C
+    .long 0x38342720
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl33:
+    .quad 0x5D305B5D305B7127
+    .quad 0x6F687320275D305B
+    .quad 0x6175716520646C75
+    .long 0x3127206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl34:
+    .quad 0x5D305B5D315B7127
+    .quad 0x6F687320275D305B
+    .quad 0x6175716520646C75
+    .long 0x3227206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl35:
+    .quad 0x5D305B5D315B7127
+    .quad 0x6F687320275D315B
+    .quad 0x6175716520646C75
+    .long 0x3327206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl36:
+    .quad 0x5D305B5D325B7127
+    .quad 0x6F687320275D305B
+    .quad 0x6175716520646C75
+    .long 0x3427206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl37:
+    .quad 0x5D305B5D325B7127
+    .quad 0x6F687320275D315B
+    .quad 0x6175716520646C75
+    .long 0x3527206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl38:
+    .quad 0x5D315B5D325B7127
+    .quad 0x6F687320275D305B
+    .quad 0x6175716520646C75
+    .long 0x3627206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl39:
+    .quad 0x28666F657A697327
+    .quad 0x756F687320272961
+    .quad 0x6C6175716520646C
+    .long 0x27382720
+    .word 0xA
+    .align 1
+__sl40:
+    .quad 0x7320275D305B6127
+    .quad 0x716520646C756F68
+    .quad 0xA273127206C6175
+    .byte 0x0
+    .align 1
+__sl41:
+    .quad 0x7320275D315B6127
+    .quad 0x716520646C756F68
+    .quad 0xA273227206C6175
+    .byte 0x0
+    .align 1
+__sl42:
+    .quad 0x28666F657A697327
+    .quad 0x756F687320272962
+    .quad 0x6C6175716520646C
+    .long 0x32312720
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl43:
+    .quad 0x7320275D305B6227
+    .quad 0x716520646C756F68
+    .quad 0xA273327206C6175
+    .byte 0x0
+    .align 1
+__sl44:
+    .quad 0x7320275D315B6227
+    .quad 0x716520646C756F68
+    .quad 0xA273427206C6175
+    .byte 0x0
+    .align 1
+__sl45:
+    .quad 0x7320275D325B6227
+    .quad 0x716520646C756F68
+    .quad 0xA273527206C6175
+    .byte 0x0
+    .align 1
+__sl48:
+    .quad 0x28666F657A697327
+    .quad 0x6F68732027293173
+    .quad 0x6175716520646C75
+    .quad 0x6F657A697327206C
+    .quad 0xA272932732866
+    .align 1
+__sl49:
+    .quad 0x20275D305B317327
+    .quad 0x6520646C756F6873
+    .quad 0x327327206C617571
+    .long 0x275D305B
+    .word 0xA
+    .align 1
+__sl50:
+    .quad 0x20275D315B317327
+    .quad 0x6520646C756F6873
+    .quad 0x327327206C617571
+    .long 0x275D315B
+    .word 0xA
+    .align 1
+__sl51:
+    .quad 0x20275D325B317327
+    .quad 0x6520646C756F6873
+    .quad 0x327327206C617571
+    .long 0x275D325B
+    .word 0xA
+    .align 1
+__sl52:
+    .quad 0x20275D335B317327
+    .quad 0x6520646C756F6873
+    .quad 0x327327206C617571
+    .long 0x275D335B
+    .word 0xA
+    .align 1
+__sl53:
+    .quad 0x28666F657A697327
+    .quad 0x6F68732027293174
+    .quad 0x6175716520646C75
+    .quad 0x6F657A697327206C
+    .quad 0xA272932742866
+    .align 1
+__sl54:
+    .quad 0x20275D305B317427
+    .quad 0x6520646C756F6873
+    .quad 0x327427206C617571
+    .long 0x275D305B
+    .word 0xA
+    .align 1
+__sl55:
+    .quad 0x20275D315B317427
+    .quad 0x6520646C756F6873
+    .quad 0x327427206C617571
+    .long 0x275D315B
+    .word 0xA
+    .align 1
+__sl56:
+    .quad 0x20275D325B317427
+    .quad 0x6520646C756F6873
+    .quad 0x327427206C617571
+    .long 0x275D325B
+    .word 0xA
+    .align 1
+__sl57:
+    .quad 0x28666F657A697327
+    .quad 0x6F68732027293277
+    .quad 0x6175716520646C75
+    .quad 0xA27323327206C
+    .align 1
+__sl58:
+    .quad 0x612E5D305B327727
+    .quad 0x6F687320275D305B
+    .quad 0x6175716520646C75
+    .long 0x3127206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl59:
+    .quad 0x612E5D315B327727
+    .quad 0x6F687320275D305B
+    .quad 0x6175716520646C75
+    .long 0x3227206C
+    .word 0xA27
+    .byte 0x0
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $320, %rsp
+    pushq %r15
+    xorb %al, %al
+    leaq -12(%rbp), %rdi
+    movq $12, %rcx
+    rep stosb
+    movl $1, %eax
+    movl %eax, -12(%rbp)
+    movl $3, %eax
+    movl %eax, -8(%rbp)
+    movl $5, %eax
+    movl %eax, -4(%rbp)
+    jmp .LS1
+.LS1:
+    leaq -12(%rbp), %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    leaq -12(%rbp), %rax
+    movl $4, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $3, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS3
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS3:
+    leaq -12(%rbp), %rax
+    movl $8, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $5, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS4
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS4:
+    xorb %al, %al
+    leaq -60(%rbp), %rdi
+    movq $48, %rcx
+    rep stosb
+    movl $1, %eax
+    movl %eax, -60(%rbp)
+    movl $3, %eax
+    movl %eax, -56(%rbp)
+    movl $5, %eax
+    movl %eax, -52(%rbp)
+    movl $2, %eax
+    movl %eax, -48(%rbp)
+    movl $4, %eax
+    movl %eax, -44(%rbp)
+    movl $6, %eax
+    movl %eax, -40(%rbp)
+    movl $3, %eax
+    movl %eax, -36(%rbp)
+    movl $5, %eax
+    movl %eax, -32(%rbp)
+    movl $7, %eax
+    movl %eax, -28(%rbp)
+    jmp .LS5
+.LS5:
+    leaq -60(%rbp), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS6
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS6:
+    leaq -60(%rbp), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    movl $4, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $3, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS7
+    leaq __sl6(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS7:
+    leaq -60(%rbp), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    movl $8, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $5, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS8
+    leaq __sl7(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS8:
+    leaq -60(%rbp), %rax
+    movl $12, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $2, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS9
+    leaq __sl8(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS9:
+    leaq -60(%rbp), %rax
+    movl $12, %edi
+    addq %rdi, %rax
+    movl $4, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $4, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS10
+    leaq __sl9(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS10:
+    leaq -60(%rbp), %rax
+    movl $12, %edi
+    addq %rdi, %rax
+    movl $8, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $6, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS11
+    leaq __sl10(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS11:
+    leaq -60(%rbp), %rax
+    movl $24, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $3, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS12
+    leaq __sl11(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS12:
+    leaq -60(%rbp), %rax
+    movl $24, %edi
+    addq %rdi, %rax
+    movl $4, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $5, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS13
+    leaq __sl12(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS13:
+    leaq -60(%rbp), %rax
+    movl $24, %edi
+    addq %rdi, %rax
+    movl $8, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $7, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS14
+    leaq __sl13(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS14:
+    xorb %al, %al
+    leaq -108(%rbp), %rdi
+    movq $48, %rcx
+    rep stosb
+    movl $1, %eax
+    movl %eax, -108(%rbp)
+    movl $3, %eax
+    movl %eax, -104(%rbp)
+    movl $5, %eax
+    movl %eax, -100(%rbp)
+    movl $2, %eax
+    movl %eax, -96(%rbp)
+    movl $4, %eax
+    movl %eax, -92(%rbp)
+    movl $6, %eax
+    movl %eax, -88(%rbp)
+    movl $3, %eax
+    movl %eax, -84(%rbp)
+    movl $5, %eax
+    movl %eax, -80(%rbp)
+    movl $7, %eax
+    movl %eax, -76(%rbp)
+    jmp .LS15
+.LS15:
+    leaq -108(%rbp), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS16
+    leaq __sl15(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS16:
+    leaq -108(%rbp), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    movl $4, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $3, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS17
+    leaq __sl16(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS17:
+    leaq -108(%rbp), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    movl $8, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $5, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS18
+    leaq __sl17(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS18:
+    leaq -108(%rbp), %rax
+    movl $12, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $2, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS19
+    leaq __sl18(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS19:
+    leaq -108(%rbp), %rax
+    movl $12, %edi
+    addq %rdi, %rax
+    movl $4, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $4, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS20
+    leaq __sl19(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS20:
+    leaq -108(%rbp), %rax
+    movl $12, %edi
+    addq %rdi, %rax
+    movl $8, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $6, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS21
+    leaq __sl20(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS21:
+    leaq -108(%rbp), %rax
+    movl $24, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $3, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS22
+    leaq __sl21(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS22:
+    leaq -108(%rbp), %rax
+    movl $24, %edi
+    addq %rdi, %rax
+    movl $4, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $5, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS23
+    leaq __sl22(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS23:
+    leaq -108(%rbp), %rax
+    movl $24, %edi
+    addq %rdi, %rax
+    movl $8, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $7, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS24
+    leaq __sl23(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS24:
+    xorb %al, %al
+    leaq -156(%rbp), %rdi
+    movq $48, %rcx
+    rep stosb
+    movl $1, %eax
+    movl %eax, -156(%rbp)
+    movl $2, %eax
+    movl %eax, -144(%rbp)
+    movl $3, %eax
+    movl %eax, -132(%rbp)
+    movl $4, %eax
+    movl %eax, -120(%rbp)
+    jmp .LS25
+.LS25:
+    leaq -156(%rbp), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS26
+    leaq __sl25(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS26:
+    leaq -156(%rbp), %rax
+    movl $12, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $2, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS27
+    leaq __sl26(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS27:
+    leaq -156(%rbp), %rax
+    movl $24, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $3, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS28
+    leaq __sl27(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS28:
+    leaq -156(%rbp), %rax
+    movl $36, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $4, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS29
+    leaq __sl28(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS29:
+    xorb %al, %al
+    leaq -188(%rbp), %rdi
+    movq $32, %rcx
+    rep stosb
+    movl $1, %eax
+    movl %eax, -188(%rbp)
+    movl $2, %eax
+    movl %eax, -172(%rbp)
+    jmp .LS30
+.LS30:
+    leaq -188(%rbp), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    addq $0, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS31
+    leaq __sl30(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS31:
+    leaq -188(%rbp), %rax
+    movl $16, %edi
+    addq %rdi, %rax
+    addq $0, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $2, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS32
+    leaq __sl31(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS32:
+    xorb %al, %al
+    leaq -236(%rbp), %rdi
+    movq $48, %rcx
+    rep stosb
+    movl $1, %eax
+    movw %ax, -236(%rbp)
+    movl $2, %eax
+    movw %ax, -224(%rbp)
+    movl $3, %eax
+    movw %ax, -222(%rbp)
+    movl $4, %eax
+    movw %ax, -212(%rbp)
+    movl $5, %eax
+    movw %ax, -210(%rbp)
+    movl $6, %eax
+    movw %ax, -208(%rbp)
+    jmp .LS33
+.LS33:
+    leaq -236(%rbp), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movw (%rax, %rdi, 1), %ax
+    movl $1, %edi
+    movsx %ax, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS34
+    leaq __sl33(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS34:
+    leaq -236(%rbp), %rax
+    movl $12, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movw (%rax, %rdi, 1), %ax
+    movl $2, %edi
+    movsx %ax, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS35
+    leaq __sl34(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS35:
+    leaq -236(%rbp), %rax
+    movl $12, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    movl $2, %edi
+    movw (%rax, %rdi, 1), %ax
+    movl $3, %edi
+    movsx %ax, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS36
+    leaq __sl35(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS36:
+    leaq -236(%rbp), %rax
+    movl $24, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movw (%rax, %rdi, 1), %ax
+    movl $4, %edi
+    movsx %ax, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS37
+    leaq __sl36(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS37:
+    leaq -236(%rbp), %rax
+    movl $24, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    movl $2, %edi
+    movw (%rax, %rdi, 1), %ax
+    movl $5, %edi
+    movsx %ax, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS38
+    leaq __sl37(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS38:
+    leaq -236(%rbp), %rax
+    movl $24, %edi
+    addq %rdi, %rax
+    movl $4, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movw (%rax, %rdi, 1), %ax
+    movl $6, %edi
+    movsx %ax, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS39
+    leaq __sl38(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS39:
+    xorb %al, %al
+    leaq -248(%rbp), %rdi
+    movq $8, %rcx
+    rep stosb
+    movl $1, %eax
+    movl %eax, -248(%rbp)
+    movl $2, %eax
+    movl %eax, -244(%rbp)
+    xorb %al, %al
+    leaq -260(%rbp), %rdi
+    movq $12, %rcx
+    rep stosb
+    movl $3, %eax
+    movl %eax, -260(%rbp)
+    movl $4, %eax
+    movl %eax, -256(%rbp)
+    movl $5, %eax
+    movl %eax, -252(%rbp)
+    jmp .LS40
+.LS40:
+    leaq -248(%rbp), %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS41
+    leaq __sl40(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS41:
+    leaq -248(%rbp), %rax
+    movl $4, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $2, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS42
+    leaq __sl41(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS42:
+    jmp .LS43
+.LS43:
+    leaq -260(%rbp), %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $3, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS44
+    leaq __sl43(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS44:
+    leaq -260(%rbp), %rax
+    movl $4, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $4, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS45
+    leaq __sl44(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS45:
+    leaq -260(%rbp), %rax
+    movl $8, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $5, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS46
+    leaq __sl45(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS46:
+    movl $6513249, -264(%rbp)
+    movw $25185, -267(%rbp)
+    movb $99, -265(%rbp)
+    xorb %al, %al
+    leaq -271(%rbp), %rdi
+    movq $4, %rcx
+    rep stosb
+    movl $97, %eax
+    movb %al, -271(%rbp)
+    movl $98, %eax
+    movb %al, -270(%rbp)
+    movl $99, %eax
+    movb %al, -269(%rbp)
+    xorl %eax, %eax
+    movb %al, -268(%rbp)
+    xorb %al, %al
+    leaq -274(%rbp), %rdi
+    movq $3, %rcx
+    rep stosb
+    movl $97, %eax
+    movb %al, -274(%rbp)
+    movl $98, %eax
+    movb %al, -273(%rbp)
+    movl $99, %eax
+    movb %al, -272(%rbp)
+    jmp .LS47
+.LS47:
+    leaq -264(%rbp), %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    leaq -271(%rbp), %rdi
+    xorl %esi, %esi
+    movb (%rdi, %rsi, 1), %dil
+    movsx %al, %eax
+    movsx %dil, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS48
+    leaq __sl49(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS48:
+    leaq -264(%rbp), %rax
+    movl $1, %edi
+    movb (%rax, %rdi, 1), %al
+    leaq -271(%rbp), %rdi
+    movl $1, %esi
+    movb (%rdi, %rsi, 1), %dil
+    movsx %al, %eax
+    movsx %dil, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS49
+    leaq __sl50(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS49:
+    leaq -264(%rbp), %rax
+    movl $2, %edi
+    movb (%rax, %rdi, 1), %al
+    leaq -271(%rbp), %rdi
+    movl $2, %esi
+    movb (%rdi, %rsi, 1), %dil
+    movsx %al, %eax
+    movsx %dil, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS50
+    leaq __sl51(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS50:
+    leaq -264(%rbp), %rax
+    movl $3, %edi
+    movb (%rax, %rdi, 1), %al
+    leaq -271(%rbp), %rdi
+    movl $3, %esi
+    movb (%rdi, %rsi, 1), %dil
+    movsx %al, %eax
+    movsx %dil, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS51
+    leaq __sl52(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS51:
+    jmp .LS52
+.LS52:
+    leaq -267(%rbp), %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    leaq -274(%rbp), %rdi
+    xorl %esi, %esi
+    movb (%rdi, %rsi, 1), %dil
+    movsx %al, %eax
+    movsx %dil, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS53
+    leaq __sl54(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS53:
+    leaq -267(%rbp), %rax
+    movl $1, %edi
+    movb (%rax, %rdi, 1), %al
+    leaq -274(%rbp), %rdi
+    movl $1, %esi
+    movb (%rdi, %rsi, 1), %dil
+    movsx %al, %eax
+    movsx %dil, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS54
+    leaq __sl55(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS54:
+    leaq -267(%rbp), %rax
+    movl $2, %edi
+    movb (%rax, %rdi, 1), %al
+    leaq -274(%rbp), %rdi
+    movl $2, %esi
+    movb (%rdi, %rsi, 1), %dil
+    movsx %al, %eax
+    movsx %dil, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS55
+    leaq __sl56(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS55:
+    xorb %al, %al
+    leaq -308(%rbp), %rdi
+    movq $32, %rcx
+    rep stosb
+    movl $1, %eax
+    movl %eax, -308(%rbp)
+    movl $2, %eax
+    movl %eax, -292(%rbp)
+    jmp .LS56
+.LS56:
+    leaq -308(%rbp), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    addq $0, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS57
+    leaq __sl58(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS57:
+    leaq -308(%rbp), %rax
+    movl $16, %edi
+    addq %rdi, %rax
+    addq $0, %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $2, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS58
+    leaq __sl59(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS58:
+    xorl %edi, %edi
+    movl %edi, %eax
+    popq %r15
+    leave
+    ret
@@ -0,0 +1,524 @@
+    .data
+    .align 8
+v1:
+    .quad __sl0
+    .quad __sl1
+    .quad __sl2
+    .align 1
+str.1:
+    .long 0x6C6C6548
+    .word 0x6F
+    .align 4
+wstr.0:
+    .quad 0x6500000048
+    .quad 0x6C0000006C
+    .quad 0x6F
+    .section .rodata
+    .align 1
+__sl0:
+    .long 0x636261
+    .align 1
+__sl1:
+    .long 0x666564
+    .align 1
+__sl2:
+    .long 0x696867
+    .align 1
+__sl3:
+    .quad 0x28666F657A697327
+    .quad 0x6F68732027293176
+    .quad 0x6175716520646C75
+    .quad 0xA27343227206C
+    .align 1
+__sl4:
+    .quad 0x305B5D305B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27612727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl5:
+    .quad 0x315B5D305B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27622727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl6:
+    .quad 0x325B5D305B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27632727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl7:
+    .quad 0x305B5D315B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27642727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl8:
+    .quad 0x315B5D315B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27652727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl9:
+    .quad 0x325B5D315B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27662727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl10:
+    .quad 0x305B5D325B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27672727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl11:
+    .quad 0x315B5D325B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27682727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl12:
+    .quad 0x325B5D325B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27692727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl14:
+    .quad 0x28666F657A697327
+    .quad 0x6873202729727473
+    .quad 0x75716520646C756F
+    .quad 0xA273627206C61
+    .align 1
+__sl15:
+    .quad 0x275D305B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA272748
+    .byte 0x0
+    .align 1
+__sl16:
+    .quad 0x275D315B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA272765
+    .byte 0x0
+    .align 1
+__sl17:
+    .quad 0x275D325B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA27276C
+    .byte 0x0
+    .align 1
+__sl18:
+    .quad 0x275D335B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA27276C
+    .byte 0x0
+    .align 1
+__sl19:
+    .quad 0x275D345B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0xA27276F
+    .byte 0x0
+    .align 1
+__sl20:
+    .quad 0x275D355B72747327
+    .quad 0x20646C756F687320
+    .quad 0x2727206C61757165
+    .long 0x2727305C
+    .word 0xA
+    .align 1
+__sl22:
+    .quad 0x28666F657A697327
+    .quad 0x7320272972747377
+    .quad 0x716520646C756F68
+    .quad 0x27343227206C6175
+    .word 0xA
+    .align 1
+__sl23:
+    .quad 0x5D305B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27274827
+    .word 0xA
+    .align 1
+__sl24:
+    .quad 0x5D315B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27276527
+    .word 0xA
+    .align 1
+__sl25:
+    .quad 0x5D325B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27276C27
+    .word 0xA
+    .align 1
+__sl26:
+    .quad 0x5D335B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27276C27
+    .word 0xA
+    .align 1
+__sl27:
+    .quad 0x5D345B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27276F27
+    .word 0xA
+    .align 1
+__sl28:
+    .quad 0x5D355B7274737727
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27305C27
+    .word 0xA27
+    .byte 0x0
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    pushq %r15
+    jmp .LS1
+.LS1:
+    leaq v1(%rip), %rax
+    xorl %edi, %edi
+    movq (%rax, %rdi, 1), %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $97, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    leaq v1(%rip), %rax
+    xorl %edi, %edi
+    movq (%rax, %rdi, 1), %rax
+    movl $1, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $98, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS3
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS3:
+    leaq v1(%rip), %rax
+    xorl %edi, %edi
+    movq (%rax, %rdi, 1), %rax
+    movl $2, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $99, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS4
+    leaq __sl6(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS4:
+    leaq v1(%rip), %rax
+    movl $8, %edi
+    movq (%rax, %rdi, 1), %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $100, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS5
+    leaq __sl7(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS5:
+    leaq v1(%rip), %rax
+    movl $8, %edi
+    movq (%rax, %rdi, 1), %rax
+    movl $1, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $101, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS6
+    leaq __sl8(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS6:
+    leaq v1(%rip), %rax
+    movl $8, %edi
+    movq (%rax, %rdi, 1), %rax
+    movl $2, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $102, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS7
+    leaq __sl9(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS7:
+    leaq v1(%rip), %rax
+    movl $16, %edi
+    movq (%rax, %rdi, 1), %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $103, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS8
+    leaq __sl10(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS8:
+    leaq v1(%rip), %rax
+    movl $16, %edi
+    movq (%rax, %rdi, 1), %rax
+    movl $1, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $104, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS9
+    leaq __sl11(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS9:
+    leaq v1(%rip), %rax
+    movl $16, %edi
+    movq (%rax, %rdi, 1), %rax
+    movl $2, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $105, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS10
+    leaq __sl12(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS10:
+    jmp .LS11
+.LS11:
+    leaq str.1(%rip), %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $72, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS12
+    leaq __sl15(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS12:
+    leaq str.1(%rip), %rax
+    movl $1, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $101, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS13
+    leaq __sl16(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS13:
+    leaq str.1(%rip), %rax
+    movl $2, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $108, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS14
+    leaq __sl17(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS14:
+    leaq str.1(%rip), %rax
+    movl $3, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $108, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS15
+    leaq __sl18(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS15:
+    leaq str.1(%rip), %rax
+    movl $4, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $111, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS16
+    leaq __sl19(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS16:
+    leaq str.1(%rip), %rax
+    movl $5, %edi
+    movb (%rax, %rdi, 1), %al
+    xorl %edi, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS17
+    leaq __sl20(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS17:
+    jmp .LS18
+.LS18:
+    leaq wstr.0(%rip), %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $72, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS19
+    leaq __sl23(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS19:
+    leaq wstr.0(%rip), %rax
+    movl $4, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $101, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS20
+    leaq __sl24(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS20:
+    leaq wstr.0(%rip), %rax
+    movl $8, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $108, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS21
+    leaq __sl25(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS21:
+    leaq wstr.0(%rip), %rax
+    movl $12, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $108, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS22
+    leaq __sl26(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS22:
+    leaq wstr.0(%rip), %rax
+    movl $16, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $111, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS23
+    leaq __sl27(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS23:
+    leaq wstr.0(%rip), %rax
+    movl $20, %edi
+    movl (%rax, %rdi, 1), %eax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS24
+    leaq __sl28(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS24:
+    xorl %edi, %edi
+    movl %edi, %eax
+    popq %r15
+    leave
+    ret
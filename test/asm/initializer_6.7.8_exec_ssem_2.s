@@ -0,0 +1,366 @@
+    .data
+    .align 1
+v1:
+    .quad 0x66656400636261
+    .long 0x696867
+    .bss
+    .align 8
+ptr.1:
+    .zero 8
+    .align 4
+x.1:
+    .zero 4
+    .align 4
+y.1:
+    .zero 4
+    .section .rodata
+    .align 1
+__sl0:
+    .long 0x636261
+    .align 1
+__sl1:
+    .long 0x666564
+    .align 1
+__sl2:
+    .long 0x696867
+    .align 1
+__sl3:
+    .quad 0x28666F657A697327
+    .quad 0x6F68732027293176
+    .quad 0x6175716520646C75
+    .quad 0xA27323127206C
+    .align 1
+__sl4:
+    .quad 0x305B5D305B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27612727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl5:
+    .quad 0x315B5D305B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27622727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl6:
+    .quad 0x325B5D305B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27632727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl7:
+    .quad 0x305B5D315B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27642727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl8:
+    .quad 0x315B5D315B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27652727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl9:
+    .quad 0x325B5D315B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27662727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl10:
+    .quad 0x305B5D325B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27672727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl11:
+    .quad 0x315B5D325B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27682727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl12:
+    .quad 0x325B5D325B317627
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27692727
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl13:
+    .quad 0x6873202772747027
+    .quad 0x75716520646C756F
+    .quad 0x6168632827206C61
+    .quad 0xA273020292A72
+    .align 1
+__sl14:
+    .quad 0x756F687320277827
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 4
+__fc0:
+    .zero 4
+    .align 1
+__sl15:
+    .quad 0x756F687320277927
+    .quad 0x6C6175716520646C
+    .quad 0xA2766302E302720
+    .byte 0x0
+    .align 1
+__sl16:
+    .quad 0x27782E3269316427
+    .quad 0x20646C756F687320
+    .quad 0x3327206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl17:
+    .quad 0x27792E3269316427
+    .quad 0x20646C756F687320
+    .quad 0x3527206C61757165
+    .word 0xA27
+    .byte 0x0
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    jmp .LS1
+.LS1:
+    leaq v1(%rip), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $97, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    leaq v1(%rip), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    movl $1, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $98, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS3
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS3:
+    leaq v1(%rip), %rax
+    xorl %edi, %edi
+    addq %rdi, %rax
+    movl $2, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $99, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS4
+    leaq __sl6(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS4:
+    leaq v1(%rip), %rax
+    movl $4, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $100, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS5
+    leaq __sl7(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS5:
+    leaq v1(%rip), %rax
+    movl $4, %edi
+    addq %rdi, %rax
+    movl $1, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $101, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS6
+    leaq __sl8(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS6:
+    leaq v1(%rip), %rax
+    movl $4, %edi
+    addq %rdi, %rax
+    movl $2, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $102, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS7
+    leaq __sl9(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS7:
+    leaq v1(%rip), %rax
+    movl $8, %edi
+    addq %rdi, %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $103, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS8
+    leaq __sl10(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS8:
+    leaq v1(%rip), %rax
+    movl $8, %edi
+    addq %rdi, %rax
+    movl $1, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $104, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS9
+    leaq __sl11(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS9:
+    leaq v1(%rip), %rax
+    movl $8, %edi
+    addq %rdi, %rax
+    movl $2, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $105, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS10
+    leaq __sl12(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS10:
+    movq ptr.1(%rip), %rax
+    xorl %edi, %edi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS11
+    leaq __sl13(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS11:
+    movl x.1(%rip), %eax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS12
+    leaq __sl14(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS12:
+    movss y.1(%rip), %xmm0
+    movss __fc0(%rip), %xmm1
+    ucomiss %xmm1, %xmm0
+    setp %al
+    ucomiss %xmm1, %xmm0
+    je .LGEN1
+    movl $1, %eax
+.LGEN1:
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS13
+    leaq __sl15(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS13:
+    xorb %al, %al
+    leaq -8(%rbp), %rdi
+    movq $8, %rcx
+    rep stosb
+    movl $3, %eax
+    movl %eax, -8(%rbp)
+    movl $5, %eax
+    movl %eax, -4(%rbp)
+    leaq -8(%rbp), %rax
+    movq (%rax), %rax
+    movq %rax, -16(%rbp)
+    leaq -16(%rbp), %rax
+    movl (%rax), %eax
+    movl $3, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS14
+    leaq __sl16(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS14:
+    leaq -16(%rbp), %rax
+    movl 4(%rax), %eax
+    movl $5, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS15
+    leaq __sl17(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS15:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
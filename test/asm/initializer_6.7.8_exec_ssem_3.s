@@ -0,0 +1,242 @@
+    .data
+    .align 8
+d:
+    .quad 0x3FF0000000000000
+    .align 4
+f:
+    .long 0x40000000
+    .align 8
+l:
+    .quad 0xFFFFFFFFFFFFFFFF
+    .align 1
+c:
+    .byte 0x2C
+    .align 2
+s:
+    .word 0x1170
+    .align 1
+b:
+    .byte 0x1
+    .align 1
+bytes:
+    .quad 0x8090A0B0C0D0E0F
+    .quad 0x1020304050607
+    .align 1
+after:
+    .byte 0x63
+    .bss
+    .align 1
+z:
+    .zero 1
+    .section .rodata
+    .align 8
+__fc0:
+    .zero 8
+    .align 8
+__fc1:
+    .quad 0x3FF0000000000000
+    .align 1
+__sl0:
+    .quad 0x756F687320276427
+    .quad 0x6C6175716520646C
+    .quad 0xA27302E312720
+    .align 4
+__fc2:
+    .long 0x40000000
+    .align 1
+__sl1:
+    .quad 0x756F687320276627
+    .quad 0x6C6175716520646C
+    .quad 0xA2766302E322720
+    .byte 0x0
+    .align 1
+__sl2:
+    .quad 0x756F687320276C27
+    .quad 0x6C6175716520646C
+    .quad 0xA274C312D2720
+    .align 1
+__sl3:
+    .quad 0x756F687320276327
+    .quad 0x6C6175716520646C
+    .long 0x34342720
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl4:
+    .quad 0x756F687320277327
+    .quad 0x6C6175716520646C
+    .quad 0xA27343634342720
+    .byte 0x0
+    .align 1
+__sl5:
+    .quad 0x756F687320276227
+    .quad 0x6C6175716520646C
+    .long 0x27312720
+    .word 0xA
+    .align 1
+__sl6:
+    .quad 0x756F687320277A27
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 1
+__sl7:
+    .quad 0x305B736574796227
+    .quad 0x6C756F687320275D
+    .quad 0x206C617571652064
+    .long 0x27353127
+    .word 0xA
+    .align 1
+__sl8:
+    .quad 0x315B736574796227
+    .quad 0x756F687320275D35
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 1
+__sl9:
+    .quad 0x2027726574666127
+    .quad 0x6520646C756F6873
+    .quad 0x393927206C617571
+    .word 0xA27
+    .byte 0x0
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    pushq %r14
+    movsd d(%rip), %xmm0
+    movsd __fc1(%rip), %xmm1
+    ucomisd %xmm1, %xmm0
+    setp %dil
+    ucomisd %xmm1, %xmm0
+    je .LGEN1
+    movl $1, %edi
+.LGEN1:
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS1
+    leaq __sl0(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS1:
+    movss f(%rip), %xmm0
+    movss __fc2(%rip), %xmm1
+    ucomiss %xmm1, %xmm0
+    setp %dil
+    ucomiss %xmm1, %xmm0
+    je .LGEN2
+    movl $1, %edi
+.LGEN2:
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS2
+    leaq __sl1(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS2:
+    movq l(%rip), %rdi
+    movq $18446744073709551615, %rsi
+    cmpq %rsi, %rdi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS3
+    leaq __sl2(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS3:
+    movb c(%rip), %dil
+    movl $44, %esi
+    movsx %dil, %edi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS4
+    leaq __sl3(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS4:
+    movw s(%rip), %di
+    movl $4464, %esi
+    movzx %di, %edi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS5
+    leaq __sl4(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS5:
+    movb b(%rip), %dil
+    movl $1, %esi
+    movzx %dil, %edi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS6
+    leaq __sl5(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS6:
+    movb z(%rip), %dil
+    xorl %esi, %esi
+    movzx %dil, %edi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS7
+    leaq __sl6(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS7:
+    leaq bytes(%rip), %rdi
+    xorl %esi, %esi
+    movb (%rdi, %rsi, 1), %dil
+    movl $15, %esi
+    movzx %dil, %edi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS8
+    leaq __sl7(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS8:
+    leaq bytes(%rip), %rdi
+    movl $15, %esi
+    movb (%rdi, %rsi, 1), %dil
+    xorl %esi, %esi
+    movzx %dil, %edi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS9
+    leaq __sl8(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS9:
+    movb after(%rip), %dil
+    movl $99, %esi
+    movzx %dil, %edi
+    cmpl %esi, %edi
+    setne %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    je .LS10
+    leaq __sl9(%rip), %rdi
+    call puts
+    movl %eax, %edi
+.LS10:
+    xorl %esi, %esi
+    movl %esi, %eax
+    popq %r14
+    leave
+    ret
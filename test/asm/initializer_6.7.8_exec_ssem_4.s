@@ -0,0 +1,423 @@
+    .data
+    .align 4
+sparse:
+    .zero 12
+    .long 0x7
+    .zero 2097136
+    .long 0xFFFFFFFF
+    .zero 2097144
+    .long 0x2A
+    .align 8
+mixed:
+    .quad 0x5
+    .zero 100
+    .byte 0x1
+    .zero 3995
+    .quad sparse+12
+    .word 0x9
+    .zero 6
+    .align 1
+text:
+    .word 0x6968
+    .byte 0x0
+    .zero 253
+    .bss
+    .align 1
+big:
+    .zero 16777216
+    .align 4
+zeros:
+    .zero 256
+    .section .rodata
+    .align 1
+__sl1:
+    .quad 0x275D305B67696227
+    .quad 0x20646C756F687320
+    .quad 0x3027206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl2:
+    .quad 0x2031285B67696227
+    .quad 0x2D20293432203C3C
+    .quad 0x6F687320275D3120
+    .quad 0x6175716520646C75
+    .long 0x3027206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl3:
+    .quad 0x3332315B67696227
+    .quad 0x6F687320275D3534
+    .quad 0x6175716520646C75
+    .long 0x3327206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl4:
+    .quad 0x5B65737261707327
+    .quad 0x756F687320275D30
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 1
+__sl5:
+    .quad 0x5B65737261707327
+    .quad 0x756F687320275D33
+    .quad 0x6C6175716520646C
+    .long 0x27372720
+    .word 0xA
+    .align 1
+__sl6:
+    .quad 0x5B65737261707327
+    .quad 0x756F687320275D34
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 1
+__sl7:
+    .quad 0x5B65737261707327
+    .quad 0x5D3931203C3C2031
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA27312D
+    .byte 0x0
+    .align 1
+__sl8:
+    .quad 0x5B65737261707327
+    .quad 0x3032203C3C203128
+    .quad 0x20275D31202D2029
+    .quad 0x6520646C756F6873
+    .quad 0x323427206C617571
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl9:
+    .quad 0x612E646578696D27
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2735
+    .align 1
+__sl10:
+    .quad 0x672E646578696D27
+    .quad 0x20275D39395B7061
+    .quad 0x6520646C756F6873
+    .quad 0x273027206C617571
+    .word 0xA
+    .align 1
+__sl11:
+    .quad 0x672E646578696D27
+    .quad 0x275D3030315B7061
+    .quad 0x20646C756F687320
+    .quad 0x3127206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl12:
+    .quad 0x672E646578696D27
+    .quad 0x275D3130315B7061
+    .quad 0x20646C756F687320
+    .quad 0x3027206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl13:
+    .quad 0x2E646578696D2A27
+    .quad 0x6C756F6873202770
+    .quad 0x206C617571652064
+    .long 0xA273727
+    .byte 0x0
+    .align 1
+__sl14:
+    .quad 0x732E646578696D27
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2739
+    .align 1
+__sl15:
+    .quad 0x365B736F72657A27
+    .quad 0x756F687320275D33
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 1
+__sl16:
+    .quad 0x5D315B7478657427
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0x27276927
+    .word 0xA
+    .align 1
+__sl17:
+    .quad 0x5D325B7478657427
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2730
+    .align 1
+__sl18:
+    .quad 0x35325B7478657427
+    .quad 0x756F687320275D35
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    pushq %r15
+    leaq big(%rip), %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    xorl %edi, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    leaq big(%rip), %rax
+    movl $16777215, %edi
+    movb (%rax, %rdi, 1), %al
+    xorl %edi, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    leaq big(%rip), %rax
+    movl $12345, %edi
+    addq %rdi, %rax
+    movl $3, %edi
+    movb %dil, (%rax)
+    leaq big(%rip), %rax
+    movl $12345, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $3, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS3
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS3:
+    leaq sparse(%rip), %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS4
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS4:
+    leaq sparse(%rip), %rax
+    movl $12, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $7, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS5
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS5:
+    leaq sparse(%rip), %rax
+    movl $16, %edi
+    movl (%rax, %rdi, 1), %eax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS6
+    leaq __sl6(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS6:
+    leaq sparse(%rip), %rax
+    movl $2097152, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $4294967295, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS7
+    leaq __sl7(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS7:
+    leaq sparse(%rip), %rax
+    movl $4194300, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $42, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS8
+    leaq __sl8(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS8:
+    leaq mixed(%rip), %rax
+    movq (%rax), %rax
+    movq $5, %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS9
+    leaq __sl9(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS9:
+    leaq mixed(%rip), %rax
+    addq $8, %rax
+    movl $99, %edi
+    movb (%rax, %rdi, 1), %al
+    xorl %edi, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS10
+    leaq __sl10(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS10:
+    leaq mixed(%rip), %rax
+    addq $8, %rax
+    movl $100, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $1, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS11
+    leaq __sl11(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS11:
+    leaq mixed(%rip), %rax
+    addq $8, %rax
+    movl $101, %edi
+    movb (%rax, %rdi, 1), %al
+    xorl %edi, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS12
+    leaq __sl12(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS12:
+    leaq mixed(%rip), %rax
+    movq 4104(%rax), %rax
+    movl (%rax), %eax
+    movl $7, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS13
+    leaq __sl13(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS13:
+    leaq mixed(%rip), %rax
+    movw 4112(%rax), %ax
+    movl $9, %edi
+    movsx %ax, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS14
+    leaq __sl14(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS14:
+    leaq zeros(%rip), %rax
+    movl $252, %edi
+    movl (%rax, %rdi, 1), %eax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS15
+    leaq __sl15(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS15:
+    leaq text(%rip), %rax
+    movl $1, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $105, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS16
+    leaq __sl16(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS16:
+    leaq text(%rip), %rax
+    movl $2, %edi
+    movb (%rax, %rdi, 1), %al
+    xorl %edi, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS17
+    leaq __sl17(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS17:
+    leaq text(%rip), %rax
+    movl $255, %edi
+    movb (%rax, %rdi, 1), %al
+    xorl %edi, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS18
+    leaq __sl18(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS18:
+    xorl %edi, %edi
+    movl %edi, %eax
+    popq %r15
+    leave
+    ret
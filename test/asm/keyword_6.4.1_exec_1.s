@@ -0,0 +1,254 @@
+    .data
+    .align 4
+counter:
+    .long 0x2
+    .section .rodata
+    .align 8
+__fc0:
+    .quad 0x3FF0000000000000
+    .align 1
+__sl0:
+    .quad 0x687320276D757327
+    .quad 0x75716520646C756F
+    .quad 0xA27323127206C61
+    .byte 0x0
+    .align 1
+__sl1:
+    .quad 0x6F68732027722A27
+    .quad 0x6175716520646C75
+    .quad 0xA27323127206C
+    .align 1
+__sl2:
+    .quad 0x74737269662E7027
+    .quad 0x6365732E70202B20
+    .quad 0x6F68732027646E6F
+    .quad 0x6175716520646C75
+    .long 0x3327206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl3:
+    .quad 0x68732027692E7727
+    .quad 0x75716520646C756F
+    .quad 0xA273027206C61
+    .align 1
+__sl4:
+    .quad 0x28666F657A697327
+    .quad 0x6C6F63206D756E65
+    .quad 0x6F6873202729726F
+    .quad 0x6175716520646C75
+    .long 0x3427206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl5:
+    .quad 0x73202767616C6627
+    .quad 0x716520646C756F68
+    .quad 0xA273127206C6175
+    .byte 0x0
+    .align 1
+__sl6:
+    .quad 0x732029746E692827
+    .quad 0x68732027656C6163
+    .quad 0x75716520646C756F
+    .quad 0xA273127206C61
+    .align 1
+__sl7:
+    .quad 0x28666F657A697327
+    .quad 0x73202729657A6973
+    .quad 0x716520646C756F68
+    .quad 0xA273827206C6175
+    .byte 0x0
+    .text
+twice:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %eax
+    addl %eax, %eax
+    movl %eax, %edi
+    movl %edi, %eax
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $64, %rsp
+    pushq %rbx
+    xorl %eax, %eax
+    movl %eax, -4(%rbp)
+    movsd __fc0(%rip), %xmm1
+    movsd %xmm1, -16(%rbp)
+    xorq %rax, %rax
+    movq %rax, -24(%rbp)
+    movl $1, %eax
+    movb %al, -25(%rbp)
+    xorb %al, %al
+    leaq -30(%rbp), %rdi
+    movq $4, %rcx
+    rep stosb
+    movl $1, %eax
+    movw %ax, -30(%rbp)
+    movl $2, %eax
+    movb %al, -28(%rbp)
+    leaq -36(%rbp), %rax
+    addq $0, %rax
+    xorl %edi, %edi
+    movl %edi, (%rax)
+    movl $1, %eax
+    movl %eax, -40(%rbp)
+    leaq -4(%rbp), %rax
+    movq %rax, -48(%rbp)
+    xorl %eax, %eax
+    movl %eax, -52(%rbp)
+    movl $10, %edi
+    leaq -52(%rbp), %rsi
+    leaq -24(%rbp), %r11
+    movl $2, %r10d
+    movl $8, %r9d
+    jmp .LS7
+.LS6:
+    movl -52(%rbp), %r8d
+    cmpl %r9d, %r8d
+    sete %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS4
+    jmp .LS1
+.LS4:
+    movl %r8d, %eax
+    xorl %edx, %edx
+    idivl %r10d
+    movl %edx, %eax
+    cmpl $0, %eax
+    je .LS3
+    jmp .LS2
+.LS3:
+.LS5:
+    movsx %r8d, %rax
+    addq %rax, (%r11)
+.LS2:
+    addl $1, (%rsi)
+.LS7:
+    movl -52(%rbp), %eax
+    cmpl %edi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS6
+.LS1:
+.LS8:
+    movl counter(%rip), %eax
+    movl %eax, %edi
+    call twice
+    movl %eax, %edi
+    leaq -4(%rbp), %rax
+    addl %edi, (%rax)
+    movl -4(%rbp), %eax
+    movl $10, %edi
+    cmpl %edi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS8
+    movl -40(%rbp), %eax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    sete %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS9
+    jmp .LL1
+.LS9:
+    movq -24(%rbp), %rax
+    movq $12, %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS10
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS10:
+    movq -48(%rbp), %rax
+    movl (%rax), %eax
+    movl $12, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS11
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS11:
+    leaq -30(%rbp), %rax
+    movw (%rax), %ax
+    leaq -30(%rbp), %rdi
+    movb 2(%rdi), %dil
+    movsx %ax, %eax
+    movsx %dil, %edi
+    addl %edi, %eax
+    movl $3, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS12
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS12:
+    leaq -36(%rbp), %rax
+    movl (%rax), %eax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS13
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS13:
+    jmp .LS14
+.LS14:
+    movb -25(%rbp), %al
+    movl $1, %edi
+    movzx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS15
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS15:
+    movsd -16(%rbp), %xmm1
+    cvttsd2sil %xmm1, %eax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS16
+    leaq __sl6(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS16:
+    jmp .LS17
+.LS17:
+    xorl %edi, %edi
+    movl %edi, %eax
+    jmp .LR2
+.LL1:
+    movl $1, %edi
+    movl %edi, %eax
+.LR2:
+    popq %rbx
+    leave
+    ret
@@ -0,0 +1,711 @@
+    .bss
+    .align 4
+counter:
+    .zero 4
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x746375646F727027
+    .quad 0x79646F625F6E695F
+    .quad 0x35202C34202C3328
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .quad 0x2035202A20323127
+    .long 0x3031202B
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl1:
+    .quad 0x746375646F727027
+    .quad 0x79646F625F6E695F
+    .quad 0x30202C34202C3328
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0xA273027
+    .byte 0x0
+    .align 1
+__sl2:
+    .quad 0x746375646F727027
+    .quad 0x646E6F635F6E695F
+    .quad 0x2C33286E6F697469
+    .quad 0x6F68732027293420
+    .quad 0x6175716520646C75
+    .quad 0xA27323127206C
+    .align 1
+__sl3:
+    .quad 0x5F6E656C6C616627
+    .quad 0x202C31286F746E69
+    .quad 0x756F687320272933
+    .quad 0x6C6175716520646C
+    .quad 0x2039202B20382720
+    .long 0x3031202B
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl4:
+    .quad 0x5F6E656C6C616627
+    .quad 0x202C31286F746E69
+    .quad 0x756F687320272930
+    .quad 0x6C6175716520646C
+    .long 0x27382720
+    .word 0xA
+    .align 1
+__sl5:
+    .quad 0x646E615F776F7227
+    .quad 0x286E6D756C6F635F
+    .quad 0x2932202C32202C6D
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .quad 0x2B2033202A203633
+    .quad 0x2B2033202A203420
+    .quad 0xA2737202A203420
+    .byte 0x0
+    .align 1
+__sl6:
+    .quad 0x6465647261756727
+    .quad 0x76262864616F6C5F
+    .quad 0x687320272933202C
+    .quad 0x75716520646C756F
+    .quad 0xA27313227206C61
+    .byte 0x0
+    .align 1
+__sl7:
+    .quad 0x6465647261756727
+    .quad 0x69282864616F6C5F
+    .quad 0x202C3020292A746E
+    .quad 0x756F687320272930
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 1
+__sl8:
+    .quad 0x775F6C61636F6C27
+    .quad 0x34286E6574746972
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .quad 0x203031202B203227
+    .quad 0x31202B203231202B
+    .long 0xA2734
+    .align 1
+__sl9:
+    .quad 0x5F6465726F747327
+    .quad 0x5F6867756F726874
+    .quad 0x7726287361696C61
+    .quad 0x2933202C7726202C
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .quad 0x2B2033202B203228
+    .quad 0x2733202A20293420
+    .word 0xA
+    .align 1
+__sl10:
+    .quad 0x2864656C6C616327
+    .quad 0x756F687320272933
+    .quad 0x6C6175716520646C
+    .quad 0x32202B2031312720
+    .quad 0xA273333202B2032
+    .byte 0x0
+    .align 1
+__sl11:
+    .quad 0x6465646976696427
+    .quad 0x33202C32202C3728
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .quad 0xA2734202A203327
+    .byte 0x0
+    .align 1
+__sl12:
+    .quad 0x6465646976696427
+    .quad 0x30202C30202C3728
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0xA273027
+    .byte 0x0
+    .text
+next:
+    pushq %rbp
+    movq %rsp, %rbp
+    leaq counter(%rip), %rax
+    addl $1, (%rax)
+    movl (%rax), %edi
+    movl %edi, %eax
+    leave
+    ret
+product_in_body:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    movl %edx, -12(%rbp)
+    xorl %eax, %eax
+    movl %eax, -16(%rbp)
+    xorl %eax, %eax
+    movl %eax, -20(%rbp)
+    movl -12(%rbp), %edi
+    movl -4(%rbp), %eax
+    movl -8(%rbp), %esi
+    imull %esi, %eax
+    movl %eax, %ecx
+    leaq -16(%rbp), %rdx
+    leaq -20(%rbp), %rsi
+    jmp .LS2
+.LS1:
+    movl -20(%rbp), %eax
+    movl %ecx, %r8d
+    addl %eax, %r8d
+    movl %r8d, %eax
+    addl %eax, (%rdx)
+    addl $1, (%rsi)
+.LS2:
+    movl -20(%rbp), %eax
+    cmpl %edi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS1
+    movl -16(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+product_in_condition:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    xorl %eax, %eax
+    movl %eax, -12(%rbp)
+    movl -4(%rbp), %eax
+    movl -8(%rbp), %edi
+    imull %edi, %eax
+    movl %eax, %edi
+    leaq -12(%rbp), %rsi
+    jmp .LS4
+.LS3:
+    addl $1, (%rsi)
+.LS4:
+    movl -12(%rbp), %eax
+    cmpl %edi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS3
+    movl -12(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+fallen_into:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    xorl %esi, %esi
+    movl %esi, -12(%rbp)
+    xorl %esi, %esi
+    movl %esi, -16(%rbp)
+    movl -4(%rbp), %edx
+    movl -8(%rbp), %r8d
+    leaq -12(%rbp), %r9
+    movl $3, %r10d
+    leaq -16(%rbp), %rax
+.LS5:
+    movl %r10d, %ecx
+    movl %edx, %esi
+    shll %cl, %esi
+    movl -16(%rbp), %ecx
+    xorl %ecx, %esi
+    addl %esi, (%r9)
+    addl $1, (%rax)
+    movl (%rax), %esi
+    cmpl %r8d, %esi
+    setl %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    jne .LS5
+    movl -12(%rbp), %esi
+    movl %esi, %eax
+    leave
+    ret
+row_and_column:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    pushq %r15
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    movl %edx, -16(%rbp)
+    xorl %eax, %eax
+    movl %eax, -20(%rbp)
+    xorl %eax, %eax
+    movl %eax, -24(%rbp)
+    movl -12(%rbp), %edi
+    movl -16(%rbp), %ecx
+    movl %ecx, %eax
+    imull $4, %eax
+    movl %eax, %r8d
+    movl $4, %esi
+    leaq -20(%rbp), %rdx
+    jmp .LS9
+.LS8:
+    xorl %eax, %eax
+    movl %eax, -28(%rbp)
+    movq -8(%rbp), %rax
+    movl -24(%rbp), %r9d
+    imull $16, %r9d
+    addq %r9, %rax
+    movq %rax, %r9
+    jmp .LS7
+.LS6:
+    movl -28(%rbp), %eax
+    imull $4, %eax
+    movl (%r9, %rax, 1), %r10d
+    movl $1, %r11d
+    movl %ecx, %eax
+    addl %r11d, %eax
+    imull %eax, %r10d
+    movl %r10d, %eax
+    movl (%r9, %r8, 1), %r10d
+    addl %r10d, %eax
+    addl %eax, (%rdx)
+    leaq -28(%rbp), %rax
+    addl $1, (%rax)
+.LS7:
+    movl -28(%rbp), %eax
+    cmpl %esi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS6
+    leaq -24(%rbp), %rax
+    addl $1, (%rax)
+.LS9:
+    movl -24(%rbp), %eax
+    cmpl %edi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS8
+    movl -20(%rbp), %edi
+    movl %edi, %eax
+    popq %r15
+    leave
+    ret
+guarded_load:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorl %esi, %esi
+    movl %esi, -16(%rbp)
+    xorl %esi, %esi
+    movl %esi, -20(%rbp)
+    movl -12(%rbp), %eax
+    movq -8(%rbp), %rdx
+    leaq -16(%rbp), %rcx
+    leaq -20(%rbp), %r8
+    jmp .LS11
+.LS10:
+    movl (%rdx), %esi
+    addl %esi, (%rcx)
+    addl $1, (%r8)
+.LS11:
+    movl -20(%rbp), %esi
+    cmpl %eax, %esi
+    setl %sil
+    andq $1, %rsi
+    cmpl $0, %esi
+    jne .LS10
+    movl -16(%rbp), %esi
+    movl %esi, %eax
+    leave
+    ret
+local_written:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl $1, %edi
+    movl %edi, -8(%rbp)
+    xorl %edi, %edi
+    movl %edi, -12(%rbp)
+    xorl %edi, %edi
+    movl %edi, -16(%rbp)
+    movl -4(%rbp), %edi
+    leaq -12(%rbp), %rsi
+    movl $2, %edx
+    leaq -8(%rbp), %rcx
+    movl $5, %r8d
+    leaq -16(%rbp), %r9
+    jmp .LS13
+.LS12:
+    movl -8(%rbp), %eax
+    imull %edx, %eax
+    addl %eax, (%rsi)
+    movl -16(%rbp), %eax
+    addl %r8d, %eax
+    movl %eax, (%rcx)
+    addl $1, (%r9)
+.LS13:
+    movl -16(%rbp), %eax
+    cmpl %edi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS12
+    movl -12(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+stored_through_alias:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movq %rdi, -8(%rbp)
+    movq %rsi, -16(%rbp)
+    movl %edx, -20(%rbp)
+    xorl %eax, %eax
+    movl %eax, -24(%rbp)
+    xorl %eax, %eax
+    movl %eax, -28(%rbp)
+    leaq -24(%rbp), %rdx
+    movl $3, %ecx
+    movl $1, %r8d
+    leaq -28(%rbp), %rsi
+    jmp .LS15
+.LS14:
+    movq -16(%rbp), %rax
+    movl (%rax), %eax
+    imull %ecx, %eax
+    addl %eax, (%rdx)
+    movq -8(%rbp), %rax
+    addl %r8d, (%rax)
+    addl $1, (%rsi)
+.LS15:
+    movl -28(%rbp), %eax
+    movl -20(%rbp), %edi
+    cmpl %edi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS14
+    movl -24(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+called:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    pushq %rbx
+    movl %edi, -4(%rbp)
+    xorl %eax, %eax
+    movl %eax, -8(%rbp)
+    xorl %eax, %eax
+    movl %eax, -12(%rbp)
+    jmp .LS17
+.LS16:
+    call next
+    movl %eax, %edi
+    leaq -8(%rbp), %rax
+    addl %edi, (%rax)
+    leaq -8(%rbp), %rax
+    movl counter(%rip), %edi
+    movl $10, %esi
+    imull %esi, %edi
+    addl %edi, (%rax)
+    leaq -12(%rbp), %rax
+    addl $1, (%rax)
+.LS17:
+    movl -12(%rbp), %eax
+    movl -4(%rbp), %edi
+    cmpl %edi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS16
+    movl -8(%rbp), %edi
+    movl %edi, %eax
+    popq %rbx
+    leave
+    ret
+divided:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    movl %edx, -12(%rbp)
+    xorl %eax, %eax
+    movl %eax, -16(%rbp)
+    xorl %eax, %eax
+    movl %eax, -20(%rbp)
+    movl -12(%rbp), %edi
+    movl -4(%rbp), %ecx
+    movl -8(%rbp), %r8d
+    leaq -16(%rbp), %r9
+    leaq -20(%rbp), %rsi
+    jmp .LS19
+.LS18:
+    movl %ecx, %eax
+    xorl %edx, %edx
+    idivl %r8d
+    movl %eax, %r10d
+    movl %ecx, %eax
+    xorl %edx, %edx
+    idivl %r8d
+    movl %edx, %eax
+    addl %eax, %r10d
+    movl %r10d, %eax
+    addl %eax, (%r9)
+    addl $1, (%rsi)
+.LS19:
+    movl -20(%rbp), %eax
+    cmpl %edi, %eax
+    setl %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS18
+    movl -16(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $48, %rsp
+    movl $3, %eax
+    movl $4, %edi
+    movl $5, %esi
+    movl %esi, %edx
+    movl %edi, %esi
+    movl %eax, %edi
+    call product_in_body
+    movl $70, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS20
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS20:
+    movl $3, %eax
+    movl $4, %edi
+    xorl %esi, %esi
+    movl %esi, %edx
+    movl %edi, %esi
+    movl %eax, %edi
+    call product_in_body
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS21
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS21:
+    movl $3, %eax
+    movl $4, %edi
+    movl %edi, %esi
+    movl %eax, %edi
+    call product_in_condition
+    movl $12, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS22
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS22:
+    movl $1, %eax
+    movl $3, %edi
+    movl %edi, %esi
+    movl %eax, %edi
+    call fallen_into
+    movl $27, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS23
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS23:
+    movl $1, %eax
+    xorl %edi, %edi
+    movl %edi, %esi
+    movl %eax, %edi
+    call fallen_into
+    movl $8, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS24
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS24:
+    xorb %al, %al
+    leaq -32(%rbp), %rdi
+    movq $32, %rcx
+    rep stosb
+    movl $1, %eax
+    movl %eax, -32(%rbp)
+    movl $2, %eax
+    movl %eax, -28(%rbp)
+    movl $3, %eax
+    movl %eax, -24(%rbp)
+    movl $4, %eax
+    movl %eax, -20(%rbp)
+    movl $5, %eax
+    movl %eax, -16(%rbp)
+    movl $6, %eax
+    movl %eax, -12(%rbp)
+    movl $7, %eax
+    movl %eax, -8(%rbp)
+    movl $8, %eax
+    movl %eax, -4(%rbp)
+    leaq -32(%rbp), %rax
+    movl $2, %edi
+    movl $2, %esi
+    movl %esi, %edx
+    movl %edi, %esi
+    movq %rax, %rdi
+    call row_and_column
+    movl $148, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS25
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS25:
+    movl $7, %eax
+    movl %eax, -36(%rbp)
+    leaq -36(%rbp), %rax
+    movl $3, %edi
+    movl %edi, %esi
+    movq %rax, %rdi
+    call guarded_load
+    movl $21, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS26
+    leaq __sl6(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS26:
+    xorl %eax, %eax
+    xorl %edi, %edi
+    movl %edi, %esi
+    movl %eax, %edi
+    call guarded_load
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS27
+    leaq __sl7(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS27:
+    movl $4, %eax
+    movl %eax, %edi
+    call local_written
+    movl $38, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS28
+    leaq __sl8(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS28:
+    movl $2, %eax
+    movl %eax, -40(%rbp)
+    leaq -40(%rbp), %rax
+    leaq -40(%rbp), %rdi
+    movl $3, %esi
+    movl %esi, %edx
+    movq %rdi, %rsi
+    movq %rax, %rdi
+    call stored_through_alias
+    movl %eax, %edi
+    movl $27, %eax
+    cmpl %eax, %edi
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS29
+    leaq __sl9(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS29:
+    movl $3, %eax
+    movl %eax, %edi
+    call called
+    movl $66, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS30
+    leaq __sl10(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS30:
+    movl $7, %eax
+    movl $2, %edi
+    movl $3, %esi
+    movl %esi, %edx
+    movl %edi, %esi
+    movl %eax, %edi
+    call divided
+    movl $12, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS31
+    leaq __sl11(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS31:
+    movl $7, %eax
+    xorl %edi, %edi
+    xorl %esi, %esi
+    movl %esi, %edx
+    movl %edi, %esi
+    movl %eax, %edi
+    call divided
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS32
+    leaq __sl12(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS32:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
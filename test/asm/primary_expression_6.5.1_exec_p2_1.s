@@ -0,0 +1,50 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x756F687320276127
+    .quad 0x6C6175716520646C
+    .long 0x27352720
+    .word 0xA
+    .align 1
+__sl1:
+    .quad 0x6873202772747027
+    .quad 0x75716520646C756F
+    .quad 0x6E69616D27206C61
+    .word 0xA27
+    .byte 0x0
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl $5, %eax
+    movl %eax, -4(%rbp)
+    movl -4(%rbp), %eax
+    movl $5, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    leaq main(%rip), %rax
+    movq %rax, -16(%rbp)
+    movq -16(%rbp), %rax
+    leaq main(%rip), %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
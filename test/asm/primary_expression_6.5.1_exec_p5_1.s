@@ -0,0 +1,79 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x756F687320276227
+    .quad 0x6C6175716520646C
+    .long 0x27352720
+    .word 0xA
+    .align 1
+__sl1:
+    .quad 0x756F687320276227
+    .quad 0x6C6175716520646C
+    .long 0x27362720
+    .word 0xA
+    .align 1
+__sl2:
+    .quad 0x756F687320276227
+    .quad 0x6C6175716520646C
+    .long 0x362D2720
+    .word 0xA27
+    .byte 0x0
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl $5, %eax
+    movl %eax, -4(%rbp)
+    movl -4(%rbp), %eax
+    movl %eax, -8(%rbp)
+    movl -8(%rbp), %eax
+    movl $5, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    leaq -8(%rbp), %rax
+    movl -4(%rbp), %edi
+    movl $1, %esi
+    addl %esi, %edi
+    movsx %edi, %rdi
+    movl %edi, (%rax)
+    movl -8(%rbp), %eax
+    movl $6, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    leaq -8(%rbp), %rax
+    movl -8(%rbp), %edi
+    movl $2, %esi
+    imull %esi, %edi
+    negl %edi
+    addl %edi, (%rax)
+    movl (%rax), %eax
+    movl $4294967290, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS3
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS3:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
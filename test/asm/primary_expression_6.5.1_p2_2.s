@@ -0,0 +1,10 @@
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
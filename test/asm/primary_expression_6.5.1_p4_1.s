@@ -0,0 +1,16 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .word 0x61
+    .align 1
+__sl1:
+    .word 0x62
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
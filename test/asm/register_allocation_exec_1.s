@@ -0,0 +1,343 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x2864616572657227
+    .quad 0x756F687320272931
+    .quad 0x6C6175716520646C
+    .quad 0xA273131322720
+    .align 1
+__sl1:
+    .quad 0x7261705F6F777427
+    .quad 0x35202C3228736D61
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0x33303127
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl2:
+    .quad 0x705F656572687427
+    .quad 0x2C3128736D617261
+    .quad 0x20272933202C3220
+    .quad 0x6520646C756F6873
+    .quad 0x353627206C617571
+    .long 0xA2733
+    .align 1
+__sl3:
+    .quad 0x2C37286564697727
+    .quad 0x6F68732027293320
+    .quad 0x6175716520646C75
+    .quad 0x273139303427206C
+    .word 0xA
+    .align 1
+__sl4:
+    .quad 0x64656E6961686327
+    .quad 0x6F68732027293128
+    .quad 0x6175716520646C75
+    .quad 0x273137343227206C
+    .word 0xA
+    .align 1
+__sl5:
+    .quad 0x3328646578696D27
+    .quad 0x687320272934202C
+    .quad 0x75716520646C756F
+    .quad 0x3731323127206C61
+    .word 0xA27
+    .byte 0x0
+    .text
+reread:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    pushq %rbx
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %eax
+    movl $1, %edi
+    addl %edi, %eax
+    movl %eax, -8(%rbp)
+    leaq -4(%rbp), %rax
+    movl $10, %edi
+    movl %edi, (%rax)
+    movl -8(%rbp), %eax
+    movl $100, %edi
+    imull %edi, %eax
+    movl -4(%rbp), %edi
+    movl $1, %esi
+    addl %esi, %edi
+    addl %edi, %eax
+    movl %eax, %edi
+    movl %edi, %eax
+    popq %rbx
+    leave
+    ret
+two_params:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    pushq %rbx
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    movl -4(%rbp), %eax
+    movl -8(%rbp), %edi
+    movl %eax, %esi
+    imull %edi, %esi
+    movl %esi, %edi
+    movl %edi, -12(%rbp)
+    leaq -8(%rbp), %rdi
+    movl $3, %esi
+    addl %esi, %eax
+    movl %eax, (%rdi)
+    movl -12(%rbp), %eax
+    movl $10, %edi
+    imull %edi, %eax
+    movl -8(%rbp), %edi
+    movl -4(%rbp), %esi
+    subl %esi, %edi
+    addl %edi, %eax
+    movl %eax, %edi
+    movl %edi, %eax
+    popq %rbx
+    leave
+    ret
+three_params:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    pushq %rbx
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    movl %edx, -12(%rbp)
+    movl -4(%rbp), %esi
+    movl -8(%rbp), %eax
+    movl %esi, %edx
+    addl %eax, %edx
+    movl -12(%rbp), %eax
+    addl %eax, %edx
+    movl %edx, -16(%rbp)
+    leaq -12(%rbp), %rax
+    movl -16(%rbp), %ecx
+    movl %ecx, %edx
+    subl %esi, %edx
+    movl %edx, (%rax)
+    movl $100, %edx
+    imull %edx, %ecx
+    movl %ecx, %edx
+    movl -12(%rbp), %esi
+    movl $10, %eax
+    imull %eax, %esi
+    addl %esi, %edx
+    movl -4(%rbp), %esi
+    movl -8(%rbp), %eax
+    xorl %eax, %esi
+    addl %esi, %edx
+    movl %edx, %eax
+    popq %rbx
+    leave
+    ret
+wide:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    pushq %rbx
+    movq %rdi, -8(%rbp)
+    movq %rsi, -16(%rbp)
+    movq -8(%rbp), %rax
+    movq -16(%rbp), %rdi
+    subq %rdi, %rax
+    movq %rax, -24(%rbp)
+    leaq -8(%rbp), %rax
+    movq $2, %rsi
+    imulq %rsi, %rdi
+    movq %rdi, (%rax)
+    movq -24(%rbp), %rax
+    movq $1000, %rdi
+    imulq %rdi, %rax
+    movq -8(%rbp), %rdi
+    movq -16(%rbp), %rsi
+    movq %rdi, %rdx
+    addq %rsi, %rdx
+    movq $10, %rcx
+    imulq %rcx, %rdx
+    addq %rdx, %rax
+    cmpq %rsi, %rdi
+    setg %dil
+    andq $1, %rdi
+    movsx %edi, %rdi
+    addq %rdi, %rax
+    movq %rax, %rdi
+    movq %rdi, %rax
+    popq %rbx
+    leave
+    ret
+chained:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    pushq %rbx
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %edi
+    movl $1, %eax
+    addl %eax, %edi
+    movl %edi, -8(%rbp)
+    movl -8(%rbp), %edi
+    movl $2, %eax
+    movl %edi, %esi
+    addl %eax, %esi
+    movl %esi, %eax
+    movl %eax, -12(%rbp)
+    movl -12(%rbp), %eax
+    movl $3, %esi
+    movl %eax, %edx
+    addl %esi, %edx
+    movl %edx, %esi
+    movl %esi, -16(%rbp)
+    leaq -4(%rbp), %rsi
+    movl -16(%rbp), %edx
+    movl %edx, (%rsi)
+    movl $1000, %esi
+    imull %esi, %edi
+    movl %edi, %esi
+    movl $100, %edi
+    imull %edi, %eax
+    movl %eax, %edi
+    addl %edi, %esi
+    movl %esi, %edi
+    movl $10, %eax
+    movl %edx, %esi
+    imull %eax, %esi
+    movl %esi, %eax
+    addl %eax, %edi
+    movl -4(%rbp), %eax
+    cmpl %edx, %eax
+    sete %al
+    andq $1, %rax
+    addl %eax, %edi
+    movl %edi, %eax
+    popq %rbx
+    leave
+    ret
+mixed:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl %esi, -8(%rbp)
+    movl -4(%rbp), %eax
+    movl $2, %edi
+    movl %edi, %ecx
+    shll %cl, %eax
+    movl %eax, -12(%rbp)
+    leaq -8(%rbp), %rax
+    movl -8(%rbp), %edi
+    movl -12(%rbp), %esi
+    addl %esi, %edi
+    movl %edi, (%rax)
+    movl $100, %edi
+    movl %esi, %eax
+    mull %edi
+    movl -8(%rbp), %edi
+    addl %edi, %eax
+    movl -4(%rbp), %edi
+    movl $1, %esi
+    andl %esi, %edi
+    addl %edi, %eax
+    movl %eax, %edi
+    movl %edi, %eax
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    movl $1, %eax
+    movl %eax, %edi
+    call reread
+    movl $211, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    movl $2, %eax
+    movl $5, %edi
+    movl %edi, %esi
+    movl %eax, %edi
+    call two_params
+    movl $103, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    movl $1, %eax
+    movl $2, %edi
+    movl $3, %esi
+    movl %esi, %edx
+    movl %edi, %esi
+    movl %eax, %edi
+    call three_params
+    movl $653, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS3
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS3:
+    movq $7, %rax
+    movq $3, %rdi
+    movq %rdi, %rsi
+    movq %rax, %rdi
+    call wide
+    movq $4091, %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS4
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS4:
+    movl $1, %eax
+    movl %eax, %edi
+    call chained
+    movl $2471, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS5
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS5:
+    movl $3, %eax
+    movl $4, %edi
+    movl %edi, %esi
+    movl %eax, %edi
+    call mixed
+    movl $1217, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS6
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS6:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
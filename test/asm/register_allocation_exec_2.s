@@ -0,0 +1,179 @@
+    .data
+    .align 8
+xs:
+    .quad 0x1
+    .quad 0x2
+    .quad 0x3
+    .quad 0x4
+    .quad 0x5
+    .quad 0x6
+    .quad 0x7
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x6465707065747327
+    .quad 0x5F65726F6665625F
+    .quad 0x2C73782864616572
+    .quad 0x6F68732027293620
+    .quad 0x6175716520646C75
+    .quad 0x636570786527206C
+    .long 0x27646574
+    .word 0xA
+    .align 1
+__sl1:
+    .quad 0x6465707065747327
+    .quad 0x5F65726F6665625F
+    .quad 0x725F6C61626F6C67
+    .quad 0x2027293628646165
+    .quad 0x6520646C756F6873
+    .quad 0x786527206C617571
+    .quad 0xA27646574636570
+    .byte 0x0
+    .align 1
+__sl2:
+    .quad 0x6465707065747327
+    .quad 0x5F65726F6665625F
+    .quad 0x2C73782864616572
+    .quad 0x6F68732027293020
+    .quad 0x6175716520646C75
+    .long 0x3027206C
+    .word 0xA27
+    .byte 0x0
+    .text
+stepped_before_read:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $48, %rsp
+    movq %rdi, -8(%rbp)
+    movl %esi, -12(%rbp)
+    xorq %rax, %rax
+    movq %rax, -24(%rbp)
+    xorl %eax, %eax
+    movl %eax, -28(%rbp)
+    movl -12(%rbp), %esi
+    movq -8(%rbp), %rdi
+    movq $3, %rdx
+    leaq -28(%rbp), %rcx
+    leaq -24(%rbp), %r8
+    movl -28(%rbp), %eax
+    movsx %eax, %rax
+    imulq $8, %rax
+    addq %rax, %rdi
+    movq %rdi, %rax
+    jmp .LS2
+.LS1:
+    movq -24(%rbp), %rdi
+    imulq %rdx, %rdi
+    movq %rdi, -40(%rbp)
+    addl $1, (%rcx)
+    addq $8, %rax
+    movq -40(%rbp), %rdi
+    movq (%rax), %r9
+    addq %r9, %rdi
+    movq %rdi, (%r8)
+.LS2:
+    movl -28(%rbp), %edi
+    cmpl %esi, %edi
+    setl %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    jne .LS1
+    movq -24(%rbp), %rdi
+    movq %rdi, %rax
+    leave
+    ret
+stepped_before_global_read:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    movl %edi, -4(%rbp)
+    xorq %rdi, %rdi
+    movq %rdi, -16(%rbp)
+    xorl %edi, %edi
+    movl %edi, -20(%rbp)
+    movl -4(%rbp), %esi
+    movq $3, %rdx
+    leaq -20(%rbp), %rax
+    leaq -16(%rbp), %rcx
+    leaq xs(%rip), %rdi
+    movl -20(%rbp), %r8d
+    movsx %r8d, %r8
+    imulq $8, %r8
+    addq %r8, %rdi
+    movq %rdi, %r9
+    jmp .LS4
+.LS3:
+    movq -16(%rbp), %rdi
+    imulq %rdx, %rdi
+    movq %rdi, -32(%rbp)
+    addl $1, (%rax)
+    addq $8, %r9
+    movq -32(%rbp), %rdi
+    movq (%r9), %r8
+    addq %r8, %rdi
+    movq %rdi, (%rcx)
+.LS4:
+    movl -20(%rbp), %edi
+    cmpl %esi, %edi
+    setl %dil
+    andq $1, %rdi
+    cmpl $0, %edi
+    jne .LS3
+    movq -16(%rbp), %rdi
+    movq %rdi, %rax
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movq $907, %rax
+    movq %rax, -8(%rbp)
+    leaq xs(%rip), %rax
+    movl $6, %edi
+    movl %edi, %esi
+    movq %rax, %rdi
+    call stepped_before_read
+    movq -8(%rbp), %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS5
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS5:
+    movl $6, %eax
+    movl %eax, %edi
+    call stepped_before_global_read
+    movq -8(%rbp), %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS6
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS6:
+    leaq xs(%rip), %rax
+    xorl %edi, %edi
+    movl %edi, %esi
+    movq %rax, %rdi
+    call stepped_before_read
+    xorq %rdi, %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS7
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS7:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
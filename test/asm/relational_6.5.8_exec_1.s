@@ -0,0 +1,474 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x3030303033287527
+    .quad 0x2029753030303030
+    .quad 0x272975312875203E
+    .quad 0x20646C756F687320
+    .quad 0x3127206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl1:
+    .quad 0x3030303033287527
+    .quad 0x2029753030303030
+    .quad 0x2975312875203D3E
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2731
+    .align 1
+__sl2:
+    .quad 0x3C20297531287527
+    .quad 0x3030303033287520
+    .quad 0x2729753030303030
+    .quad 0x20646C756F687320
+    .quad 0x3127206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl3:
+    .quad 0x3C20297531287527
+    .quad 0x303030332875203D
+    .quad 0x2975303030303030
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2731
+    .align 1
+__sl4:
+    .quad 0x3030303033287527
+    .quad 0x2029753030303030
+    .quad 0x272975312875203C
+    .quad 0x20646C756F687320
+    .quad 0x3027206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl5:
+    .quad 0x3030303033287527
+    .quad 0x2029753030303030
+    .quad 0x3030332875203D3C
+    .quad 0x7530303030303030
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0xA273127
+    .byte 0x0
+    .align 1
+__sl6:
+    .quad 0x3C2029312D286927
+    .quad 0x2027297530287520
+    .quad 0x6520646C756F6873
+    .quad 0x273027206C617571
+    .word 0xA
+    .align 1
+__sl7:
+    .quad 0x3E2029312D286927
+    .quad 0x2027297530287520
+    .quad 0x6520646C756F6873
+    .quad 0x273127206C617571
+    .word 0xA
+    .align 1
+__sl8:
+    .quad 0x30387830286C7527
+    .quad 0x3030303030303030
+    .quad 0x6C75303030303030
+    .quad 0x31286C75203E2029
+    .quad 0x6F68732027296C75
+    .quad 0x6175716520646C75
+    .long 0x3127206C
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl9:
+    .quad 0x296C7531286C7527
+    .quad 0x30286C75203D3E20
+    .quad 0x3030303030303878
+    .quad 0x3030303030303030
+    .quad 0x68732027296C7530
+    .quad 0x75716520646C756F
+    .quad 0xA273027206C61
+    .align 1
+__sl10:
+    .quad 0x3030317830286C27
+    .quad 0x296C303030303030
+    .quad 0x296C31286C203E20
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA2731
+    .align 1
+__sl11:
+    .quad 0x3030317830286C27
+    .quad 0x296C303030303030
+    .quad 0x7830286C203D3C20
+    .quad 0x6666666666666637
+    .quad 0x756F68732027296C
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 1
+__sl12:
+    .quad 0x303178302D286C27
+    .quad 0x6C30303030303030
+    .quad 0x6C31286C203C2029
+    .quad 0x6C756F6873202729
+    .quad 0x206C617571652064
+    .long 0xA273127
+    .byte 0x0
+    .align 1
+__sl13:
+    .quad 0x3C2029312D286927
+    .quad 0x7320272930286920
+    .quad 0x716520646C756F68
+    .quad 0xA273127206C6175
+    .byte 0x0
+    .align 1
+__sl14:
+    .quad 0x3E2029312D286927
+    .quad 0x202729302869203D
+    .quad 0x6520646C756F6873
+    .quad 0x273027206C617571
+    .word 0xA
+    .text
+u:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+ul:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movq %rdi, -8(%rbp)
+    movq -8(%rbp), %rdi
+    movq %rdi, %rax
+    leave
+    ret
+l:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movq %rdi, -8(%rbp)
+    movq -8(%rbp), %rdi
+    movq %rdi, %rax
+    leave
+    ret
+i:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movl %edi, -4(%rbp)
+    movl -4(%rbp), %edi
+    movl %edi, %eax
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    movl $3000000000, %eax
+    movl %eax, %edi
+    call u
+    movl %eax, %ebx
+    movl $1, %eax
+    movl %eax, %edi
+    call u
+    cmpl %eax, %ebx
+    seta %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    movl $3000000000, %eax
+    movl %eax, %edi
+    call u
+    movl %eax, %ebx
+    movl $1, %eax
+    movl %eax, %edi
+    call u
+    cmpl %eax, %ebx
+    setnb %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    movl $1, %eax
+    movl %eax, %edi
+    call u
+    movl %eax, %ebx
+    movl $3000000000, %eax
+    movl %eax, %edi
+    call u
+    cmpl %eax, %ebx
+    setb %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS3
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS3:
+    movl $1, %eax
+    movl %eax, %edi
+    call u
+    movl %eax, %ebx
+    movl $3000000000, %eax
+    movl %eax, %edi
+    call u
+    cmpl %eax, %ebx
+    setbe %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS4
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS4:
+    movl $3000000000, %eax
+    movl %eax, %edi
+    call u
+    movl %eax, %ebx
+    movl $1, %eax
+    movl %eax, %edi
+    call u
+    cmpl %eax, %ebx
+    setb %al
+    andq $1, %rax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS5
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS5:
+    movl $3000000000, %eax
+    movl %eax, %edi
+    call u
+    movl %eax, %ebx
+    movl $3000000000, %eax
+    movl %eax, %edi
+    call u
+    cmpl %eax, %ebx
+    setbe %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS6
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS6:
+    movl $4294967295, %eax
+    movl %eax, %edi
+    call i
+    movl %eax, %ebx
+    xorl %eax, %eax
+    movl %eax, %edi
+    call u
+    cmpl %eax, %ebx
+    setb %al
+    andq $1, %rax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS7
+    leaq __sl6(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS7:
+    movl $4294967295, %eax
+    movl %eax, %edi
+    call i
+    movl %eax, %ebx
+    xorl %eax, %eax
+    movl %eax, %edi
+    call u
+    cmpl %eax, %ebx
+    seta %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS8
+    leaq __sl7(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS8:
+    movq $9223372036854775808, %rax
+    movq %rax, %rdi
+    call ul
+    movq %rax, %rbx
+    movq $1, %rax
+    movq %rax, %rdi
+    call ul
+    cmpq %rax, %rbx
+    seta %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS9
+    leaq __sl8(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS9:
+    movq $1, %rax
+    movq %rax, %rdi
+    call ul
+    movq %rax, %rbx
+    movq $9223372036854775808, %rax
+    movq %rax, %rdi
+    call ul
+    cmpq %rax, %rbx
+    setnb %al
+    andq $1, %rax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS10
+    leaq __sl9(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS10:
+    movq $4294967296, %rax
+    movq %rax, %rdi
+    call l
+    movq %rax, %rbx
+    movq $1, %rax
+    movq %rax, %rdi
+    call l
+    cmpq %rax, %rbx
+    setg %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS11
+    leaq __sl10(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS11:
+    movq $4294967296, %rax
+    movq %rax, %rdi
+    call l
+    movq %rax, %rbx
+    movq $2147483647, %rax
+    movq %rax, %rdi
+    call l
+    cmpq %rax, %rbx
+    setle %al
+    andq $1, %rax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS12
+    leaq __sl11(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS12:
+    movq $18446744069414584320, %rax
+    movq %rax, %rdi
+    call l
+    movq %rax, %rbx
+    movq $1, %rax
+    movq %rax, %rdi
+    call l
+    cmpq %rax, %rbx
+    setl %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS13
+    leaq __sl12(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS13:
+    movl $4294967295, %eax
+    movl %eax, %edi
+    call i
+    movl %eax, %ebx
+    xorl %eax, %eax
+    movl %eax, %edi
+    call i
+    cmpl %eax, %ebx
+    setl %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS14
+    leaq __sl13(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS14:
+    movl $4294967295, %eax
+    movl %eax, %edi
+    call i
+    movl %eax, %ebx
+    xorl %eax, %eax
+    movl %eax, %edi
+    call i
+    cmpl %eax, %ebx
+    setge %al
+    andq $1, %rax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS15
+    leaq __sl14(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS15:
+    xorl %edi, %edi
+    movl %edi, %eax
+    leave
+    ret
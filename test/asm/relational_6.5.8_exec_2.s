@@ -0,0 +1,210 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x3031783028746127
+    .quad 0x7530303030303030
+    .quad 0x287461203E20296C
+    .quad 0x6666666666377830
+    .quad 0x732027296C756666
+    .quad 0x716520646C756F68
+    .quad 0xA273127206C6175
+    .byte 0x0
+    .align 1
+__sl1:
+    .quad 0x3031783028746127
+    .quad 0x7530303030303030
+    .quad 0x7461203D3C20296C
+    .quad 0x6666666637783028
+    .quad 0x2027296C75666666
+    .quad 0x6520646C756F6873
+    .quad 0x273027206C617571
+    .word 0xA
+    .align 1
+__sl2:
+    .quad 0x3831783028746127
+    .quad 0x7530303030303030
+    .quad 0x287461203C20296C
+    .quad 0x3030303030327830
+    .quad 0x2027296C75303030
+    .quad 0x6520646C756F6873
+    .quad 0x273127206C617571
+    .word 0xA
+    .align 1
+__sl3:
+    .quad 0x3831783028746127
+    .quad 0x7530303030303030
+    .quad 0x7461203D3E20296C
+    .quad 0x3030303032783028
+    .quad 0x27296C7530303030
+    .quad 0x20646C756F687320
+    .quad 0x3027206C61757165
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl4:
+    .quad 0x756F687320276E27
+    .quad 0x6C6175716520646C
+    .long 0x27342720
+    .word 0xA
+    .align 1
+__sl5:
+    .quad 0x6E65203D3E207027
+    .quad 0x6C756F6873202764
+    .quad 0x206C617571652064
+    .long 0xA273127
+    .byte 0x0
+    .text
+at:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $16, %rsp
+    movq %rdi, -8(%rbp)
+    movq -8(%rbp), %rdi
+    movq %rdi, %rax
+    leave
+    ret
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $48, %rsp
+    pushq %r15
+    movq $4294967296, %rax
+    movq %rax, %rdi
+    call at
+    movq %rax, %rbx
+    movq $2147483647, %rax
+    movq %rax, %rdi
+    call at
+    cmpq %rax, %rbx
+    seta %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    movq $4294967296, %rax
+    movq %rax, %rdi
+    call at
+    movq %rax, %rbx
+    movq $2147483647, %rax
+    movq %rax, %rdi
+    call at
+    cmpq %rax, %rbx
+    setbe %al
+    andq $1, %rax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    movq $6442450944, %rax
+    movq %rax, %rdi
+    call at
+    movq %rax, %rbx
+    movq $8589934592, %rax
+    movq %rax, %rdi
+    call at
+    cmpq %rax, %rbx
+    setb %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS3
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS3:
+    movq $6442450944, %rax
+    movq %rax, %rdi
+    call at
+    movq %rax, %rbx
+    movq $8589934592, %rax
+    movq %rax, %rdi
+    call at
+    cmpq %rax, %rbx
+    setnb %al
+    andq $1, %rax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS4
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS4:
+    xorb %al, %al
+    leaq -16(%rbp), %rdi
+    movq $16, %rcx
+    rep stosb
+    xorl %eax, %eax
+    movl %eax, -16(%rbp)
+    leaq -16(%rbp), %rax
+    movq %rax, -24(%rbp)
+    leaq -16(%rbp), %rax
+    movl $16, %edi
+    addq %rdi, %rax
+    movq %rax, -32(%rbp)
+    xorl %eax, %eax
+    movl %eax, -36(%rbp)
+    movq -32(%rbp), %rdi
+    leaq -36(%rbp), %rdx
+    leaq -24(%rbp), %rsi
+    jmp .LS6
+.LS5:
+    addl $1, (%rdx)
+    addq $4, (%rsi)
+.LS6:
+    movq -24(%rbp), %rax
+    cmpq %rdi, %rax
+    setb %al
+    andq $1, %rax
+    cmpl $0, %eax
+    jne .LS5
+    movl -36(%rbp), %eax
+    movl $4, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS7
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS7:
+    movq -24(%rbp), %rax
+    movq -32(%rbp), %rdi
+    cmpq %rdi, %rax
+    setnb %al
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS8
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS8:
+    xorl %edi, %edi
+    movl %edi, %eax
+    popq %r15
+    leave
+    ret
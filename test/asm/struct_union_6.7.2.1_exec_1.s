@@ -0,0 +1,510 @@
+    .data
+    .align 8
+sp:
+    .byte 0x1
+    .zero 3
+    .long 0x2
+    .word 0x3
+    .zero 6
+    .quad 0x4
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x28666F657A697327
+    .quad 0x7020746375727473
+    .quad 0x2027296465646461
+    .quad 0x6520646C756F6873
+    .quad 0x343227206C617571
+    .word 0xA27
+    .byte 0x0
+    .align 1
+__sl1:
+    .quad 0x292A726168632827
+    .quad 0x2D20692E70732620
+    .quad 0x292A726168632820
+    .quad 0x6873202770732620
+    .quad 0x75716520646C756F
+    .quad 0xA273427206C61
+    .align 1
+__sl2:
+    .quad 0x292A726168632827
+    .quad 0x2D20732E70732620
+    .quad 0x292A726168632820
+    .quad 0x6873202770732620
+    .quad 0x75716520646C756F
+    .quad 0xA273827206C61
+    .align 1
+__sl3:
+    .quad 0x292A726168632827
+    .quad 0x2D206C2E70732620
+    .quad 0x292A726168632820
+    .quad 0x6873202770732620
+    .quad 0x75716520646C756F
+    .quad 0xA27363127206C61
+    .byte 0x0
+    .align 1
+__sl4:
+    .quad 0x28666F657A697327
+    .quad 0x766F206E6F696E75
+    .quad 0x20272979616C7265
+    .quad 0x6520646C756F6873
+    .quad 0x273827206C617571
+    .word 0xA
+    .align 1
+__sl5:
+    .quad 0x292A726168632827
+    .quad 0x202D20692E752620
+    .quad 0x20292A7261686328
+    .quad 0x756F687320277526
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 1
+__sl6:
+    .quad 0x275D305B632E7527
+    .quad 0x20646C756F687320
+    .quad 0x3027206C61757165
+    .long 0x27343478
+    .word 0xA
+    .align 1
+__sl7:
+    .quad 0x275D335B632E7527
+    .quad 0x20646C756F687320
+    .quad 0x3027206C61757165
+    .long 0x27313478
+    .word 0xA
+    .align 1
+__sl8:
+    .quad 0x732027632E707327
+    .quad 0x716520646C756F68
+    .quad 0xA273127206C6175
+    .byte 0x0
+    .align 1
+__sl9:
+    .quad 0x732027692E707327
+    .quad 0x716520646C756F68
+    .quad 0xA273227206C6175
+    .byte 0x0
+    .align 1
+__sl10:
+    .quad 0x732027732E707327
+    .quad 0x716520646C756F68
+    .quad 0xA273327206C6175
+    .byte 0x0
+    .align 1
+__sl11:
+    .quad 0x7320276C2E707327
+    .quad 0x716520646C756F68
+    .quad 0xA273427206C6175
+    .byte 0x0
+    .align 1
+__sl12:
+    .quad 0x68732027632E7027
+    .quad 0x75716520646C756F
+    .quad 0xA273527206C61
+    .align 1
+__sl13:
+    .quad 0x68732027692E7027
+    .quad 0x75716520646C756F
+    .quad 0xA273627206C61
+    .align 1
+__sl14:
+    .quad 0x68732027732E7027
+    .quad 0x75716520646C756F
+    .quad 0xA273727206C61
+    .align 1
+__sl15:
+    .quad 0x687320276C2E7027
+    .quad 0x75716520646C756F
+    .quad 0xA273827206C61
+    .align 8
+__fc0:
+    .quad 0x4024000000000000
+    .align 1
+__sl16:
+    .quad 0x28666F657A697327
+    .quad 0x6F20746375727473
+    .quad 0x7320272972657475
+    .quad 0x716520646C756F68
+    .quad 0x27383427206C6175
+    .word 0xA
+    .align 1
+__sl17:
+    .quad 0x292A726168632827
+    .quad 0x656E6E692E6F2620
+    .quad 0x6328202D20732E72
+    .quad 0x6F2620292A726168
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA273631
+    .byte 0x0
+    .align 1
+__sl18:
+    .quad 0x72656E6E692E6F27
+    .quad 0x756F68732027732E
+    .quad 0x6C6175716520646C
+    .long 0x27392720
+    .word 0xA
+    .align 1
+__sl19:
+    .quad 0x6761743E2D6F7027
+    .quad 0x646C756F68732027
+    .quad 0x27206C6175716520
+    .long 0xA273131
+    .byte 0x0
+    .align 1
+__sl20:
+    .quad 0x72656E6E692E6F27
+    .quad 0x756F68732027692E
+    .quad 0x6C6175716520646C
+    .long 0x27302720
+    .word 0xA
+    .align 8
+__fc1:
+    .quad 0x4024000000000000
+    .align 1
+__sl21:
+    .quad 0x3D20643E2D6F7027
+    .quad 0x2027302E3031203D
+    .quad 0x6520646C756F6873
+    .quad 0x273127206C617571
+    .word 0xA
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $96, %rsp
+    pushq %r15
+    jmp .LS1
+.LS1:
+    leaq sp(%rip), %rax
+    addq $4, %rax
+    leaq sp(%rip), %rdi
+    subq %rdi, %rax
+    movq %rax, %rdi
+    movq $1, %rsi
+    movq %rdi, %rax
+    xorq %rdx, %rdx
+    idivq %rsi
+    movq $4, %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    leaq sp(%rip), %rax
+    addq $8, %rax
+    leaq sp(%rip), %rdi
+    subq %rdi, %rax
+    movq %rax, %rdi
+    movq $1, %rsi
+    movq %rdi, %rax
+    xorq %rdx, %rdx
+    idivq %rsi
+    movq $8, %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS3
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS3:
+    leaq sp(%rip), %rax
+    addq $16, %rax
+    leaq sp(%rip), %rdi
+    subq %rdi, %rax
+    movq %rax, %rdi
+    movq $1, %rsi
+    movq %rdi, %rax
+    xorq %rdx, %rdx
+    idivq %rsi
+    movq $16, %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS4
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS4:
+    jmp .LS5
+.LS5:
+    leaq -8(%rbp), %rax
+    addq $0, %rax
+    leaq -8(%rbp), %rdi
+    subq %rdi, %rax
+    movq %rax, %rdi
+    movq $1, %rsi
+    movq %rdi, %rax
+    xorq %rdx, %rdx
+    idivq %rsi
+    xorq %rdi, %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS6
+    leaq __sl5(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS6:
+    leaq -8(%rbp), %rax
+    addq $0, %rax
+    movl $1094861636, %edi
+    movl %edi, (%rax)
+    leaq -8(%rbp), %rax
+    addq $0, %rax
+    xorl %edi, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $68, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS7
+    leaq __sl6(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS7:
+    leaq -8(%rbp), %rax
+    addq $0, %rax
+    movl $3, %edi
+    movb (%rax, %rdi, 1), %al
+    movl $65, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS8
+    leaq __sl7(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS8:
+    leaq sp(%rip), %rax
+    movb (%rax), %al
+    movl $1, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS9
+    leaq __sl8(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS9:
+    leaq sp(%rip), %rax
+    movl 4(%rax), %eax
+    movl $2, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS10
+    leaq __sl9(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS10:
+    leaq sp(%rip), %rax
+    movw 8(%rax), %ax
+    movl $3, %edi
+    movsx %ax, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS11
+    leaq __sl10(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS11:
+    leaq sp(%rip), %rax
+    movq 16(%rax), %rax
+    movq $4, %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS12
+    leaq __sl11(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS12:
+    xorb %al, %al
+    leaq -32(%rbp), %rdi
+    movq $24, %rcx
+    rep stosb
+    movl $5, %eax
+    movb %al, -32(%rbp)
+    movl $6, %eax
+    movl %eax, -28(%rbp)
+    movl $7, %eax
+    movw %ax, -24(%rbp)
+    movq $8, %rax
+    movq %rax, -16(%rbp)
+    leaq -32(%rbp), %rax
+    movb (%rax), %al
+    movl $5, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS13
+    leaq __sl12(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS13:
+    leaq -32(%rbp), %rax
+    movl 4(%rax), %eax
+    movl $6, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS14
+    leaq __sl13(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS14:
+    leaq -32(%rbp), %rax
+    movw 8(%rax), %ax
+    movl $7, %edi
+    movsx %ax, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS15
+    leaq __sl14(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS15:
+    leaq -32(%rbp), %rax
+    movq 16(%rax), %rax
+    movq $8, %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS16
+    leaq __sl15(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS16:
+    leaq -80(%rbp), %rax
+    movq %rax, -88(%rbp)
+    leaq -80(%rbp), %rax
+    addq $0, %rax
+    movl $11, %edi
+    movb %dil, (%rax)
+    leaq -80(%rbp), %rax
+    addq $8, %rax
+    movq %rax, %rdi
+    addq $4, %rdi
+    xorl %esi, %esi
+    movl %esi, (%rdi)
+    movq -88(%rbp), %rdi
+    addq $8, %rdi
+    addq $8, %rdi
+    movl $9, %esi
+    movw %si, (%rdi)
+    leaq -80(%rbp), %rdi
+    addq $40, %rdi
+    movsd __fc0(%rip), %xmm0
+    movsd %xmm0, (%rdi)
+    jmp .LS17
+.LS17:
+    addq $8, %rax
+    leaq -80(%rbp), %rdi
+    subq %rdi, %rax
+    movq %rax, %rdi
+    movq $1, %rsi
+    movq %rdi, %rax
+    xorq %rdx, %rdx
+    idivq %rsi
+    movq $16, %rdi
+    cmpq %rdi, %rax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS18
+    leaq __sl17(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS18:
+    leaq -80(%rbp), %rax
+    addq $8, %rax
+    movw 8(%rax), %ax
+    movl $9, %edi
+    movsx %ax, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS19
+    leaq __sl18(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS19:
+    movq -88(%rbp), %rax
+    movb (%rax), %al
+    movl $11, %edi
+    movsx %al, %eax
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS20
+    leaq __sl19(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS20:
+    leaq -80(%rbp), %rax
+    addq $8, %rax
+    movl 4(%rax), %eax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS21
+    leaq __sl20(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS21:
+    movq -88(%rbp), %rax
+    movsd 40(%rax), %xmm0
+    movsd __fc1(%rip), %xmm1
+    ucomisd %xmm1, %xmm0
+    setnp %al
+    ucomisd %xmm1, %xmm0
+    je .LGEN1
+    xorl %eax, %eax
+.LGEN1:
+    andq $1, %rax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS22
+    leaq __sl21(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS22:
+    xorl %edi, %edi
+    movl %edi, %eax
+    popq %r15
+    leave
+    ret
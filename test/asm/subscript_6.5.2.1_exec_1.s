@@ -0,0 +1,122 @@
+    .section .rodata
+    .align 1
+__sl0:
+    .quad 0x20275D305B737827
+    .quad 0x6520646C756F6873
+    .quad 0x273027206C617571
+    .word 0xA
+    .align 1
+__sl1:
+    .quad 0x20275D315B737827
+    .quad 0x6520646C756F6873
+    .quad 0x273127206C617571
+    .word 0xA
+    .align 1
+__sl2:
+    .quad 0x20275D325B737827
+    .quad 0x6520646C756F6873
+    .quad 0x273227206C617571
+    .word 0xA
+    .align 1
+__sl3:
+    .quad 0x20275D335B737827
+    .quad 0x6520646C756F6873
+    .quad 0x273327206C617571
+    .word 0xA
+    .align 1
+__sl4:
+    .quad 0x20275D345B737827
+    .quad 0x6520646C756F6873
+    .quad 0x273427206C617571
+    .word 0xA
+    .text
+    .globl main
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $32, %rsp
+    pushq %r15
+    xorb %al, %al
+    leaq -20(%rbp), %rdi
+    movq $20, %rcx
+    rep stosb
+    xorl %eax, %eax
+    movl %eax, -20(%rbp)
+    movl $1, %eax
+    movl %eax, -16(%rbp)
+    movl $2, %eax
+    movl %eax, -12(%rbp)
+    movl $3, %eax
+    movl %eax, -8(%rbp)
+    movl $4, %eax
+    movl %eax, -4(%rbp)
+    leaq -20(%rbp), %rax
+    xorl %edi, %edi
+    movl (%rax, %rdi, 1), %eax
+    xorl %edi, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS1
+    leaq __sl0(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS1:
+    leaq -20(%rbp), %rax
+    movl $4, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $1, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS2
+    leaq __sl1(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS2:
+    leaq -20(%rbp), %rax
+    movl $8, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $2, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS3
+    leaq __sl2(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS3:
+    leaq -20(%rbp), %rax
+    movl $12, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $3, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS4
+    leaq __sl3(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS4:
+    leaq -20(%rbp), %rax
+    movl $16, %edi
+    movl (%rax, %rdi, 1), %eax
+    movl $4, %edi
+    cmpl %edi, %eax
+    setne %al
+    andq $1, %rax
+    cmpl $0, %eax
+    je .LS5
+    leaq __sl4(%rip), %rax
+    movq %rax, %rdi
+    call puts
+.LS5:
+    xorl %edi, %edi
+    movl %edi, %eax
+    popq %r15
+    leave
+    ret
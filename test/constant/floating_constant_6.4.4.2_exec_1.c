@@ -0,0 +1,21 @@
+/* ISO: 6.4.4.2; decimal floating constants round correctly for their own type, and suffixes work on hexadecimal ones */
+
+#include "../test.h"
+
+int main(void)
+{
+    ASSERT_EQUALS(0.1, 0x1.999999999999ap-4);
+    ASSERT_EQUALS(1e23, 0x1.52d02c7e14af6p+76);
+    ASSERT_EQUALS(123.456, 0x1.edd2f1a9fbe77p+6);
+    ASSERT_EQUALS(4.9e-324, 0x0.0000000000001p-1022);
+    ASSERT_EQUALS(2.2250738585072011e-308, 0x0.fffffffffffffp-1022);
+    ASSERT_EQUALS(9007199254740993.0, 9007199254740992.0);
+    ASSERT_EQUALS(0.30000000000000000000000000000000001, 0x1.3333333333333p-2);
+    ASSERT_EQUALS(0.1f, 0x1.99999ap-4f);
+    ASSERT_EQUALS(16777217.0f, 16777216.0f);
+    ASSERT_EQUALS(1.00000005960464477539062501f, 0x1.000002p0f);
+    ASSERT_EQUALS(0x1p3f, 8.0f);
+    ASSERT_EQUALS(0x1.8P1F, 3.0f);
+    ASSERT_EQUALS(.5e1, 5.0);
+    ASSERT_EQUALS(00.25, 0.25);
+}
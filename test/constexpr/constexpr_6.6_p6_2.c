@@ -0,0 +1,16 @@
+/* ISO: 6.6 (6), 6.6 (9); the operands of casts and subscripts in constant expressions must be constant too */
+
+int f(void);
+
+enum e1
+{
+    // function call under a cast in an integer constant expression
+    E1_V1 = (int) f()
+};
+
+// function call under a cast in an arithmetic constant expression
+static double d = (double) f();
+
+// function call as the index of a subscript in an address constant
+static int xs[3];
+static int* p = &xs[f()];
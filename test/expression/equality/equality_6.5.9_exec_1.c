@@ -0,0 +1,18 @@
+/* ISO: 6.5.9 (5, 6); equality operator semantics for pointers */
+
+#include "../../test.h"
+
+static char* at(unsigned long address) { return (char*) address; }
+
+int main(void)
+{
+    // pointers that only differ above the lower 32 bits aren't equal
+    ASSERT_EQUALS(at(0x100000000ul) == at(0ul), 0);
+    ASSERT_EQUALS(at(0x100000001ul) != at(1ul), 1);
+
+    // a null pointer constant on either side
+    ASSERT_EQUALS(at(0x100000000ul) != 0, 1);
+    ASSERT_EQUALS(0 == at(0x100000000ul), 0);
+    ASSERT_EQUALS(at(0ul) == 0, 1);
+    return 0;
+}
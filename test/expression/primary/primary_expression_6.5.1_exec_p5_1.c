@@ -0,0 +1,16 @@
+/* ISO: 6.5.1 (5); parenthesized expressions, nested deep enough that reparsing each level would never finish */
+
+#include "../../test.h"
+
+int main(void)
+{
+    int a = 5;
+    int b = ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((a))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))));
+    ASSERT_EQUALS(b, 5);
+
+    ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((b)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) = (((((((((((((((((((((((((((((((((long) ((((((((((((((((((((((((((((((((a + 1))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))));
+    ASSERT_EQUALS(b, 6);
+
+    b += ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((-(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((int) b * 2))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))));
+    ASSERT_EQUALS(b, -6);
+}
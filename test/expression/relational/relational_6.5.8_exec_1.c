@@ -0,0 +1,35 @@
+/* ISO: 6.5.8 (3, 6); relational operator semantics for unsigned and wide operands */
+
+#include "../../test.h"
+
+// the operands come through calls so nothing is folded before run time
+static unsigned u(unsigned x) { return x; }
+static unsigned long ul(unsigned long x) { return x; }
+static long l(long x) { return x; }
+static int i(int x) { return x; }
+
+int main(void)
+{
+    // the top bit is just a large value for an unsigned int
+    ASSERT_EQUALS(u(3000000000u) > u(1u), 1);
+    ASSERT_EQUALS(u(3000000000u) >= u(1u), 1);
+    ASSERT_EQUALS(u(1u) < u(3000000000u), 1);
+    ASSERT_EQUALS(u(1u) <= u(3000000000u), 1);
+    ASSERT_EQUALS(u(3000000000u) < u(1u), 0);
+    ASSERT_EQUALS(u(3000000000u) <= u(3000000000u), 1);
+
+    // an int converted to unsigned int, where -1 is the largest value there is
+    ASSERT_EQUALS(i(-1) < u(0u), 0);
+    ASSERT_EQUALS(i(-1) > u(0u), 1);
+
+    ASSERT_EQUALS(ul(0x8000000000000000ul) > ul(1ul), 1);
+    ASSERT_EQUALS(ul(1ul) >= ul(0x8000000000000000ul), 0);
+
+    // the upper half of a long counts, even though the result is an int
+    ASSERT_EQUALS(l(0x100000000l) > l(1l), 1);
+    ASSERT_EQUALS(l(0x100000000l) <= l(0x7fffffffl), 0);
+    ASSERT_EQUALS(l(-0x100000000l) < l(1l), 1);
+    ASSERT_EQUALS(i(-1) < i(0), 1);
+    ASSERT_EQUALS(i(-1) >= i(0), 0);
+    return 0;
+}
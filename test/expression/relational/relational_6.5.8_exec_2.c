@@ -0,0 +1,24 @@
+/* ISO: 6.5.8 (5); relational operator semantics for pointers */
+
+#include "../../test.h"
+
+// pointers made from addresses that only differ above the lower 32 bits
+static char* at(unsigned long address) { return (char*) address; }
+
+int main(void)
+{
+    ASSERT_EQUALS(at(0x100000000ul) > at(0x7ffffffful), 1);
+    ASSERT_EQUALS(at(0x100000000ul) <= at(0x7ffffffful), 0);
+    ASSERT_EQUALS(at(0x180000000ul) < at(0x200000000ul), 1);
+    ASSERT_EQUALS(at(0x180000000ul) >= at(0x200000000ul), 0);
+
+    int xs[4] = { 0 };
+    int* p = xs;
+    int* end = xs + 4;
+    int n = 0;
+    for (; p < end; ++p)
+        ++n;
+    ASSERT_EQUALS(n, 4);
+    ASSERT_EQUALS(p >= end, 1);
+    return 0;
+}
@@ -0,0 +1,50 @@
+/* ISO: 6.9; external declarations: function definitions and declarations side by side */
+
+#include "../test.h"
+
+typedef int number;
+
+int twice(int x);
+
+int a = 1, b, c = 3;
+
+static number table[3] = { 4, 5, 6 }, *cursor = table + 1;
+
+struct pair { int first; int second; };
+
+struct pair origin, unit = { 1, 1 };
+
+int (*op)(int) = twice;
+
+int twice(int x)
+{
+    return x * 2;
+}
+
+number sum(number x, int y)
+{
+    return x + y;
+}
+
+void swap(struct pair* p)
+{
+    int first = p->first;
+    p->first = p->second;
+    p->second = first;
+}
+
+int main(void)
+{
+    ASSERT_EQUALS(a, 1);
+    ASSERT_EQUALS(b, 0);
+    ASSERT_EQUALS(c, 3);
+    ASSERT_EQUALS(*cursor, 5);
+    ASSERT_EQUALS(origin.first + origin.second, 0);
+    ASSERT_EQUALS(unit.first + unit.second, 2);
+    ASSERT_EQUALS(op(21), 42);
+    ASSERT_EQUALS(sum(table[0], 3), 7);
+    struct pair p = { 1, 2 };
+    swap(&p);
+    ASSERT_EQUALS(p.first, 2);
+    ASSERT_EQUALS(p.second, 1);
+}
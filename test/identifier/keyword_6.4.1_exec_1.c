@@ -0,0 +1,55 @@
+/* ISO: 6.4.1 (1); keywords are looked up as keywords, not identifiers */
+
+#include "../test.h"
+
+typedef unsigned long size;
+
+struct pair { short first; signed char second; };
+union word { int i; float f; };
+enum color { RED, GREEN };
+
+static inline int twice(register int x)
+{
+    return x + x;
+}
+
+extern void rotate(double _Complex z, double _Imaginary angle);
+
+int counter = 2;
+
+int main(void)
+{
+    auto int total = 0;
+    const volatile double scale = 1.0;
+    long sum = 0;
+    _Bool flag = 1;
+    struct pair p = { 1, 2 };
+    union word w;
+    w.i = 0;
+    int c = GREEN;
+    int* restrict r = &total;
+    for (int i = 0; i < 10; ++i)
+    {
+        if (i == 8)
+            break;
+        else if (i % 2)
+            continue;
+        sum += i;
+    }
+    do
+        total += twice(counter);
+    while (total < 10);
+    if (c == RED)
+        goto fail;
+    ASSERT_EQUALS(sum, 12);
+    ASSERT_EQUALS(*r, 12);
+    ASSERT_EQUALS(p.first + p.second, 3);
+    ASSERT_EQUALS(w.i, 0);
+    ASSERT_EQUALS(sizeof(enum color), 4);
+    ASSERT_EQUALS(flag, 1);
+    ASSERT_EQUALS((int) scale, 1);
+    ASSERT_EQUALS(sizeof(size), 8);
+    return 0;
+fail:
+    return 1;
+}
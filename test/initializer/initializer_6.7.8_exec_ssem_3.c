@@ -0,0 +1,27 @@
+/* ISO: 6.7.8 (11); static scalar initializers are converted to the type of the object */
+
+#include "../test.h"
+
+static double d = 1;
+static float f = 2;
+static long l = -1;
+static char c = 300;
+static unsigned short s = 70000;
+static _Bool b = 2;
+static _Bool z = 0.0;
+static unsigned char bytes[] = { 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+static unsigned char after = 99;
+
+int main(void)
+{
+    ASSERT_EQUALS(d, 1.0);
+    ASSERT_EQUALS(f, 2.0f);
+    ASSERT_EQUALS(l, -1L);
+    ASSERT_EQUALS(c, 44);
+    ASSERT_EQUALS(s, 4464);
+    ASSERT_EQUALS(b, 1);
+    ASSERT_EQUALS(z, 0);
+    ASSERT_EQUALS(bytes[0], 15);
+    ASSERT_EQUALS(bytes[15], 0);
+    ASSERT_EQUALS(after, 99);
+}
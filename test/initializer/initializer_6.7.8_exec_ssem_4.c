@@ -0,0 +1,32 @@
+/* ISO: 6.7.8 (10); static objects are zero wherever they aren't explicitly initialized, however big they are */
+
+#include "../test.h"
+
+static char big[1 << 24];
+static int sparse[1 << 20] = { [3] = 7, [1 << 19] = -1, [(1 << 20) - 1] = 42 };
+static struct { long a; char gap[4096]; int* p; short s; } mixed = { 5, { [100] = 1 }, &sparse[3], 9 };
+static int zeros[64] = { 0 };
+static const char text[256] = "hi";
+
+int main(void)
+{
+    ASSERT_EQUALS(big[0], 0);
+    ASSERT_EQUALS(big[(1 << 24) - 1], 0);
+    big[12345] = 3;
+    ASSERT_EQUALS(big[12345], 3);
+    ASSERT_EQUALS(sparse[0], 0);
+    ASSERT_EQUALS(sparse[3], 7);
+    ASSERT_EQUALS(sparse[4], 0);
+    ASSERT_EQUALS(sparse[1 << 19], -1);
+    ASSERT_EQUALS(sparse[(1 << 20) - 1], 42);
+    ASSERT_EQUALS(mixed.a, 5);
+    ASSERT_EQUALS(mixed.gap[99], 0);
+    ASSERT_EQUALS(mixed.gap[100], 1);
+    ASSERT_EQUALS(mixed.gap[101], 0);
+    ASSERT_EQUALS(*mixed.p, 7);
+    ASSERT_EQUALS(mixed.s, 9);
+    ASSERT_EQUALS(zeros[63], 0);
+    ASSERT_EQUALS(text[1], 'i');
+    ASSERT_EQUALS(text[2], 0);
+    ASSERT_EQUALS(text[255], 0);
+}
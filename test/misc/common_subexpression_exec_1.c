@@ -0,0 +1,93 @@
+/* common subexpression elimination: reuse only where the first computation dominates, and only while memory hasn't changed under it */
+
+// -i: common subexpression elimination in before_branch: [1-9][0-9]* instructions replaced
+// -i: common subexpression elimination in in_each_arm: 0 instructions replaced
+// -i: common subexpression elimination in commuted: [1-9][0-9]* instructions replaced
+// -i: common subexpression elimination in local_written_between: 0 instructions replaced
+// -i: common subexpression elimination in store_through_other_pointer: 0 instructions replaced
+// -i: common subexpression elimination in call_between: 0 instructions replaced
+
+#include "../test.h"
+
+static int g;
+
+static void set_g(int x)
+{
+    g = x;
+}
+
+// computed before the branch, so both arms and the code after them can reuse it
+static int before_branch(int a, int b, int c)
+{
+    int x = a * b + 7;
+    int r;
+    if (c)
+        r = a * b + 7 + 1;
+    else
+        r = a * b + 7 - 1;
+    return r + (a * b + 7);
+}
+
+// computed in each arm, neither of which is on every path to the code after them
+static int in_each_arm(int a, int b, int c)
+{
+    int r;
+    if (c)
+        r = (a ^ b) * 3;
+    else
+        r = (a ^ b) * 5;
+    return r + (a ^ b);
+}
+
+static int commuted(int a, int b)
+{
+    return (a * b) - (b * a) + (a + b) * (b + a);
+}
+
+// subtracting and shifting the other way around are different computations
+static int not_commuted(int a, int b)
+{
+    return (a - b) * 100 + (b - a) * 10 + ((a << b) == (b << a));
+}
+
+// a store to the local in between means the second read gets the new value
+static int local_written_between(int a)
+{
+    int b = a;
+    int x = b + 1;
+    b = 10;
+    int y = b + 1;
+    return x * 100 + y;
+}
+
+// p and q could be (and here are) the same object
+static int store_through_other_pointer(int* p, int* q)
+{
+    int before = *p;
+    *q = 9;
+    return before * 10 + *p;
+}
+
+// a call could write any memory whose address got out
+static int call_between(void)
+{
+    g = 1;
+    int before = g + 1;
+    set_g(5);
+    return before * 10 + (g + 1);
+}
+
+int main(void)
+{
+    ASSERT_EQUALS(before_branch(3, 4, 1), 39);
+    ASSERT_EQUALS(before_branch(3, 4, 0), 37);
+    ASSERT_EQUALS(in_each_arm(6, 3, 1), 20);
+    ASSERT_EQUALS(in_each_arm(6, 3, 0), 30);
+    ASSERT_EQUALS(commuted(6, 7), 169);
+    ASSERT_EQUALS(not_commuted(5, 2), 270);
+    ASSERT_EQUALS(local_written_between(1), 211);
+    int v = 4;
+    ASSERT_EQUALS(store_through_other_pointer(&v, &v), 49);
+    ASSERT_EQUALS(call_between(), 26);
+    return 0;
+}
@@ -0,0 +1,72 @@
+/* constant propagation: constants through merges, branches that are never taken, and what has to wait for run time */
+
+// -i: constant propagation in same_either_way: [1-9][0-9]* instructions folded
+// -i: constant propagation in different_each_way: 0 instructions folded, 0 removed
+// -i: constant propagation in one_way_only: [1-9][0-9]* instructions folded, [1-9][0-9]* removed
+// -i: constant propagation in short_circuit: [1-9][0-9]* instructions folded, [1-9][0-9]* removed
+// -i: constant propagation in narrowed: [1-9][0-9]* instructions folded
+
+#include "../test.h"
+
+static int id(int x)
+{
+    return x;
+}
+
+// both arms give 4, so the merge is 4 whichever way control goes
+static int same_either_way(int c)
+{
+    return c ? 4 : 2 + 2;
+}
+
+// two different constants meet as a value only known at run time
+static int different_each_way(int c)
+{
+    return c ? 4 : 5;
+}
+
+// the other arm can't be reached, so its call goes away and only 7 reaches the merge
+static int one_way_only(void)
+{
+    return 3 > 4 ? id(1) : 7;
+}
+
+static int short_circuit(int c)
+{
+    return (c && 0) + (1 || id(c)) + (0 && id(c));
+}
+
+// dividing by zero and overflowing a signed division are left for run time (where the arm never
+// runs), since folding either of them would trap in the compiler
+static int left_for_run_time(int c)
+{
+    return c ? 1 / 0 + (-2147483647 - 1) / -1 : 2;
+}
+
+// values are read at the width of the type they're used as
+static int narrowed(void)
+{
+    unsigned char uc = 200 + 100;
+    signed char sc = 127 + 1;
+    unsigned u = 0u - 1u;
+    long long wide = 2147483647 + 1LL;
+    return uc == 44 && sc == -128 && u == 4294967295u && wide == 2147483648LL && (-1 < 0u) == 0;
+}
+
+int main(void)
+{
+    ASSERT_EQUALS(same_either_way(id(0)), 4);
+    ASSERT_EQUALS(same_either_way(id(1)), 4);
+    ASSERT_EQUALS(different_each_way(id(0)), 5);
+    ASSERT_EQUALS(different_each_way(id(1)), 4);
+    ASSERT_EQUALS(one_way_only(), 7);
+    ASSERT_EQUALS(short_circuit(id(1)), 1);
+    ASSERT_EQUALS(left_for_run_time(id(0)), 2);
+    ASSERT_EQUALS(narrowed(), 1);
+
+    // floats are folded in their own precision, the same as they're computed at run time
+    float third = 1.0f / 3.0f;
+    float one = id(1);
+    ASSERT_EQUALS(third, one / 3.0f);
+    return 0;
+}
@@ -0,0 +1,128 @@
+/* dead code elimination: which stores to locals can go, and what has to stay even when nothing uses it */
+
+// -i: dead code elimination in overwritten: [1-9][0-9]* instructions removed
+// -i: dead code elimination in through_own_address: [1-9][0-9]* instructions removed
+// -i: dead code elimination in read_one_way: 0 instructions removed
+// -i: dead code elimination in escaped: 0 instructions removed
+// -i: dead code elimination in partly_written: 0 instructions removed
+// -i: dead code elimination in unused_results: [1-9][0-9]* instructions removed
+// -i: dead code elimination in volatile_accesses: 0 instructions removed
+
+#include "../test.h"
+
+static int trail;
+
+// leaves a trail of digits, so a call that went missing or moved shows up
+static int mark(int digit)
+{
+    trail = trail * 10 + digit;
+    return digit;
+}
+
+static void store(int* p, int x)
+{
+    *p = x;
+}
+
+// the first two stores are written over before anything reads them
+static int overwritten(int x)
+{
+    int a = x;
+    a = x + 1;
+    a = x + 2;
+    return a;
+}
+
+// written through an address that's only ever used right there, which still counts as a plain store
+static int through_own_address(int x)
+{
+    int a;
+    *&a = x;
+    *&a = x * 2;
+    return a;
+}
+
+// the store at the bottom of the loop is read at the top of the next trip
+static int read_next_trip(int n)
+{
+    int sum = 0, prev = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        sum += prev;
+        prev = i;
+    }
+    return sum;
+}
+
+// only one way out of the branch reads the first store
+static int read_one_way(int c)
+{
+    int a = 1;
+    if (c)
+        return a;
+    a = 2;
+    return a;
+}
+
+// once the address goes somewhere else, any store could be read through it
+static int escaped(int x)
+{
+    int a = x;
+    int* p = &a;
+    store(p, x + 1);
+    a = x + 2;
+    store(p, *p + 1);
+    return a;
+}
+
+// a store to part of the local isn't a store to all of it
+static int partly_written(void)
+{
+    int a = 0x01020304;
+    *(char*) &a = 0;
+    return a;
+}
+
+static int unused_results(int x)
+{
+    int y = x * 3 + 1;
+    y + x;
+    mark(1);
+    x + mark(2);
+    mark(3) ? x : y;
+    return x;
+}
+
+static int volatile_accesses(void)
+{
+    volatile int v = 1;
+    v = 2;
+    v;
+    return v;
+}
+
+static int unreachable(int x)
+{
+    goto out;
+    x = mark(9);
+out:
+    return x;
+    mark(9);
+}
+
+int main(void)
+{
+    ASSERT_EQUALS(overwritten(5), 7);
+    ASSERT_EQUALS(through_own_address(5), 10);
+    ASSERT_EQUALS(read_next_trip(10), 36);
+    ASSERT_EQUALS(read_one_way(1), 1);
+    ASSERT_EQUALS(read_one_way(0), 2);
+    ASSERT_EQUALS(escaped(5), 8);
+    ASSERT_EQUALS(partly_written(), 0x01020300);
+    ASSERT_EQUALS(unused_results(4), 4);
+    ASSERT_EQUALS(trail, 123);
+    ASSERT_EQUALS(volatile_accesses(), 2);
+    ASSERT_EQUALS(unreachable(6), 6);
+    ASSERT_EQUALS(trail, 123);
+    return 0;
+}
@@ -0,0 +1,179 @@
+/* induction variable strength reduction: which counters step a pointer instead, and when the counter itself can go */
+
+// -i: induction variable strength reduction in eight_wide: 1 addresses reduced, 1 counters eliminated
+// -i: induction variable strength reduction in one_wide: 1 addresses reduced, 1 counters eliminated
+// -i: induction variable strength reduction in second_column: 1 addresses reduced, 1 counters eliminated
+// -i: induction variable strength reduction in every_third: 1 addresses reduced, 1 counters eliminated
+// -i: induction variable strength reduction in downward: 1 addresses reduced, 1 counters eliminated
+// -i: induction variable strength reduction in up_to_exactly: 1 addresses reduced, 1 counters eliminated
+// -i: induction variable strength reduction in weighted: 1 addresses reduced, 0 counters eliminated
+// -i: induction variable strength reduction in read_after: 1 addresses reduced, 0 counters eliminated
+// -i: induction variable strength reduction in stepped_twice: 0 addresses reduced
+// -i: induction variable strength reduction in unsigned_counter: 0 addresses reduced
+// -i: induction variable strength reduction in with_call: 0 addresses reduced
+
+#include "../test.h"
+
+static int trips;
+
+static void tick(void)
+{
+    ++trips;
+}
+
+static long eight_wide(long* a, int n)
+{
+    long s = 0;
+    for (int i = 0; i < n; ++i)
+        s += a[i];
+    return s;
+}
+
+static int one_wide(char* a, int n)
+{
+    int s = 0;
+    for (int i = 0; i < n; i++)
+        s += a[i];
+    return s;
+}
+
+// the pointer steps a whole row at a time, and the column is an offset from it
+static int second_column(int (*rows)[2], int n)
+{
+    int s = 0;
+    for (int i = 0; i < n; ++i)
+        s += rows[i][1];
+    return s;
+}
+
+static int every_third(int* a, int n)
+{
+    int s = 0;
+    for (int i = 0; i < n; i += 3)
+        s += a[i];
+    return s;
+}
+
+// the pointer steps back from the end, and stops once it's gone past the first element
+static int downward(int* a, int n)
+{
+    int s = 0;
+    for (int i = n - 1; i >= 0; --i)
+        s += a[i];
+    return s;
+}
+
+static int up_to_exactly(int* a, int n)
+{
+    int s = 0;
+    for (int i = 0; i != n; ++i)
+        s += a[i];
+    return s;
+}
+
+// dst can be a or b, so each store has to land before the next load
+static void in_place(int* dst, int* a, int* b, int n)
+{
+    for (int i = 0; i < n; ++i)
+        dst[i] = a[i] + b[i];
+}
+
+// the counter is also read as a number, so it stays alongside the pointer
+static int weighted(int* a, int n)
+{
+    int s = 0;
+    for (int i = 0; i < n; ++i)
+        s += a[i] * i;
+    return s;
+}
+
+static int read_after(int* a, int n)
+{
+    int i;
+    int s = 0;
+    for (i = 0; i < n; ++i)
+        s += a[i];
+    return s * 100 + i;
+}
+
+static int stepped_twice(int* a, int n)
+{
+    int s = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        s += a[i];
+        if (a[i] < 0)
+            ++i;
+    }
+    return s;
+}
+
+// an unsigned counter wraps instead of running off the end, so it isn't a simple walk
+static int unsigned_counter(int* a, unsigned n)
+{
+    int s = 0;
+    for (unsigned i = 0; i < n; ++i)
+        s += a[i];
+    return s;
+}
+
+static int with_call(int* a, int n)
+{
+    int s = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        tick();
+        s += a[i];
+    }
+    return s;
+}
+
+int main(void)
+{
+    long longs[5] = { 1, 2, 3, 4, 5 };
+    ASSERT_EQUALS(eight_wide(longs, 5), 15);
+    ASSERT_EQUALS(eight_wide(longs, 0), 0);
+    ASSERT_EQUALS(eight_wide(longs, -3), 0);
+    ASSERT_EQUALS(eight_wide((long*) 0, 0), 0);
+
+    char chars[4] = { 10, 20, 30, 40 };
+    ASSERT_EQUALS(one_wide(chars, 4), 100);
+
+    int rows[3][2] = { { 1, 5 }, { 2, 7 }, { 3, 9 } };
+    ASSERT_EQUALS(second_column(rows, 3), 21);
+
+    int xs[7] = { 1, 2, 3, 4, 5, 6, 7 };
+    ASSERT_EQUALS(every_third(xs, 7), 1 + 4 + 7);
+    ASSERT_EQUALS(every_third(xs, 6), 1 + 4);
+
+    ASSERT_EQUALS(downward(xs, 4), 10);
+    ASSERT_EQUALS(downward(xs, 1), 1);
+    ASSERT_EQUALS(downward(xs, 0), 0);
+
+    ASSERT_EQUALS(up_to_exactly(xs, 3), 6);
+    ASSERT_EQUALS(up_to_exactly(xs, 0), 0);
+
+    int a[4] = { 1, 2, 3, 4 };
+    int b[4] = { 10, 20, 30, 40 };
+    int c[4] = { 0 };
+    in_place(c, a, b, 4);
+    ASSERT_EQUALS(c[0], 11);
+    ASSERT_EQUALS(c[3], 44);
+    in_place(a, a, a, 4);
+    ASSERT_EQUALS(a[2], 6);
+
+    ASSERT_EQUALS(weighted(b, 4), 20 + 60 + 120);
+
+    ASSERT_EQUALS(read_after(xs, 3), 603);
+    ASSERT_EQUALS(read_after(xs, -2), 0);
+
+    int skips[6] = { 1, -2, 100, 3, 4, 5 };
+    ASSERT_EQUALS(stepped_twice(skips, 6), 1 - 2 + 3 + 4 + 5);
+
+    ASSERT_EQUALS(unsigned_counter(xs, 4u), 10);
+    ASSERT_EQUALS(unsigned_counter(xs, 0u), 0);
+
+    ASSERT_EQUALS(with_call(xs, 3), 6);
+    ASSERT_EQUALS(trips, 3);
+    return 0;
+}
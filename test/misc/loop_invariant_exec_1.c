@@ -0,0 +1,128 @@
+/* loop-invariant code motion: what can be computed once ahead of a loop, and what has to stay in it */
+
+// -i: loop-invariant code motion in product_in_body: [1-9][0-9]* instructions hoisted
+// -i: loop-invariant code motion in product_in_condition: [1-9][0-9]* instructions hoisted
+// -i: loop-invariant code motion in fallen_into: [1-9][0-9]* instructions hoisted
+// -i: loop-invariant code motion in row_and_column: [1-9][0-9]* instructions hoisted
+// -i: loop-invariant code motion in called: 0 instructions hoisted
+
+#include "../test.h"
+
+static int counter;
+
+static int next(void)
+{
+    return ++counter;
+}
+
+static int product_in_body(int a, int b, int n)
+{
+    int s = 0;
+    for (int i = 0; i < n; ++i)
+        s += a * b + i;
+    return s;
+}
+
+// the bound is worked out again on every trip around
+static int product_in_condition(int a, int b)
+{
+    int i = 0;
+    while (i < a * b)
+        ++i;
+    return i;
+}
+
+// a do loop falls into its body rather than jumping to it
+static int fallen_into(int a, int n)
+{
+    int s = 0, i = 0;
+    do
+        s += (a << 3) ^ i;
+    while (++i < n);
+    return s;
+}
+
+// the row's address only changes in the outer loop, and the scale in neither
+static int row_and_column(int (*m)[4], int rows, int col)
+{
+    int s = 0;
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < 4; ++j)
+            s += m[i][j] * (col + 1) + m[i][col];
+    return s;
+}
+
+// the loop doesn't run when n is 0, and then p mustn't be read
+static int guarded_load(int* p, int n)
+{
+    int s = 0;
+    for (int i = 0; i < n; ++i)
+        s += *p;
+    return s;
+}
+
+// x is read on the first trip before it's written
+static int local_written(int n)
+{
+    int x = 1, s = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        s += x * 2;
+        x = i + 5;
+    }
+    return s;
+}
+
+// the store through p changes what q points at, so *q is read again each time
+static int stored_through_alias(int* p, int* q, int n)
+{
+    int s = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        s += *q * 3;
+        *p += 1;
+    }
+    return s;
+}
+
+// the call could change counter, and then anything read from memory
+static int called(int n)
+{
+    int s = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        s += next();
+        s += counter * 10;
+    }
+    return s;
+}
+
+// dividing could trap, so it doesn't run any more often than it did
+static int divided(int a, int d, int n)
+{
+    int s = 0;
+    for (int i = 0; i < n; ++i)
+        s += a / d + a % d;
+    return s;
+}
+
+int main(void)
+{
+    ASSERT_EQUALS(product_in_body(3, 4, 5), 12 * 5 + 10);
+    ASSERT_EQUALS(product_in_body(3, 4, 0), 0);
+    ASSERT_EQUALS(product_in_condition(3, 4), 12);
+    ASSERT_EQUALS(fallen_into(1, 3), 8 + 9 + 10);
+    ASSERT_EQUALS(fallen_into(1, 0), 8);
+    int m[2][4] = { { 1, 2, 3, 4 }, { 5, 6, 7, 8 } };
+    ASSERT_EQUALS(row_and_column(m, 2, 2), 36 * 3 + 4 * 3 + 4 * 7);
+    int v = 7;
+    ASSERT_EQUALS(guarded_load(&v, 3), 21);
+    ASSERT_EQUALS(guarded_load((int*) 0, 0), 0);
+    ASSERT_EQUALS(local_written(4), 2 + 10 + 12 + 14);
+    int w = 2;
+    ASSERT_EQUALS(stored_through_alias(&w, &w, 3), (2 + 3 + 4) * 3);
+    ASSERT_EQUALS(called(3), 11 + 22 + 33);
+    ASSERT_EQUALS(divided(7, 2, 3), 3 * 4);
+    ASSERT_EQUALS(divided(7, 0, 0), 0);
+    return 0;
+}
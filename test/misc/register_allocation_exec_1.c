@@ -0,0 +1,59 @@
+/* register allocation: a physical register coalesced with temporaries isn't handed out to another one live at the same time */
+
+#include "../test.h"
+
+// each of these returns through a register that gets coalesced with the temporaries computing the
+// result, while other temporaries are still waiting for registers of their own
+
+static int reread(int a)
+{
+    int x = a + 1;
+    a = 10;
+    return x * 100 + (a + 1);
+}
+
+static int two_params(int a, int b)
+{
+    int x = a * b;
+    b = a + 3;
+    return x * 10 + (b - a);
+}
+
+static int three_params(int a, int b, int c)
+{
+    int x = a + b + c;
+    c = x - a;
+    return x * 100 + c * 10 + (a ^ b);
+}
+
+static long wide(long a, long b)
+{
+    long x = a - b;
+    a = b * 2;
+    return x * 1000 + (a + b) * 10 + (a > b);
+}
+
+static int chained(int a)
+{
+    int x = a + 1, y = x + 2, z = y + 3;
+    a = z;
+    return x * 1000 + y * 100 + z * 10 + (a == z);
+}
+
+static unsigned mixed(unsigned a, int b)
+{
+    unsigned x = a << 2;
+    b = b + (int) x;
+    return x * 100 + (unsigned) b + (a & 1);
+}
+
+int main(void)
+{
+    ASSERT_EQUALS(reread(1), 211);
+    ASSERT_EQUALS(two_params(2, 5), 103);
+    ASSERT_EQUALS(three_params(1, 2, 3), 653);
+    ASSERT_EQUALS(wide(7, 3), 4091);
+    ASSERT_EQUALS(chained(1), 2471);
+    ASSERT_EQUALS(mixed(3, 4), 1217);
+    return 0;
+}
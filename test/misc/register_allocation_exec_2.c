@@ -0,0 +1,40 @@
+/* register allocation: a temporary redefined from its own value (x = x + 1) stays live up to that redefinition */
+
+#include "../test.h"
+
+static long xs[7] = { 1, 2, 3, 4, 5, 6, 7 };
+
+// with a[i] reduced to a pointer, the pointer is bumped from itself right after ++i, before
+// anything else reads it, and t is computed in between
+static long stepped_before_read(long* a, int n)
+{
+    long s = 0;
+    for (int i = 0; i < n;)
+    {
+        long t = s * 3;
+        ++i;
+        s = t + a[i];
+    }
+    return s;
+}
+
+static long stepped_before_global_read(int n)
+{
+    long s = 0;
+    for (int i = 0; i < n;)
+    {
+        long t = s * 3;
+        ++i;
+        s = t + xs[i];
+    }
+    return s;
+}
+
+int main(void)
+{
+    long expected = ((((2 * 3 + 3) * 3 + 4) * 3 + 5) * 3 + 6) * 3 + 7;
+    ASSERT_EQUALS(stepped_before_read(xs, 6), expected);
+    ASSERT_EQUALS(stepped_before_global_read(6), expected);
+    ASSERT_EQUALS(stepped_before_read(xs, 0), 0);
+    return 0;
+}
@@ -0,0 +1,75 @@
+#!/bin/bash
+
+# precompiled headers: a snapshot stands in for its header while every dependency is unchanged,
+# and one that is stale, truncated or corrupt falls back to preprocessing the header again
+
+declare -i passed=0
+declare -i count=0
+
+dir=$(mktemp -d)
+header=$dir/pch_value.h
+inner=$dir/pch_inner.h
+source=$dir/pch_main.c
+pch=$header.pch
+
+printf "*** PRECOMPILED HEADER RESULTS ***\n"
+
+# rewrites a file without changing its modification time
+rewrite()
+{
+    touch -r $1 $dir/stamp
+    printf "$2" > $1
+    touch -r $dir/stamp $1
+}
+
+# compiles and runs the program, expecting the value it returns
+check()
+{
+    local name=$1
+    local expected=$2
+    local status=-1
+    ../ecc -S -o $dir/a.s $source &> $dir/output.txt
+    if [[ $? -eq 0 ]] && as -o $dir/a.o $dir/a.s && ld -o $dir/a $dir/a.o ../libc/libc.a ../libecc/libecc.a; then
+        $dir/a
+        status=$?
+    fi
+    if [[ $status -eq $expected ]]; then
+        printf " - pch %s: pass\n" "$name"
+        passed=$(($passed + 1))
+    else
+        printf " - pch %s: FAIL, expected %d, got %d:\n%s\n" "$name" $expected $status "$(cat $dir/output.txt)"
+    fi
+    count=$(($count + 1))
+}
+
+printf '#include "pch_inner.h"\nstatic int value(void) { return VALUE; }\n' > $header
+printf '#define VALUE 1\n' > $inner
+printf '#include "pch_value.h"\nint main(void) { return value(); }\n' > $source
+
+../ecc --emit-pch $header
+check "emitted" 1
+
+# same mtime and size, so the snapshot (still saying 1) is used
+rewrite $inner '#define VALUE 2\n'
+check "used while dependencies are unchanged" 1
+
+touch -d "+1 second" $inner
+check "stale after a dependency's mtime changes" 2
+
+../ecc --emit-pch $header
+rewrite $inner '#define VALUE 33\n'
+check "stale after a dependency's size changes" 33
+
+../ecc --emit-pch $header
+rewrite $inner '#define VALUE 44\n'
+truncate -s -8 $pch
+check "truncated" 44
+
+printf 'ECCPCH' > $pch
+head -c 256 /dev/urandom >> $pch
+check "corrupt" 44
+
+rm -rf $dir
+
+[[ $count -eq 1 ]] && c="" || c="s"
+printf "passed %d/%d test%s\n" "$passed" "$count" "$c"
@@ -0,0 +1,24 @@
+/* ISO: 6.10.1 (1); the controlling expression of #if and #elif */
+
+#include "../../test.h"
+
+int main(void)
+{
+    int area = 0;
+#if 4 * 3 > 10 && 2
+    area = 4 * 3;
+#endif
+    ASSERT_EQUALS(area, 12);
+
+    int chosen = 0;
+#if (4 - 4) || 0
+    chosen = 1;
+#elif -1 > 0
+    chosen = 2;
+#elif 3 % 2 ? 1 : 0
+    chosen = 3;
+#else
+    chosen = 4;
+#endif
+    ASSERT_EQUALS(chosen, 3);
+}
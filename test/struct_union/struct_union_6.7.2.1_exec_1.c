@@ -0,0 +1,68 @@
+/* ISO: 6.7.2.1; member offsets, sizes, and alignments of structs and unions */
+
+#include "../test.h"
+
+struct padded
+{
+    char c;
+    int i;
+    short s;
+    long l;
+};
+
+union overlay
+{
+    char c[5];
+    int i;
+};
+
+struct outer
+{
+    char tag;
+    struct padded inner;
+    union overlay u;
+    double d;
+};
+
+static struct padded sp = { .l = 4, .c = 1, .s = 3, .i = 2 };
+
+int main(void)
+{
+    // ISO: 6.7.2.1 (12) - members are padded to their alignment
+    ASSERT_EQUALS(sizeof(struct padded), 24);
+    ASSERT_EQUALS((char*) &sp.i - (char*) &sp, 4);
+    ASSERT_EQUALS((char*) &sp.s - (char*) &sp, 8);
+    ASSERT_EQUALS((char*) &sp.l - (char*) &sp, 16);
+
+    // ISO: 6.7.2.1 (14) - every union member starts at the beginning of the union
+    union overlay u;
+    ASSERT_EQUALS(sizeof(union overlay), 8);
+    ASSERT_EQUALS((char*) &u.i - (char*) &u, 0);
+    u.i = 0x41424344;
+    ASSERT_EQUALS(u.c[0], 0x44);
+    ASSERT_EQUALS(u.c[3], 0x41);
+
+    ASSERT_EQUALS(sp.c, 1);
+    ASSERT_EQUALS(sp.i, 2);
+    ASSERT_EQUALS(sp.s, 3);
+    ASSERT_EQUALS(sp.l, 4);
+
+    struct padded p = { 5, 6, 7, 8 };
+    ASSERT_EQUALS(p.c, 5);
+    ASSERT_EQUALS(p.i, 6);
+    ASSERT_EQUALS(p.s, 7);
+    ASSERT_EQUALS(p.l, 8);
+
+    struct outer o;
+    struct outer* po = &o;
+    o.tag = 11;
+    o.inner.i = 0;
+    po->inner.s = 9;
+    o.d = 10.0;
+    ASSERT_EQUALS(sizeof(struct outer), 48);
+    ASSERT_EQUALS((char*) &o.inner.s - (char*) &o, 16);
+    ASSERT_EQUALS(o.inner.s, 9);
+    ASSERT_EQUALS(po->tag, 11);
+    ASSERT_EQUALS(o.inner.i, 0);
+    ASSERT_EQUALS(po->d == 10.0, 1);
+}
@@ -15,7 +15,10 @@ do
     asmfile=asm/$base.s
     difffile=diff/$base.diff
 
+    # a stale assembly file from an earlier run must not stand in for a compiler crash
+    rm -f $asmfile
     ../ecc -S -o $asmfile $filepath &> $actualfile
+    declare -i compile_status=$?
     content=$(cat $actualfile)
     declare -i exit_status=0
 
@@ -32,18 +35,33 @@ do
         fi
     fi
 
+    # each "// -i: <pattern>" line is an extended regex that has to match a line the compiler
+    # prints with -i, e.g., to check that an optimization actually happened
+    missing=""
+    patterns=$(sed -n 's#^// -i: ##p' $filepath)
+    if [[ "$patterns" != "" ]]; then
+        info=$(../ecc -i -S -o /dev/null $filepath 2>&1)
+        while IFS= read -r pattern; do
+            grep -Eq -- "$pattern" <<< "$info" || missing+="$pattern"$'\n'
+        done <<< "$patterns"
+    fi
+
     if [[ -a "$expectedfile" ]]; then
         diff=$(diff $actualfile $expectedfile)
     else
         diff=$(printf "" | diff $actualfile -)
     fi
 
-    if [[ "$diff" == "" ]] && [[ $exit_status -lt 128 ]]; then
+    if [[ "$diff" == "" ]] && [[ $exit_status -lt 128 ]] && [[ $compile_status -lt 128 ]] && [[ "$missing" == "" ]]; then
         printf " - %s: pass\n" $filename
         passed=$(($passed + 1))
     else
-        if [[ "$content" != "" ]]; then
+        if [[ $compile_status -ge 128 ]]; then
+            printf " - %s: FAIL, compiler interrupted by signal: %d\n" $filename $(($compile_status - 128))
+        elif [[ "$content" != "" ]]; then
             printf " - %s: FAIL, compilation error:\n%s\n" $filename "$content"
+        elif [[ "$missing" != "" ]]; then
+            printf " - %s: FAIL, not in -i output:\n%s" $filename "$missing"
         elif [[ $exit_status -ge 128 ]]; then
             printf " - %s: FAIL, output program interrupted by signal: %d\n" $filename $(($exit_status - 128))
         else